@@ -67,6 +67,7 @@ public:
 
 protected:
     void InternLoad(AudioEngine& audioEngine);
+    void InternLoad(AudioEngine& audioEngine, const std::string& fileData);
     void InternUnload() const;
 
 private:
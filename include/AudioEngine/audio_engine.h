@@ -60,6 +60,19 @@ public:
         bool is3D,
         bool isLooping,
         bool isStreamLoading) override;
+
+    /**
+     * \brief Create a sound from a file already read in memory, the data is copied by FMOD.
+     * \param fileData
+     * \param clip
+     * \param is3D
+     * \param isLooping
+     */
+    void LoadSoundFromMemory(
+        const std::string& fileData,
+        Clip& clip,
+        bool is3D,
+        bool isLooping);
     //-------------------------------------------------------------------------
 
     //----------------------------- PLAYING SOUND -----------------------------
@@ -0,0 +1,126 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2019-2020, POK Family. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of POK Family nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Author : Nicolas Schneider
+// Co-Author :
+// Date : 06.05.2020
+//-----------------------------------------------------------------------------
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+
+namespace poke {
+namespace chunk {
+using ChunkIndex = uint16_t;
+
+/**
+ * \brief Sorted set of chunk indexes, without limit on the number of chunks.
+ * \details An entity is in a few chunks at most, they are stored without allocation up to kInlineCapacity.
+ */
+class ChunkSet {
+public:
+    static const size_t kInlineCapacity = 4;
+
+    ChunkSet() = default;
+
+    ChunkSet(std::initializer_list<ChunkIndex> chunkIndexes)
+    {
+        for (const ChunkIndex chunkIndex : chunkIndexes) { Insert(chunkIndex); }
+    }
+
+    void Insert(const ChunkIndex chunkIndex)
+    {
+        ChunkIndex* it = std::lower_bound(MutableBegin(), MutableEnd(), chunkIndex);
+        if (it != MutableEnd() && *it == chunkIndex) { return; }
+
+        const size_t position = it - MutableBegin();
+        if (size_ < kInlineCapacity) {
+            std::copy_backward(inlineChunks_.begin() + position, inlineChunks_.begin() + size_, inlineChunks_.begin() + size_ + 1);
+            inlineChunks_[position] = chunkIndex;
+        } else {
+            if (size_ == kInlineCapacity) { chunks_.assign(inlineChunks_.begin(), inlineChunks_.end()); }
+            chunks_.insert(chunks_.begin() + position, chunkIndex);
+        }
+        size_++;
+    }
+
+    void Erase(const ChunkIndex chunkIndex)
+    {
+        ChunkIndex* it = std::lower_bound(MutableBegin(), MutableEnd(), chunkIndex);
+        if (it == MutableEnd() || *it != chunkIndex) { return; }
+
+        if (size_ <= kInlineCapacity) {
+            std::copy(it + 1, MutableEnd(), it);
+        } else {
+            chunks_.erase(chunks_.begin() + (it - MutableBegin()));
+            if (size_ - 1 == kInlineCapacity) {
+                std::copy(chunks_.begin(), chunks_.end(), inlineChunks_.begin());
+                chunks_.clear();
+            }
+        }
+        size_--;
+    }
+
+    bool Contains(const ChunkIndex chunkIndex) const
+    {
+        return std::binary_search(begin(), end(), chunkIndex);
+    }
+
+    void Clear()
+    {
+        size_ = 0;
+        chunks_.clear();
+    }
+
+    bool IsEmpty() const { return size_ == 0; }
+
+    size_t Size() const { return size_; }
+
+    const ChunkIndex* begin() const { return size_ <= kInlineCapacity ? inlineChunks_.data() : chunks_.data(); }
+    const ChunkIndex* end() const { return begin() + size_; }
+
+    bool operator==(const ChunkSet& other) const
+    {
+        return size_ == other.size_ && std::equal(begin(), end(), other.begin());
+    }
+
+    bool operator!=(const ChunkSet& other) const { return !operator==(other); }
+
+private:
+    ChunkIndex* MutableBegin() { return size_ <= kInlineCapacity ? inlineChunks_.data() : chunks_.data(); }
+    ChunkIndex* MutableEnd() { return MutableBegin() + size_; }
+
+    std::array<ChunkIndex, kInlineCapacity> inlineChunks_{};
+    std::vector<ChunkIndex> chunks_;
+    size_t size_ = 0;
+};
+} //namespace chunk
+} //namespace poke
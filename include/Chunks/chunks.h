@@ -32,16 +32,13 @@
 #pragma once
 
 #include <vector>
-#include <bitset>
 
+#include <Chunks/chunk_set.h>
 #include <Math/vector.h>
 #include <Ecs/ComponentManagers/transforms_manager.h>
 
 namespace poke {
 namespace chunk {
-using ChunkBitSet = std::bitset<64>;
-using ChunkIndex = uint8_t;
-
 //Indicate the status of a chunk, the enum is in order od priority.
 enum class ChunkStatus : uint8_t {
     ACTIVE = 0,
@@ -56,8 +53,6 @@ enum class ChunkStatus : uint8_t {
  */
 class Chunk {
 public:
-    inline static const ChunkBitSet kNullIndex = -1;
-
     /**
 	 * \brief This constructor should be used to construct a chunk when their is no chunk in the scene.
 	 */
@@ -148,11 +143,11 @@ public:
     math::Vec3 GetExtent() const { return extent_; }
     void SetExtent(const math::Vec3 extends) { extent_ = extends; }
 
-    const ChunkBitSet GetChunksToShow() const { return chunksToShow_; }
-    void SetChunksToShow(const ChunkBitSet chunkToShow) { chunksToShow_ = chunkToShow; }
+    const ChunkSet& GetChunksToShow() const { return chunksToShow_; }
+    void SetChunksToShow(const ChunkSet& chunkToShow) { chunksToShow_ = chunkToShow; }
 
-    const ChunkBitSet GetChunksToHide() const { return chunksToHide_; }
-    void SetChunksToHide(const ChunkBitSet chunkToHide) { chunksToHide_ = chunkToHide; }
+    const ChunkSet& GetChunksToHide() const { return chunksToHide_; }
+    void SetChunksToHide(const ChunkSet& chunkToHide) { chunksToHide_ = chunkToHide; }
 
     const std::vector<ecs::EntityIndex>& GetEntitiesToActivate() const;
     void SetEntitiesToActivate(const std::vector<ecs::EntityIndex>& entitiesToActivate);
@@ -160,8 +155,8 @@ public:
     const std::vector<ecs::EntityIndex>& GetLinkEntities() const;
     void SetLinkEntities(const std::vector<ecs::EntityIndex>& linkEntities);
 
-    const ChunkBitSet GetChunksToDestroy() const { return chunksToDestroy_; }
-    void SetChunksToDestroy(const ChunkBitSet chunkToDestroy) { chunksToDestroy_ = chunkToDestroy; }
+    const ChunkSet& GetChunksToDestroy() const { return chunksToDestroy_; }
+    void SetChunksToDestroy(const ChunkSet& chunkToDestroy) { chunksToDestroy_ = chunkToDestroy; }
 
     ChunkStatus GetStatus() const { return chunkStatus_; }
     void SetStatus(const ChunkStatus chunkStatus) { chunkStatus_ = chunkStatus; }
@@ -173,9 +168,9 @@ private:
 
     ChunkStatus chunkStatus_;
 
-    ChunkBitSet chunksToShow_;
-    ChunkBitSet chunksToHide_;
-    ChunkBitSet chunksToDestroy_;
+    ChunkSet chunksToShow_;
+    ChunkSet chunksToHide_;
+    ChunkSet chunksToDestroy_;
     std::vector<ecs::EntityIndex> entitiesToActivate_;
 
     std::vector<ecs::EntityIndex> linkEntities_;
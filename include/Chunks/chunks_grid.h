@@ -0,0 +1,90 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2019-2020, POK Family. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of POK Family nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Author : Nicolas Schneider
+// Co-Author :
+// Date : 06.05.2020
+//-----------------------------------------------------------------------------
+#pragma once
+
+#include <array>
+#include <limits>
+#include <vector>
+
+#include <Chunks/chunks.h>
+
+namespace poke {
+namespace chunk {
+/**
+ * \brief Uniform grid over the bounds of the chunks, used to find the chunks of a position or an aabb without testing all of them.
+ * \details The cells are close to the average size of a chunk, each one lists the chunks overlapping it in index order.
+ */
+class ChunksGrid {
+public:
+    inline static const ChunkIndex kNoChunk = std::numeric_limits<ChunkIndex>::max();
+
+    ChunksGrid() = default;
+
+    void Build(const std::vector<Chunk>& chunks);
+
+    /**
+     * \brief Find the first chunk containing the position, in index order.
+     * \return kNoChunk if the position is outside of every chunk
+     */
+    ChunkIndex FindChunk(const std::vector<Chunk>& chunks, math::Vec3 position) const;
+
+    /**
+     * \brief Find every chunk overlapping the aabb.
+     */
+    ChunkSet FindChunks(const std::vector<Chunk>& chunks, physics::AABB aabb) const;
+
+    size_t GetCellNb() const { return cellStarts_.empty() ? 0 : cellStarts_.size() - 1; }
+private:
+    /**
+     * \brief Range of the cells overlapping the bounds, clamped to the grid.
+     * \return false if the bounds are outside of the grid
+     */
+    bool GetCellRange(
+        math::Vec3 min,
+        math::Vec3 max,
+        std::array<int, 3>& minCell,
+        std::array<int, 3>& maxCell) const;
+
+    size_t GetCellIndex(int x, int y, int z) const;
+
+    inline static const size_t kMaxCellNb = 1 << 16;
+
+    math::Vec3 origin_;
+    math::Vec3 cellSize_;
+    std::array<int, 3> cellNb_{ 0, 0, 0 };
+
+    //Chunks of the cell i are in cellChunks_[cellStarts_[i], cellStarts_[i + 1]]
+    std::vector<uint32_t> cellStarts_;
+    std::vector<ChunkIndex> cellChunks_;
+};
+} //namespace chunk
+} //namespace poke
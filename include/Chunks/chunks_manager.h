@@ -30,11 +30,14 @@
 // Date : 26.03.2020
 //----------------------------------------------------------------------------------
 #pragma once
-#include <bitset>
+#include <unordered_map>
 
+#include <Chunks/chunks_grid.h>
 #include <Chunks/interface_chunk_manager.h>
 #include <optional_custom.h>
 #include <CoreEngine/Observer/subjects_container.h>
+#include <Ecs/Prefabs/engine_prefab.h>
+#include <ResourcesManager/resource_loader.h>
 
 namespace poke {
 class Engine;
@@ -43,11 +46,11 @@ namespace chunk {
 class ChunksManager : public IChunksManager {
 public:
     ChunksManager(Engine& engine);
-    ~ChunksManager() = default;
+    ~ChunksManager();
 
     //------------------------------- OBSERVER --------------------------------
     void RegisterObserverNewActiveChunk(
-        const std::function<void(ChunkBitSet)>& observerCallback) override;
+        const std::function<void(ChunkIndex)>& observerCallback) override;
     //-------------------------------------------------------------------------
 
     //-------------------------------- CHUNK ----------------------------------
@@ -65,20 +68,28 @@ public:
 
     void SetChunk(ChunkIndex chunkIndex, const Chunk& chunk) override;
 
-    void SetChunks(const std::array<Chunk, kMaxChunkNb>& chunks, uint8_t nbChunk) override;
+    void SetChunks(const std::vector<Chunk>& chunks, ChunkIndex nbChunk) override;
 
-    const std::array<Chunk, kMaxChunkNb>& GetChunks() const override { return chunks_; }
+    const std::vector<Chunk>& GetChunks() const override { return chunks_; }
 
-    uint8_t GetChunkNb() const override { return nbChunk_; }
+    ChunkIndex GetChunkNb() const override { return static_cast<ChunkIndex>(chunks_.size()); }
 
-    ChunkStatus GetChunkStatus(ChunkBitSet chunkIndex) override;
+    ChunkStatus GetChunkStatus(const ChunkSet& chunksIndex) override;
 
     //-------------------------------------------------------------------------
 
     //------------------------------- ENTITIES --------------------------------
-    ChunkBitSet AddEntity(math::Vec3 position) override;
+    ChunkSet AddEntity(math::Vec3 position) override;
 
-    ChunkBitSet AddEntity(physics::AABB aabb) override;
+    ChunkSet AddEntity(physics::AABB aabb) override;
+    //-------------------------------------------------------------------------
+
+    //------------------------------ STREAMING --------------------------------
+    void SetStreaming(const bool isStreaming) override { isStreaming_ = isStreaming; }
+
+    void UpdateStreaming() override;
+
+    const ChunkStreamingStats& GetStreamingStats() const override { return streamingStats_; }
     //-------------------------------------------------------------------------
 
 	//------------------------------- ENTITIES --------------------------------
@@ -94,18 +105,74 @@ public:
     //-------------------------------------------------------------------------
 
 private:
+    /**
+     * \brief Entities of a chunk decoded by the resource loader.
+     */
+    struct ChunkEntities {
+        //False when the file of the evicted chunk couldn't be read
+        bool isRead = false;
+        ecs::EnginePrefab prefab;
+        std::vector<ecs::EntityTag> tags;
+        std::vector<ChunkSet> activatedBy;
+    };
+
+    struct StreamedChunk {
+        //Streamed entities in the ecs, empty when evicted
+        std::vector<ecs::EntityIndex> entities;
+        //The evicted entities are written on disk as msgpack, nothing is kept in memory
+        bool isEvicted = false;
+        size_t evictedBytes = 0;
+        Future<ChunkEntities> loadingEntities;
+    };
+
     void SetNewActiveChunk(ChunkIndex newActiveChunk);
 
+    /**
+     * \brief Rebuild the grid if the chunks changed since the last query.
+     */
+    const ChunksGrid& GetGrid();
+
     void OnUnloadScene();
 
-    std::array<Chunk, kMaxChunkNb> chunks_;
-    ChunkIndex nbChunk_ = 0;
+    void StartStreaming();
+
+    std::vector<ecs::EntityIndex> FindStreamedEntities(
+        ChunkIndex chunkIndex,
+        const std::unordered_map<ecs::EntityIndex, int>& linkCounts) const;
+
+    void EvictChunk(ChunkIndex chunkIndex);
+
+    void PrefetchChunk(ChunkIndex chunkIndex);
+
+    void InstantiateChunk(ChunkIndex chunkIndex);
+
+    /**
+     * \brief Wait the loads of the evicted entities, the loader is shared with the resources managers.
+     */
+    void WaitPrefetches();
+
+    /**
+     * \brief Forget the streamed chunks and delete the files of the evicted ones.
+     */
+    void ClearStreamedChunks();
+
+    std::vector<Chunk> chunks_;
+
+    ChunksGrid grid_;
+    bool isGridDirty_ = true;
 
     ChunkIndex activeChunkIndex_ = 0;
 
     std::experimental::optional<const math::Transform> targetTransform_;
 
-    observer::Subject<ChunkBitSet> observerNewActiveChunk_;
+    observer::Subject<ChunkIndex> observerNewActiveChunk_;
+
+    bool isStreaming_ = false;
+    std::vector<StreamedChunk> streamedChunks_;
+    ChunkStreamingStats streamingStats_;
+
+    //Shared with the resources managers, its workers read the files of the evicted chunks
+    ResourceLoader& resourceLoader_;
 };
 } //namespace chunk
 } //namespace poke
@@ -34,15 +34,27 @@
 
 namespace poke {
 namespace chunk {
+/**
+ * \brief Memory used by the streamed chunks since the first eviction of the scene.
+ */
+struct ChunkStreamingStats {
+	//Entities of the streamed chunks currently in the ecs
+	size_t residentEntityNb = 0;
+	size_t peakResidentEntityNb = 0;
+	//Serialized entities of the evicted chunks, written on disk
+	size_t evictedBytes = 0;
+	size_t peakEvictedBytes = 0;
+	size_t loadedChunkNb = 0;
+	size_t evictedChunkNb = 0;
+};
+
 class IChunksManager {
 public:
-	static const uint8_t kMaxChunkNb = 64;
-
     IChunksManager() = default;
     virtual ~IChunksManager() = default;
 
 	//------------------------------- OBSERVER --------------------------------
-	virtual void RegisterObserverNewActiveChunk(const std::function<void(ChunkBitSet)>& observerCallback) = 0;
+	virtual void RegisterObserverNewActiveChunk(const std::function<void(ChunkIndex)>& observerCallback) = 0;
     //-------------------------------------------------------------------------
 
     /**
@@ -81,7 +93,7 @@ public:
 	 * \brief Get all chunks
 	 * \return 
 	 */
-	virtual const std::array<Chunk, kMaxChunkNb>& GetChunks() const = 0;
+	virtual const std::vector<Chunk>& GetChunks() const = 0;
 
     /**
 	 * \brief Set the value for a given chunks.
@@ -94,7 +106,7 @@ public:
 	 * \brief Set all chunks.
 	 * \details Warning, it will override every existing chunks data.
 	 */
-	virtual void SetChunks(const std::array<Chunk, kMaxChunkNb>&chunks, uint8_t nbChunk) = 0;
+	virtual void SetChunks(const std::vector<Chunk>& chunks, ChunkIndex nbChunk) = 0;
 
     /**
 	 * \brief Get the active chunk's index.
@@ -105,27 +117,29 @@ public:
     /**
 	 * \brief Add a new entity inside the chunk manager. Use the world position, the object will be in only one chunk.
 	 * \param worldPosition 
+	 * \return an empty set if the position is outside of every chunk
 	 */
-	virtual ChunkBitSet AddEntity(math::Vec3 worldPosition) = 0;
+	virtual ChunkSet AddEntity(math::Vec3 worldPosition) = 0;
 
 	/**
 	 * \brief Add a new entity inside the chunk manager. Use the rigidbody aabb to check all possible chunks.
 	 * \param aabb
+	 * \return an empty set if the aabb is outside of every chunk
 	 */
-	virtual ChunkBitSet AddEntity(physics::AABB aabb) = 0;
+	virtual ChunkSet AddEntity(physics::AABB aabb) = 0;
 
     /**
 	 * \brief Get the number of chunks in the scene
 	 * \return 
 	 */
-	virtual uint8_t GetChunkNb() const = 0;
+	virtual ChunkIndex GetChunkNb() const = 0;
 
     /**
-	 * \brief Get the status of a chunk
-	 * \param chunkIndex 
+	 * \brief Get the status of the most active chunk of the set
+	 * \param chunksIndex 
 	 * \return 
 	 */
-	virtual ChunkStatus GetChunkStatus(ChunkBitSet chunkIndex) = 0;
+	virtual ChunkStatus GetChunkStatus(const ChunkSet& chunksIndex) = 0;
 
     /**
 	 * \brief Display a chunk
@@ -141,6 +155,20 @@ public:
      */
 	virtual void DebugHideChunk(ChunkIndex chunkIndex) = 0;
 
+	/**
+	 * \brief Stream the entities of the chunks, must be set before loading the scene.
+	 * \details The chunks to show are loaded in the background and the chunks to destroy are evicted from the ecs.
+	 * Only the entities linked to a single chunk and made of engine components are streamed, the others stay loaded.
+	 */
+	virtual void SetStreaming(bool isStreaming) = 0;
+
+	/**
+	 * \brief Instantiate the chunks loaded in the background. This function should be called every frame.
+	 */
+	virtual void UpdateStreaming() = 0;
+
+	virtual const ChunkStreamingStats& GetStreamingStats() const = 0;
+
 	virtual json ToJson(const std::map<ecs::EntityIndex, ecs::EntityIndex>& baseParentIdToOffsetParentId) = 0;
 
 	virtual void SetFromJson(const json& chunksJson, const std::map<ecs::EntityIndex, ecs::EntityIndex>& baseParentToOffsetParent) = 0;
@@ -31,7 +31,6 @@
 //----------------------------------------------------------------------------------
 #pragma once
 #include <Chunks/interface_chunk_manager.h>
-#include <bitset>
 #include <algorithm>
 
 namespace poke {
@@ -43,7 +42,7 @@ public:
 
     //------------------------------- OBSERVER --------------------------------
     virtual void RegisterObserverNewActiveChunk(
-        const std::function<void(ChunkBitSet)>& observerCallback) override
+        const std::function<void(ChunkIndex)>& observerCallback) override
     {
         observerCallback(0);
     };
@@ -67,19 +66,15 @@ public:
 
     ChunkIndex GetActiveChunkIndex() override { return 0; }
 
-	const std::array<Chunk, kMaxChunkNb>& GetChunks() const override
-    {
-		std::array<Chunk, kMaxChunkNb> dummy;
-        return dummy;
-    }
+	const std::vector<Chunk>& GetChunks() const override { return chunks_; }
 
-    ChunkBitSet AddEntity(math::Vec3 position) override
+    ChunkSet AddEntity(math::Vec3 position) override
     {
 		position;
-		return 0;
+		return {};
     }
 
-    ChunkBitSet AddEntity(physics::AABB aabb) override
+    ChunkSet AddEntity(physics::AABB aabb) override
     {
 		aabb;
 		return {};
@@ -94,12 +89,19 @@ public:
 		chunksJson;
     }
 
-	uint8_t GetChunkNb() const override { return 0; }
-	ChunkStatus GetChunkStatus(ChunkBitSet chunkIndex) override { return ChunkStatus::HIDDEN; }
+	void SetStreaming(bool isStreaming) override
+    {
+		isStreaming;
+    }
+	void UpdateStreaming() override {}
+	const ChunkStreamingStats& GetStreamingStats() const override { return streamingStats_; }
+
+	ChunkIndex GetChunkNb() const override { return 0; }
+	ChunkStatus GetChunkStatus(const ChunkSet& chunksIndex) override { return ChunkStatus::HIDDEN; }
     ChunkIndex CreateChunk() override { return 0; }
     void DestroyChunk(ChunkIndex chunkIndex) override{}
     void SetChunk(ChunkIndex chunkIndex, const Chunk& chunk) override{}
-    void SetChunks(const std::array<Chunk, kMaxChunkNb>&chunks, uint8_t nbChunk) override{}
+    void SetChunks(const std::vector<Chunk>& chunks, ChunkIndex nbChunk) override{}
     void DebugDisplayChunk(ChunkIndex chunkIndex) override
     {
 		chunkIndex;
@@ -110,6 +112,9 @@ public:
 		chunkIndex;
 		void();
     }
+private:
+	std::vector<Chunk> chunks_;
+	ChunkStreamingStats streamingStats_;
 };
 } //namespace chunk
 } //namespace poke
@@ -50,13 +50,13 @@ private:
 
     void OnUnloadScene() override;
 
-	void OnChangeActiveChunk(chunk::ChunkBitSet chunkIndex);
+	void OnChangeActiveChunk(chunk::ChunkIndex chunkIndex);
 
     ecs::EntityVector newEntities_;
     ecs::EntityVector destroyedEntities_;
     ecs::EntityVector updateEntities_;
 
-	std::vector<chunk::ChunkBitSet> chunkIndex_;
+	std::vector<chunk::ChunkSet> chunkIndex_;
 
 	ecs::EntityIndex maxEntityIndex_ = 0;
 
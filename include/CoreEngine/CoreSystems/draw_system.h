@@ -29,12 +29,17 @@
 // Date : 04.02.20
 //-----------------------------------------------------------------------------
 #pragma once
+#include <array>
+
 #include <Ecs/system.h>
 #include <Ecs/ComponentManagers/models_manager.h>
 #include <Ecs/ComponentManagers/transforms_manager.h>
 #include <GraphicsEngine/Models/model_command_buffer.h>
+#include <GraphicsEngine/Models/mesh_lod.h>
 #include <CoreEngine/Camera/interface_camera.h>
 #include <Ecs/Utility/entity_vector.h>
+#include <Memory/triple_buffer.h>
+#include <ResourcesManager/resource_type.h>
 
 namespace poke {
 class DrawSystem final : public ecs::System {
@@ -59,6 +64,15 @@ private:
 
 	bool CullAABB(physics::AABB aabb, const FrustumPlanes& frustumPlanes);
 
+	/**
+	 * \brief Get the instances of every level of detail of the entity's mesh.
+	 * \return The full detail mesh.
+	 */
+	graphics::Mesh& SetInstancingIndexes(
+		ecs::EntityIndex entityIndex,
+		const graphics::Material& material,
+		ResourceID meshID);
+
 	graphics::ModelCommandBuffer& modelCommandBuffer_;
 
 	ecs::EntityVector entities_;
@@ -73,7 +87,12 @@ private:
 	ecs::ModelsManager& modelsManager_;
 	ecs::TransformsManager& transformsManager_;
 
-	std::vector<graphics::ModelInstanceIndex> instancingIndexes_;
+	struct InstancingIndexes {
+		std::array<graphics::ModelInstanceIndex, graphics::kMaxLodCount> lods{};
+		size_t lodCount = 1;
+	};
+
+	std::vector<InstancingIndexes> instancingIndexes_;
 	std::vector<graphics::ModelForwardIndex> forwardIndexes_;
 
 	std::vector<physics::MeshShape> meshShapes_;
@@ -88,8 +107,8 @@ private:
 		ecs::EntityIndex entityIndex;
 	};
 
-	std::vector<BlockDrawForwardInfo> forwardDrawInfo1_;
-	std::vector<BlockDrawForwardInfo> forwardDrawInfo2_;
+	//Written during draw, read during culling
+	memory::TripleBuffer<std::vector<BlockDrawForwardInfo>> forwardDrawInfos_;
 
     struct BlockDrawInstanceInfo {
 		math::Matrix4 worldMatrix;
@@ -102,12 +121,12 @@ private:
     };
 
     struct DrawInstancesInfo {
-		bool frontToBackSorting;
+		bool frontToBackSorting = false;
 
 		std::vector<BlockDrawInstanceInfo> instances;
     };
 
-	std::vector<DrawInstancesInfo> instanceDrawInfos1_;
-	std::vector<DrawInstancesInfo> instanceDrawInfos2_;
+	//Written during draw, read during culling
+	memory::TripleBuffer<std::vector<DrawInstancesInfo>> instanceDrawInfos_;
 };
 } //namespace poke
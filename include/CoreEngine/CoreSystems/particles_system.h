@@ -33,9 +33,12 @@
 
 #include <Ecs/ComponentManagers/particle_systems_manager.h>
 #include <GraphicsEngine/Particles/particle_command_buffer.h>
+#include <GraphicsEngine/Particles/particles_storage.h>
 #include <Editor/ResourcesManagers/editor_materials_manager.h>
 #include <CoreEngine/Camera/interface_camera.h>
 #include <Ecs/Utility/entity_vector.h>
+#include <Memory/triple_buffer.h>
+#include <Utility/job_pool.h>
 
 namespace poke {
 class ParticlesSystem final : public ecs::System {
@@ -70,6 +73,19 @@ private:
 
     void OnUnloadScene();
 
+    struct ParticlesDrawPacket;
+
+    /**
+     * \brief Simulate every emitted particle system, emitters are split between the main thread and the workers.
+     */
+    void SimulateParticleSystems(std::vector<ParticlesDrawPacket>& drawPackets);
+
+    /**
+     * \brief Age, cull, move and color the particles of one emitter then fill its draw packet.
+     * \details Only touches the data of this emitter so it can run on any thread.
+     */
+    void SimulateParticleSystem(size_t particleIndex, ParticlesDrawPacket& drawPacket);
+
     //Entities
 	ecs::EntityVector newEntities_;
 	ecs::EntityVector destroyedEntities_;
@@ -84,38 +100,26 @@ private:
 	ICamera& camera_;
 	graphics::ParticleCommandBuffer& particleCommandBuffer_;
 
-    //Drawing data
-	std::vector<std::vector<graphics::ParticleDrawInfo>> particlesDrawing_;
-	std::vector<std::vector<graphics::ParticleDrawInfo>> particlesRendering_;
+    //Drawing data of one particle system for one frame
+	struct ParticlesDrawPacket {
+		int instanceIndex = 0;
+		std::vector<graphics::ParticleDrawInfo> particles;
+	};
+    //Written during draw, read during culling
+	memory::TripleBuffer<std::vector<ParticlesDrawPacket>> drawPackets_;
 
     //Index of particle instance
-	std::vector<int> particleInstanceIndexDrawing_;
-	std::vector<int> particleInstanceIndexRendering_;
-
-    //Particles
-	struct Particle {
-		int nbParticles;
-
-		std::vector<uint32_t> numberOfRows;
-		std::vector<Color> originalColor;
-		std::vector<Color> colorOffset;
+	std::vector<int> particleInstanceIndexes_;
 
-		std::vector<ColorGradient> colorOverLifetime;
-
-		std::vector<math::Vec3> position;
-		std::vector<math::Vec3> velocity;
-
-		std::vector<math::Vec2> imageOffset1;
-		std::vector<math::Vec2> imageOffset2;
+    //Current particles
+	std::vector<graphics::ParticlesStorage> particles_;
 
-		std::vector<float> lifetime;
-		std::vector<float> scale;
+    //Simulation
+	inline static const size_t kMinParticlesPerRange = 4096;
 
-		std::vector<float> elapsedTime;
-		std::vector<float> transparency;
-		std::vector<float> imageBlendFactor;
-	};
-    //Current particles
-	std::vector<Particle> particles_;
+	JobPool& jobPool_;
+	std::vector<std::pair<size_t, size_t>> simulationRanges_;
+	float simulationDeltaTime_ = 0.0f;
+	math::Vec3 simulationCameraPosition_;
 };
 } //namespace poke
@@ -56,8 +56,6 @@ private:
 
 	std::experimental::optional<graphics::GizmoCommandBuffer&> gizmoCommandBuffer_;
 
-	const unsigned int kMinSpline_ = 4;
-
 	std::vector<ecs::EntityIndex> entities_;
 };
 } //namespace poke
@@ -35,6 +35,7 @@
 #include <Ecs/system.h>
 #include <Ecs/ComponentManagers/trail_renderer_manager.h>
 #include <Ecs/Utility/entity_vector.h>
+#include <Memory/triple_buffer.h>
 #include <GraphicsEngine/Models/model_command_buffer.h>
 #include <ResourcesManager/MeshManagers/interface_mesh_manager.h>
 
@@ -73,10 +74,11 @@ private:
     struct MeshRebuildInfo {
 		DynamicMeshIndex dynamicMeshIndex;
 		std::vector<graphics::VertexMesh> vertices;
-		std::vector<uint32_t> indexes;
+		ecs::TrailMeshRange meshRange;
     };
 
 	std::vector<MeshRebuildInfo> meshesToUpdates_;
+	size_t meshesToUpdateCount_ = 0;
 	std::vector<graphics::ModelForwardIndex> forwardIndexes_;
 
     struct TrailDrawInfos {
@@ -85,8 +87,11 @@ private:
 		graphics::ModelForwardIndex forwardIndex;
     };
 
-	std::vector<TrailDrawInfos> drawInfosDrawing_;
-	std::vector<TrailDrawInfos> drawInfosRendering_;
+	//Written during update, read during culling
+	memory::TripleBuffer<std::vector<TrailDrawInfos>> drawInfos_;
 	std::vector<DynamicMeshIndex> dynamicMeshIndex_;
+
+	//Same indexes for every trail, only the drawn range changes
+	std::vector<uint32_t> ringIndexes_;
 };
 } //namespace poke
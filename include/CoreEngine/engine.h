@@ -36,6 +36,8 @@
 #include <CoreEngine/module_container.h>
 #include <CoreEngine/Observer/subjects_container.h>
 #include <CoreEngine/settings.h>
+#include <Utility/frame_limiter.h>
+#include <Utility/job_pool.h>
 #include <Utility/worker_thread.h>
 #include <CoreEngine/engine_application.h>
 #include <CoreEngine/core_systems_container.h>
@@ -152,21 +154,44 @@ public:
 
     void Wait(ThreadType type);
 
+    /**
+     * \brief Set the tasks executed by the thread at each RunFrameTasks, they are built once instead of every frame.
+     */
+    void SetFrameTasks(std::vector<std::function<void()>> frameTasks, ThreadType type);
+
+    /**
+     * \brief Start the frame tasks of the thread, Wait returns once they are done.
+     */
+    void RunFrameTasks(ThreadType type);
+
     //Getters
     ModuleContainer& GetModuleManager();
 
     const EngineSetting& GetEngineSettings() const { return engineSettings_; }
 
+    /**
+     * \brief Keeps the frames of the app at the frame rate of the settings.
+     */
+    FrameLimiter& GetFrameLimiter() { return frameLimiter_; }
+
+    /**
+     * \brief Workers shared by the systems to split their update, only used from the main thread.
+     */
+    JobPool& GetJobPool() { return jobPool_; }
+
     void SetApp(std::unique_ptr<EngineApplication>&& app);
 
 	EngineApplication& GetApp() { return *app_; }
 private:
     EngineSetting engineSettings_;
 
+    FrameLimiter frameLimiter_;
+
     //Threads
     WorkerThread mainThread_;
     WorkerThread drawThread_;
     WorkerThread workerThread_;
+    JobPool jobPool_;
 
     //Callbacks
     observer::SubjectsContainer<observer::MainLoopSubject> subjectsContainer_;
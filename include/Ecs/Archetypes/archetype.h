@@ -30,6 +30,7 @@
 // Date : 28.02.2020
 //----------------------------------------------------------------------------------
 #pragma once
+#include <Ecs/Archetypes/components_blob.h>
 #include <Ecs/Entities/entity_mask.h>
 
 //Include Components data struct files
@@ -53,27 +54,44 @@ namespace ecs {
  */
 class Archetype : public EntityMask {
 public:
-	Archetype();
+	Archetype() = default;
 	~Archetype() = default;
 
     virtual void SetFromJson(const json& archetypeJson);
 
 	virtual json ToJson() const;
 
-    //Component Data
-	physics::Collider collider;
-	graphics::Model model;
-	physics::Rigidbody rigidbody;
-	SplineFollower spline;
-    math::Transform transform;
-	Light light;
-	audio::AudioSource audioSource;
-	graphics::ParticleSystem particleSystem;
-	TrailRenderer trailRenderer;
-	SegmentRenderer segmentRenderer;
-	EditorComponent editorComponent;
+    /**
+	 * \brief Get a component of the archetype, a default component is returned if it isn't in its mask.
+	 */
+	template<typename T>
+	const T& GetComponent(const ComponentType::ComponentType type) const
+	{
+		static const T kDefaultComponent{};
+		return HasComponent(type) ? components_.Get<T>(type) : kDefaultComponent;
+	}
 
-	size_t size;
+    /**
+	 * \brief Add a component to the archetype and get it to modify it.
+	 */
+	template<typename T>
+	T& EmplaceComponent(const ComponentType::ComponentType type)
+	{
+		AddComponent(type);
+		return components_.Emplace<T>(type);
+	}
+
+	template<typename T>
+	void SetComponent(const ComponentType::ComponentType type, const T& component)
+	{
+		EmplaceComponent<T>(type) = component;
+	}
+
+	size_t size = 0;
+
+private:
+	//Only the components added are stored, a prefab library doesn't carry every component for each object
+	ComponentsBlob components_;
 };
 }//namespace ecs
 }//namespace poke
\ No newline at end of file
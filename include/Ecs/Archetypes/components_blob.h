@@ -0,0 +1,138 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2019-2020, POK Family. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of POK Family nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Author : Nicolas Schneider
+// Co-Author :
+// Date : 28.05.2020
+//-----------------------------------------------------------------------------
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include <CoreEngine/cassert.h>
+#include <Ecs/ecs_utility.h>
+
+namespace poke {
+namespace ecs {
+/**
+ * \brief Type-erased storage of components, only the components added are stored one after the other.
+ */
+class ComponentsBlob {
+public:
+    ComponentsBlob() = default;
+    ~ComponentsBlob();
+
+    ComponentsBlob(const ComponentsBlob& other);
+    ComponentsBlob(ComponentsBlob&& other) noexcept;
+    ComponentsBlob& operator=(const ComponentsBlob& other);
+    ComponentsBlob& operator=(ComponentsBlob&& other) noexcept;
+
+    /**
+     * \brief Get a stored component, a default component is returned if it isn't stored.
+     */
+    template<typename T>
+    const T& Get(const ComponentType::ComponentType type) const
+    {
+        const Entry* entry = FindEntry(type);
+        if (!entry) {
+            static const T kDefaultComponent{};
+            return kDefaultComponent;
+        }
+        cassert(entry->ops == GetOps<T>(), "The component is stored with another type");
+        return *static_cast<const T*>(GetData(*entry));
+    }
+
+    /**
+     * \brief Get a stored component, it is default constructed at the end of the blob if it isn't stored yet.
+     */
+    template<typename T>
+    T& Emplace(const ComponentType::ComponentType type)
+    {
+        static_assert(alignof(T) <= alignof(std::max_align_t), "Components can't be over aligned");
+
+        const Entry* entry = FindEntry(type);
+        if (!entry) { return *static_cast<T*>(Add(type, GetOps<T>())); }
+        cassert(entry->ops == GetOps<T>(), "The component is stored with another type");
+        return *static_cast<T*>(GetData(*entry));
+    }
+
+    bool Has(const ComponentType::ComponentType type) const { return FindEntry(type) != nullptr; }
+
+    /**
+     * \brief Get the size in bytes of the components stored.
+     */
+    size_t GetSize() const { return size_; }
+
+private:
+    struct ComponentOps {
+        size_t size;
+        size_t alignment;
+        void (*construct)(void* destination);
+        void (*copy)(void* destination, const void* source);
+        void (*move)(void* destination, void* source);
+        void (*destroy)(void* component);
+    };
+
+    struct Entry {
+        ComponentType::ComponentType type;
+        size_t offset;
+        const ComponentOps* ops;
+    };
+
+    template<typename T>
+    static const ComponentOps* GetOps()
+    {
+        static const ComponentOps kOps{
+            sizeof(T),
+            alignof(T),
+            [](void* destination) { new(destination) T(); },
+            [](void* destination, const void* source) { new(destination) T(*static_cast<const T*>(source)); },
+            [](void* destination, void* source) { new(destination) T(std::move(*static_cast<T*>(source))); },
+            [](void* component) { static_cast<T*>(component)->~T(); }
+        };
+        return &kOps;
+    }
+
+    const Entry* FindEntry(ComponentType::ComponentType type) const;
+
+    const void* GetData(const Entry& entry) const;
+
+    void* GetData(const Entry& entry);
+
+    void* Add(ComponentType::ComponentType type, const ComponentOps* ops);
+
+    void Clear();
+
+    std::vector<Entry> entries_;
+    std::unique_ptr<std::max_align_t[]> data_;
+    size_t size_ = 0;
+};
+} //namespace ecs
+} //namespace poke
@@ -73,6 +73,11 @@ public:
 	void ClearEntity(const EntityIndex entityIndex);
 
 	void SetWithArchetype(const EntityPool archetypeData, const Archetype& archetype);
+
+	/**
+	 * \brief Set only the components of the given types, the other managers are not used.
+	 */
+	void SetWithArchetype(const EntityPool archetypeData, const Archetype& archetype, ComponentMask components);
 	void InsertArchetype(EntityIndex entity, const Archetype& archetype);
 	void EraseArchetype(EntityPool pool, size_t nbObjectToErase);
 
@@ -105,6 +110,11 @@ public:
 		return *static_cast<T*>(componentsManagers_[componentsManagerIndex].get());
 	}
 
+	/**
+	 * \brief Returns the manager of the given component type, nullptr if it has not been created.
+	 * \param componentType : a single ComponentType value
+	 */
+	IComponentsManager* FindComponentsManager(ComponentMask componentType) const;
 
     
 private:
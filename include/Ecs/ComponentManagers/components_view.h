@@ -0,0 +1,106 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2019-2020, POK Family. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of POK Family nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Author : Nicolas Schneider
+// Co-Author :
+// Date : 08.05.2020
+//-----------------------------------------------------------------------------
+#pragma once
+
+#include <vector>
+
+#include <Ecs/ecs_utility.h>
+
+namespace poke {
+namespace ecs {
+/**
+ * \brief Entities whose component was updated in place, each one is listed once.
+ */
+class DirtyEntities {
+public:
+    void Insert(const EntityIndex entityIndex)
+    {
+        if (static_cast<size_t>(entityIndex) >= flags_.size()) { flags_.resize(entityIndex + 1, false); }
+        if (flags_[entityIndex]) { return; }
+
+        flags_[entityIndex] = true;
+        entities_.push_back(entityIndex);
+    }
+
+    bool IsDirty(const EntityIndex entityIndex) const
+    {
+        return static_cast<size_t>(entityIndex) < flags_.size() && flags_[entityIndex];
+    }
+
+    const std::vector<EntityIndex>& GetEntities() const { return entities_; }
+
+    void Clear()
+    {
+        for (const EntityIndex entityIndex : entities_) { flags_[entityIndex] = false; }
+        entities_.clear();
+    }
+
+private:
+    std::vector<bool> flags_;
+    std::vector<EntityIndex> entities_;
+};
+
+/**
+ * \brief In place access to the components of a manager, replacing the copies of GetComponent and SetComponent.
+ * \details The view is invalidated when the number of entities changes.
+ */
+template<typename T>
+class ComponentsView {
+public:
+    explicit ComponentsView(std::vector<T>& components, DirtyEntities* dirtyEntities = nullptr)
+        : components_(components),
+          dirtyEntities_(dirtyEntities) {}
+
+    /**
+     * \brief Write the simulation state of the component, the observers aren't notified.
+     */
+    T& operator[](const EntityIndex entityIndex) { return components_[entityIndex]; }
+
+    const T& operator[](const EntityIndex entityIndex) const { return components_[entityIndex]; }
+
+    /**
+     * \brief Write the component and notify the observers of the updated components at the next update.
+     */
+    T& Update(const EntityIndex entityIndex)
+    {
+        if (dirtyEntities_) { dirtyEntities_->Insert(entityIndex); }
+        return components_[entityIndex];
+    }
+
+    size_t size() const { return components_.size(); }
+
+private:
+    std::vector<T>& components_;
+    DirtyEntities* dirtyEntities_;
+};
+} //namespace ecs
+} //namespace poke
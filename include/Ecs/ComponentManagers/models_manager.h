@@ -31,6 +31,7 @@
 //-----------------------------------------------------------------------------
 #pragma once
 
+#include <Ecs/ComponentManagers/components_view.h>
 #include <Ecs/ComponentManagers/interface_components_manager.h>
 
 #include <GraphicsEngine/Models/model.h>
@@ -51,7 +52,14 @@ public:
     void InsertArchetype(EntityIndex entity, const Archetype& archetype) override;
     void EraseEntities(EntityPool pool, size_t nbObjectToErase) override;
 
-    graphics::Model GetComponent(EntityIndex entityIndex);
+    const graphics::Model& GetComponent(EntityIndex entityIndex) const;
+
+    /**
+     * \brief In place access to the components, Update flags the entity for the observers of the updated components.
+     */
+    ComponentsView<graphics::Model> GetComponentsView() { return ComponentsView<graphics::Model>(models_, &dirtyEntities_); }
+
+    DirtyEntities& GetDirtyEntities() { return dirtyEntities_; }
 
     static graphics::VertexInput GetVertexInput(uint32_t binding = 0);
 
@@ -69,6 +77,7 @@ public:
 	}
 private:
 	std::vector<graphics::Model> models_;
+	DirtyEntities dirtyEntities_;
 };
 } //namespace ecs
 } //namespace poke
@@ -30,6 +30,7 @@
 // Date : 26.02.20
 //-----------------------------------------------------------------------------
 #pragma once
+#include <Ecs/ComponentManagers/components_view.h>
 #include <Ecs/ComponentManagers/interface_components_manager.h>
 #include <GraphicsEngine/Particles/particle_system.h>
 
@@ -61,6 +62,16 @@ public:
 
     void SetComponent(EntityIndex entityIndex, const graphics::ParticleSystem& particleSystem);
 
+    /**
+     * \brief In place access to the components, Update flags the entity for the observers of the updated components.
+     */
+    ComponentsView<graphics::ParticleSystem> GetComponentsView()
+    {
+        return ComponentsView<graphics::ParticleSystem>(particleSystems_, &dirtyEntities_);
+    }
+
+    DirtyEntities& GetDirtyEntities() { return dirtyEntities_; }
+
     void Clear();
 
 	constexpr static int GetComponentIndex()
@@ -69,6 +80,7 @@ public:
 	}
 private:
     std::vector<graphics::ParticleSystem> particleSystems_;
+    DirtyEntities dirtyEntities_;
 };
 } //namespace ecs
 } //namespace poke
@@ -30,6 +30,7 @@
 // Date : 15.01.20
 //-----------------------------------------------------------------------------
 #pragma once
+#include <Ecs/ComponentManagers/components_view.h>
 #include <Ecs/ComponentManagers/interface_components_manager.h>
 #include <PhysicsEngine/rigidbody.h>
 
@@ -61,6 +62,11 @@ public:
 
     void SetComponent(EntityIndex entityIndex, const physics::Rigidbody& rigidbody);
 
+    /**
+     * \brief In place access to the components.
+     */
+    ComponentsView<physics::Rigidbody> GetComponentsView() { return ComponentsView<physics::Rigidbody>(rigidbodies_); }
+
     void SetComponentFromJson(
         EntityIndex entityIndex,
         const json& componentJson) override;
@@ -33,6 +33,7 @@
 
 #include <vector>
 
+#include <Ecs/ComponentManagers/components_view.h>
 #include <Ecs/ComponentManagers/interface_components_manager.h>
 #include <Ecs/Components/spline_follower.h>
 
@@ -67,6 +68,11 @@ public:
 
     void SetComponent(EntityIndex entityIndex, const SplineFollower& spline);
 
+    /**
+     * \brief In place access to the components.
+     */
+    ComponentsView<SplineFollower> GetComponentsView() { return ComponentsView<SplineFollower>(splineFollowers_); }
+
     void SetComponentFromJson(
         EntityIndex entityIndex,
         const json& componentJson) override;
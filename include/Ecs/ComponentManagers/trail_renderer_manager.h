@@ -33,6 +33,7 @@
 
 #include <vector>
 
+#include <Ecs/ComponentManagers/components_view.h>
 #include <Ecs/ComponentManagers/interface_components_manager.h>
 #include <Ecs/Components/trail_renderer.h>
 
@@ -68,6 +69,11 @@ public:
 
     void SetComponent(EntityIndex entityIndex, const TrailRenderer& trailRenderer);
 
+    /**
+     * \brief In place access to the components.
+     */
+    ComponentsView<TrailRenderer> GetComponentsView() { return ComponentsView<TrailRenderer>(trailRenderers_); }
+
     void SetComponentFromJson(
         const EntityIndex entityIndex,
         const json& componentJson) override;
@@ -130,6 +130,13 @@ public:
      */
     math::Vec3 GetWorldRotation(EntityIndex entityIndex);
 
+    /**
+     * \brief Get the world orientation of the given index, the local orientations composed down the hierarchy
+     * \param entityIndex
+     * \return
+     */
+    math::Quaternion GetWorldOrientation(EntityIndex entityIndex) const;
+
     /**
      * \brief Get the world transform of the given index
      * \param entityIndex
@@ -172,9 +179,9 @@ private:
 
     math::Matrix4 CalculateLocalToParentMatrix(EntityIndex entityIndex) const;
 
-    math::Vec3 GetLocalRotationFromWorldRotation(
+    math::Quaternion GetLocalOrientationFromWorldOrientation(
         EntityIndex entityIndex,
-        math::Vec3 rotation
+        math::Quaternion orientation
     ) const;
     math::Vec3 GetLocalScaleFromWorldScale(
         EntityIndex entityIndex,
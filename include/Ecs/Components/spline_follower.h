@@ -66,6 +66,10 @@ struct SplineFollower {
      */
     float speed = 0.05f;
 	float totalPercentage = 0;
+    /**
+     * \brief Distance traveled along the spline, the percentages are deduced from it.
+     */
+    float distance = 0;
 };
 } //namespace ecs
 } //namespace poke
@@ -53,6 +53,8 @@ struct TrailRendererVertex {
         return !(*this == other);
     }
 
+	TrailRendererVertex() = default;
+
 	TrailRendererVertex(const math::Vec3 position, const math::Vec3 centerPosition, const math::Vec3 derivedDirection) :
 		centerPosition(centerPosition),
 		derivedDirection(derivedDirection),
@@ -69,8 +71,19 @@ struct TrailRendererVertex {
 	math::Vec3 centerPosition; //the center position in the trail that this vertex was derived from
 	math::Vec3 derivedDirection; //the direction from the 1) center position to the 2) position of this vertex
 	math::Vec3 position;
-	float creationTime;
-	float timeAlive;
+	float creationTime = 0;
+	float timeAlive = 0;
+};
+
+/**
+ * \brief Range of the trail mesh written by TrailRenderer::WriteMesh.
+ * \details The vertex range wraps around the ring, the index range is in the pattern of GenerateRingIndexes.
+ */
+struct TrailMeshRange {
+	uint32_t firstVertex = 0;
+	uint32_t vertexCount = 0;
+	uint32_t firstIndex = 0;
+	uint32_t indexCount = 0;
 };
 
 struct TrailRenderer {
@@ -84,11 +97,17 @@ struct TrailRenderer {
 
     bool Update(math::Vec3 worldPos);
 
+    /**
+     * \brief Add and retire the vertices, return true when the mesh changed.
+     */
+    bool Update(math::Vec3 worldPos, float dt, math::Vec3 cameraFront);
+
     size_t GetNumberOfPoints() const;
 
-	const std::vector<math::Vec3>& GetCenterPosition() const { return centerPositions_; }
-	const std::vector<TrailRendererVertex>& GetLeftVertices() const { return leftVertices_; }
-	const std::vector<TrailRendererVertex>& GetRightVertices() const { return rightVertices_; }
+    /**
+     * \brief Number of pairs of vertices alive, the oldest are retired when there are more than kMaxVertexPairs.
+     */
+    size_t GetVertexPairsCount() const { return count_; }
 
     void Clear();
 
@@ -106,19 +125,37 @@ struct TrailRenderer {
 	math::Vec3 renderDirection = {0, 1, 0};
 	bool isPaused = false;
 
-	std::pair<std::vector<graphics::VertexMesh>, std::vector<uint32_t>> GenerateMesh();
+	/**
+	 * \brief Write the vertices alive in their slot of the ring, the slot i uses the vertices 2 * i and 2 * i + 1.
+	 * \param ringVertices : kMaxVertexPairs * 2 vertices, only the returned range is written.
+	 * \return an empty range if there are less than two pairs of vertices.
+	 */
+	TrailMeshRange WriteMesh(graphics::VertexMesh* ringVertices) const;
+
+	/**
+	 * \brief Indexes of the quads between each slot and the next one, the ring is repeated twice to never wrap the drawn range.
+	 */
+	static std::vector<uint32_t> GenerateRingIndexes();
+
+	inline static const size_t kMaxVertexPairs = 128;
 private:
-    bool TryAddVertices(math::Vec3 worldPos);
+    bool TryAddVertices(math::Vec3 worldPos, math::Vec3 cameraFront);
 
     bool TryRemoveVertices();
 
     bool SetVertexWidth();
 
+    size_t GetSlot(const size_t pairIndex) const { return (head_ + pairIndex) % kMaxVertexPairs; }
 
     //Logic fields
-	std::vector<math::Vec3> centerPositions_;
+	math::Vec3 lastCenterPosition_;
+	bool hasCenterPosition_ = false;
+
+	//Rings of kMaxVertexPairs vertices, allocated with the first vertices
 	std::vector<TrailRendererVertex> leftVertices_;
 	std::vector<TrailRendererVertex> rightVertices_;
+	size_t head_ = 0;
+	size_t count_ = 0;
 };
 } //namespace ecs
 } //namespace poke
@@ -31,6 +31,8 @@
 //----------------------------------------------------------------------------------
 #pragma once
 
+#include <unordered_map>
+
 #include <Ecs/interface_ecs_manager.h>
 #include <CoreEngine/Observer/subject.h>
 #include <CoreEngine/Observer/subjects_container.h>
@@ -131,6 +133,12 @@ public:
     std::map<ecs::EntityIndex, ecs::EntityIndex> SetEntitiesFromJson(const json& entitiesJson) override;
 
 	std::tuple<json, std::map<ecs::EntityIndex, ecs::EntityIndex>> EntitiesToJson() override;
+
+	json EntitiesToPrefabJson(const std::vector<EntityIndex>& entities) override;
+
+	bool IsBinarySceneSupported() const override { return true; }
+
+	std::map<ecs::EntityIndex, ecs::EntityIndex> SetEntitiesFromBinary(const scene::BinarySceneView& sceneView) override;
     //-------------------------------------------------------------------------
 
     //------------------------------- OBSERVERS -------------------------------
@@ -219,6 +227,11 @@ public:
 protected:
     void UpdateDestroyedEntities();
 
+    /**
+     * \brief Notify the observers of the components updated in place since the last update.
+     */
+    void NotifyUpdatedComponents();
+
     void OnAppBuild();
 
     void AllocatePoolMemory(size_t sizeToAdd);
@@ -232,6 +245,15 @@ protected:
 
     std::vector<EntityIndex> InstantiatePrefab(const Prefab& prefab) override;
 
+    void AddPrefabPool(ResourceID prefabID, const Prefab& prefab, size_t instancesCount) override;
+
+    std::vector<EntityIndex> InstantiatePooledPrefab(ResourceID prefabID, const Prefab& prefab) override;
+
+    /**
+     * \brief Instantiate a prefab referenced by a scene.
+     */
+    virtual std::vector<EntityIndex> InstantiateScenePrefab(const std::string& prefabName);
+
     std::vector<EntityIndex> visibleEntities_;
 
     std::vector<EntityPool> pools_;
@@ -259,6 +281,40 @@ protected:
     std::vector<EntityMask> entities_;
 
     std::vector<std::pair<EntityIndex, float>> entitiesToDestroy_;
+
+private:
+    struct PrefabInstance {
+        std::vector<EntityIndex> entities;
+        bool isActive = false;
+        //False once the components could have been changed by the gameplay
+        bool isReset = true;
+    };
+
+    struct PrefabPool {
+        ResourceID prefabID;
+        std::vector<size_t> parentIndexes;
+        std::vector<PrefabInstance> instances;
+        std::vector<size_t> freeInstances;
+    };
+
+    /**
+     * \brief Set inactive the entities of an instance instead of destroying them.
+     */
+    void ReleasePrefabInstance(PrefabPool& pool, size_t instanceIndex);
+
+    /**
+     * \brief Write back the components of the objects of the prefab, only the managers of these components are used.
+     */
+    void ResetPrefabInstance(const PrefabPool& pool, PrefabInstance& instance, const Prefab& prefab);
+
+    std::vector<PrefabPool> prefabPools_;
+
+    struct PooledEntity {
+        size_t poolIndex;
+        size_t instanceIndex;
+        size_t objectIndex;
+    };
+    std::unordered_map<EntityIndex, PooledEntity> pooledEntities_;
 };
 } // namespace ecs
 } //namespace poke
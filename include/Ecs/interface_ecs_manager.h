@@ -54,6 +54,10 @@ class EditorPrefabsManager;
 class CorePrefabsManager;
 class CoreArchetypesManager;
 
+namespace scene {
+class BinarySceneView;
+} //namespace scene
+
 namespace observer {
 enum class EntitiesSubjects : uint8_t {
     INIT = 0,
@@ -305,6 +309,16 @@ public:
 	//------------------------- LOADING / UNLOADING ---------------------------
 	virtual std::map<ecs::EntityIndex, ecs::EntityIndex> SetEntitiesFromJson(const json& entitiesJson) = 0;
 	virtual std::tuple<json, std::map<ecs::EntityIndex, ecs::EntityIndex>> EntitiesToJson() = 0;
+	/**
+	 * \brief Serialize entities in the format read by EnginePrefab::SetFromJson, the parents are indexes in the list.
+	 * \details Only the components an Archetype can hold are written, a parent must be before its children.
+	 */
+	virtual json EntitiesToPrefabJson(const std::vector<EntityIndex>& entities) = 0;
+	/**
+	 * \brief Returns true if the scenes can be loaded from their .pokscenebin instead of the json.
+	 */
+	virtual bool IsBinarySceneSupported() const = 0;
+	virtual std::map<ecs::EntityIndex, ecs::EntityIndex> SetEntitiesFromBinary(const scene::BinarySceneView& sceneView) = 0;
 	//-------------------------------------------------------------------------
 
     //------------------------------- OBSERVER --------------------------------
@@ -371,6 +385,19 @@ protected:
 private:
 	virtual std::vector<EntityIndex> InstantiatePrefab(const Prefab& prefab) = 0;
 
+	/**
+	 * \brief Instantiate inactive instances of a prefab, they are reused by InstantiatePooledPrefab until the scene is unloaded.
+	 * \param prefabID : the id of the prefab in its PrefabsManager.
+	 * \param instancesCount : the number of instances created.
+	 */
+	virtual void AddPrefabPool(ResourceID prefabID, const Prefab& prefab, size_t instancesCount) = 0;
+
+	/**
+	 * \brief Activate a free instance of the pool of the prefab, InstantiatePrefab is used when there is none.
+	 * \return all entities of the instance, in the order of the objects of the prefab.
+	 */
+	virtual std::vector<EntityIndex> InstantiatePooledPrefab(ResourceID prefabID, const Prefab& prefab) = 0;
+
 	/**
      * \brief Update an already existing archetype. WARNING Don't use this function for resizing. This function must be called only from the ArchetypeManger.
      * \param archetypeID
@@ -191,6 +191,17 @@ public:
     }
 	std::tuple<json, std::map<ecs::EntityIndex, ecs::EntityIndex>> EntitiesToJson() override {
         return std::make_tuple(json(), std::map<ecs::EntityIndex, ecs::EntityIndex>());
+    }
+	json EntitiesToPrefabJson(const std::vector<EntityIndex>& entities) override
+    {
+		entities;
+		return json();
+    }
+	bool IsBinarySceneSupported() const override { return false; }
+	std::map<ecs::EntityIndex, ecs::EntityIndex> SetEntitiesFromBinary(const scene::BinarySceneView& sceneView) override
+    {
+		sceneView;
+		return std::map<ecs::EntityIndex, ecs::EntityIndex>();
     }
 	//-------------------------------------------------------------------------
 
@@ -356,6 +367,21 @@ private:
 		prefab;
 		return { };
     }
+
+	void AddPrefabPool(ResourceID prefabID, const Prefab& prefab, size_t instancesCount) override
+	{
+		prefabID;
+		prefab;
+		instancesCount;
+	}
+
+	std::vector<EntityIndex> InstantiatePooledPrefab(ResourceID prefabID, const Prefab& prefab) override
+	{
+		prefabID;
+		prefab;
+		return { };
+	}
+
 	void UpdateArchetype(
 		ArchetypeID archetypeID,
 		const Archetype& archetype) override
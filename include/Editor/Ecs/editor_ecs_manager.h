@@ -57,6 +57,9 @@ public:
 	std::map<ecs::EntityIndex, ecs::EntityIndex> SetEntitiesFromJson(const json& entitiesJson) override;
 
     std::tuple<json, std::map<ecs::EntityIndex, ecs::EntityIndex>> EntitiesToJson() override;
+
+	//The editor needs the names and editor components only saved in the json
+	bool IsBinarySceneSupported() const override { return false; }
     //-------------------------------------------------------------------------
 
     /**
@@ -33,6 +33,7 @@
 
 #include <Game/ResourcesManager/PrefabsManager/game_prefabs_manager.h>
 #include <Editor/Ecs/editor_prefab.h>
+#include <ResourcesManager/resource_index.h>
 
 namespace poke {
 namespace editor {
@@ -48,6 +49,8 @@ public:
 
     void AddPrefab(const std::string& prefabName) override;
 
+	void AddPrefabPool(const std::string& prefabName, size_t instancesCount) override;
+
 	const ecs::Prefab& GetPrefab(
 		const nonstd::string_view& prefabName) const override;
 
@@ -93,6 +96,7 @@ public:
 	//-------------------------------------------------------------------------
 private:
 	std::vector<ResourceID> prefabsID_;
+	ResourceIndex prefabIndex_;
 	std::vector<editor::EditorPrefab> prefabs_;
 	std::vector<std::string> prefabsNames_;
 };
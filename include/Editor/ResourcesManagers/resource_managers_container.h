@@ -34,12 +34,13 @@
 #include <Editor/ResourcesManagers/editor_textures_manager.h>
 #include <Editor/ResourcesManagers/editor_sounds_manager.h>
 #include <Editor/ResourcesManagers/editor_prefabs_manager.h>
+#include <ResourcesManager/resource_hot_reloader.h>
 
 namespace poke {
 namespace editor {
 class ResourcesManagerContainer {
 public:
-    ResourcesManagerContainer();
+    explicit ResourcesManagerContainer(ResourceLoader& resourceLoader);
 
     void Init();
 
@@ -49,6 +50,9 @@ public:
 	EditorSoundsManager editorSoundsManager;
 	EditorPrefabsManager editorPrefabsManager;
 
+    //Reloads the meshes, textures and materials edited while the editor runs
+    ResourceHotReloader hotReloader;
+
 private:
     void OnUnloadScene();
 };
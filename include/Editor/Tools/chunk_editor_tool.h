@@ -64,7 +64,7 @@ private:
 
 	std::vector<ecs::EntityIndex> chunkEntities_;
 
-	std::array<chunk::Chunk, 64> chunkArray_;
+	std::vector<chunk::Chunk> chunkArray_;
 
 	std::vector<std::string> chunkNames_;
 	
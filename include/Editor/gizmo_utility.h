@@ -73,7 +73,7 @@ public:
 		Color color = gizmoColorAabb_);
 
 	static const void DisplayAllChunksGizmo();
-	static const void DisplayChunkGizmo(uint8_t chunkIndex);
+	static const void DisplayChunkGizmo(chunk::ChunkIndex chunkIndex);
 
 	static const void DisplayTransformGizmo(
 		const math::Transform& transform,
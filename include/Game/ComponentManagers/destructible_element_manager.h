@@ -31,6 +31,7 @@
 
 #pragma once
 #include <Utility/json_utility.h>
+#include <Ecs/ComponentManagers/components_view.h>
 #include <Ecs/ComponentManagers/interface_components_manager.h>
 
 #include <Game/Components/destructible_element.h>
@@ -60,6 +61,11 @@ public:
 	 */
 	DestructibleElement GetComponent(const ecs::EntityIndex entityIndex);
 
+	/**
+	 * \brief In place access to the components.
+	 */
+	ecs::ComponentsView<DestructibleElement> GetComponentsView() { return ecs::ComponentsView<DestructibleElement>(destructibleElements_); }
+
 	void SetWithArchetype(ecs::EntityPool entityPool, 
 						  const ecs::Archetype& archetype) override;
 	
@@ -29,6 +29,7 @@
 // Date : 18.02.20
 //----------------------------------------------------------------------------------
 #pragma once
+#include <Ecs/ComponentManagers/components_view.h>
 #include <Ecs/ComponentManagers/interface_components_manager.h>
 #include <Game/Components/enemy.h>
 
@@ -51,9 +52,14 @@ public:
 		ecs::EntityIndex entityIndex,
 		const json& componentJson) override;
 
-	Enemy GetComponent(const ecs::EntityIndex entityIndex);
+	const Enemy& GetComponent(const ecs::EntityIndex entityIndex) const;
 	void SetComponent(const ecs::EntityIndex entityIndex, Enemy enemy);
 
+	/**
+	 * \brief In place access to the components.
+	 */
+	ecs::ComponentsView<Enemy> GetComponentsView() { return ecs::ComponentsView<Enemy>(enemies_); }
+
 	constexpr static int GetComponentIndex()
 	{
 		return math::log2(static_cast<int>(ecs::ComponentType::ComponentType::ENEMY));
@@ -29,6 +29,7 @@
 // Date : 19.02.20
 //----------------------------------------------------------------------------------
 #pragma once
+#include <Ecs/ComponentManagers/components_view.h>
 #include <Ecs/ComponentManagers/interface_components_manager.h>
 
 #include <Game/Components/missile.h>
@@ -53,6 +54,11 @@ public:
 	json GetJsonFromComponent(ecs::EntityIndex entityIndex) override;	Missile GetComponent(ecs::EntityIndex entityIndex);
 	void SetComponent(ecs::EntityIndex entityIndex, Missile missile);
 
+	/**
+	 * \brief In place access to the components.
+	 */
+	ecs::ComponentsView<Missile> GetComponentsView() { return ecs::ComponentsView<Missile>(missiles_); }
+
 	constexpr static int GetComponentIndex()
 	{
 		return math::log2(static_cast<int>(ecs::ComponentType::ComponentType::MISSILE));
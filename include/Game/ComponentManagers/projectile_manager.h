@@ -33,6 +33,7 @@
 #include <Utility/json_utility.h>
 
 #include <Game/Components/projectile.h>
+#include <Ecs/ComponentManagers/components_view.h>
 #include <Ecs/ComponentManagers/interface_components_manager.h>
 
 namespace poke::game {
@@ -66,6 +67,11 @@ public:
 	void SetComponent(const ecs::EntityIndex entityIndex,
 		const Projectile& projectile);
 
+	/**
+	 * \brief In place access to the components.
+	 */
+	ecs::ComponentsView<Projectile> GetComponentsView() { return ecs::ComponentsView<Projectile>(projectiles_); }
+
 	void SetComponentFromJson(ecs::EntityIndex entityIndex, const json& componentJson) override;
 	json GetJsonFromComponent(ecs::EntityIndex entityIndex) override;
 
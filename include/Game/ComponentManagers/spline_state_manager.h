@@ -52,7 +52,7 @@ public:
 
 	json GetJsonFromComponent(const ecs::EntityIndex entityIndex) override;
 
-	SplineStates GetComponent(const ecs::EntityIndex entityIndex);
+	const SplineStates& GetComponent(const ecs::EntityIndex entityIndex) const;
 
 	void SetComponent(const ecs::EntityIndex entityIndex, const SplineStates& splineStates);
 
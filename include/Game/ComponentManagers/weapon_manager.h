@@ -32,6 +32,7 @@
 #pragma once
 #include <Utility/json_utility.h>
 #include <Math/tranform.h>
+#include <Ecs/ComponentManagers/components_view.h>
 #include <Ecs/ComponentManagers/interface_components_manager.h>
 #include <Game/ComponentManagers/projectile_manager.h>
 
@@ -60,13 +61,18 @@ public:
 	 * \param entityIndex : the index of the entity
 	 * \return a struct with all the data and the index of the component
 	 */
-	Weapon GetComponent(const ecs::EntityIndex entityIndex);
+	const Weapon& GetComponent(const ecs::EntityIndex entityIndex) const;
 
 	void SetWithArchetype(ecs::EntityPool entityPool,
 						  const ecs::Archetype& archetype) override;
 	
 	void SetComponent(const ecs::EntityIndex entityIndex, const Weapon& weapon);
 
+	/**
+	 * \brief In place access to the components.
+	 */
+	ecs::ComponentsView<Weapon> GetComponentsView() { return ecs::ComponentsView<Weapon>(weapons_); }
+
 	void SetComponentFromJson(ecs::EntityIndex entityIndex, const json& componentJson) override;
 	json GetJsonFromComponent(ecs::EntityIndex entityIndex) override;
 
@@ -54,17 +54,6 @@ public:
     void SetFromJson(const json& archetypeJson) override;
 
     json ToJson() const override;
-
-	Player player;
-	Weapon weapon;
-	SpecialAttack specialAttack;
-	DestructibleElement destructibleElement;
-	Projectile projectile;
-	Enemy enemy;
-	Missile missile;
-	SplineStates splineStates;
-	Jiggle jiggle;
-	GameCamera gameCamera;
 };
 } //namespace game
 } //namespace poke
@@ -44,6 +44,9 @@ public:
 	std::map<ecs::EntityIndex, ecs::EntityIndex> SetEntitiesFromJson(const json& entitiesJson) override;
 
     std::tuple<json, std::map<ecs::EntityIndex, ecs::EntityIndex>> EntitiesToJson() override;
+
+protected:
+	std::vector<ecs::EntityIndex> InstantiateScenePrefab(const std::string& prefabName) override;
 };
 } // namespace ecs
 } //namespace poke
@@ -35,6 +35,7 @@
 #include <Game/ComponentManagers/player_manager.h>
 #include <Game/ComponentManagers/weapon_manager.h>
 #include <Ecs/ComponentManagers/transforms_manager.h>
+#include <ResourcesManager/resource_index.h>
 
 namespace poke {
 namespace game {
@@ -53,6 +54,7 @@ public:
         const nonstd::string_view& prefabName) const override;
 
     void AddPrefab(const std::string& prefabName) override;
+    void AddPrefabPool(const std::string& prefabName, size_t instancesCount) override;
     const ecs::Prefab& GetPrefab(
         const nonstd::string_view& prefabName) const override;
 
@@ -66,6 +68,7 @@ public:
 	void Resize(size_t newSize) override;
 protected:	
     std::vector<ResourceID> prefabsID_;
+    ResourceIndex prefabIndex_;
     std::vector<GamePrefab> prefabs_;
 };
 } //namespace game
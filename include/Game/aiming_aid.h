@@ -35,6 +35,7 @@
 #include <CoreEngine/ServiceLocator/service_locator_definition.h>
 #include <Game/ComponentManagers/player_manager.h>
 #include <Game/game_system.h>
+#include <Game/spatial_hash.h>
 #include <Ecs/Utility/entity_vector.h>
 
 
@@ -47,8 +48,6 @@ public:
 private:
 	void OnUpdate();
 
-	void SelectVisibleEntities();
-
 	void LookAtCamera(const ecs::EntityIndex entityIndex);
 	
 	void OnEntitySetActive(ecs::EntityIndex entityIndex) override;
@@ -73,10 +72,7 @@ private:
 	graphics::Model targetSightNeutralModel_;
 	graphics::Model targetSightLockModel_;
 
-    inline static const size_t maxTargetNb = 1000;
 	inline static const size_t maxPlayerNb = 4;
-    size_t beaconTargetNb_ = 0;
-	size_t beaconConfirmedTargetNb_ = 0;
 	const float kMaxTargetDistance_ = 200.0f;
 	const float kMaxAimAngle_ = 4.0f;
 	const float kKeepTargetUntilAngle_ = 4.5f;
@@ -92,10 +88,6 @@ private:
 
 	std::array<math::Vec3, maxPlayerNb> targetSightPositions_;
 	std::array<math::Vec3, maxPlayerNb> playerPositions_;
-	std::array<math::Vec3, maxTargetNb> targetPositions_;
-	std::array<ecs::EntityIndex, maxTargetNb> targets_;
-	std::array<ecs::EntityIndex, maxTargetNb> selectedTargets_;
-	std::array<float, maxTargetNb> selectedTargetAngles_;
 	std::array<graphics::Model, maxPlayerNb> targetSightModels_;
 
 	std::array<TargetSightState, maxPlayerNb> newTargetSightStates_;
@@ -109,6 +101,7 @@ private:
 
 	std::vector<math::Vec3> aimDirections_;
 	std::vector<Player> playersDatas_;
+	std::vector<SpatialHash::Entry> lockableTargets_;
 };
 }//namespace game
 }//namespace poke
\ No newline at end of file
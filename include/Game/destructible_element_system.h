@@ -74,6 +74,8 @@ private:
 	const float kParticleTimeAsteroid_ = 1.25f;
 	const float kParticleTimeShip_ = 1.25f;
 	const float kParticleTimeTurret_ = 1.25f;
+	//Elements destroyed per second by the player weapons at their max rate
+	const float kMaxDestructionsPerSecond_ = 4.0f;
 
 	const std::size_t kMaxArchetypeDebrisNb_ = 1000;
 	const std::size_t kDebrisNbPerAsteroids_ = 10;
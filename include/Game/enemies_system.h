@@ -81,7 +81,8 @@ private:
 	const float kPercentageFullCheck = 99.8f / 100.0f;
 	std::array<math::Vec3, futurePosNb> playerFuturePositions_;
 
-	std::array<float, futurePosNb> projectileFutureDistances_;
+	//Squared, compared to the squared distances to the future positions
+	std::array<float, futurePosNb> projectileFutureSqrDistances_;
 
 	ecs::EntityVector enemyIndexes_ = ecs::EntityVector(kEnemyNb_);
 	ecs::EntityVector enemySplineIndexes_ = ecs::EntityVector(kEnemyNb_);
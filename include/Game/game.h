@@ -40,6 +40,7 @@
 #include <Game/Ecs/game_ecs_manager.h>
 #include <Game/Ecs/game_archetypes_manager.h>
 #include <Game/prefabs_container.h>
+#include <Game/spatial_hash.h>
 
 namespace poke {
 //-----------------------------FORWARD DECLARATION----------------------------------
@@ -92,12 +93,24 @@ public:
 	GameArchetypesManager& GetGameArchetypesManager() {
 		return gameArchetypesManager_;
 	}
+
+    /**
+     * \brief Get the visible destructible elements that can be locked, refreshed before every update.
+     */
+	const SpatialHash& GetTargetsSpatialHash() const {
+		return targetsSpatialHash_;
+	}
     //----------------------------------------------------------------------------------
 
     bool IsPaused() const { return state_ == AppState::PAUSE; }
 
     void UnPause() { state_ = AppState::RUNNING; }
 private:
+	/**
+	 * \brief Register the tasks of the main and render threads, run every frame by Run.
+	 */
+	void SetFrameTasks();
+
 	AppSystemsContainer appSystemsContainer_;
 	//Callbacks
 	observer::Subject<> subjectAppBuild_;
@@ -116,6 +129,11 @@ private:
 	GameArchetypesManager gameArchetypesManager_;
 
 	GameEcsManager gameEcsManager_;
+
+	SpatialHash targetsSpatialHash_;
+
+	//Reused every frame to build the window title
+	std::string windowTitle_;
 };
 } //namespace game
 } //namespace poke
@@ -0,0 +1,86 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2019-2020, POK Family. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of POK Family nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Author : Nicolas Schneider
+// Co-Author :
+// Date : 30.05.2020
+//-----------------------------------------------------------------------------
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <Math/quaternion.h>
+#include <Math/vector.h>
+
+namespace poke {
+namespace game {
+/**
+ * \brief Kernels used to update the homing missiles stored as structure of arrays.
+ * \details They use SSE when it is available and fall back on scalar loops otherwise.
+ * They don't touch anything but the given range so ranges of missiles can be updated in parallel.
+ */
+namespace missile_kernels {
+/**
+ * \brief Missiles flying toward their target, one value per missile in each array.
+ */
+struct MissilesBatch {
+    void Resize(size_t count);
+
+    size_t GetSize() const { return speeds.size(); }
+
+    std::vector<float> positionsX, positionsY, positionsZ;
+    std::vector<float> targetsX, targetsY, targetsZ;
+
+    //Normalized
+    std::vector<float> directionsX, directionsY, directionsZ;
+    std::vector<float> speeds;
+    std::vector<float> lifeTimes;
+
+    //Outputs
+    std::vector<float> velocitiesX, velocitiesY, velocitiesZ;
+    //1 when the direction changed, the rotation is then in rotations
+    std::vector<uint8_t> hasTurned;
+    std::vector<math::Quaternion> rotations;
+};
+
+/**
+ * \brief Turn the missiles of [begin, end) toward their target when it's in front of them, then age them.
+ * \param cosMaxAngle : cosine of the widest angle between the direction of a missile and its target
+ * \param lerpValue : part of the way to the target direction done in one update
+ * \details The life time stops at 0, the rotations look along the direction.
+ */
+void UpdateMissiles(
+    MissilesBatch& missiles,
+    size_t begin,
+    size_t end,
+    float deltaTime,
+    float cosMaxAngle,
+    float lerpValue);
+} //namespace missile_kernels
+} //namespace game
+} //namespace poke
@@ -36,8 +36,10 @@
 #include <Game/ComponentManagers/destructible_element_manager.h>
 #include <Math/quaternion.h>
 #include <Ecs/Utility/entity_vector.h>
+#include <Utility/job_pool.h>
 
 #include <Game/game_system.h>
+#include <Game/missile_kernels.h>
 
 namespace poke {
 namespace game {
@@ -50,6 +52,16 @@ public:
 private:
 	void OnUpdate();
 
+	/**
+	 * \brief Update the batch in contiguous ranges, the first one is updated by the main thread.
+	 */
+	void UpdateMissilesBatch(float deltaTime);
+
+	/**
+	 * \brief Destroy the missiles that exploded or ran out of life time since the last call.
+	 */
+	void DestroyMissiles();
+
 	void OnEntitySetActive(const ecs::EntityIndex entityIndex) override;
 	void OnEntitySetInactive(const ecs::EntityIndex entityIndex) override;
 
@@ -59,7 +71,6 @@ private:
 	void OnTriggerEnter(const ecs::EntityIndex entityIndex, const physics::Collision collision);
 
 	void MissileExplosion(const ecs::EntityIndex entityIndex);
-	bool IsInFieldOfAim(const math::Vec3 missileDirection, const math::Vec3 targetDirection, const float maxAngle) const;
 
     ecs::TransformsManager& transformsManager_;
 	ecs::RigidbodyManager& rigidbodyManager_;
@@ -68,6 +79,8 @@ private:
 	ecs::ParticleSystemsManager& particleSystemsManager_;
 	poke::game::GamePrefabsManager& gamePrefabsManager_;
 	const float kParticleTime_ = 5.0f;
+	//Missiles exploding per second when the player and the enemies fire their salvos
+	const float kMaxExplosionsPerSecond_ = 6.0f;
 
 	const size_t kMaxMissileNb_ = 201;
 	ecs::EntityVector entityIndexes_ = ecs::EntityVector(kMaxMissileNb_);
@@ -76,12 +89,16 @@ private:
 	const float kMaxAngle_ = 90.0f;
 	const float kLerpValue_ = 0.5f;
 
-    //Missile update data optimisation
-	std::vector<Missile> missiles_;
-	std::vector<physics::Rigidbody> rigidbodies_;
-	std::vector<math::Transform> transforms_;
-	std::vector<math::Vec3> missileTargetDirections_;
-	size_t flagEndData_;
+	//Below, the missiles are updated by the main thread alone
+	inline static const size_t kMinMissilesPerRange = 512;
+
+	//Missiles flying, in the order of the batch
+	std::vector<ecs::EntityIndex> batchEntities_;
+	missile_kernels::MissilesBatch batch_;
+	JobPool& jobPool_;
+
+	//The missiles aren't destroyed while they are in the batch or during a trigger
+	std::vector<ecs::EntityIndex> destroyedMissiles_;
 };
 }//namespace game
 }//namespace poke
\ No newline at end of file
@@ -63,8 +63,13 @@ private:
 
 	void OnTriggerEnter(const ecs::EntityIndex entityIndex, const physics::Collision collision);
 
+    /**
+     * \brief Spawn the impact particles, the projectile is destroyed at the end of the next update.
+     */
     void DestroyProjectile(ecs::EntityIndex entityIndex, DestructibleElement::Type type = DestructibleElement::Type::SHIP);
 
+    bool IsDestroyed(ecs::EntityIndex entityIndex) const;
+
     Time& time_;
 	ProjectileManager& projectileManager_;
 	ecs::TransformsManager& transformsManager_;
@@ -73,6 +78,8 @@ private:
 	ecs::ParticleSystemsManager& particleSystemsManager_;
 	graphics::ParticleSystem particleSystem_;
 	const float kParticleTime_ = 1;
+	//Impacts per second when the player and the enemies in range fire at their max rate
+	const float kMaxImpactsPerSecond_ = 30.0f;
 
 	graphics::GizmoCommandBuffer& gizmoCommandBuffer_;
 	poke::game::GamePrefabsManager& gamePrefabsManager_;
@@ -81,5 +88,8 @@ private:
 
 	ecs::EntityVector entityIndexes_ = ecs::EntityVector(kMaxProjectileNb_);
 	ecs::EntityVector registeredEntities_ = ecs::EntityVector(kMaxProjectileNb_);
+
+	//The projectiles aren't destroyed during a trigger
+	std::vector<ecs::EntityIndex> destroyedProjectiles_;
 };
 }//namespace poke::game
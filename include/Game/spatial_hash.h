@@ -0,0 +1,125 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2019-2020, POK Family. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of POK Family nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Author : Nicolas Schneider
+// Co-Author :
+// Date : 29.05.2020
+//-----------------------------------------------------------------------------
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include <Ecs/ecs_utility.h>
+#include <Math/vector.h>
+
+namespace poke {
+namespace game {
+/**
+ * \brief Hash grid of gameplay entities, rebuilt each frame to find the entities around a position without testing all of them.
+ * \details Cells are hashed in a table as big as the entities, their entities are stored one after the other.
+ */
+class SpatialHash {
+public:
+    struct Entry {
+        ecs::EntityIndex entityIndex;
+        math::Vec3 position;
+    };
+
+    explicit SpatialHash(float cellSize = 50.0f);
+
+    /**
+     * \brief Remove every entity, the memory is kept for the next frame.
+     */
+    void Clear();
+
+    /**
+     * \brief Add an entity, it can only be found after the next Build.
+     */
+    void Insert(ecs::EntityIndex entityIndex, math::Vec3 position);
+
+    /**
+     * \brief Sort the entities inserted by cell.
+     */
+    void Build();
+
+    /**
+     * \brief Find the entities closer than the radius.
+     * \param results : cleared then filled in no particular order
+     */
+    void QueryRadius(math::Vec3 center, float radius, std::vector<Entry>& results) const;
+
+    /**
+     * \brief Find the entities inside a cone, like the targets in the aim of a player.
+     * \param direction : axis of the cone, it is normalized
+     * \param maxAngle : angle in degrees between the axis and the side of the cone, below 90 degrees
+     * \param results : cleared then filled in no particular order
+     */
+    void QueryCone(
+        math::Vec3 origin,
+        math::Vec3 direction,
+        float maxAngle,
+        float maxDistance,
+        std::vector<Entry>& results) const;
+
+    /**
+     * \brief Find the k entities closest to the position.
+     * \param results : cleared then filled from the closest to the farthest
+     */
+    void QueryNearest(math::Vec3 position, size_t count, float maxDistance, std::vector<Entry>& results) const;
+
+    size_t GetSize() const { return entries_.size(); }
+
+private:
+    using Cell = std::array<int, 3>;
+
+    Cell GetCell(math::Vec3 position) const;
+
+    uint32_t GetBucketIndex(const Cell& cell) const;
+
+    /**
+     * \brief Call the function for each entity in the cells overlapping the bounds, each entity is visited once.
+     */
+    template<typename Function>
+    void ForEachInBounds(math::Vec3 min, math::Vec3 max, Function function) const;
+
+    float inverseCellSize_;
+
+    //Entities inserted since the last Clear, sorted by bucket after Build with their cells
+    std::vector<Entry> entries_;
+    std::vector<Cell> entryCells_;
+
+    //Entities of the bucket i are in entries_[bucketStarts_[i], bucketStarts_[i + 1][
+    std::vector<uint32_t> bucketStarts_;
+
+    //Buffers of Build, kept between the frames
+    std::vector<uint32_t> entryBuckets_;
+    std::vector<Entry> sortedEntries_;
+    std::vector<Cell> sortedEntryCells_;
+};
+} //namespace game
+} //namespace poke
@@ -55,6 +55,18 @@ public:
     void Begin(
         VkCommandBufferUsageFlags usage =
             VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
+
+    /**
+     * \brief Start to write inside a secondary command buffer executed inside a render pass
+     * \param inheritanceInfo render pass, subpass and framebuffer the buffer will be executed in
+     * \param usage by default the command buffer continue the render pass of the primary command buffer
+     */
+    void Begin(
+        const VkCommandBufferInheritanceInfo& inheritanceInfo,
+        VkCommandBufferUsageFlags usage =
+            VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT |
+            VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT);
+
     /**
      * \brief Close the command buffer, nothing can be written inside anymore
      */
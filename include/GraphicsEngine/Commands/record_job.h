@@ -0,0 +1,108 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2019-2020, POK Family. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of POK Family nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Author : Nicolas Schneider
+// Co-Author :
+// Date : 04.05.20
+//-----------------------------------------------------------------------------
+#pragma once
+
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+#include <GraphicsEngine/Pipelines/pipeline.h>
+#include <Math/vector.h>
+
+namespace poke {
+namespace graphics {
+/**
+ * \brief Maximum number of threads used to record secondary command buffers.
+ */
+const uint32_t kMaxRecordWorkers = 4;
+
+/**
+ * \brief Render pass and framebuffer the secondary command buffers of a render stage are recorded for.
+ */
+struct RecordJobTarget {
+    VkRenderPass renderPass = VK_NULL_HANDLE;
+    VkFramebuffer framebuffer = VK_NULL_HANDLE;
+    math::Vec2Int size;
+};
+
+/**
+ * \brief Everything needed to record one subrenderer into a secondary command buffer.
+ * \details Jobs are built on the render thread, recorded on a worker thread and executed by the
+ * primary command buffer in the order of their slot.
+ */
+struct RecordJob {
+    Pipeline::Stage stage;
+    int subrendererIndex = -1;
+
+    //Index of the secondary command buffer used for this frame, also the execution order.
+    uint32_t slot = 0;
+    //A slot is always recorded by the same worker, so its command buffer always comes from the same pool.
+    uint32_t workerIndex = 0;
+
+    VkCommandBufferInheritanceInfo inheritanceInfo{};
+    VkViewport viewport{};
+    VkRect2D scissor{};
+};
+
+/**
+ * \brief Number of record workers to use for a given hardware concurrency.
+ * \param hardwareConcurrency value returned by std::thread::hardware_concurrency()
+ * \return a value between 1 and kMaxRecordWorkers
+ */
+uint32_t ComputeRecordWorkerCount(uint32_t hardwareConcurrency);
+
+/**
+ * \brief Viewport used by every render stage, flipped on the y axis.
+ * \param size 
+ * \return 
+ */
+VkViewport ComputeViewport(const math::Vec2Int& size);
+
+VkRect2D ComputeScissor(const math::Vec2Int& size);
+
+/**
+ * \brief Fill the CPU side parameters of a record job. No vulkan call is made.
+ * \param stage 
+ * \param subrendererIndex 
+ * \param slot 
+ * \param workerCount 
+ * \param target 
+ * \return 
+ */
+RecordJob CreateRecordJob(
+    const Pipeline::Stage& stage,
+    int subrendererIndex,
+    uint32_t slot,
+    uint32_t workerCount,
+    const RecordJobTarget& target);
+} //namespace graphics
+} //namespace poke
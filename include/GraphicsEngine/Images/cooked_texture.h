@@ -0,0 +1,167 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2019-2020, POK Family. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of POK Family nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Author : Nicolas Schneider
+// Co-Author :
+// Date : 27.05.20
+//-----------------------------------------------------------------------------
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <GraphicsEngine/Images/texture_compressor.h>
+#include <Utility/mapped_file.h>
+
+namespace poke {
+namespace cooked_texture {
+const uint32_t kMagic = 0x58544B50; //"PKTX"
+const uint32_t kVersion = 1;
+
+/**
+ * \brief Levels are aligned on the size of a compressed block inside the file.
+ */
+const size_t kDataAlignment = 16;
+
+/**
+ * \brief Followed by a Mip for every level, then their texels stored one after the other.
+ */
+struct Header {
+	uint32_t magic;
+	uint32_t version;
+	uint64_t sourceHash; // XXH64 of the image file
+	uint64_t sourceSize;
+	uint32_t width;
+	uint32_t height;
+	uint32_t format; // texture_compressor::TextureFormat
+	uint32_t mipCount;
+};
+
+struct Mip {
+	uint32_t width;
+	uint32_t height;
+	uint64_t offset;
+	uint64_t size;
+};
+
+/**
+ * \brief Hash of the source file stored in the cooked texture to detect when it changed.
+ */
+uint64_t HashSource(const uint8_t* data, size_t size);
+} //namespace cooked_texture
+
+/**
+ * \brief Non owning view over a cooked texture.
+ */
+class CookedTextureView {
+public:
+	CookedTextureView() = default;
+
+	/**
+	 * \brief Check the header and the bounds of every level. The data must outlive the view.
+	 * \return True if the data is a valid cooked texture.
+	 */
+	bool SetData(const uint8_t* data, size_t size);
+
+	bool IsValid() const { return header_ != nullptr; }
+
+	/**
+	 * \brief Returns true if the texture has been cooked from a source with the given hash and size.
+	 */
+	bool IsUpToDate(uint64_t sourceHash, uint64_t sourceSize) const;
+
+	uint32_t GetWidth() const { return header_->width; }
+	uint32_t GetHeight() const { return header_->height; }
+
+	texture_compressor::TextureFormat GetFormat() const
+	{
+		return static_cast<texture_compressor::TextureFormat>(header_->format);
+	}
+
+	/**
+	 * \brief Levels stored, the full size image is the level 0.
+	 */
+	uint32_t GetMipCount() const { return header_->mipCount; }
+
+	const cooked_texture::Mip& GetMip(const size_t level) const { return mips_[level]; }
+
+	const uint8_t* GetMipData(const size_t level) const { return data_ + mips_[level].offset; }
+
+	/**
+	 * \brief Size of the first levels, they are contiguous and can be uploaded with a single copy from GetMipData(0).
+	 */
+	size_t GetMipsSize(size_t mipCount) const;
+
+private:
+	const uint8_t* data_ = nullptr;
+	const cooked_texture::Header* header_ = nullptr;
+	const cooked_texture::Mip* mips_ = nullptr;
+};
+
+/**
+ * \brief Cooked texture mapped from the disk.
+ */
+class CookedTextureFile {
+public:
+	CookedTextureFile() = default;
+
+	/**
+	 * \brief Map the .poktex at the given full path.
+	 * \return True if the file exists and is a valid cooked texture.
+	 */
+	bool Open(const std::string& filePath);
+
+	void Close();
+
+	bool IsOpen() const { return view_.IsValid(); }
+
+	const CookedTextureView& GetView() const { return view_; }
+
+private:
+	MappedFile file_;
+	CookedTextureView view_;
+};
+
+/**
+ * \brief Cook the decoded RGBA8 pixels of a source image with their mip chain.
+ * \details Opaque images are stored as BC1, the others as BC3. Images losing too much
+ * once compressed, like very sharp pixel art, keep RGBA8 levels.
+ */
+std::vector<uint8_t> CookTexture(
+	const uint8_t* pixels,
+	uint32_t width,
+	uint32_t height,
+	uint64_t sourceHash,
+	uint64_t sourceSize);
+
+/**
+ * \brief Write a cooked texture at the given full path.
+ * \return True if written, false otherwise.
+ */
+bool WriteCookedTexture(const std::vector<uint8_t>& bytes, const std::string& filePath);
+} //namespace poke
@@ -35,6 +35,7 @@
 #include <vector>
 
 #include <GraphicsEngine/Descriptors/interface_descriptor.h>
+#include <GraphicsEngine/Images/cooked_texture.h>
 
 #include <vulkan/vulkan.h>
 #include <utility/file_system.h>
@@ -52,6 +53,9 @@ struct LoadedImageInfos {
     uint32_t width = 0;
     uint32_t height = 0;
     uint32_t components = 0;
+
+    //Used instead of the pixels when open
+    CookedTextureFile cookedTexture;
 };
 
 /**
@@ -139,6 +143,14 @@ public:
         FileType fileType
 	);
 
+    /**
+     * \brief Decode pixels of an image file already in memory as RGBA8
+     * \param data 
+     * \param size 
+     * \return 
+     */
+    static LoadedImageInfos LoadPixelsFromMemory(const uint8_t* data, size_t size);
+
     static uint32_t GetMipLevels(VkExtent3D extent);
 
     static bool HasDepth(VkFormat format);
@@ -290,6 +302,19 @@ public:
         uint32_t layerCount,
         uint32_t baseArrayLayer);
 
+    /**
+     * \brief Copy a buffer containing every mip level of an image
+     * \param buffer 
+     * \param image 
+     * \param extent Extent of the level 0
+     * \param mipOffsets Offset of each level in the buffer
+     */
+    static void CopyBufferToImageMips(
+        const VkBuffer& buffer,
+        const VkImage& image,
+        VkExtent3D extent,
+        const std::vector<VkDeviceSize>& mipOffsets);
+
     /**
      * \brief Copy an image to a new image. It's mainly use for mipmap images
      * \param srcImage 
@@ -121,6 +121,19 @@ public:
      */
     void Load();
 
+    /**
+     * \brief Load the image using pixels already decoded, e.g. by a ResourceLoader.
+     * \param loadedImage
+     */
+    void Load(LoadedImageInfos&& loadedImage);
+
+    /**
+     * \brief Map the cooked texture when it is up to date, otherwise decode the image file and cook it.
+     * \param filename Full name of the texture with its extension.
+     * \return 
+     */
+    static LoadedImageInfos LoadData(const std::string& filename);
+
     const std::string& GetFilename() const { return filename_; }
 
     bool IsMipmap() const { return mipmap_; }
@@ -136,6 +149,11 @@ public:
 	bool IsAnisotropic() const { return anisotropic_; }
 
 private:
+    /**
+     * \brief Upload every level of the cooked texture, no mipmap is generated.
+     */
+    void LoadCooked();
+
     std::string filename_ = {};
 
     bool anisotropic_;
@@ -146,6 +164,7 @@ private:
     uint32_t height_ = 0;
     uint32_t mipLevels_ = 0;
     std::vector<char> tmpPixelsContainer_;
+    CookedTextureFile tmpCookedTexture_;
 };
 } //namespace graphics
 } //namespace poke
@@ -0,0 +1,101 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2019-2020, POK Family. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of POK Family nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Author : Nicolas Schneider
+// Co-Author :
+// Date : 27.05.20
+//-----------------------------------------------------------------------------
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace poke {
+namespace texture_compressor {
+/**
+ * \brief Layout of the texels of a cooked texture.
+ */
+enum class TextureFormat : uint32_t {
+	RGBA8 = 0,
+	BC1, // Opaque, 8 bytes per block
+	BC3 // With alpha, 16 bytes per block
+};
+
+/**
+ * \brief Width and height of a compressed block, in texels.
+ */
+const uint32_t kBlockDimension = 4;
+
+/**
+ * \brief Textures losing more than that once compressed are stored as RGBA8, in dB.
+ */
+const float kMinCompressedPsnr = 32.0f;
+
+/**
+ * \brief RGBA8 pixels of a mip level.
+ */
+struct MipLevel {
+	uint32_t width = 0;
+	uint32_t height = 0;
+	std::vector<uint8_t> pixels;
+};
+
+/**
+ * \brief Box filtered levels down to 1x1, the first one is a copy of the pixels.
+ * \details Same level count and sizes than the mipmaps blitted by Image::CreateMipmaps.
+ */
+std::vector<MipLevel> GenerateMipChain(const uint8_t* pixels, uint32_t width, uint32_t height);
+
+bool IsCompressed(TextureFormat format);
+
+/**
+ * \brief Size in bytes of a level of the given format.
+ */
+size_t GetLevelSize(TextureFormat format, uint32_t width, uint32_t height);
+
+/**
+ * \brief Returns true if any pixel is not fully opaque.
+ */
+bool HasAlpha(const uint8_t* pixels, size_t pixelCount);
+
+/**
+ * \brief Encode RGBA8 pixels, borders of the last blocks repeat the last row and column.
+ */
+std::vector<uint8_t> CompressLevel(const uint8_t* pixels, uint32_t width, uint32_t height, TextureFormat format);
+
+/**
+ * \brief Decode a level back to RGBA8 pixels.
+ */
+std::vector<uint8_t> DecompressLevel(const uint8_t* data, uint32_t width, uint32_t height, TextureFormat format);
+
+/**
+ * \brief Peak signal to noise ratio between two sets of 8 bits values, in dB. Identical values return infinity.
+ */
+float ComputePsnr(const uint8_t* values, const uint8_t* otherValues, size_t size);
+} //namespace texture_compressor
+} //namespace poke
@@ -114,32 +114,9 @@ public:
     template <typename T>
     void SetVertices(const std::vector<T>& vertices)
     {
-		vertexBuffer_.reset();
-		vertexCount_ = static_cast<uint32_t>(vertices.size());
-
-        if (vertices.empty())
-            return;
-		const auto vertexStaging = Buffer(
-			sizeof(T) * vertices.size(),
-			VK_BUFFER_USAGE_TRANSFER_SRC_BIT, 
-			VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, 
-			vertices.data());
-
-		vertexBuffer_.emplace(
-			vertexStaging.GetSize(), 
-			VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
-			VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
-
-		CommandBuffer commandBuffer;
-
-		VkBufferCopy copyRegion = {};
-		copyRegion.size = vertexStaging.GetSize();
-		vkCmdCopyBuffer(commandBuffer, vertexStaging.GetBuffer(), vertexBuffer_->GetBuffer(), 1, &copyRegion);
-
-		commandBuffer.SubmitIdle();
+		SetVertexData(vertices.data(), sizeof(T) * vertices.size(), static_cast<uint32_t>(vertices.size()));
     }
 
-
     std::vector<uint32_t> GetIndices(size_t offset) const;
 
     void SetIndices(const std::vector<uint32_t>& indices);
@@ -158,7 +135,7 @@ public:
      */
     float GetRadius() const { return radius_; }
 
-    static VkIndexType GetIndexType() { return VK_INDEX_TYPE_UINT32; }
+    VkIndexType GetIndexType() const { return indexType_; }
 
     math::Vec3 GetExtent() const;
 
@@ -180,9 +157,9 @@ public:
             std::numeric_limits<float>::max(),
             std::numeric_limits<float>::max());
         maxExtents_ = math::Vec3(
-            std::numeric_limits<float>::min(),
-            std::numeric_limits<float>::min(),
-            std::numeric_limits<float>::min());
+            std::numeric_limits<float>::lowest(),
+            std::numeric_limits<float>::lowest(),
+            std::numeric_limits<float>::lowest());
 
         for (const auto& vertex : vertices) {
             minExtents_ = math::Vec3(
@@ -205,7 +182,46 @@ public:
             maxExtents_.GetMagnitude());
     }
 
+    /**
+     * \brief Upload vertices and indices read in place, used by cooked meshes to skip the copies and the extents computation.
+     * \param indexType VK_INDEX_TYPE_UINT16 or VK_INDEX_TYPE_UINT32.
+     */
+    void Initialize(
+        const VertexMesh* vertices,
+        uint32_t vertexCount,
+        const void* indices,
+        uint32_t indexCount,
+        VkIndexType indexType,
+        const math::Vec3& minExtents,
+        const math::Vec3& maxExtents);
+
+    /**
+     * \brief Allocate a host visible vertex buffer written in place by UpdateVertices, the indexes don't change.
+     * \details Nothing is drawn before the first SetDrawRange.
+     * \param regionCount Number of copies of the vertices, a region drawn by a frame in flight is never written.
+     */
+    void InitializeDynamic(uint32_t vertexCapacity, const std::vector<uint32_t>& indices, uint32_t regionCount = 1);
+
+    /**
+     * \brief Switch to the next region of a dynamic mesh, written by the next UpdateVertices and drawn from then on.
+     */
+    void NextVertexRegion();
+
+    /**
+     * \brief Write a range of the current region of the vertex buffer of a dynamic mesh.
+     */
+    void UpdateVertices(const VertexMesh* vertices, uint32_t firstVertex, uint32_t vertexCount);
+
+    /**
+     * \brief Range of the indexes drawn by CmdRender, all the indexes by default.
+     */
+    void SetDrawRange(uint32_t firstIndex, uint32_t indexCount);
+
 private:
+    void SetVertexData(const void* vertices, size_t size, uint32_t vertexCount);
+
+    void SetIndexData(const void* indices, size_t size, uint32_t indexCount, VkIndexType indexType);
+
     std::experimental::optional<Buffer> vertexBuffer_;
     std::experimental::optional<Buffer> indexBuffer_;
 
@@ -217,7 +233,14 @@ private:
     math::Vec3 maxExtents_;
     uint32_t indexCount_ = 0;
 
+    uint32_t firstDrawnIndex_ = 0;
+    uint32_t drawnIndexCount_ = 0;
+
+    uint32_t vertexRegionCount_ = 1;
+    uint32_t vertexRegion_ = 0;
+
     float radius_ = 0;
+    VkIndexType indexType_ = VK_INDEX_TYPE_UINT32;
 };
 } //namespace graphics
 } //namespace poke
@@ -0,0 +1,80 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2019-2020, POK Family. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of POK Family nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Author : Nicolas Schneider
+// Co-Author :
+// Date : 25.05.20
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+
+#include <Math/vector.h>
+
+namespace poke {
+namespace graphics {
+/**
+ * \brief Maximum levels of detail of a mesh, the full detail one included.
+ */
+const size_t kMaxLodCount = 4;
+
+/**
+ * \brief Projected radius, relative to half the screen height, under which each level after the first one is used.
+ */
+const float kLodScreenSizes[kMaxLodCount - 1] = { 0.25f, 0.12f, 0.05f };
+
+/**
+ * \brief Radius of the sphere bounding a box, the extent is the full size of the box.
+ */
+inline float GetLodRadius(const math::Vec3& extent)
+{
+    return extent.GetMagnitude() * 0.5f;
+}
+
+/**
+ * \brief Pick a level of detail from the size of a bounding sphere on the screen.
+ * \param projectionScale Element [1][1] of the projection matrix, 1 / tan(fov / 2).
+ * \param lodCount Levels available for the mesh.
+ */
+inline size_t SelectLod(
+    const float radius,
+    const float distance,
+    const float projectionScale,
+    const size_t lodCount)
+{
+    if (lodCount <= 1 || distance <= radius) { return 0; }
+
+    const float screenSize = radius * std::abs(projectionScale) / distance;
+
+    size_t lod = 0;
+    while (lod + 1 < lodCount && lod + 1 < kMaxLodCount && screenSize < kLodScreenSizes[lod]) { lod++; }
+    return lod;
+}
+} //namespace graphics
+} //namespace poke
@@ -53,6 +53,16 @@ struct ForwardDrawCmd {
 using ModelInstanceIndex = size_t;
 using ModelForwardIndex = int;
 
+/**
+ * \brief Instanced draws of the last frame.
+ */
+struct ModelDrawStats {
+    size_t instanceCount = 0;
+    size_t triangleCount = 0;
+    //Triangles that would have been drawn without the levels of detail
+    size_t fullDetailTriangleCount = 0;
+};
+
 /**
  * \brief Drawing command buffer specific to draw models in the deferred pass
  */
@@ -75,6 +85,20 @@ public:
 
 	ModelInstanceIndex GetModelInstanceIndex(const Material& material, const Mesh& mesh);
 
+    /**
+     * \brief Get the instances of a level of detail of a mesh, keyed by material, mesh and level.
+     * \param material
+     * \param mesh Full detail mesh.
+     * \param lodMesh Mesh drawn for this level, the full detail mesh for the level 0.
+     * \param lod
+     * \return
+     */
+	ModelInstanceIndex GetModelInstanceIndex(
+        const Material& material,
+        const Mesh& mesh,
+        const Mesh& lodMesh,
+        size_t lod);
+
     /**
      * \brief Get an index to draw a object with forward rendering.
      * \return 
@@ -118,14 +142,24 @@ public:
 
     void PrepareData();
 
+    const ModelDrawStats& GetDrawStats() const { return drawStats_; }
+
 private:
     void OnUnloadScene();
 
     static const int kSizePerType = 200;
 
+    struct ModelInstanceKey {
+        const Material* material;
+        const Mesh* mesh;
+        size_t lod;
+    };
+
     //Data for gpu instancing
 	std::vector<std::vector<InstancingDrawCmd>> instancesMatrix_;
     std::vector<std::unique_ptr<ModelInstance>> modelInstances_;
+    std::vector<ModelInstanceKey> modelInstanceKeys_;
+    ModelDrawStats drawStats_;
 
     //Data for forward rendering
 	uint64_t nextFreeForwardIndex_ = 0;
@@ -0,0 +1,112 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2019-2020, POK Family. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of POK Family nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Author : Nicolas Schneider
+// Co-Author :
+// Date : 09.05.20
+//-----------------------------------------------------------------------------
+#pragma once
+
+#include <cstdint>
+
+#include <Math/vector.h>
+#include <Utility/color_gradient.h>
+
+namespace poke {
+namespace graphics {
+/**
+ * \brief Kernels used to simulate particles stored as structure of arrays.
+ * \details They use SSE when it is available and fall back on scalar loops otherwise.
+ * They don't touch anything but the given arrays so emitters can be simulated in parallel.
+ */
+namespace particle_kernels {
+/**
+ * \brief elapsedTime[i] += deltaTime
+ */
+void AgeParticles(float* elapsedTime, size_t count, float deltaTime);
+
+/**
+ * \brief Count the dead particles at the head of a ring buffer, they are retired by advancing the head.
+ * \details The particles must die in emission order, the elapsed times decrease from the head so the search is binary.
+ * \param first index of the head, the particles are [first, first + count) wrapping around capacity.
+ */
+size_t CountDeadParticlesInRing(
+    const float* elapsedTime,
+    const float* lifetime,
+    size_t first,
+    size_t count,
+    size_t capacity);
+
+struct ParticleMove {
+    uint32_t destination;
+    uint32_t source;
+};
+
+/**
+ * \brief Compute the moves that fill the dead particles with the alive ones from the end of the arrays.
+ * \details Linear and branchless, only min(dead, alive) particles have to be moved so bursts of deaths
+ * stay cheap. The order of the particles is not kept. moves must be able to contain count / 2 + 1 moves.
+ * \return the number of alive particles, they are in [0, aliveCount) once the moves are applied.
+ */
+size_t ComputeDeadParticlesMoves(
+    const float* elapsedTime,
+    const float* lifetime,
+    size_t count,
+    ParticleMove* moves,
+    size_t& movesCount);
+
+template<typename T>
+void ApplyParticlesMoves(T* values, const ParticleMove* moves, const size_t movesCount)
+{
+    for (size_t i = 0; i < movesCount; i++) { values[moves[i].destination] = values[moves[i].source]; }
+}
+
+/**
+ * \brief velocities[i].y += gravity
+ */
+void ApplyGravity(math::Vec3* velocities, size_t count, float gravity);
+
+/**
+ * \brief positions[i] += velocities[i] * deltaTime
+ */
+void IntegratePositions(math::Vec3* positions, const math::Vec3* velocities, size_t count, float deltaTime);
+
+/**
+ * \brief colors[i] = originalColors[i] * gradient.GetColorAt(elapsedTime[i] / lifetime[i]), transparencies[i] = colors[i].a
+ * \details The gradient lookup is done as a gather in its precomputed color table.
+ */
+void ComputeColorsOverLifetime(
+    const ColorGradient& gradient,
+    const float* elapsedTime,
+    const float* lifetime,
+    const Color* originalColors,
+    Color* colors,
+    float* transparencies,
+    size_t count);
+} //namespace particle_kernels
+} //namespace graphics
+} //namespace poke
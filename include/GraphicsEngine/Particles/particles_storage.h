@@ -0,0 +1,102 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2019-2020, POK Family. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of POK Family nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Author : Nicolas Schneider
+// Co-Author :
+// Date : 01.06.2020
+//-----------------------------------------------------------------------------
+#pragma once
+
+#include <vector>
+
+#include <GraphicsEngine/Particles/particle.h>
+
+namespace poke {
+namespace graphics {
+/**
+ * \brief Particles of one emitter stored as structure of arrays, simulated by the particle kernels.
+ */
+struct ParticlesStorage {
+	int nbParticles = 0;
+
+	//Emitters with a constant lifetime keep their particles in a ring buffer, they die in emission order
+	//so the dead ones are always at the head and no compaction is needed
+	bool isRingBuffer = false;
+	//Alive particles are [firstParticle, firstParticle + nbParticles), wrapping around in ring buffer mode
+	size_t firstParticle = 0;
+
+	//Set during emission, read by the simulation
+	bool isSimulated = false;
+	//Copied from the component when the emitter is added or its component updated, not every frame
+	float gravityModifier = 0.0f;
+	ColorGradient colorOverLifetime;
+
+	std::vector<uint32_t> numberOfRows;
+	std::vector<Color> originalColor;
+	std::vector<Color> colorOffset;
+
+	std::vector<math::Vec3> position;
+	std::vector<math::Vec3> velocity;
+
+	std::vector<math::Vec2> imageOffset1;
+	std::vector<math::Vec2> imageOffset2;
+
+	std::vector<float> lifetime;
+	std::vector<float> scale;
+
+	std::vector<float> elapsedTime;
+	std::vector<float> transparency;
+	std::vector<float> imageBlendFactor;
+
+	size_t GetCapacity() const { return numberOfRows.size(); }
+
+	/**
+	 * \brief Add a particle at the end, return false if there are already maxParticles.
+	 */
+	bool Emit(const Particle& particle, size_t maxParticles);
+
+	/**
+	 * \brief Switch between ring buffer and linear storage, the ring buffer is only entered when empty.
+	 */
+	void SetRingBuffer(bool ringBuffer);
+
+	/**
+	 * \brief Remove dead particles, compaction in linear mode and head advance in ring buffer mode.
+	 */
+	void RemoveDeadParticles();
+
+	void Resize(size_t size);
+
+	void Set(size_t index, const Particle& particle);
+
+	/**
+	 * \brief Move the particles so the first one is at index 0.
+	 */
+	void Linearize();
+};
+} //namespace graphics
+} //namespace poke
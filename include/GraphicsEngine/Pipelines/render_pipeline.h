@@ -80,6 +80,12 @@ public:
 
     virtual ~RenderPipeline() = default;
 
+    /**
+     * \brief Called once per frame on the render thread before any subrenderer is recorded.
+     * \details Used to prepare data shared between subrenderers, as OnRender can be called from any record worker.
+     */
+    virtual void OnPrepare() {}
+
     virtual void OnRender(const CommandBuffer& commandBuffer) = 0;
 
     const Pipeline::Stage& GetStage() const { return stage_; }
@@ -35,6 +35,7 @@
 #include <unordered_map>
 
 #include <GraphicsEngine/Pipelines/render_pipeline.h>
+#include <GraphicsEngine/Commands/record_job.h>
 
 namespace poke {
 namespace graphics {
@@ -110,6 +111,63 @@ public:
 		}
 	}
 
+	/**
+	 * \brief Prepare every enabled subrenderer before recording them.
+	 */
+	void Prepare()
+	{
+		for (const auto &[typeId, subrenderer] : subrenderers_) {
+			if (subrenderer && subrenderer->IsEnabled()) {
+				subrenderer->OnPrepare();
+			}
+		}
+	}
+
+	/**
+	 * \brief Append a record job for each enabled subrenderer of a stage, in the order they were added.
+	 * \param stage The Subrender stage.
+	 * \param target Render pass and framebuffer the jobs are recorded for.
+	 * \param workerCount Number of record workers.
+	 * \param jobs Output, the slot of a job is its position inside this vector.
+	 */
+	void BuildRecordJobs(
+		const Pipeline::Stage &stage,
+		const RecordJobTarget &target,
+		const uint32_t workerCount,
+		std::vector<RecordJob> &jobs) const
+	{
+		for (const auto &[stageIndex, typeId] : stages_) {
+			if (stageIndex.first != stage) {
+				continue;
+			}
+
+			const auto it = subrenderers_.find(typeId);
+			if (it == subrenderers_.end() || !it->second || !it->second->IsEnabled()) {
+				continue;
+			}
+
+			jobs.push_back(CreateRecordJob(
+				stage,
+				typeId,
+				static_cast<uint32_t>(jobs.size()),
+				workerCount,
+				target));
+		}
+	}
+
+	/**
+	 * \brief Record the subrenderer of a job. Can be called from any thread.
+	 * \param job 
+	 * \param commandBuffer The secondary command buffer to record render command into.
+	 */
+	void Record(const RecordJob &job, const CommandBuffer &commandBuffer) const
+	{
+		const auto it = subrenderers_.find(job.subrendererIndex);
+
+		cassert(it != subrenderers_.end() && it->second, "Error when trying to record subrenderer");
+
+		it->second->OnRender(commandBuffer);
+	}
 
 private:
 	using StageIndex = std::pair<Pipeline::Stage, std::size_t>;
@@ -50,6 +50,8 @@ public:
     explicit SubrendererOpaque(Pipeline::Stage stage);
 	~SubrendererOpaque();
 
+    void OnPrepare() override;
+
     void OnRender(const CommandBuffer& commandBuffer) override;
 
 	constexpr static int GetSubrendererIndex()
@@ -33,9 +33,11 @@
 
 #include <vector>
 #include <map>
+#include <mutex>
 #include <thread>
 
 #include <GraphicsEngine/interface_graphic_engine.h>
+#include <Utility/worker_thread.h>
 
 #include <vulkan/vulkan.h>
 #include <xxhash.h>
@@ -135,6 +137,8 @@ public:
 
     Renderer& GetRenderer() override;
 
+    void BuildRecordJobs(const Pipeline::Stage& stage, std::vector<RecordJob>& jobs) override;
+
 	//--------------- PIPELINE MATERIAL MANAGER --------------------------
     const PipelineMaterialManager& GetPipelineMaterialManager() const override;
 
@@ -196,8 +200,22 @@ private:
     std::unique_ptr<Swapchain> swapchain_;
 
 	std::map<std::thread::id, std::unique_ptr<CommandPool>> commandPools_;
+	std::mutex commandPoolsMutex_;
     std::vector<std::unique_ptr<CommandBuffer>> commandBuffers_;
 
+    struct SecondaryCommandBuffer {
+        std::unique_ptr<CommandBuffer> commandBuffer;
+        //Worker whose command pool allocated the command buffer
+        uint32_t workerIndex = 0;
+    };
+
+    //Secondary command buffers for each swapchain image, indexed by record job slot
+    std::vector<std::vector<SecondaryCommandBuffer>> secondaryCommandBuffers_;
+    std::vector<std::unique_ptr<WorkerThread>> recordWorkers_;
+    //Jobs of every render stage of the frame
+    std::vector<RecordJob> recordJobs_;
+    std::vector<VkCommandBuffer> secondaryHandles_;
+
     VkPipelineCache pipelineCache_{};
     std::vector<VkSemaphore> presentCompletesSemaphore_;
     std::vector<VkSemaphore> renderCompletesSemaphore_;
@@ -230,6 +248,23 @@ private:
 
     void EndRenderpass(const RenderStage& renderStage);
 
+    /**
+     * \brief Record the jobs of the current render stage in secondary command buffers using the record workers and wait for them.
+     * \param firstJob Index of the first job of the render stage, the following ones are from the same stage.
+     * \param imageIndex 
+     */
+    void RecordSecondaryCommandBuffers(size_t firstJob, size_t imageIndex);
+
+    void RecordSecondaryCommandBuffer(const RecordJob& job, size_t imageIndex);
+
+    /**
+     * \brief Execute the secondary command buffers of a subpass of the current render stage in the primary command buffer.
+     * \param firstJob Index of the first job of the render stage.
+     * \param subpass 
+     * \param imageIndex 
+     */
+    void ExecuteSecondaryCommandBuffers(size_t firstJob, uint32_t subpass, size_t imageIndex);
+
 	void RecreatePass(RenderStage& renderStage);
 
     void RecreateAttachmentsMap();
@@ -42,6 +42,7 @@
 #include <GraphicsEngine/Commands/command_pool.h>
 #include <GraphicsEngine/Renderpass/swapchain.h>
 #include <GraphicsEngine/Commands/command_buffer.h>
+#include <GraphicsEngine/Commands/record_job.h>
 #include <GraphicsEngine/Devices/physical_device.h>
 #include <GraphicsEngine/RenderStage/render_stage.h>
 #include <GraphicsEngine/Renderers/renderer.h>
@@ -156,6 +157,14 @@ public:
 	virtual void RegisterObserverUpdateSkybox(std::function<void(const ImageCube&)> observer) = 0;
 
 	virtual Renderer& GetRenderer() = 0;
+
+    /**
+	 * \brief Build the record jobs of every enabled subrenderer of a stage.
+	 * \details Only the CPU side parameters are computed, the jobs are recorded in secondary command buffers during Render.
+	 * \param stage 
+	 * \param jobs Output, jobs are appended in their execution order.
+	 */
+	virtual void BuildRecordJobs(const Pipeline::Stage& stage, std::vector<RecordJob>& jobs) = 0;
 };
 } // namespace graphics 
 } // namespace poke
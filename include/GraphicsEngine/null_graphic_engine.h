@@ -46,7 +46,7 @@ public:
     void RecreateCommandBuffers() override{}
     void SetRenderer(std::unique_ptr<Renderer>&& renderer) override
     {
-		renderer;
+		renderer_ = std::move(renderer);
     }
 
     const VkPipelineCache& GetPipelineCache() const override
@@ -191,9 +191,23 @@ public:
 
     Renderer& GetRenderer() override
     {
-		cassert(false, "Impossible to get renderer from a null GraphicEngine");
-		abort();
+		cassert(renderer_, "Impossible to get renderer from a null GraphicEngine without renderer");
+		return *renderer_;
+    }
+
+    void BuildRecordJobs(const Pipeline::Stage& stage, std::vector<RecordJob>& jobs) override
+    {
+		if (!renderer_) { return; }
+
+		//No render pass nor framebuffer, only the CPU side of the jobs is built
+		renderer_->GetRendererContainer().BuildRecordJobs(
+			stage,
+			RecordJobTarget{},
+			ComputeRecordWorkerCount(std::thread::hardware_concurrency()),
+			jobs);
     }
+private:
+	std::unique_ptr<Renderer> renderer_;
 };
 } //namespace graphics
 } //namespace poke
@@ -31,11 +31,17 @@
 //----------------------------------------------------------------------------------
 #pragma once
 
+#include <memory>
 #include <vector>
-#include <Math/vector.h>
+
+#include <Math/spline_path.h>
 
 namespace poke {
 namespace math {
+/**
+ * \brief Catmull-Rom spline referencing a shared SplinePath, copying it doesn't copy the points.
+ * The path is released when the spline is destroyed or its points are changed.
+ */
 class CubicHermiteSpline {
 public:
 	CubicHermiteSpline(const std::vector<Vec3>& points = {});
@@ -48,11 +54,14 @@ public:
 
     Vec3 Lerp(int pointIndex, double percent) const;
 
+    /**
+     * \brief Arc length of the segment starting at the point.
+     */
     float GetSegmentLength(int pointIndex) const;
 
 	float GetTotalLength() const;
 
-    std::vector<Vec3> GetPoints() const;
+    const std::vector<Vec3>& GetPoints() const;
 
     void SetPoint(Vec3 point, uint8_t pos);
     void SetPoints(const std::vector<Vec3>& points);
@@ -61,13 +70,13 @@ public:
 
     int GetMaxSize() const;
 
-private:
-    double GetPortionOfDistance(double t, Vec3 p0, Vec3 p1) const;
+    SplineID GetID() const;
 
-	unsigned short front_ = 0;
+    const SplinePath& GetPath() const { return *path_; }
+
+private:
 	inline static const int maxSize = 256;
-	std::array<Vec3, maxSize> points_;
-	float totalLength_;
+	std::shared_ptr<const SplinePath> path_;
 };
 } //namespace math
-} //namespace poke
\ No newline at end of file
+} //namespace poke
@@ -67,6 +67,11 @@ public:
     static Quaternion RotateAroundAxis(Vec3 rhs, float rot);
     Vec3 GetEulerAngles() const;
 
+    /**
+     * \brief Inverse of GetEulerAngles, the rotations are around x, then y, then z (in rads).
+     */
+    static Quaternion FromEulerAngles(Vec3 eulerAngles);
+
 	static Quaternion FromEulerRad(const Vec3 euler);
 
     static Quaternion FromToRotation(Vec3 fromDirection, Vec3 toDirection);
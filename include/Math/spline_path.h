@@ -0,0 +1,155 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2019-2020, POK Family. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of POK Family nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Author : Nicolas Schneider
+// Co-Author :
+// Date : 09.05.2020
+//-----------------------------------------------------------------------------
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <Math/vector.h>
+
+namespace poke {
+namespace math {
+using SplineID = uint32_t;
+
+/**
+ * \brief Point of a spline, the percentage is the parameter of the curve in the segment.
+ */
+struct SplineLocation {
+    int segment = 0;
+    float percentage = 0.0f;
+};
+
+/**
+ * \brief Baked Catmull-Rom spline, the segments are cubic polynomials with an arc length table.
+ * \details The segment i goes from the point i + 1 to the point i + 2, the first and last points are only tangents.
+ */
+class SplinePath {
+public:
+    SplinePath(SplineID id, const std::vector<Vec3>& points);
+
+    SplineID GetID() const { return id_; }
+
+    const std::vector<Vec3>& GetPoints() const { return points_; }
+
+    int GetSegmentCount() const { return static_cast<int>(segments_.size()); }
+
+    float GetLength() const { return segmentStarts_.back(); }
+
+    float GetSegmentLength(int segment) const;
+
+    /**
+     * \brief Distance along the spline at the beginning of the segment.
+     */
+    float GetSegmentStart(int segment) const;
+
+    /**
+     * \brief Find the segment and the percentage at a distance along the spline, clamped to the spline.
+     */
+    SplineLocation Locate(float distance) const;
+
+    /**
+     * \brief Distance along the spline of a location.
+     */
+    float GetDistance(SplineLocation location) const;
+
+    Vec3 Evaluate(int segment, float percentage) const;
+
+    Vec3 Evaluate(const SplineLocation location) const { return Evaluate(location.segment, location.percentage); }
+
+    /**
+     * \brief Evaluate the positions at distances along the spline in one go.
+     */
+    void Evaluate(const float* distances, Vec3* positions, size_t count) const;
+
+    inline static const int kSamplesPerSegment = 32;
+
+private:
+    //Coefficients of the polynomial a + b * t + c * t^2 + d * t^3
+    struct Segment {
+        Vec3 a;
+        Vec3 b;
+        Vec3 c;
+        Vec3 d;
+    };
+
+    SplineID id_;
+    std::vector<Vec3> points_;
+    std::vector<Segment> segments_;
+    //Start of each segment and the total length at the end
+    std::vector<float> segmentStarts_;
+    //kSamplesPerSegment + 1 lengths from the start of each segment
+    std::vector<float> arcLengths_;
+};
+
+/**
+ * \brief Splines shared by every component using them, the same points are stored once.
+ * \details The splines are reference counted, a spline is removed when the last component using it is destroyed or edited.
+ */
+class SplineRegistry {
+public:
+    static SplineRegistry& Get();
+
+    /**
+     * \brief Get the spline with these points, it is baked the first time.
+     */
+    std::shared_ptr<const SplinePath> Register(const std::vector<Vec3>& points);
+
+    /**
+     * \brief Returns nullptr if the spline isn't used anymore.
+     */
+    std::shared_ptr<const SplinePath> GetSpline(SplineID id) const;
+
+    const std::shared_ptr<const SplinePath>& GetEmptySpline() const { return emptySpline_; }
+
+    /**
+     * \brief Number of splines used, the empty spline included.
+     */
+    size_t GetSplineCount() const;
+
+private:
+    SplineRegistry();
+
+    /**
+     * \brief Called when the last reference to the spline is released.
+     */
+    void Unregister(const SplinePath* path);
+
+    mutable std::mutex mutex_;
+    std::shared_ptr<const SplinePath> emptySpline_;
+    std::unordered_map<SplineID, std::weak_ptr<const SplinePath>> splines_;
+    std::unordered_multimap<uint64_t, SplineID> splineIDs_;
+    SplineID nextID_ = 1;
+};
+} //namespace math
+} //namespace poke
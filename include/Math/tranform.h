@@ -33,6 +33,7 @@
 
 #include <Math/vector.h>
 #include <Math/matrix.h>
+#include <Math/quaternion.h>
 
 namespace poke {
 namespace math {
@@ -61,10 +62,20 @@ public:
 
 	void SetLocalPosition(Vec3 value);
 
+	/**
+	 * \brief Euler angles (in rads) of the local orientation, the view used by the editor and the json.
+	 */
 	Vec3 GetLocalRotation() const;
 
 	void SetLocalRotation(Vec3 value);
 
+	Quaternion GetLocalOrientation() const;
+
+	/**
+	 * \brief Set the local orientation, the quaternion must be normalized.
+	 */
+	void SetLocalOrientation(Quaternion value);
+
 	Vec3 GetLocalScale() const;
 
 	void SetLocalScale(Vec3 value);
@@ -79,6 +90,11 @@ public:
 	 */
 	void SetFromJson(const json& transformJson);
 
+	/**
+	 * \brief Get the local to parent matrix, translation * rotation * scale.
+	 */
+	Matrix4 GetLocalMatrix() const;
+
 	/**
 	 * \brief This function should only be used when the transform has no parent and its localSpace is equal to its worldSpace
 	 * \return
@@ -87,7 +103,7 @@ public:
 private:
 
 	Vec3 localPosition_;
-	Vec3 localRotation_;
+	Quaternion localRotation_;
 	Vec3 localScale_;
 };
 }
@@ -0,0 +1,156 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2019-2020, POK Family. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of POK Family nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Author : Nicolas Schneider
+// Co-Author :
+// Date : 08.05.20
+//-----------------------------------------------------------------------------
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace poke
+{
+namespace memory
+{
+/**
+ * \brief Linear allocator for data that only lives during one frame.
+ * \details Allocating only moves an offset in a preallocated buffer, nothing is freed until Reset is called at the end of
+ * the frame. When the buffer is full the allocation falls back on the heap, the buffer is then grown to the peak usage
+ * at the next reset so the following frames stay allocation free.
+ * Each thread owns its own arena, accessible through FrameArena::Get().
+ */
+class FrameArena
+{
+public:
+	struct Stats {
+		//Bytes currently allocated
+		size_t usedSize = 0;
+		//Highest usage since the last reset
+		size_t peakSize = 0;
+		//Highest usage since the creation of the arena
+		size_t highWaterMark = 0;
+		//Number of allocations that didn't fit in the buffer since the creation of the arena
+		size_t overflowCount = 0;
+		size_t capacity = 0;
+	};
+
+	explicit FrameArena(size_t capacity = kDefaultCapacity);
+
+	~FrameArena();
+
+	FrameArena(const FrameArena&) = delete;
+	FrameArena& operator=(const FrameArena&) = delete;
+
+	/**
+	 * \brief Arena of the calling thread, it is created the first time the thread use it.
+	 */
+	static FrameArena& Get();
+
+	/**
+	 * \brief Reset the arenas of every thread.
+	 * \warning Must only be called when no thread is using its arena, at the end of the frame.
+	 */
+	static void ResetAll();
+
+	/**
+	 * \brief Highest usage reached by one arena during the last frame.
+	 */
+	static size_t GetLastFramePeakSize();
+
+	void* Allocate(size_t size, size_t alignment);
+
+	/**
+	 * \brief Memory is only given back if it is the last allocation, otherwise it stays used until the next reset.
+	 */
+	void Deallocate(void* ptr, size_t size);
+
+	/**
+	 * \brief Free every allocation made since the last reset.
+	 */
+	void Reset();
+
+	const Stats& GetStats() const { return stats_; }
+private:
+	static const size_t kDefaultCapacity = 1 << 20;
+
+	std::unique_ptr<uint8_t[]> buffer_;
+	size_t capacity_;
+	size_t offset_ = 0;
+
+	std::vector<std::unique_ptr<uint8_t[]>> overflowBlocks_;
+	size_t overflowSize_ = 0;
+
+	Stats stats_;
+};
+
+/**
+ * \brief STL allocator using a FrameArena, the default one use the arena of the calling thread.
+ * \warning Containers using it must not outlive the frame.
+ */
+template<typename T>
+class FrameAllocator
+{
+public:
+	using value_type = T;
+
+	FrameAllocator() noexcept : arena_(&FrameArena::Get()) {}
+
+	explicit FrameAllocator(FrameArena& arena) noexcept : arena_(&arena) {}
+
+	template<typename U>
+	FrameAllocator(const FrameAllocator<U>& other) noexcept : arena_(other.GetArena()) {}
+
+	T* allocate(const size_t count)
+	{
+		return static_cast<T*>(arena_->Allocate(count * sizeof(T), alignof(T)));
+	}
+
+	void deallocate(T* ptr, const size_t count) noexcept
+	{
+		arena_->Deallocate(ptr, count * sizeof(T));
+	}
+
+	FrameArena* GetArena() const noexcept { return arena_; }
+
+	template<typename U>
+	bool operator==(const FrameAllocator<U>& other) const noexcept { return arena_ == other.GetArena(); }
+
+	template<typename U>
+	bool operator!=(const FrameAllocator<U>& other) const noexcept { return arena_ != other.GetArena(); }
+private:
+	FrameArena* arena_;
+};
+
+template<typename T>
+using FrameVector = std::vector<T, FrameAllocator<T>>;
+} //namespace memory
+using namespace memory;
+} //namespace poke
@@ -0,0 +1,122 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2019-2020, POK Family. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of POK Family nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Author : Nicolas Schneider
+// Co-Author :
+// Date : 07.05.20
+//-----------------------------------------------------------------------------
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace poke
+{
+namespace memory
+{
+/**
+ * \brief Lock-free triple buffer used to hand frame data from the update thread to the render thread.
+ * \details The producer always owns the write buffer and the consumer always owns the read buffer, the third one
+ * is the last published frame. Publish and Fetch only exchange indexes, the data is never copied.
+ * A buffer given back to the producer still contains the data of an old frame, it must be cleared before being filled.
+ * \tparam T type of the frame data
+ */
+template<typename T>
+class TripleBuffer
+{
+public:
+	TripleBuffer() = default;
+
+	explicit TripleBuffer(const T& initialValue)
+		: buffers_{ initialValue, initialValue, initialValue } {}
+
+	~TripleBuffer() = default;
+
+	TripleBuffer(const TripleBuffer&) = delete;
+	TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+	/**
+	 * \brief Buffer filled by the producer thread.
+	 */
+	T& GetWriteBuffer() { return buffers_[writeIndex_]; }
+	const T& GetWriteBuffer() const { return buffers_[writeIndex_]; }
+
+	/**
+	 * \brief Buffer used by the consumer thread, it stays the same until the next successful Fetch.
+	 */
+	T& GetReadBuffer() { return buffers_[readIndex_]; }
+	const T& GetReadBuffer() const { return buffers_[readIndex_]; }
+
+	/**
+	 * \brief Called by the producer when its frame is complete. The write buffer is exchanged with the middle one.
+	 */
+	void Publish()
+	{
+		const uint8_t previous = state_.exchange(
+			static_cast<uint8_t>(writeIndex_ | kNewDataBit),
+			std::memory_order_acq_rel);
+		writeIndex_ = previous & kIndexMask;
+	}
+
+	/**
+	 * \brief Called by the consumer to get the last published frame.
+	 * \return false if nothing has been published since the last fetch, the read buffer stays the same.
+	 */
+	bool Fetch()
+	{
+		if ((state_.load(std::memory_order_relaxed) & kNewDataBit) == 0) { return false; }
+
+		const uint8_t previous = state_.exchange(readIndex_, std::memory_order_acq_rel);
+		readIndex_ = previous & kIndexMask;
+		return true;
+	}
+
+	/**
+	 * \brief Apply a function on the three buffers.
+	 * \warning Not thread safe, must only be called when neither the producer nor the consumer is running (e.g. scene unload).
+	 */
+	template<typename Function>
+	void ForEach(Function function)
+	{
+		for (auto& buffer : buffers_) { function(buffer); }
+	}
+private:
+	static const uint8_t kIndexMask = 0x3;
+	static const uint8_t kNewDataBit = 0x4;
+
+	std::array<T, 3> buffers_;
+
+	uint8_t writeIndex_ = 0;
+	uint8_t readIndex_ = 1;
+
+	//Index of the middle buffer and a flag set when it contains a frame not read yet
+	std::atomic<uint8_t> state_{ 2 };
+};
+} //namespace memory
+using namespace memory;
+} //namespace poke
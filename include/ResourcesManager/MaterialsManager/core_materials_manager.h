@@ -37,6 +37,8 @@
 #include <ResourcesManager/MaterialsManager/material_diffuse.h>
 #include <ResourcesManager/MaterialsManager/material_trail.h>
 #include <ResourcesManager/MaterialsManager/material_particle.h>
+#include <ResourcesManager/resource_index.h>
+#include <ResourcesManager/resource_loader.h>
 
 namespace poke {
 class CoreMaterialsManager : public IMaterialsManager {
@@ -49,6 +51,9 @@ public:
     graphics::Material& GetMaterial(const std::string& materialName) override;
     graphics::Material& GetMaterial(ResourceID resourceID) override;
 
+    ResourceHandle GetMaterialHandle(ResourceID resourceID) const override;
+    graphics::Material& GetMaterialByHandle(ResourceHandle handle) override;
+
     void Clear() override;
 
     void Resize(size_t newSize) override;
@@ -61,7 +66,54 @@ public:
 
     json ToJson() override;
 
+    /**
+     * \brief Read the materials and decode their textures on the loader's workers.
+     * \param resourceLoader
+     */
+    void SetResourceLoader(ResourceLoader& resourceLoader);
+
+    /**
+     * \brief Set again a material already loaded from its json, it keeps its ResourceID. Its type can't change.
+     * \param materialName
+     * \param materialJson
+     */
+    void ReloadMaterial(const std::string& materialName, const json& materialJson);
+
+    /**
+     * \brief Make the materials using a texture 2D use another one, used when the texture is reloaded.
+     * \param oldTexture
+     * \param newTexture
+     */
+    void ReplaceTexture2D(const graphics::Image2d& oldTexture, const graphics::Image2d& newTexture);
+
 protected:
+    /**
+     * \brief Start reading the materials and decoding their textures 2D, AddMaterial waits for them.
+     * \param materialsJson
+     */
+    void PreloadMaterials(const json& materialsJson);
+
+    /**
+     * \brief Index the last material added to the list of its type.
+     * \param materialType
+     * \param materialIDs
+     */
+    void IndexLastMaterial(
+        graphics::MaterialType materialType,
+        const std::vector<ResourceID>& materialIDs);
+
+    /**
+     * \brief Index again every material stored.
+     */
+    void RebuildIndex();
+
+    //The handles store the material type and the position in the list of this type
+    ResourceIndex materialIndex_;
+
+    ResourceLoader* resourceLoader_ = nullptr;
+    std::vector<std::pair<ResourceID, Future<json>>> pendingMaterials_;
+
+
     std::vector<ResourceID> skyboxMaterialIDs_;
     std::vector<MaterialSkybox> skyboxMaterials_;
 
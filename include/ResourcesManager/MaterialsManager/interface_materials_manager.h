@@ -62,6 +62,19 @@ public:
 	 */
     virtual graphics::Material& GetMaterial(ResourceID resourceID) = 0;
 
+	/**
+	 * \brief Get the handle of a material, it can be cached to skip the lookup.
+	 * \param resourceID It's the id of the name of the file.
+	 * \return kInvalidResourceHandle if the material doesn't exist
+	 */
+	virtual ResourceHandle GetMaterialHandle(ResourceID resourceID) const = 0;
+
+	/**
+	 * \brief Get a material by the handle returned from GetMaterialHandle.
+	 * \param handle
+	 */
+	virtual graphics::Material& GetMaterialByHandle(ResourceHandle handle) = 0;
+
     /**
 	 * \brief Get default material's id.
 	 * \return 
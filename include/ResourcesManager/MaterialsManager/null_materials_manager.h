@@ -42,6 +42,8 @@ public:
 
     graphics::Material& GetMaterial(const std::string& materialName) override;
     graphics::Material& GetMaterial(ResourceID resourceID) override;
+    ResourceHandle GetMaterialHandle(ResourceID resourceID) const override;
+    graphics::Material& GetMaterialByHandle(ResourceHandle handle) override;
 
     void Clear() override {}
 
@@ -0,0 +1,169 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2019-2020, POK Family. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of POK Family nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Author : Nicolas Schneider
+// Co-Author :
+// Date : 23.05.20
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <GraphicsEngine/vertex_mesh.h>
+#include <Math/vector.h>
+#include <ResourcesManager/MeshManagers/mesh_optimizer.h>
+#include <Utility/mapped_file.h>
+
+namespace poke {
+namespace cooked_mesh {
+const uint32_t kMagic = 0x534D4B50; //"PKMS"
+//Version 4: the max extents of the meshes below 0 were wrong
+const uint32_t kVersion = 4;
+
+/**
+ * \brief Vertices and indices are aligned on this size inside the file.
+ */
+const size_t kDataAlignment = 8;
+
+/**
+ * \brief Followed by a Lod for every level of detail, then their vertices and indices read in place.
+ */
+struct Header {
+	uint32_t magic;
+	uint32_t version;
+	uint64_t sourceHash; // XXH64 of the .obj content
+	uint64_t sourceSize;
+	uint32_t lodCount; // Full detail mesh included
+	math::Vec3 minExtents;
+	math::Vec3 maxExtents;
+};
+
+struct Lod {
+	uint32_t vertexCount;
+	uint32_t indexCount;
+	uint32_t indexSize; // 2 or 4 bytes
+	uint32_t vertexOffset;
+	uint32_t indexOffset;
+};
+
+/**
+ * \brief Hash of the source file stored in the cooked mesh to detect when it changed.
+ */
+uint64_t HashSource(const uint8_t* data, size_t size);
+} //namespace cooked_mesh
+
+/**
+ * \brief Non owning view over a cooked mesh.
+ */
+class CookedMeshView {
+public:
+	CookedMeshView() = default;
+
+	/**
+	 * \brief Check the header and the bounds of the vertices and indices. The data must outlive the view.
+	 * \return True if the data is a valid cooked mesh.
+	 */
+	bool SetData(const uint8_t* data, size_t size);
+
+	bool IsValid() const { return header_ != nullptr; }
+
+	/**
+	 * \brief Returns true if the mesh has been cooked from a source with the given hash and size.
+	 */
+	bool IsUpToDate(uint64_t sourceHash, uint64_t sourceSize) const;
+
+	/**
+	 * \brief Levels of detail stored, the full detail mesh is the level 0.
+	 */
+	size_t GetLodCount() const { return header_->lodCount; }
+
+	uint32_t GetVertexCount(const size_t lod = 0) const { return lods_[lod].vertexCount; }
+	uint32_t GetIndexCount(const size_t lod = 0) const { return lods_[lod].indexCount; }
+	uint32_t GetIndexSize(const size_t lod = 0) const { return lods_[lod].indexSize; }
+
+	const graphics::VertexMesh* GetVertices(size_t lod = 0) const;
+	const void* GetIndices(size_t lod = 0) const;
+
+	/**
+	 * \brief Copy the indices as 32 bits, whatever their size in the file.
+	 */
+	std::vector<uint32_t> GetIndicesUint32(size_t lod = 0) const;
+
+	const math::Vec3& GetMinExtents() const { return header_->minExtents; }
+	const math::Vec3& GetMaxExtents() const { return header_->maxExtents; }
+
+private:
+	const uint8_t* data_ = nullptr;
+	const cooked_mesh::Header* header_ = nullptr;
+	const cooked_mesh::Lod* lods_ = nullptr;
+};
+
+/**
+ * \brief Cooked mesh mapped from the disk.
+ */
+class CookedMeshFile {
+public:
+	CookedMeshFile() = default;
+
+	/**
+	 * \brief Map the .pokmesh at the given full path.
+	 * \return True if the file exists and is a valid cooked mesh.
+	 */
+	bool Open(const std::string& filePath);
+
+	void Close();
+
+	bool IsOpen() const { return view_.IsValid(); }
+
+	const CookedMeshView& GetView() const { return view_; }
+
+private:
+	MappedFile file_;
+	CookedMeshView view_;
+};
+
+/**
+ * \brief Cook vertices and indices parsed from a source file.
+ * \details Indices are stored on 16 bits when the vertices of their level allow it.
+ * \param lods Simplified levels after the full detail mesh.
+ */
+std::vector<uint8_t> CookMesh(
+	const std::vector<graphics::VertexMesh>& vertices,
+	const std::vector<uint32_t>& indices,
+	uint64_t sourceHash,
+	uint64_t sourceSize,
+	const std::vector<MeshLodData>& lods = {});
+
+/**
+ * \brief Write a cooked mesh at the given full path.
+ * \return True if written, false otherwise.
+ */
+bool WriteCookedMesh(const std::vector<uint8_t>& bytes, const std::string& filePath);
+} //namespace poke
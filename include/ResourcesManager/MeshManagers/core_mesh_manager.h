@@ -42,6 +42,8 @@
 #include <ResourcesManager/MeshManagers/mesh_line_gizmo.h>
 #include <ResourcesManager/MeshManagers/mesh_box_gizmo.h>
 #include <ResourcesManager/MeshManagers/mesh_sphere_gizmo.h>
+#include <ResourcesManager/resource_index.h>
+#include <ResourcesManager/resource_loader.h>
 #include <json.hpp>
 
 namespace poke {
@@ -59,6 +61,15 @@ enum class MeshPrimitive : uint8_t {
     LENGTH
 };
 
+/**
+ * \brief Vector storing a mesh referenced by a ResourceHandle.
+ */
+enum class MeshStorage : uint8_t {
+    OBJ = 0,
+    DYNAMIC,
+    PRIMITIVE
+};
+
 /**
  * \brief Store all created mesh
  */
@@ -73,11 +84,17 @@ public:
 
 	void AddMesh(const std::string& name) override;
 
-    DynamicMeshIndex CreateDynamicMesh() override;
+    DynamicMeshIndex CreateDynamicMesh(uint32_t vertexCapacity, const std::vector<uint32_t>& indexes) override;
 
     ResourceID GetDynamicMeshResourceID(DynamicMeshIndex dynamicMeshIndex) override;
 
-    void UpdateDynamicMesh(DynamicMeshIndex dynamicMeshIndex, const std::vector<graphics::VertexMesh>& vertices, const std::vector<uint32_t>& indexes) override;
+    void UpdateDynamicMesh(
+        DynamicMeshIndex dynamicMeshIndex,
+        const std::vector<graphics::VertexMesh>& vertices,
+        uint32_t firstVertex,
+        uint32_t vertexCount,
+        uint32_t firstIndex,
+        uint32_t indexCount) override;
 
     void DestroyDynamicMesh(DynamicMeshIndex dynamicMeshIndex) override;
 
@@ -85,6 +102,14 @@ public:
 
     graphics::Mesh& GetMesh(ResourceID resourceID) override;
 
+    ResourceHandle GetMeshHandle(ResourceID resourceID) const override;
+
+    graphics::Mesh& GetMeshByHandle(ResourceHandle handle) override;
+
+    size_t GetMeshLodCount(ResourceHandle handle) const override;
+
+    graphics::Mesh& GetMeshLodByHandle(ResourceHandle handle, size_t lod) override;
+
     graphics::Mesh& GetSphere() override;
 
     graphics::Mesh& GetCube() override;
@@ -120,11 +145,50 @@ public:
     void SetFromJson(const json& meshesJson) override;
 
     json ToJson() override;
+
+    /**
+     * \brief Parse the meshes on the loader's workers, without loader the meshes are parsed on the main thread.
+     * \param resourceLoader
+     */
+    void SetResourceLoader(ResourceLoader& resourceLoader);
+
+    /**
+     * \brief Upload again an obj mesh already loaded, it keeps its ResourceID and its levels keep their address.
+     * The graphics device must be idle.
+     * \param name
+     * \param meshData returned by MeshObj::LoadData
+     */
+    void ReloadMesh(const std::string& name, const MeshObjData& meshData);
 protected:
+    /**
+     * \brief Start parsing the meshes, AddMesh waits for the parsed data and uploads it.
+     * \param meshesJson
+     */
+    void PreloadMeshes(const json& meshesJson);
+
+    bool HasObjMesh(ResourceID resourceID) const;
+
+    std::vector<std::pair<ResourceID, Future<MeshObjData>>>::iterator FindPendingMesh(ResourceID resourceID);
+
+    /**
+     * \brief Index again the primitives and every mesh stored.
+     */
+    void RebuildIndex();
+
+    graphics::Mesh& GetPrimitive(MeshPrimitive meshPrimitive);
+
+    ResourceIndex meshIndex_;
+
+    ResourceLoader* resourceLoader_ = nullptr;
+    std::vector<std::pair<ResourceID, Future<MeshObjData>>> pendingMeshes_;
+
 	std::vector<XXH64_hash_t> meshIDs_;
     std::vector<graphics::Mesh> meshes_;
+    //Levels after the full detail mesh, for every obj mesh
+    std::vector<std::vector<graphics::Mesh>> meshLods_;
 
-	std::vector<graphics::Mesh> dynamicMeshes_;
+	//The meshes aren't moved when the vector grows, their buffers stay valid
+	std::vector<std::unique_ptr<graphics::Mesh>> dynamicMeshes_;
 	std::vector<XXH64_hash_t> dynamicMeshIDs_;
 
 	DynamicMeshIndex nextFreeDynamicMesh_ = 0;
@@ -55,17 +55,25 @@ public:
 	 */
     virtual void AddMesh(const std::string& name) = 0;
 
-	virtual DynamicMeshIndex CreateDynamicMesh() = 0;
+    /**
+     * \brief Create a mesh with a persistent vertex buffer and static indexes, updated with UpdateDynamicMesh.
+     */
+	virtual DynamicMeshIndex CreateDynamicMesh(uint32_t vertexCapacity, const std::vector<uint32_t>& indexes) = 0;
 
 	virtual ResourceID GetDynamicMeshResourceID(DynamicMeshIndex dynamicMeshIndex) = 0;
 
     /**
-     * \brief 
-     * \param dynamicMeshIndex 
-     * \param vertices 
-     * \param indexes 
+     * \brief Upload a range of vertices and set the range of indexes drawn.
+     * \param vertices : all the vertices of the mesh, only the range is read.
+     * \param firstVertex : the vertex range wraps around to the first vertex.
      */
-    virtual void UpdateDynamicMesh(DynamicMeshIndex dynamicMeshIndex, const std::vector<graphics::VertexMesh>& vertices, const std::vector<uint32_t>& indexes) = 0;
+    virtual void UpdateDynamicMesh(
+        DynamicMeshIndex dynamicMeshIndex,
+        const std::vector<graphics::VertexMesh>& vertices,
+        uint32_t firstVertex,
+        uint32_t vertexCount,
+        uint32_t firstIndex,
+        uint32_t indexCount) = 0;
 
 	virtual void DestroyDynamicMesh(DynamicMeshIndex dynamicMeshIndex) = 0;
 
@@ -84,6 +92,35 @@ public:
      */
     virtual graphics::Mesh& GetMesh(ResourceID resourceID) = 0;
 
+    /**
+     * \brief Get the handle of a mesh, it can be cached to skip the lookup.
+     * \param resourceID
+     * \return kInvalidResourceHandle if the mesh doesn't exist
+     */
+    virtual ResourceHandle GetMeshHandle(ResourceID resourceID) const = 0;
+
+    /**
+     * \brief Get a mesh by the handle returned from GetMeshHandle.
+     * \param handle
+     * \return
+     */
+    virtual graphics::Mesh& GetMeshByHandle(ResourceHandle handle) = 0;
+
+    /**
+     * \brief Get the number of levels of detail of a mesh, the full detail mesh included.
+     * \param handle
+     * \return
+     */
+    virtual size_t GetMeshLodCount(ResourceHandle handle) const = 0;
+
+    /**
+     * \brief Get a level of detail of a mesh, the level 0 is the mesh itself.
+     * \param handle
+     * \param lod Must be lower than GetMeshLodCount.
+     * \return
+     */
+    virtual graphics::Mesh& GetMeshLodByHandle(ResourceHandle handle, size_t lod) = 0;
+
     /**
 	 * \brief Get the sphere's primitive.
 	 * \return 
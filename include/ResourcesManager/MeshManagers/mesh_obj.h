@@ -32,8 +32,27 @@
 #pragma once
 
 #include <GraphicsEngine/Models/mesh.h>
+#include <ResourcesManager/MeshManagers/cooked_mesh.h>
 
 namespace poke {
+/**
+ * \brief Vertices and indices of a .obj file, ready to be uploaded.
+ */
+struct MeshObjData {
+    std::vector<graphics::VertexMesh> vertices;
+    std::vector<uint32_t> indices;
+    //Simplified levels after the full detail mesh
+    std::vector<MeshLodData> lods;
+
+    //Used instead of the vertices, indices and lods when the cooked mesh is up to date
+    CookedMeshFile cookedMesh;
+
+    /**
+     * \brief Returns true if the .obj couldn't be read, it can be half written while being saved.
+     */
+    bool IsEmpty() const { return vertices.empty() && !cookedMesh.IsOpen(); }
+};
+
 /**
  * \brief Mesh that is loaded from a .obj file.
  */
@@ -45,6 +64,49 @@ public:
 
     ~MeshObj() override = default;
 
+    /**
+     * \brief Parse a .obj file without using the graphics device, can be called from any thread.
+     * \param filename
+     * \return Empty data if the file can't be parsed.
+     */
+    static MeshObjData Parse(const std::string& filename);
+
+    /**
+     * \brief Map the cooked mesh of a .obj file, the .obj is parsed, optimized, simplified and cooked again if it changed since.
+     * Can be called from any thread.
+     * \param filename
+     * \return Empty data if the file can't be parsed.
+     */
+    static MeshObjData LoadData(const std::string& filename);
+
     void Load(const std::string& filename);
+
+    /**
+     * \brief Upload data returned by Parse or LoadData.
+     * \param meshData
+     */
+    void Load(const MeshObjData& meshData);
+
+    /**
+     * \brief Upload the simplified levels of data returned by Parse or LoadData.
+     * \param meshData
+     * \param lodMeshes Resized to the number of levels after the full detail mesh.
+     */
+    static void LoadLods(const MeshObjData& meshData, std::vector<graphics::Mesh>& lodMeshes);
+
+    /**
+     * \brief Upload the simplified levels in meshes already created, their number and address don't change.
+     * \param meshData
+     * \param lodMeshes
+     */
+    static void ReloadLods(const MeshObjData& meshData, std::vector<graphics::Mesh>& lodMeshes);
+
+private:
+    /**
+     * \brief Number of levels including the full detail mesh.
+     */
+    static size_t GetLodCount(const MeshObjData& meshData);
+
+    static void LoadLevel(const MeshObjData& meshData, size_t lod, graphics::Mesh& mesh);
 };
 } //namespace poke
@@ -0,0 +1,135 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2019-2020, POK Family. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of POK Family nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Author : Nicolas Schneider
+// Co-Author :
+// Date : 24.05.20
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <GraphicsEngine/vertex_mesh.h>
+#include <GraphicsEngine/Models/mesh_lod.h>
+
+namespace poke {
+/**
+ * \brief Vertices and indices of a simplified level of detail.
+ */
+struct MeshLodData {
+	std::vector<graphics::VertexMesh> vertices;
+	std::vector<uint32_t> indices;
+};
+
+namespace mesh_optimizer {
+/**
+ * \brief Size of the simulated post transform cache, in vertices.
+ */
+const size_t kVertexCacheSize = 16;
+
+/**
+ * \brief Levels generated after the full detail mesh, each one targets half the triangles of the previous one.
+ */
+const size_t kMaxGeneratedLodCount = graphics::kMaxLodCount - 1;
+
+/**
+ * \brief Maximum error of each generated level, relative to the radius of the mesh.
+ */
+const float kLodMaxErrors[kMaxGeneratedLodCount] = { 0.01f, 0.03f, 0.08f };
+
+/**
+ * \brief Meshes with less triangles are not worth simplifying.
+ */
+const size_t kLodMinTriangleCount = 64;
+
+/**
+ * \brief Efficiency of the post transform cache for an index order.
+ */
+struct VertexCacheStats {
+	//Average cache miss ratio, transformed vertices per triangle. 0.5 is the best case, 3 the worst
+	float acmr = 0.0f;
+	//Average transform to vertex ratio, 1 is the best case
+	float atvr = 0.0f;
+};
+
+/**
+ * \brief Simulate a FIFO post transform cache over triangle list indices.
+ */
+VertexCacheStats AnalyzeVertexCache(
+	const std::vector<uint32_t>& indices,
+	size_t vertexCount,
+	size_t cacheSize = kVertexCacheSize);
+
+/**
+ * \brief Reorder the triangles to reuse the vertices still in the post transform cache (Tipsify).
+ * \details The winding of the triangles is kept.
+ */
+void OptimizeVertexCache(
+	std::vector<uint32_t>& indices,
+	size_t vertexCount,
+	size_t cacheSize = kVertexCacheSize);
+
+/**
+ * \brief Reorder the vertices in the order they are first used by the indices, unused vertices are removed.
+ */
+void OptimizeVertexFetch(
+	std::vector<graphics::VertexMesh>& vertices,
+	std::vector<uint32_t>& indices);
+
+/**
+ * \brief Collapse edges with the lowest quadric error until the target is reached.
+ * \details Border vertices, which include the UV and normal seams, are never moved.
+ * \param maxError Maximum distance to the original surface, relative to the radius of the mesh.
+ * \param resultError Set to the relative error reached if not null.
+ * \return Indices of the simplified mesh, using the same vertices.
+ */
+std::vector<uint32_t> SimplifyMesh(
+	const std::vector<graphics::VertexMesh>& vertices,
+	const std::vector<uint32_t>& indices,
+	size_t targetIndexCount,
+	float maxError,
+	float* resultError = nullptr);
+
+/**
+ * \brief Simplify the mesh in up to kMaxGeneratedLodCount levels, each one optimized.
+ * \details Stops when a level doesn't remove enough triangles within its maximum error.
+ * \return Levels after the full detail mesh.
+ */
+std::vector<MeshLodData> GenerateLods(
+	const std::vector<graphics::VertexMesh>& vertices,
+	const std::vector<uint32_t>& indices);
+
+/**
+ * \brief Every optimization done when a mesh is cooked, vertex cache first then vertex fetch.
+ */
+void OptimizeMesh(
+	std::vector<graphics::VertexMesh>& vertices,
+	std::vector<uint32_t>& indices);
+} //namespace mesh_optimizer
+} //namespace poke
@@ -63,6 +63,33 @@ public:
 		abort();
     }
 
+	ResourceHandle GetMeshHandle(ResourceID resourceID) const override
+    {
+		resourceID;
+		return kInvalidResourceHandle;
+    }
+
+	graphics::Mesh& GetMeshByHandle(ResourceHandle handle) override
+    {
+		handle;
+		cassert(false, "Impossible to acces NullMeshManager.");
+		abort();
+    }
+
+	size_t GetMeshLodCount(ResourceHandle handle) const override
+    {
+		handle;
+		return 0;
+    }
+
+	graphics::Mesh& GetMeshLodByHandle(ResourceHandle handle, size_t lod) override
+    {
+		handle;
+		lod;
+		cassert(false, "Impossible to acces NullMeshManager.");
+		abort();
+    }
+
 
     graphics::Mesh& GetSphere() override
     {
@@ -128,12 +155,15 @@ public:
 
 	json ToJson() override { return json(); }
 
-	DynamicMeshIndex CreateDynamicMesh() override { return 0; }
+	DynamicMeshIndex CreateDynamicMesh(uint32_t vertexCapacity, const std::vector<uint32_t>& indexes) override { return 0; }
 	ResourceID GetDynamicMeshResourceID(DynamicMeshIndex dynamicMeshIndex) override { return 0; }
     void UpdateDynamicMesh(
         DynamicMeshIndex dynamicMeshIndex,
         const std::vector<graphics::VertexMesh>& vertices,
-        const std::vector<uint32_t>& indexes) override{ }
+        uint32_t firstVertex,
+        uint32_t vertexCount,
+        uint32_t firstIndex,
+        uint32_t indexCount) override{ }
     void DestroyDynamicMesh(DynamicMeshIndex dynamicMeshIndex) override{}
 };
 } //namespace poke
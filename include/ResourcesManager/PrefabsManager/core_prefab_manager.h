@@ -32,6 +32,7 @@
 #pragma once
 #include <ResourcesManager/PrefabsManager/interface_prefab_manager.h>
 #include <Ecs/Prefabs/engine_prefab.h>
+#include <ResourcesManager/resource_index.h>
 
 namespace poke {
 class CorePrefabsManager : public IPrefabsManager{
@@ -43,6 +44,7 @@ public:
         const nonstd::string_view& prefabName) const override;
 
     void AddPrefab(const std::string& prefabName) override;
+    void AddPrefabPool(const std::string& prefabName, size_t instancesCount) override;
     const ecs::Prefab& GetPrefab(const nonstd::string_view& prefabName) const override;
 
     const std::vector<ResourceID>& GetPrefabsIDs() const override;
@@ -56,6 +58,7 @@ public:
 
 private:
 	std::vector<ResourceID> prefabsID_;
+	ResourceIndex prefabIndex_;
 	std::vector<ecs::EnginePrefab> prefabs_;
 };
 } //namespace poke
\ No newline at end of file
@@ -51,6 +51,12 @@ public:
      */
     virtual void AddPrefab(const std::string& prefabFileName) = 0;
 
+    /**
+     * \brief Add a prefab and instantiate inactive instances of it, Instantiate reuses them until the scene is unloaded.
+     * \param instancesCount the number of instances that can be active at the same time without creating entities.
+     */
+    virtual void AddPrefabPool(const std::string& prefabFileName, size_t instancesCount) = 0;
+
     /**
      * \brief Get a prefab from its name
      * \param prefabName 
@@ -46,6 +46,11 @@ public:
     {
 		prefabName;
     }
+    void AddPrefabPool(const std::string& prefabName, size_t instancesCount) override
+    {
+		prefabName;
+		instancesCount;
+    }
     const ecs::Prefab& GetPrefab(const nonstd::string_view& prefabName) const override;
 
     const std::vector<ResourceID>& GetPrefabsIDs() const override;
@@ -35,6 +35,7 @@
 #include <ResourcesManager/SoundsManagers/interface_sounds_manager.h>
 #include <json.hpp>
 #include <ResourcesManager/SoundsManagers/sound.h>
+#include <ResourcesManager/resource_loader.h>
 
 namespace poke {
 class CoreSoundsManager : public ISoundsManager {
@@ -58,7 +59,23 @@ public:
 
     void LoadDefaultSound() override;
 
+    /**
+     * \brief Read the clips on the loader's workers, musics are streamed and still opened by FMOD.
+     * \param resourceLoader
+     */
+    void SetResourceLoader(ResourceLoader& resourceLoader);
+
 protected:
+    /**
+     * \brief Start reading the clips, AddSound waits for the file and gives it to FMOD.
+     * \param soundsJson
+     */
+    void PreloadSounds(const json& soundsJson);
+
+    ResourceLoader* resourceLoader_ = nullptr;
+    std::vector<std::pair<ResourceID, Future<std::string>>> pendingSounds_;
+
+
     std::vector<ResourceID> soundIDs_;
     std::vector<Sound> sounds_;
 
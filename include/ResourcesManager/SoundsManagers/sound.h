@@ -42,6 +42,12 @@ public:
 
     void Load();
 
+    /**
+     * \brief Load the sound from its file already read, e.g. by a ResourceLoader.
+     * \param fileData
+     */
+    void Load(const std::string& fileData);
+
     void Unload() const;
 };
 } //namespace poke
\ No newline at end of file
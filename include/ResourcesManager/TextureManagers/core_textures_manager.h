@@ -34,6 +34,8 @@
 #include <GraphicsEngine/Images/image_2d.h>
 #include <GraphicsEngine/Images/image_cube.h>
 #include <ResourcesManager/TextureManagers/interface_texture_manager.h>
+#include <ResourcesManager/resource_index.h>
+#include <ResourcesManager/resource_loader.h>
 
 namespace poke {
 /**
@@ -53,6 +55,8 @@ public:
      */
     void AddTexture2D(const std::string& texturePath) override;
 
+    void PreloadTextures2D(const std::vector<std::string>& texturePaths) override;
+
     /**
      * \brief Get a texture by it's hash value
      * \param resourceID 
@@ -60,6 +64,10 @@ public:
      */
     const graphics::Image2d& GetTexture2DByID(ResourceID resourceID) const override;
 
+    ResourceHandle GetTexture2DHandle(ResourceID resourceID) const override;
+
+    const graphics::Image2d& GetTexture2DByHandle(ResourceHandle handle) const override;
+
     /**
      * \brief Get a texture by it's path
      * \param texturePath 
@@ -97,7 +105,36 @@ public:
 
     json ToJson() override;
 
+    /**
+     * \brief Decode the textures on the loader's workers, without loader the textures are decoded on the main thread.
+     * \param resourceLoader
+     */
+    void SetResourceLoader(ResourceLoader& resourceLoader);
+
+    /**
+     * \brief Replace a texture 2D already loaded by a new one keeping its ResourceID. The graphics device must be idle.
+     * \param texturePath
+     * \param loadedImage returned by Image2d::LoadData
+     * \return The replaced texture, to keep until nothing references it, or nullptr if the texture isn't loaded.
+     */
+    std::unique_ptr<graphics::Image2d> ReloadTexture2D(
+        const std::string& texturePath,
+        graphics::LoadedImageInfos&& loadedImage);
+
 protected:
+    static std::unique_ptr<graphics::Image2d> CreateImage2d(const std::string& texturePath);
+
+    /**
+     * \brief Index again every texture stored.
+     */
+    void RebuildIndex();
+
+    ResourceIndex image2dIndex_;
+    ResourceIndex imageCubeIndex_;
+
+    ResourceLoader* resourceLoader_ = nullptr;
+    std::vector<std::pair<ResourceID, Future<graphics::LoadedImageInfos>>> pendingImage2ds_;
+
 	std::vector<ResourceID> image2dIDs_;
     //TODO(@Nico) remove unique_ptr
 	std::vector<std::unique_ptr<graphics::Image2d>> image2ds_;
@@ -31,6 +31,7 @@
 //----------------------------------------------------------------------------------
 #pragma once
 #include <string>
+#include <vector>
 
 #include <ResourcesManager/resource_type.h>
 
@@ -50,6 +51,12 @@ public:
      */
     virtual void AddTexture2D(const std::string& texturePath) = 0;
 
+    /**
+     * \brief Start decoding textures 2D before they are added, AddTexture2D then only uploads them.
+     * \param texturePaths It must be the full names of the textures with the extension.
+     */
+    virtual void PreloadTextures2D(const std::vector<std::string>& texturePaths) = 0;
+
     /**
      * \brief Get a texture by it's hash value.
      * \param resourceID
@@ -58,6 +65,20 @@ public:
     virtual const graphics::Image2d& GetTexture2DByID(
 		ResourceID resourceID) const = 0;
 
+    /**
+     * \brief Get the handle of a texture, it can be cached to skip the lookup.
+     * \param resourceID
+     * \return kInvalidResourceHandle if the texture doesn't exist
+     */
+    virtual ResourceHandle GetTexture2DHandle(ResourceID resourceID) const = 0;
+
+    /**
+     * \brief Get a texture by the handle returned from GetTexture2DHandle.
+     * \param handle
+     * \return
+     */
+    virtual const graphics::Image2d& GetTexture2DByHandle(ResourceHandle handle) const = 0;
+
     /**
      * \brief Get a texture by it's path
      * \param texturePath It's the full path with the extension
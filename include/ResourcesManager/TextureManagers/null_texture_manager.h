@@ -41,6 +41,11 @@ public:
 		texturePath;
     }
 
+    void PreloadTextures2D(const std::vector<std::string>& texturePaths) override
+    {
+		texturePaths;
+    }
+
     const graphics::Image2d& GetTexture2DByID(ResourceID resourceID) const
     override
     {
@@ -49,6 +54,19 @@ public:
 		abort();
     }
 
+    ResourceHandle GetTexture2DHandle(ResourceID resourceID) const override
+    {
+		resourceID;
+		return kInvalidResourceHandle;
+    }
+
+    const graphics::Image2d& GetTexture2DByHandle(ResourceHandle handle) const override
+    {
+		handle;
+		cassert(false, "Impossible to access to NulLTextureManager");
+		abort();
+    }
+
     const graphics::Image2d& GetTexture2DByName(
         const std::string& texturePath) const override
     {
@@ -0,0 +1,100 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2019-2020, POK Family. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of POK Family nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Author : Nicolas Schneider
+// Co-Author :
+// Date : 21.05.2020
+//-----------------------------------------------------------------------------
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <ResourcesManager/MaterialsManager/core_materials_manager.h>
+#include <ResourcesManager/MeshManagers/core_mesh_manager.h>
+#include <ResourcesManager/TextureManagers/core_textures_manager.h>
+#include <ResourcesManager/resource_loader.h>
+#include <Utility/file_watcher.h>
+
+namespace poke {
+/**
+ * \brief Reload the meshes, textures 2D and materials whose file changed while they are loaded.
+ * The files are read and decoded in the background, the resources are swapped at a frame boundary and keep their ResourceID.
+ */
+class ResourceHotReloader {
+public:
+    ResourceHotReloader(
+        CoreMeshManager& meshManager,
+        CoreTexturesManager& texturesManager,
+        CoreMaterialsManager& materialsManager,
+        ResourceLoader& resourceLoader);
+
+    /**
+     * \brief Start watching the resource folders of the ROM.
+     * \return True if at least one folder is watched.
+     */
+    bool Start();
+
+    void Stop();
+
+    bool IsRunning() const { return fileWatcher_.IsRunning(); }
+
+    /**
+     * \brief Start loading the files changed since the last call and swap the resources loaded since.
+     * Must be called between two frames, the graphics device is waited before swapping.
+     */
+    void Update();
+
+private:
+    template<typename T>
+    using PendingReloads = std::vector<std::pair<std::string, Future<T>>>;
+
+    /**
+     * \brief Start loading a changed file if its resource is loaded.
+     * A file still loading is delayed until its previous load has been swapped.
+     * \param filePath
+     */
+    void LoadChangedFile(std::string filePath);
+
+    void SwapReloadedResources();
+
+    CoreMeshManager& meshManager_;
+    CoreTexturesManager& texturesManager_;
+    CoreMaterialsManager& materialsManager_;
+
+    FileWatcher fileWatcher_;
+    //Shared with the resources managers
+    ResourceLoader& resourceLoader_;
+
+    PendingReloads<MeshObjData> reloadingMeshes_;
+    PendingReloads<graphics::LoadedImageInfos> reloadingTextures2D_;
+    PendingReloads<json> reloadingMaterials_;
+
+    std::vector<std::string> delayedFilePaths_;
+};
+} //namespace poke
@@ -0,0 +1,126 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2019-2020, POK Family. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of POK Family nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Author : Nicolas Schneider
+// Co-Author :
+// Date : 22.05.2020
+//-----------------------------------------------------------------------------
+#pragma once
+
+#include <vector>
+
+#include <ResourcesManager/resource_type.h>
+
+namespace poke {
+/**
+ * \brief Open addressing hash index from a ResourceID to the handle of the resource inside its manager.
+ * ResourceIDs are already XXH64 hashes, so their low bits are used directly as the slot.
+ */
+class ResourceIndex {
+public:
+    explicit ResourceIndex(size_t capacity = kDefaultCapacity);
+
+    /**
+     * \brief Insert or replace the handle of a resource.
+     * \param resourceID must not be 0, it's used to mark the empty slots
+     * \param handle
+     */
+    void Insert(ResourceID resourceID, ResourceHandle handle);
+
+    /**
+     * \brief Find the handle of a resource.
+     * \param resourceID
+     * \return kInvalidResourceHandle if the resource is not indexed
+     */
+    ResourceHandle Find(ResourceID resourceID) const
+    {
+        const size_t mask = keys_.size() - 1;
+        for (size_t slot = GetSlot(resourceID); ; slot = (slot + 1) & mask) {
+            if (keys_[slot] == resourceID) { return handles_[slot]; }
+            if (keys_[slot] == kEmptyKey) { return kInvalidResourceHandle; }
+        }
+    }
+
+    /**
+     * \brief Remove a resource, following slots are shifted back so no tombstone is needed.
+     * \param resourceID
+     * \return false if the resource was not indexed
+     */
+    bool Erase(ResourceID resourceID);
+
+    void Clear();
+
+    /**
+     * \brief Grow the table once so the given count of resources can be inserted without rehashing again.
+     * \param count
+     */
+    void Reserve(size_t count);
+
+    size_t GetSize() const { return size_; }
+
+    size_t GetCapacity() const { return keys_.size(); }
+
+    /**
+     * \brief Handle of a manager storing its resources in several vectors.
+     * \param storage index of the vector, on 8 bits
+     * \param index position inside the vector, on 24 bits
+     */
+    static ResourceHandle MakeHandle(uint8_t storage, size_t index)
+    {
+        return (static_cast<ResourceHandle>(storage) << kStorageShift) |
+            (static_cast<ResourceHandle>(index) & kIndexMask);
+    }
+
+    static uint8_t GetHandleStorage(const ResourceHandle handle)
+    {
+        return static_cast<uint8_t>(handle >> kStorageShift);
+    }
+
+    static size_t GetHandleIndex(const ResourceHandle handle) { return handle & kIndexMask; }
+
+private:
+    size_t GetSlot(const ResourceID resourceID) const
+    {
+        return static_cast<size_t>(resourceID) & (keys_.size() - 1);
+    }
+
+    void Rehash(size_t capacity);
+
+    std::vector<ResourceID> keys_;
+    std::vector<ResourceHandle> handles_;
+    size_t size_ = 0;
+
+    inline static const ResourceID kEmptyKey = 0;
+    //Must be a power of two
+    inline static const size_t kDefaultCapacity = 64;
+    //Half of the slots stay empty to keep the probes short
+    inline static const size_t kMaxLoadFactorInverse = 2;
+
+    inline static const uint32_t kStorageShift = 24;
+    inline static const ResourceHandle kIndexMask = (1u << kStorageShift) - 1;
+};
+} //namespace poke
@@ -0,0 +1,104 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2019-2020, POK Family. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of POK Family nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Author : Nicolas Schneider
+// Co-Author :
+// Date : 20.05.2020
+//-----------------------------------------------------------------------------
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <Utility/future.h>
+#include <Utility/worker_thread.h>
+
+namespace poke {
+/**
+ * \brief Pool of workers reading and decoding resources outside of the main thread.
+ * The managers only do the upload or the registration of the loaded data on the main thread.
+ */
+class ResourceLoader {
+public:
+    /**
+     * \brief Without workers, the resources are loaded on the calling thread.
+     * \param workerCount
+     */
+    explicit ResourceLoader(
+        size_t workerCount = ComputeWorkerCount(std::thread::hardware_concurrency()));
+
+    ResourceLoader(const ResourceLoader&) = delete;
+    ResourceLoader& operator=(const ResourceLoader&) = delete;
+
+    /**
+     * \brief Run the load function on a worker.
+     * \param load must not use the graphics or the audio device.
+     * \return handle blocking on Get() until the data is loaded
+     */
+    template<typename T>
+    Future<T> LoadAsync(std::function<T()> load);
+
+    /**
+     * \brief Wait all workers to finish their loads.
+     */
+    void Wait();
+
+    size_t GetWorkerCount() const { return workers_.size(); }
+
+    /**
+     * \brief Number of workers, keeping one core for the main thread.
+     * \param hardwareConcurrency value returned by std::thread::hardware_concurrency()
+     */
+    static size_t ComputeWorkerCount(unsigned hardwareConcurrency);
+
+private:
+    std::vector<std::unique_ptr<WorkerThread>> workers_;
+    size_t nextWorker_ = 0;
+
+    inline static const size_t kMaxWorkers = 8;
+};
+
+template <typename T>
+Future<T> ResourceLoader::LoadAsync(std::function<T()> load)
+{
+    //std::function must be copyable, the task is shared with the worker
+    auto task = std::make_shared<std::packaged_task<T()>>(std::move(load));
+    Future<T> future(task->get_future());
+
+    if (workers_.empty()) {
+        (*task)();
+        return future;
+    }
+
+    workers_[nextWorker_]->DoAsync([task]() { (*task)(); });
+    nextWorker_ = (nextWorker_ + 1) % workers_.size();
+
+    return future;
+}
+} //namespace poke
@@ -32,6 +32,7 @@
 #pragma once
 
 #include <cstdint>
+#include <limits>
 #include <math/hash.h>
 
 
@@ -39,6 +40,13 @@ namespace poke {
 
 using ResourceID = XXH64_hash_t;
 
+/**
+ * \brief Position of a resource inside its manager, it stays valid until the manager is cleared.
+ */
+using ResourceHandle = uint32_t;
+
+const ResourceHandle kInvalidResourceHandle = std::numeric_limits<ResourceHandle>::max();
+
 enum class ResourceType : uint8_t {
     TEXTURE = 0,
     MESH,
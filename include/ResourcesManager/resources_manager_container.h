@@ -36,6 +36,7 @@
 #include <ResourcesManager/MaterialsManager/core_materials_manager.h>
 #include <ResourcesManager/SoundsManagers/core_sounds_manager.h>
 #include <ResourcesManager/PrefabsManager/core_prefab_manager.h>
+#include <ResourcesManager/resource_loader.h>
 
 namespace poke {
 class Engine;
@@ -46,6 +47,9 @@ public:
 
     void Init();
 
+    //Shared by the managers, the chunks streaming and the hot reloader to read and decode the resources
+    ResourceLoader resourceLoader;
+
     CoreTexturesManager textureManager;
 	CoreMeshManager meshManager;
 	CoreMaterialsManager materialsManager;
@@ -0,0 +1,313 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2019-2020, POK Family. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of POK Family nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Author : Nicolas Schneider
+// Co-Author :
+// Date : 12.05.20
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <json.hpp>
+#include <string_view.hpp>
+
+#include <Ecs/ecs_utility.h>
+#include <Math/hash.h>
+#include <Math/vector.h>
+#include <Utility/file_system.h>
+#include <Utility/mapped_file.h>
+
+namespace poke {
+namespace scene {
+namespace binary_scene {
+const uint32_t kMagic = 0x42534B50; //"PKSB"
+//Version 2: the hash and size of the .pokscene are stored to detect when the json changed
+//Version 3: models, rigidbodies and colliders are stored as typed records
+const uint32_t kVersion = 3;
+const uint32_t kNoString = std::numeric_limits<uint32_t>::max();
+
+/**
+ * \brief Every section is aligned on this size inside the file.
+ */
+const size_t kSectionAlignment = 8;
+
+enum class SectionType : uint32_t {
+	STRING_ENTRIES = 0, // StringEntry[count]
+	STRING_DATA, // char[size], strings are not null terminated
+	SCENE_DATA, // CBOR encoded scene json without the gameObjects (resources, archetypes, chunks)
+	ENTITY_FLAGS, // uint8_t[entityCount]
+	ENTITY_TAGS, // ecs::EntityTag[entityCount]
+	ENTITY_PREFABS, // string index[entityCount]
+	ENTITY_PARENTS, // ecs::EntityIndex[entityCount], parent id as saved in the scene
+	TRANSFORM_POSITIONS, // math::Vec3[entityCount]
+	TRANSFORM_ROTATIONS, // math::Vec3[entityCount]
+	TRANSFORM_SCALES, // math::Vec3[entityCount]
+	COMPONENT_BLOCK, // ComponentBlockHeader, then entities, data offsets and CBOR data
+	TYPED_COMPONENT_BLOCK // TypedComponentBlockHeader, then entities and one record per entity
+};
+
+namespace EntityFlag {
+enum EntityFlag : uint8_t {
+	HAS_TRANSFORM = 1u << 0,
+	HAS_TAG = 1u << 1,
+	HAS_ACTIVE = 1u << 2,
+	IS_ACTIVE = 1u << 3
+};
+} //namespace EntityFlag
+
+struct Header {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t entityCount;
+	uint32_t sectionCount;
+	uint64_t sourceHash;
+	uint64_t sourceSize;
+};
+
+struct Section {
+	SectionType type;
+	uint32_t count;
+	uint64_t offset;
+	uint64_t size;
+};
+
+struct StringEntry {
+	math::StringHash hash;
+	uint32_t offset;
+	uint32_t length;
+};
+
+/**
+ * \brief Followed by uint32_t entities[entityCount], uint32_t dataOffsets[entityCount + 1] and the CBOR data.
+ */
+struct ComponentBlockHeader {
+	uint32_t nameIndex;
+	uint32_t entityCount;
+};
+
+/**
+ * \brief Followed by uint32_t entities[entityCount], padded to kSectionAlignment, and the records.
+ */
+struct TypedComponentBlockHeader {
+	uint32_t nameIndex;
+	uint32_t entityCount;
+	uint32_t recordSize;
+	uint32_t padding;
+};
+
+/**
+ * \brief Model as read by the models manager, without going through json.
+ */
+struct ModelRecord {
+	uint64_t materialID;
+	uint64_t meshID;
+};
+
+struct RigidbodyRecord {
+	math::Vec3 linearVelocity;
+	math::Vec3 angularVelocity;
+	float linearDrag;
+	float angularDrag;
+	uint32_t type;
+};
+
+/**
+ * \brief Extent is the box extent or the mesh extent, radius is used by spheres and ellipsoids.
+ */
+struct ColliderRecord {
+	uint32_t shapeType;
+	uint32_t isTrigger;
+	math::Vec3 positionOffset;
+	math::Vec3 extent;
+	float radius;
+};
+
+/**
+ * \brief Size of the records of a typed component block, 0 if the component is stored as CBOR.
+ */
+uint32_t GetRecordSize(ecs::ComponentType::ComponentType componentType);
+
+/**
+ * \brief Hash of the .pokscene stored in the binary scene to detect when it changed.
+ */
+uint64_t HashSource(const uint8_t* data, size_t size);
+
+/**
+ * \brief Returns the component type loaded from a gameObject key, EMPTY if the key isn't a component.
+ */
+ecs::ComponentType::ComponentType GetComponentType(nonstd::string_view componentKey);
+} //namespace binary_scene
+
+/**
+ * \brief All the components of the same type stored in a binary scene, sorted by scene entity.
+ * Typed blocks hold one record per entity, the others hold CBOR json.
+ */
+struct BinaryComponentBlock {
+	nonstd::string_view name;
+	ecs::ComponentType::ComponentType componentType = ecs::ComponentType::EMPTY;
+	uint32_t entityCount = 0;
+	const uint32_t* entities = nullptr;
+	const uint32_t* dataOffsets = nullptr;
+	const uint8_t* data = nullptr;
+	const uint8_t* records = nullptr;
+
+	bool IsTyped() const { return records != nullptr; }
+
+	template<typename T>
+	const T& GetRecord(const size_t index) const
+	{
+		return reinterpret_cast<const T*>(records)[index];
+	}
+
+	/**
+	 * \brief Decode the component, typed records are converted back to their json.
+	 */
+	json GetComponentJson(size_t index) const;
+};
+
+/**
+ * \brief Non owning view over a binary scene. Arrays are read in place, only components and scene data are decoded on demand.
+ */
+class BinarySceneView {
+public:
+	BinarySceneView() = default;
+
+	/**
+	 * \brief Check the header and the bounds of every section. The data must outlive the view.
+	 * \return True if the data is a valid binary scene.
+	 */
+	bool SetData(const uint8_t* data, size_t size);
+
+	bool IsValid() const { return header_ != nullptr; }
+
+	/**
+	 * \brief Returns true if the scene has been compiled from a .pokscene with the given hash and size.
+	 */
+	bool IsUpToDate(uint64_t sourceHash, uint64_t sourceSize) const;
+
+	uint32_t GetEntityCount() const { return header_->entityCount; }
+
+	uint32_t GetStringCount() const { return stringCount_; }
+
+	nonstd::string_view GetString(uint32_t stringIndex) const;
+
+	/**
+	 * \brief Returns the index of the string with the given hash, binary_scene::kNoString if not found.
+	 */
+	uint32_t FindString(math::StringHash hash) const;
+
+	const uint8_t* GetFlags() const { return flags_; }
+	const ecs::EntityTag* GetTags() const { return tags_; }
+	const uint32_t* GetPrefabs() const { return prefabs_; }
+	const ecs::EntityIndex* GetParents() const { return parents_; }
+	const math::Vec3* GetPositions() const { return positions_; }
+	const math::Vec3* GetRotations() const { return rotations_; }
+	const math::Vec3* GetScales() const { return scales_; }
+
+	size_t GetComponentBlockCount() const { return componentBlocks_.size(); }
+	const BinaryComponentBlock& GetComponentBlock(const size_t blockIndex) const { return componentBlocks_[blockIndex]; }
+
+	/**
+	 * \brief Returns the scene json without its gameObjects.
+	 */
+	json GetSceneDataJson() const;
+
+	/**
+	 * \brief Rebuild the .pokscene json.
+	 */
+	json ToJson() const;
+
+private:
+	const binary_scene::Section* FindSection(binary_scene::SectionType type) const;
+
+	template<typename T>
+	const T* GetEntityArray(binary_scene::SectionType type) const;
+
+	const uint8_t* data_ = nullptr;
+	size_t size_ = 0;
+
+	const binary_scene::Header* header_ = nullptr;
+	const binary_scene::Section* sections_ = nullptr;
+
+	const binary_scene::StringEntry* strings_ = nullptr;
+	uint32_t stringCount_ = 0;
+	const char* stringData_ = nullptr;
+
+	const uint8_t* flags_ = nullptr;
+	const ecs::EntityTag* tags_ = nullptr;
+	const uint32_t* prefabs_ = nullptr;
+	const ecs::EntityIndex* parents_ = nullptr;
+	const math::Vec3* positions_ = nullptr;
+	const math::Vec3* rotations_ = nullptr;
+	const math::Vec3* scales_ = nullptr;
+
+	std::vector<BinaryComponentBlock> componentBlocks_;
+};
+
+/**
+ * \brief Binary scene mapped from the disk.
+ */
+class BinarySceneFile {
+public:
+	BinarySceneFile() = default;
+
+	/**
+	 * \brief Map the .pokscenebin with the given name.
+	 * \return True if the file exists and is a valid binary scene.
+	 */
+	bool Open(const std::string& fileName, FolderType folderType = FolderType::ROM);
+
+	const BinarySceneView& GetView() const { return view_; }
+
+private:
+	MappedFile file_;
+	BinarySceneView view_;
+};
+
+/**
+ * \brief Compile a .pokscene json into a binary scene.
+ * \param sourceHash Hash of the .pokscene file the json has been read from.
+ * \param sourceSize Size of the .pokscene file the json has been read from.
+ */
+std::vector<uint8_t> CompileBinaryScene(const json& sceneJson, uint64_t sourceHash = 0, uint64_t sourceSize = 0);
+
+/**
+ * \brief Compile a .pokscene json and write it next to the json scene.
+ * The .pokscene must already be written in the same folder, its hash is stored in the binary scene.
+ * \return True if written, false otherwise.
+ */
+bool ExportBinaryScene(
+	const json& sceneJson,
+	const std::string& fileName,
+	FolderType folderType = FolderType::SAVE_IN_ROM);
+} //namespace scene
+} //namespace poke
@@ -31,8 +31,10 @@
 //----------------------------------------------------------------------------------
 #pragma once
 
+#include <map>
 #include <string>
 
+#include <Ecs/ecs_utility.h>
 #include <Math/vector.h>
 #include <Utility/color.h>
 
@@ -87,6 +89,11 @@ public:
     const std::string& GetSceneFileName() const { return fileName_; }
 
 private:
+	void LoadResources(const json& sceneJson) const;
+	void LoadArchetypesAndChunks(
+		const json& sceneJson,
+		const std::map<ecs::EntityIndex, ecs::EntityIndex>& baseParentToOffsetParent) const;
+
 	// Warning: not the same as InnerSceneManager::activeSceneIndex_ !
 	SceneIndex sceneIndex_;
 
@@ -86,6 +86,11 @@ public:
 
 	inline const static int kMaxSize = 256;
 
+    /**
+     * \brief Precomputed colors, GetColorAt(position) is the color at index position * (kMaxSize - 1).
+     */
+    const std::array<Color, kMaxSize>& GetColors() const { return colors_; }
+
 private:
     void RefreshColors();
 
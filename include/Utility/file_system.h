@@ -49,6 +49,7 @@ enum class FileType : char {
 	LOGS,
 	JSON,
 	SCENE,
+	BINARY_SCENE,
 	PREFAB,
 	LANG,
 	BINDING,
@@ -59,10 +60,12 @@ enum class FileType : char {
 	FRAG,
 	COMP,
 	TEXTURE,
+	COOKED_TEXTURE,
 	IMAGE_CUBE,
     SKYBOX,
 	COMPILED_SHADER,
     MESH,
+	COOKED_MESH,
 	USER_PREFS,
 	ENGINE_SETTING,
 	APP_SETTING,
@@ -72,6 +75,7 @@ enum class FileType : char {
 	PARTICLE,
     SOUNDS,
     FMOD_BANK,
+	EVICTED_CHUNK,
 	CUSTOM
 };
 
@@ -191,6 +195,14 @@ public:
 		FolderType folderType = FolderType::SAVE
     );
 
+    /**
+     * \brief Write the data in a temporary file renamed over the given file once complete.
+     * Readers never see a partially written file, a file mapped by a reader keeps its old content.
+     * \param filePath The full path to the file.
+     * \return True if written, false otherwise
+     */
+	static bool WriteFileAtomically(const std::string& filePath, const void* data, size_t size);
+
     /**
      * \brief Read a file and return its content
      * \param fileName Name of the file
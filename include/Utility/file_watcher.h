@@ -0,0 +1,88 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2019-2020, POK Family. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of POK Family nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Author : Nicolas Schneider
+// Co-Author :
+// Date : 21.05.2020
+//-----------------------------------------------------------------------------
+#pragma once
+
+#include <atomic>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace poke {
+/**
+ * \brief Watch folders and their subfolders from a background thread and collect the files written in them.
+ * Uses inotify on Linux, ReadDirectoryChangesW on Windows and compares the write times on the other platforms.
+ */
+class FileWatcher {
+public:
+	FileWatcher() = default;
+	~FileWatcher();
+
+	FileWatcher(const FileWatcher&) = delete;
+	FileWatcher& operator=(const FileWatcher&) = delete;
+
+	/**
+	 * \brief Start watching the given folders, stop watching the previous ones if any.
+	 * \param folderPaths Paths ending with a '/', the changed files are returned prefixed with them.
+	 * \return True if at least one folder is watched.
+	 */
+	bool Start(const std::vector<std::string>& folderPaths);
+
+	void Stop();
+
+	bool IsRunning() const { return isRunning_; }
+
+	/**
+	 * \brief Get the files written since the last call, each file once. Never blocks on the watcher thread's work.
+	 */
+	std::vector<std::string> PollChanges();
+
+	/**
+	 * \brief Delay between two checks of the watched folders, or between two checks of IsRunning with native notifications.
+	 */
+	inline static const int kPollIntervalMs = 100;
+
+private:
+	void Run(std::promise<bool>& isWatching);
+
+	void PushChange(const std::string& filePath);
+
+	std::vector<std::string> folderPaths_;
+
+	std::mutex mutex_;
+	std::vector<std::string> changes_;
+
+	std::atomic<bool> isRunning_{ false };
+	std::thread thread_;
+};
+} //namespace poke
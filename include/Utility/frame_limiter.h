@@ -0,0 +1,82 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2019-2020, POK Family. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of POK Family nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Author : Nicolas Schneider
+// Co-Author :
+// Date : 31.05.2020
+//-----------------------------------------------------------------------------
+#pragma once
+
+#include <chrono>
+
+namespace poke {
+/**
+ * \brief Keeps the frames at a target duration, sleeps most of the remaining time then spins until the end of the frame.
+ */
+class FrameLimiter {
+public:
+    using Duration = std::chrono::duration<double, std::milli>;
+
+    /**
+     * \brief A target frame time of 0 doesn't limit the frames
+     */
+    explicit FrameLimiter(Duration targetFrameTime = Duration(0));
+
+    ~FrameLimiter();
+
+    FrameLimiter(const FrameLimiter&) = delete;
+    FrameLimiter& operator=(const FrameLimiter&) = delete;
+
+    void SetTargetFrameTime(Duration targetFrameTime);
+
+    Duration GetTargetFrameTime() const { return targetFrameTime_; }
+
+    /**
+     * \brief Wait for the end of the current frame.
+     * \details A frame that overruns starts the next one right away, the lost time isn't caught up.
+     */
+    void WaitEndOfFrame();
+
+    /**
+     * \brief Sleep for a frame in which nothing is done, even when the frames aren't limited.
+     */
+    void Idle();
+
+    /**
+     * \brief Time kept for spinning before the end of a frame, it follows how late the sleeps wake up.
+     */
+    Duration GetSpinTime() const { return spinTime_; }
+private:
+    using Clock = std::chrono::steady_clock;
+
+    Duration targetFrameTime_;
+    Clock::time_point endOfFrame_;
+    bool isStarted_ = false;
+
+    Duration spinTime_;
+};
+} //namespace poke
@@ -30,6 +30,7 @@
 //-----------------------------------------------------------------------------
 #pragma once
 
+#include <chrono>
 #include <future>
 #include <optional_custom.h>
 
@@ -47,6 +48,23 @@ public:
 		return future_.valid() || current_;
 	}
 
+	/**
+	 * \brief Check without blocking if Get can return the value immediately.
+	 */
+	bool IsReady() const noexcept {
+		if (current_) { return true; }
+
+		return future_.valid() &&
+			future_.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+	}
+
+	/**
+	 * \brief Block until the value is set, without taking it.
+	 */
+	void Wait() const {
+		if (future_.valid()) { future_.wait(); }
+	}
+
 	T &Get() noexcept {
 		if (future_.valid()) {
 			current_ = future_.get();
@@ -0,0 +1,66 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2019-2020, POK Family. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of POK Family nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Author : Nicolas Schneider
+// Co-Author :
+// Date : 01.06.2020
+//-----------------------------------------------------------------------------
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <Utility/worker_thread.h>
+
+namespace poke {
+/**
+ * \brief Workers shared by the systems splitting their frame work in ranges.
+ * The systems run one after the other on the main thread, each one waits the workers it used before returning.
+ */
+class JobPool {
+public:
+    explicit JobPool(size_t workerCount);
+
+    JobPool(const JobPool&) = delete;
+    JobPool& operator=(const JobPool&) = delete;
+
+    size_t GetWorkerCount() const { return workers_.size(); }
+
+    WorkerThread& GetWorker(const size_t workerIndex) { return *workers_[workerIndex]; }
+
+    /**
+     * \brief Number of workers, half of the cores are left to the engine threads and the resources loader.
+     * \param hardwareConcurrency value returned by std::thread::hardware_concurrency()
+     */
+    static size_t ComputeWorkerCount(unsigned hardwareConcurrency);
+
+private:
+    std::vector<std::unique_ptr<WorkerThread>> workers_;
+
+    inline static const size_t kMaxWorkers = 3;
+};
+} //namespace poke
@@ -30,10 +30,12 @@
 //----------------------------------------------------------------------------------
 #pragma once
 
+#include <functional>
 #include <queue>
 #include <mutex>
 #include <condition_variable>
 #include <thread>
+#include <vector>
 
 namespace poke
 {
@@ -57,7 +59,18 @@ public:
     void DoSync(const std::function<void()>& task);
 
     /**
-	 * \brief Wait this worker to finish all its task
+     * \brief Set the tasks executed in order by each RunFrameTasks, they are kept between the frames.
+     * \details Must not be called while the frame tasks are executed.
+     */
+    void SetFrameTasks(std::vector<std::function<void()>> frameTasks);
+
+    /**
+     * \brief Execute the frame tasks asynchronously with a single lock, nothing is allocated.
+     */
+    void RunFrameTasks();
+
+    /**
+	 * \brief Wait this worker to finish all its task, including the one currently executed
 	 */
 	void Wait();
 
@@ -72,8 +85,14 @@ private:
 
 	volatile bool isRunning_ = true;
 
+	//True while a task is executed outside of the lock
+	bool isWorking_ = false;
+
 	std::queue<std::function<void()>> tasks_;
 
+	std::vector<std::function<void()>> frameTasks_;
+	bool areFrameTasksPending_ = false;
+
 	std::unique_ptr<std::thread> thread_;
 	
 	std::condition_variable itemInQueue_;
@@ -35,6 +35,15 @@ void AudioClip::InternLoad(AudioEngine& audioEngine)
         isStreamingLoading_);
 }
 
+void AudioClip::InternLoad(AudioEngine& audioEngine, const std::string& fileData)
+{
+    audioEngine.LoadSoundFromMemory(
+        fileData,
+        clip_,
+        is3D_,
+        isLooping_);
+}
+
 void AudioClip::InternUnload() const
 {
     CheckFMOD(clip_->release());
@@ -92,6 +92,28 @@ void AudioEngine::LoadSound(
             &clip));
 }
 
+void AudioEngine::LoadSoundFromMemory(
+    const std::string& fileData,
+    Clip& clip,
+    const bool is3D,
+    const bool isLooping)
+{
+    FMOD_MODE mode = FMOD_OPENMEMORY | FMOD_CREATECOMPRESSEDSAMPLE;
+    mode |= is3D ? FMOD_3D : FMOD_2D;
+    mode |= isLooping ? FMOD_LOOP_NORMAL : FMOD_LOOP_OFF;
+
+    FMOD_CREATESOUNDEXINFO soundInfo = {};
+    soundInfo.cbsize = sizeof(FMOD_CREATESOUNDEXINFO);
+    soundInfo.length = static_cast<unsigned int>(fileData.size());
+
+    CheckFMOD(
+        fmodImplementation_.system->createSound(
+            fileData.data(),
+            mode,
+            &soundInfo,
+            &clip));
+}
+
 void AudioEngine::PlaySound(
     const Clip& clip,
     const math::Vec3 pos,
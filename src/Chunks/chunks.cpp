@@ -34,34 +34,16 @@ json Chunk::ToJson(const std::map<ecs::EntityIndex, ecs::EntityIndex>& baseParen
     }
 
     //Chunks to show
-    int nb = 0;
     newJson["chunksToShow"] = nlohmann::detail::value_t::array;
-    for (int i = 0; i < IChunksManager::kMaxChunkNb; i++) {
-        if (chunksToShow_[i]) {
-            newJson["chunksToShow"][nb] = i;
-            nb++;
-        }
-    }
+    for (const ChunkIndex chunkIndex : chunksToShow_) { newJson["chunksToShow"].push_back(chunkIndex); }
 
     //Chunks to destroy
-    nb = 0;
     newJson["chunksToDestroy"] = nlohmann::detail::value_t::array;
-    for (int i = 0; i < IChunksManager::kMaxChunkNb; i++) {
-        if (chunksToDestroy_[i]) {
-            newJson["chunksToDestroy"][nb] = i;
-            nb++;
-        }
-    }
+    for (const ChunkIndex chunkIndex : chunksToDestroy_) { newJson["chunksToDestroy"].push_back(chunkIndex); }
 
     //Chunks to hide
-    nb = 0;
     newJson["chunksToHide"] = nlohmann::detail::value_t::array;
-    for (int i = 0; i < IChunksManager::kMaxChunkNb; i++) {
-        if (chunksToHide_[i]) {
-            newJson["chunksToHide"][nb] = i;
-            nb++;
-        }
-    }
+    for (const ChunkIndex chunkIndex : chunksToHide_) { newJson["chunksToHide"].push_back(chunkIndex); }
     return newJson;
 }
 
@@ -95,19 +77,19 @@ void Chunk::SetFromJson(const json& json, const std::map<ecs::EntityIndex, ecs::
     cassert(
         CheckJsonExists(json, "chunksToShow"),
         "The json for the chunk is missing the chunksToShow variable");
-    for (const auto& i : json["chunksToShow"]) { chunksToShow_.set(i); }
+    for (const auto& i : json["chunksToShow"]) { chunksToShow_.Insert(i.get<ChunkIndex>()); }
 
     //Chunks to destroy
     cassert(
         CheckJsonExists(json, "chunksToDestroy"),
         "The json for the chunk is missing the chunksToDestroy variable");
-    for (const auto& i : json["chunksToDestroy"]) { chunksToDestroy_.set(i); }
+    for (const auto& i : json["chunksToDestroy"]) { chunksToDestroy_.Insert(i.get<ChunkIndex>()); }
 
     //Chunks to hide
     cassert(
         CheckJsonExists(json, "chunksToHide"),
         "The json for the chunk is missing the chunksToHide variable");
-    for (const auto& i : json["chunksToHide"]) { chunksToHide_.set(i); }
+    for (const auto& i : json["chunksToHide"]) { chunksToHide_.Insert(i.get<ChunkIndex>()); }
 
     std::sort(linkEntities_.begin(), linkEntities_.end());
 }
@@ -218,55 +200,25 @@ void Chunk::RemoveEntityToActivate(const ecs::EntityIndex entityIndex)
     if (it != entitiesToActivate_.end()) { entitiesToActivate_.erase(it); }
 }
 
-void Chunk::AddChunkToShow(const ChunkIndex chunkIndex)
-{
-    cassert(
-        chunkIndex < IChunksManager::kMaxChunkNb,
-        "the chunk index must be smalle than the kMaxChunkNb");
-    chunksToShow_.set(chunkIndex);
-}
+void Chunk::AddChunkToShow(const ChunkIndex chunkIndex) { chunksToShow_.Insert(chunkIndex); }
 
-void Chunk::RemoveChunkToShow(const ChunkIndex chunkIndex)
-{
-    cassert(
-        chunkIndex < IChunksManager::kMaxChunkNb,
-        "the chunk index must be smalle than the kMaxChunkNb");
-    chunksToShow_.set(chunkIndex, false);
-}
+void Chunk::RemoveChunkToShow(const ChunkIndex chunkIndex) { chunksToShow_.Erase(chunkIndex); }
 
-void Chunk::AddChunkToHide(const ChunkIndex chunkIndex)
-{
-    cassert(
-        chunkIndex < IChunksManager::kMaxChunkNb,
-        "the chunk index must be smalle than the kMaxChunkNb");
-    chunksToHide_.set(chunkIndex);
-}
+void Chunk::AddChunkToHide(const ChunkIndex chunkIndex) { chunksToHide_.Insert(chunkIndex); }
 
-void Chunk::RemoveChunkToHide(const ChunkIndex chunkIndex)
-{
-    cassert(
-        chunkIndex < IChunksManager::kMaxChunkNb,
-        "the chunk index must be smalle than the kMaxChunkNb");
-    chunksToHide_.set(chunkIndex, false);
-}
+void Chunk::RemoveChunkToHide(const ChunkIndex chunkIndex) { chunksToHide_.Erase(chunkIndex); }
 
-void Chunk::AddChunkToDestroy(const ChunkIndex chunkIndex)
-{
-    cassert(
-        chunkIndex < IChunksManager::kMaxChunkNb,
-        "the chunk index must be smalle than the kMaxChunkNb");
-    chunksToDestroy_.set(chunkIndex);
-}
+void Chunk::AddChunkToDestroy(const ChunkIndex chunkIndex) { chunksToDestroy_.Insert(chunkIndex); }
+
+void Chunk::RemoveChunkToDestroy(const ChunkIndex chunkIndex) { chunksToDestroy_.Erase(chunkIndex); }
 
-void Chunk::RemoveChunkToDestroy(const ChunkIndex chunkIndex)
+void Chunk::Destroy()
 {
-    cassert(
-        chunkIndex < IChunksManager::kMaxChunkNb,
-        "the chunk index must be smalle than the kMaxChunkNb");
-    chunksToDestroy_.set(chunkIndex, false);
-}
+    EcsManagerLocator::Get().DestroyEntities(linkEntities_);
 
-void Chunk::Destroy() { EcsManagerLocator::Get().DestroyEntities(linkEntities_); }
+    //The indexes can be reused by new entities
+    linkEntities_.clear();
+}
 
 const std::vector<ecs::EntityIndex>& Chunk::GetEntitiesToActivate() const
 {
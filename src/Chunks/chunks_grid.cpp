@@ -0,0 +1,155 @@
+#include <Chunks/chunks_grid.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace poke {
+namespace chunk {
+namespace {
+//Chunks with a flat side still get a cell size
+const float kMinCellSize = 0.01f;
+} //namespace
+
+void ChunksGrid::Build(const std::vector<Chunk>& chunks)
+{
+    cellNb_ = { 0, 0, 0 };
+    cellStarts_.clear();
+    cellChunks_.clear();
+    if (chunks.empty()) { return; }
+
+    //Bounds of the level and average size of a chunk
+    math::Vec3 min = chunks[0].GetPosition() - chunks[0].GetExtent() * 0.5f;
+    math::Vec3 max = chunks[0].GetPosition() + chunks[0].GetExtent() * 0.5f;
+    math::Vec3 averageExtent{ 0, 0, 0 };
+    for (const Chunk& chunk : chunks) {
+        const math::Vec3 chunkMin = chunk.GetPosition() - chunk.GetExtent() * 0.5f;
+        const math::Vec3 chunkMax = chunk.GetPosition() + chunk.GetExtent() * 0.5f;
+        for (int axis = 0; axis < 3; axis++) {
+            min[axis] = std::min(min[axis], chunkMin[axis]);
+            max[axis] = std::max(max[axis], chunkMax[axis]);
+            averageExtent[axis] += std::abs(chunk.GetExtent()[axis]) / chunks.size();
+        }
+    }
+
+    origin_ = min;
+    size_t cellNb = 1;
+    for (int axis = 0; axis < 3; axis++) {
+        cellSize_[axis] = std::max(averageExtent[axis], kMinCellSize);
+        cellNb_[axis] = std::max(static_cast<int>(std::ceil((max[axis] - min[axis]) / cellSize_[axis])), 1);
+        cellNb *= cellNb_[axis];
+    }
+
+    //Sparse levels get bigger cells
+    if (cellNb > kMaxCellNb) {
+        const float scale = std::cbrt(static_cast<float>(cellNb) / kMaxCellNb);
+        cellNb = 1;
+        for (int axis = 0; axis < 3; axis++) {
+            cellSize_[axis] *= scale;
+            cellNb_[axis] = std::max(static_cast<int>(std::ceil((max[axis] - min[axis]) / cellSize_[axis])), 1);
+            cellNb *= cellNb_[axis];
+        }
+    }
+
+    //Count then fill, in chunk order to keep the lists sorted
+    cellStarts_.assign(cellNb + 1, 0);
+    std::vector<std::array<int, 3>> chunkCellRanges(chunks.size() * 2);
+    for (size_t i = 0; i < chunks.size(); i++) {
+        std::array<int, 3>& minCell = chunkCellRanges[i * 2];
+        std::array<int, 3>& maxCell = chunkCellRanges[i * 2 + 1];
+        GetCellRange(
+            chunks[i].GetPosition() - chunks[i].GetExtent() * 0.5f,
+            chunks[i].GetPosition() + chunks[i].GetExtent() * 0.5f,
+            minCell,
+            maxCell);
+
+        for (int z = minCell[2]; z <= maxCell[2]; z++) {
+            for (int y = minCell[1]; y <= maxCell[1]; y++) {
+                for (int x = minCell[0]; x <= maxCell[0]; x++) { cellStarts_[GetCellIndex(x, y, z) + 1]++; }
+            }
+        }
+    }
+    for (size_t i = 0; i < cellNb; i++) { cellStarts_[i + 1] += cellStarts_[i]; }
+
+    cellChunks_.resize(cellStarts_.back());
+    std::vector<uint32_t> cellEnds(cellStarts_.begin(), cellStarts_.end() - 1);
+    for (size_t i = 0; i < chunks.size(); i++) {
+        const std::array<int, 3>& minCell = chunkCellRanges[i * 2];
+        const std::array<int, 3>& maxCell = chunkCellRanges[i * 2 + 1];
+        for (int z = minCell[2]; z <= maxCell[2]; z++) {
+            for (int y = minCell[1]; y <= maxCell[1]; y++) {
+                for (int x = minCell[0]; x <= maxCell[0]; x++) {
+                    cellChunks_[cellEnds[GetCellIndex(x, y, z)]++] = static_cast<ChunkIndex>(i);
+                }
+            }
+        }
+    }
+}
+
+ChunkIndex ChunksGrid::FindChunk(const std::vector<Chunk>& chunks, const math::Vec3 position) const
+{
+    std::array<int, 3> cell;
+    if (!GetCellRange(position, position, cell, cell)) { return kNoChunk; }
+
+    const size_t cellIndex = GetCellIndex(cell[0], cell[1], cell[2]);
+    for (uint32_t i = cellStarts_[cellIndex]; i < cellStarts_[cellIndex + 1]; i++) {
+        if (chunks[cellChunks_[i]].IsPositionInside(position)) { return cellChunks_[i]; }
+    }
+    return kNoChunk;
+}
+
+ChunkSet ChunksGrid::FindChunks(const std::vector<Chunk>& chunks, const physics::AABB aabb) const
+{
+    ChunkSet chunkSet;
+
+    std::array<int, 3> minCell;
+    std::array<int, 3> maxCell;
+    if (!GetCellRange(
+        aabb.worldPosition - aabb.worldExtent * 0.5f,
+        aabb.worldPosition + aabb.worldExtent * 0.5f,
+        minCell,
+        maxCell)) {
+        return chunkSet;
+    }
+
+    for (int z = minCell[2]; z <= maxCell[2]; z++) {
+        for (int y = minCell[1]; y <= maxCell[1]; y++) {
+            for (int x = minCell[0]; x <= maxCell[0]; x++) {
+                const size_t cellIndex = GetCellIndex(x, y, z);
+                for (uint32_t i = cellStarts_[cellIndex]; i < cellStarts_[cellIndex + 1]; i++) {
+                    const ChunkIndex chunkIndex = cellChunks_[i];
+                    if (!chunkSet.Contains(chunkIndex) && chunks[chunkIndex].Overlap(aabb)) {
+                        chunkSet.Insert(chunkIndex);
+                    }
+                }
+            }
+        }
+    }
+    return chunkSet;
+}
+
+bool ChunksGrid::GetCellRange(
+    const math::Vec3 min,
+    const math::Vec3 max,
+    std::array<int, 3>& minCell,
+    std::array<int, 3>& maxCell) const
+{
+    if (cellStarts_.empty()) { return false; }
+
+    for (int axis = 0; axis < 3; axis++) {
+        const float cellMin = std::floor((min[axis] - origin_[axis]) / cellSize_[axis]);
+        const float cellMax = std::floor((max[axis] - origin_[axis]) / cellSize_[axis]);
+        if (cellMax < 0.0f || cellMin > static_cast<float>(cellNb_[axis])) { return false; }
+
+        //The max side of the grid is in the last cell
+        minCell[axis] = std::min(std::max(static_cast<int>(cellMin), 0), cellNb_[axis] - 1);
+        maxCell[axis] = std::min(std::max(static_cast<int>(cellMax), 0), cellNb_[axis] - 1);
+    }
+    return true;
+}
+
+size_t ChunksGrid::GetCellIndex(const int x, const int y, const int z) const
+{
+    return (static_cast<size_t>(z) * cellNb_[1] + y) * cellNb_[0] + x;
+}
+} //namespace chunk
+} //namespace poke
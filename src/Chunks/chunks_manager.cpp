@@ -2,28 +2,77 @@
 
 #include <CoreEngine/ServiceLocator/service_locator_definition.h>
 #include <CoreEngine/engine.h>
-#include <bitset>
+#include <Utility/file_system.h>
+#include <Utility/log.h>
+#include <Utility/mapped_file.h>
 #include <algorithm>
+#include <set>
 
 namespace poke {
 namespace chunk {
+namespace {
+//Components an EnginePrefab can instantiate
+const ecs::ComponentMask kStreamedComponents =
+    ecs::ComponentType::TRANSFORM |
+    ecs::ComponentType::RIGIDBODY |
+    ecs::ComponentType::COLLIDER |
+    ecs::ComponentType::MODEL |
+    ecs::ComponentType::LIGHT |
+    ecs::ComponentType::SPLINE_FOLLOWER |
+    ecs::ComponentType::PARTICLE_SYSTEM |
+    ecs::ComponentType::AUDIO_SOURCE |
+    ecs::ComponentType::TRAIL_RENDERER |
+    ecs::ComponentType::EDITOR_COMPONENT;
+
+bool IsEntityStreamable(ecs::IEcsManager& ecsManager, const ecs::EntityIndex entity)
+{
+    if (!ecsManager.HasComponent(entity, ecs::ComponentType::TRANSFORM)) { return false; }
+
+    for (ecs::ComponentMask componentType = 1; componentType < ecs::ComponentType::LENGTH; componentType <<= 1) {
+        if (!(componentType & kStreamedComponents) && ecsManager.HasComponent(entity, componentType)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::string GetEvictedChunkName(const ChunkIndex chunkIndex) { return "evictedChunk" + std::to_string(chunkIndex); }
+
+std::string GetEvictedChunkPath(const ChunkIndex chunkIndex)
+{
+    return PokFileSystem::GetFullPath(GetEvictedChunkName(chunkIndex), FileType::EVICTED_CHUNK, FolderType::SAVE);
+}
+} //namespace
+
 ChunksManager::ChunksManager(Engine& engine)
+    : resourceLoader_(engine.GetModuleManager().resourcesManagerContainer.resourceLoader)
 {
     engine.GetModuleManager().sceneManager.AddOnUnloadObserver(
         [this]() { this->OnUnloadScene(); });
 }
 
+ChunksManager::~ChunksManager() { ClearStreamedChunks(); }
+
 void ChunksManager::OnUnloadScene()
 {
-    activeChunkIndex_ = 0;
+    if (isStreaming_ && !chunks_.empty()) {
+        LogDebug(
+            "Chunks streaming peak : " + std::to_string(streamingStats_.peakResidentEntityNb) + " entities, " +
+            std::to_string(streamingStats_.peakEvictedBytes) + " bytes evicted",
+            LogType::SCENE_LOG);
+    }
+
+    ClearStreamedChunks();
+    streamingStats_ = ChunkStreamingStats();
 
-    for (auto i = 0; i < nbChunk_; i++) { chunks_[i] = Chunk(); }
+    activeChunkIndex_ = 0;
 
-    nbChunk_ = 0;
+    chunks_.clear();
+    isGridDirty_ = true;
 }
 
 void ChunksManager::RegisterObserverNewActiveChunk(
-    const std::function<void(ChunkBitSet)>& observerCallback)
+    const std::function<void(ChunkIndex)>& observerCallback)
 {
     observerNewActiveChunk_.AddObserver(observerCallback);
 }
@@ -32,63 +81,52 @@ void ChunksManager::UpdateActiveChunkWithPosition(
     const math::Vec3 worldPosition)
 {
     //Check if world position is still in active chunk
-    if (!chunks_[activeChunkIndex_].IsPositionInside(worldPosition)) {
-        //Find new chunk
-        for (uint8_t i = 0; i < nbChunk_; i++) {
-            if (chunks_[i].IsPositionInside(worldPosition)) {
-                SetNewActiveChunk(i);
-                break;
-            }
-        }
-    }
+    if (activeChunkIndex_ < chunks_.size() && chunks_[activeChunkIndex_].IsPositionInside(worldPosition)) { return; }
+
+    //Find new chunk
+    const ChunkIndex newActiveChunk = GetGrid().FindChunk(chunks_, worldPosition);
+    if (newActiveChunk != ChunksGrid::kNoChunk) { SetNewActiveChunk(newActiveChunk); }
 }
 
 void ChunksManager::SetActiveChunk(const ChunkIndex chunkIndex) { SetNewActiveChunk(chunkIndex); }
 
-ChunkIndex ChunksManager::CreateChunk() { return nbChunk_++; }
+ChunkIndex ChunksManager::CreateChunk()
+{
+    cassert(chunks_.size() < ChunksGrid::kNoChunk, "Too many chunks");
+    chunks_.emplace_back();
+    isGridDirty_ = true;
+
+    if (isStreaming_) {
+        //The workers fill the loads of the streamed chunks
+        WaitPrefetches();
+        streamedChunks_.resize(chunks_.size());
+    }
+    return static_cast<ChunkIndex>(chunks_.size() - 1);
+}
 
 void ChunksManager::DestroyChunk(const ChunkIndex chunkIndex)
 {
-    for (ChunkIndex i = 0, index = 0; i < nbChunk_; i++) {
-        if (i != chunkIndex) {
-            auto chunk = chunks_[index];
-
-            //offset chunks to hide
-            auto chunksToHide = chunk.GetChunksToHide();
-            for (ChunkIndex j = 0, k = 0; j < chunksToHide.size() - 1; j++, k++) {
-                if (j == chunkIndex) { k--; }
-
-                chunksToHide[i] = chunksToHide[k];
-            }
-            chunksToHide.set(chunksToHide.size(), false);
-            chunk.SetChunksToHide(chunksToHide);
-
-            //offset chunks to show
-            auto chunksToShow = chunk.GetChunksToShow();
-            for (ChunkIndex j = 0, k = 0; j < chunksToShow.size() - 1; j++, k++) {
-                if (j == chunkIndex) { k--; }
-
-                chunksToShow[i] = chunksToShow[k];
-            }
-            chunksToShow.set(chunksToShow.size(), false);
-            chunk.SetChunksToShow(chunksToShow);
-
-            //offset chunks to destroy
-            auto chunksToDestroy = chunk.GetChunksToDestroy();
-            for (ChunkIndex j = 0, k = 0; j < chunksToDestroy.size() - 1; j++, k++) {
-                if (j == chunkIndex) { k--; }
-
-                chunksToDestroy[i] = chunksToDestroy[k];
-            }
-            chunksToShow.set(chunksToDestroy.size(), false);
-            chunk.SetChunksToDestroy(chunksToDestroy);
-
-            chunks_[i] = chunk;
-            index++;
+    cassert(!isStreaming_, "Impossible to destroy a chunk while streaming");
+    chunks_.erase(chunks_.begin() + chunkIndex);
+    isGridDirty_ = true;
+
+    //Offset the chunks after the destroyed one
+    const auto offsetChunks = [chunkIndex](const ChunkSet& chunks) {
+        ChunkSet offsetChunks;
+        for (const ChunkIndex index : chunks) {
+            if (index != chunkIndex) { offsetChunks.Insert(index > chunkIndex ? index - 1 : index); }
         }
+        return offsetChunks;
+    };
+    for (auto& chunk : chunks_) {
+        chunk.SetChunksToHide(offsetChunks(chunk.GetChunksToHide()));
+        chunk.SetChunksToShow(offsetChunks(chunk.GetChunksToShow()));
+        chunk.SetChunksToDestroy(offsetChunks(chunk.GetChunksToDestroy()));
     }
 
-    nbChunk_--;
+    if (activeChunkIndex_ > chunkIndex || activeChunkIndex_ == chunks_.size()) {
+        activeChunkIndex_ = activeChunkIndex_ > 0 ? activeChunkIndex_ - 1 : 0;
+    }
 }
 
 const Chunk& ChunksManager::GetChunk(const ChunkIndex chunkIndex) { return chunks_[chunkIndex]; }
@@ -97,46 +135,34 @@ ChunkIndex ChunksManager::GetActiveChunkIndex() { return activeChunkIndex_; }
 
 void ChunksManager::SetChunk(const ChunkIndex chunkIndex, const Chunk& chunk)
 {
-    cassert(chunkIndex < kMaxChunkNb, "chunkIndex must be smalle th kMaxChunkNb");
+    cassert(chunkIndex < chunks_.size(), "chunkIndex must be smaller than the number of chunks");
     chunks_[chunkIndex] = chunk;
+    isGridDirty_ = true;
 }
 
-void ChunksManager::SetChunks(const std::array<Chunk, kMaxChunkNb>& chunks, const uint8_t nbChunk)
-{
-    nbChunk_ = nbChunk;
-    chunks_ = chunks;
-}
-
-ChunkBitSet ChunksManager::AddEntity(const math::Vec3 position)
+void ChunksManager::SetChunks(const std::vector<Chunk>& chunks, const ChunkIndex nbChunk)
 {
-    ChunkBitSet chunksIndex = 0;
+    chunks_.assign(chunks.begin(), chunks.begin() + std::min(static_cast<size_t>(nbChunk), chunks.size()));
+    isGridDirty_ = true;
 
-    for (ChunkIndex i = 0; i < nbChunk_; i++) {
-        if (chunks_[i].IsPositionInside(position)) {
-            chunksIndex.set(i);
-            return chunksIndex;
-        }
+    if (isStreaming_) {
+        WaitPrefetches();
+        streamedChunks_.resize(chunks_.size());
     }
-
-    return Chunk::kNullIndex;
 }
 
-ChunkBitSet ChunksManager::AddEntity(const physics::AABB aabb)
+ChunkSet ChunksManager::AddEntity(const math::Vec3 position)
 {
-    ChunkBitSet chunksIndex = 0;
+    ChunkSet chunksIndex;
 
-    bool found = false;
-    for (ChunkIndex i = 0; i < nbChunk_; i++) {
-        if (chunks_[i].Overlap(aabb)) {
-            chunksIndex.set(i);
-            found = true;
-        }
-    }
-    if (!found) { return Chunk::kNullIndex; }
+    const ChunkIndex chunkIndex = GetGrid().FindChunk(chunks_, position);
+    if (chunkIndex != ChunksGrid::kNoChunk) { chunksIndex.Insert(chunkIndex); }
 
     return chunksIndex;
 }
 
+ChunkSet ChunksManager::AddEntity(const physics::AABB aabb) { return GetGrid().FindChunks(chunks_, aabb); }
+
 void ChunksManager::DebugDisplayChunk(const ChunkIndex chunkIndex)
 {
 	auto& ecsManager = EcsManagerLocator::Get();
@@ -155,12 +181,12 @@ void ChunksManager::DebugHideChunk(const ChunkIndex chunkIndex)
 	}
 }
 
-ChunkStatus ChunksManager::GetChunkStatus(const ChunkBitSet chunkIndex)
+ChunkStatus ChunksManager::GetChunkStatus(const ChunkSet& chunksIndex)
 {
     ChunkStatus chunkStatus = ChunkStatus::LENGTH;
 
-    for (ChunkIndex i = 0; i < nbChunk_; i++) {
-        if (chunkIndex.test(i)) { chunkStatus = std::min(chunks_[i].GetStatus(), chunkStatus); }
+    for (const ChunkIndex chunkIndex : chunksIndex) {
+        if (chunkIndex < chunks_.size()) { chunkStatus = std::min(chunks_[chunkIndex].GetStatus(), chunkStatus); }
     }
 
     return chunkStatus;
@@ -170,21 +196,35 @@ json ChunksManager::ToJson(const std::map<ecs::EntityIndex, ecs::EntityIndex>& b
 {
     json chunksJson;
 
-    for (ChunkIndex i = 0; i < nbChunk_; i++) { chunksJson[i] = chunks_[i].ToJson(baseParentIdToOffsetParentId); }
+    for (size_t i = 0; i < chunks_.size(); i++) { chunksJson[i] = chunks_[i].ToJson(baseParentIdToOffsetParentId); }
 
     return chunksJson;
 }
 
 void ChunksManager::SetFromJson(const json& chunksJson, const std::map<ecs::EntityIndex, ecs::EntityIndex>& baseParentIdToOffsetParentId)
 {
-    nbChunk_ = chunksJson.size();
+    chunks_.assign(chunksJson.size(), Chunk());
+    isGridDirty_ = true;
 
     for (size_t i = 0; i < chunksJson.size(); i++) {
         chunks_[i].SetFromJson(chunksJson[i], baseParentIdToOffsetParentId);
         chunks_[i].SetStatus(ChunkStatus::HIDDEN);
     }
 
+    if (chunks_.empty()) { return; }
+
     SetNewActiveChunk(0);
+
+    if (isStreaming_) { StartStreaming(); }
+}
+
+const ChunksGrid& ChunksManager::GetGrid()
+{
+    if (isGridDirty_) {
+        grid_.Build(chunks_);
+        isGridDirty_ = false;
+    }
+    return grid_;
 }
 
 void ChunksManager::SetNewActiveChunk(const ChunkIndex newActiveChunk)
@@ -197,30 +237,249 @@ void ChunksManager::SetNewActiveChunk(const ChunkIndex newActiveChunk)
     }
 
     //Set visible chunk
-    const auto visibleChunksIndex = chunks_[activeChunkIndex_].GetChunksToShow();
-    for (ChunkIndex i = 0; i < nbChunk_; i++) {
-        if (visibleChunksIndex[i]) { chunks_[i].SetStatus(ChunkStatus::VISIBLE); }
-    }
+    const ChunkSet& visibleChunksIndex = chunks_[activeChunkIndex_].GetChunksToShow();
+    for (const ChunkIndex i : visibleChunksIndex) { chunks_[i].SetStatus(ChunkStatus::VISIBLE); }
 
     //Hide chunks
-    const auto hiddenChunksIndex = chunks_[activeChunkIndex_].GetChunksToHide();
-    for (ChunkIndex i = 0; i < nbChunk_; i++) {
-        if (hiddenChunksIndex[i]) { chunks_[i].SetStatus(ChunkStatus::HIDDEN); }
-    }
+    for (const ChunkIndex i : chunks_[activeChunkIndex_].GetChunksToHide()) { chunks_[i].SetStatus(ChunkStatus::HIDDEN); }
 
     //Destroy
-    const auto destroyedChunksIndex = chunks_[activeChunkIndex_].GetChunksToDestroy();
-    for (ChunkIndex i = 0; i < nbChunk_; i++) {
-        if (destroyedChunksIndex[i]) {
-            chunks_[i].SetStatus(ChunkStatus::DESTROYED);
-            chunks_[i].Destroy();
-        }
+    for (const ChunkIndex i : chunks_[activeChunkIndex_].GetChunksToDestroy()) {
+        chunks_[i].SetStatus(ChunkStatus::DESTROYED);
+        if (isStreaming_) { EvictChunk(i); }
+        chunks_[i].Destroy();
     }
 
     //Set current chunk active
     chunks_[activeChunkIndex_].SetStatus(ChunkStatus::ACTIVE);
 
+    if (isStreaming_) {
+        for (const ChunkIndex i : visibleChunksIndex) { PrefetchChunk(i); }
+
+        //The active chunk can't wait for the next frames
+        PrefetchChunk(activeChunkIndex_);
+        if (streamedChunks_[activeChunkIndex_].loadingEntities.HasValue()) {
+            InstantiateChunk(activeChunkIndex_);
+        }
+    }
+
     observerNewActiveChunk_.Notify(activeChunkIndex_);
 }
+
+void ChunksManager::UpdateStreaming()
+{
+    if (!isStreaming_) { return; }
+
+    for (ChunkIndex i = 0; i < streamedChunks_.size(); i++) {
+        if (!streamedChunks_[i].loadingEntities.IsReady()) { continue; }
+
+        //The chunk can be hidden or destroyed while it was loading, the load is only dropped once finished
+        if (chunks_[i].GetStatus() <= ChunkStatus::VISIBLE) {
+            InstantiateChunk(i);
+        } else {
+            streamedChunks_[i].loadingEntities = Future<ChunkEntities>();
+        }
+    }
+}
+
+void ChunksManager::StartStreaming()
+{
+    ClearStreamedChunks();
+    streamedChunks_.resize(chunks_.size());
+    PokFileSystem::CreateDirectory(PokFileSystem::GetPath(FileType::EVICTED_CHUNK, FolderType::SAVE));
+
+    //Entities shared by several chunks stay in the ecs
+    std::unordered_map<ecs::EntityIndex, int> linkCounts;
+    for (const auto& chunk : chunks_) {
+        for (const auto entity : chunk.GetLinkEntities()) { linkCounts[entity]++; }
+    }
+
+    for (ChunkIndex i = 0; i < chunks_.size(); i++) {
+        streamedChunks_[i].entities = FindStreamedEntities(i, linkCounts);
+        streamingStats_.residentEntityNb += streamedChunks_[i].entities.size();
+    }
+
+    //The scene is loaded whole, the chunks not shown are evicted before the first frame
+    for (ChunkIndex i = 0; i < chunks_.size(); i++) {
+        if (chunks_[i].GetStatus() > ChunkStatus::VISIBLE) { EvictChunk(i); }
+    }
+    streamingStats_.peakResidentEntityNb = streamingStats_.residentEntityNb;
+    streamingStats_.peakEvictedBytes = streamingStats_.evictedBytes;
+}
+
+std::vector<ecs::EntityIndex> ChunksManager::FindStreamedEntities(
+    const ChunkIndex chunkIndex,
+    const std::unordered_map<ecs::EntityIndex, int>& linkCounts) const
+{
+    auto& ecsManager = EcsManagerLocator::Get();
+    auto& transformsManager = ecsManager.GetComponentsManager<ecs::TransformsManager>();
+
+    std::set<ecs::EntityIndex> streamedEntities;
+    for (const auto entity : chunks_[chunkIndex].GetLinkEntities()) {
+        if (linkCounts.at(entity) == 1 && IsEntityStreamable(ecsManager, entity)) {
+            streamedEntities.insert(entity);
+        }
+    }
+
+    //A hierarchy is streamed whole or not at all, the children are destroyed with their parent
+    bool hasRemovedEntity = true;
+    while (hasRemovedEntity) {
+        hasRemovedEntity = false;
+        for (auto it = streamedEntities.begin(); it != streamedEntities.end();) {
+            const ecs::EntityIndex parent = transformsManager.GetParent(*it);
+            bool isHierarchyStreamed = parent == ecs::kNoParent || streamedEntities.count(parent) > 0;
+            for (const auto child : transformsManager.GetChildren(*it)) {
+                isHierarchyStreamed &= streamedEntities.count(child) > 0;
+            }
+
+            if (isHierarchyStreamed) {
+                ++it;
+            } else {
+                it = streamedEntities.erase(it);
+                hasRemovedEntity = true;
+            }
+        }
+    }
+
+    //The prefab instantiates the parents before their children
+    std::vector<ecs::EntityIndex> entities;
+    entities.reserve(streamedEntities.size());
+    for (const auto root : streamedEntities) {
+        if (transformsManager.GetParent(root) != ecs::kNoParent) { continue; }
+
+        std::vector<ecs::EntityIndex> hierarchy{ root };
+        while (!hierarchy.empty()) {
+            const ecs::EntityIndex entity = hierarchy.back();
+            hierarchy.pop_back();
+            entities.push_back(entity);
+
+            const auto& children = transformsManager.GetChildren(entity);
+            hierarchy.insert(hierarchy.end(), children.rbegin(), children.rend());
+        }
+    }
+    return entities;
+}
+
+void ChunksManager::EvictChunk(const ChunkIndex chunkIndex)
+{
+    StreamedChunk& streamedChunk = streamedChunks_[chunkIndex];
+    if (streamedChunk.entities.empty()) { return; }
+
+    auto& ecsManager = EcsManagerLocator::Get();
+
+    json prefabJson = ecsManager.EntitiesToPrefabJson(streamedChunk.entities);
+    std::vector<ecs::EntityIndex> roots;
+    for (size_t i = 0; i < streamedChunk.entities.size(); i++) {
+        const ecs::EntityIndex entity = streamedChunk.entities[i];
+
+        //The indexes will change, the chunks referencing the entity are saved with it
+        json activatedBy = json::array();
+        for (ChunkIndex j = 0; j < chunks_.size(); j++) {
+            const auto& entitiesToActivate = chunks_[j].GetEntitiesToActivate();
+            if (std::find(entitiesToActivate.begin(), entitiesToActivate.end(), entity) != entitiesToActivate.end()) {
+                activatedBy.push_back(j);
+            }
+        }
+
+        prefabJson[i]["tag"] = ecsManager.GetTag(entity);
+        prefabJson[i]["activatedBy"] = activatedBy;
+
+        if (prefabJson[i]["transform"]["parent"] == ecs::kNoParent) { roots.push_back(entity); }
+    }
+
+    //The entities stay in the ecs if they can't be written
+    const std::vector<uint8_t> evictedEntities = json::to_msgpack(prefabJson);
+    if (!PokFileSystem::WriteFileAtomically(GetEvictedChunkPath(chunkIndex), evictedEntities.data(), evictedEntities.size())) {
+        LogWarning("Impossible to write the entities of the chunk " + std::to_string(chunkIndex), LogType::SCENE_LOG);
+        return;
+    }
+
+    for (const auto entity : streamedChunk.entities) {
+        for (auto& chunk : chunks_) { chunk.RemoveEntityToActivate(entity); }
+        chunks_[chunkIndex].RemoveLinkEntity(entity);
+    }
+    ecsManager.DestroyEntities(roots);
+
+    streamedChunk.isEvicted = true;
+    streamedChunk.evictedBytes = evictedEntities.size();
+    streamingStats_.residentEntityNb -= streamedChunk.entities.size();
+    streamingStats_.evictedBytes += streamedChunk.evictedBytes;
+    streamingStats_.peakEvictedBytes = std::max(streamingStats_.peakEvictedBytes, streamingStats_.evictedBytes);
+    streamingStats_.evictedChunkNb++;
+    streamedChunk.entities.clear();
+}
+
+void ChunksManager::PrefetchChunk(const ChunkIndex chunkIndex)
+{
+    StreamedChunk& streamedChunk = streamedChunks_[chunkIndex];
+    if (!streamedChunk.isEvicted || streamedChunk.loadingEntities.HasValue()) { return; }
+
+    //The file isn't modified before the chunk is instantiated or the scene unloaded, which waits for the loader
+    streamedChunk.loadingEntities = resourceLoader_.LoadAsync<ChunkEntities>([evictedChunkPath = GetEvictedChunkPath(chunkIndex)]() {
+        ChunkEntities chunkEntities;
+
+        MappedFile evictedFile;
+        if (!evictedFile.Open(evictedChunkPath)) { return chunkEntities; }
+        const json prefabJson = json::from_msgpack(evictedFile.GetData(), evictedFile.GetData() + evictedFile.GetSize());
+
+        chunkEntities.prefab.SetFromJson(prefabJson);
+        for (const auto& objectJson : prefabJson) {
+            chunkEntities.tags.push_back(objectJson["tag"]);
+            ChunkSet activatedBy;
+            for (const auto& chunkIndex : objectJson["activatedBy"]) { activatedBy.Insert(chunkIndex.get<ChunkIndex>()); }
+            chunkEntities.activatedBy.push_back(activatedBy);
+        }
+        chunkEntities.isRead = true;
+        return chunkEntities;
+    });
+}
+
+void ChunksManager::WaitPrefetches()
+{
+    for (const auto& streamedChunk : streamedChunks_) { streamedChunk.loadingEntities.Wait(); }
+}
+
+void ChunksManager::ClearStreamedChunks()
+{
+    WaitPrefetches();
+    for (ChunkIndex i = 0; i < streamedChunks_.size(); i++) {
+        if (streamedChunks_[i].isEvicted) {
+            PokFileSystem::DeleteFile(GetEvictedChunkName(i), FileType::EVICTED_CHUNK, FolderType::SAVE);
+        }
+    }
+    streamedChunks_.clear();
+}
+
+void ChunksManager::InstantiateChunk(const ChunkIndex chunkIndex)
+{
+    StreamedChunk& streamedChunk = streamedChunks_[chunkIndex];
+    const ChunkEntities& chunkEntities = streamedChunk.loadingEntities.Get();
+    if (!chunkEntities.isRead) {
+        LogWarning("Impossible to read the entities of the chunk " + std::to_string(chunkIndex), LogType::SCENE_LOG);
+    }
+
+    auto& ecsManager = EcsManagerLocator::Get();
+    streamedChunk.entities = chunkEntities.prefab.Instantiate();
+    for (size_t i = 0; i < streamedChunk.entities.size(); i++) {
+        const ecs::EntityIndex entity = streamedChunk.entities[i];
+        ecsManager.SetTag(entity, chunkEntities.tags[i]);
+        chunks_[chunkIndex].AddLinkEntity(entity);
+
+        for (const ChunkIndex j : chunkEntities.activatedBy[i]) { chunks_[j].AddEntityToActivate(entity); }
+        if (chunkEntities.activatedBy[i].Contains(activeChunkIndex_)) {
+            ecsManager.SetActive(entity, ecs::EntityStatus::ACTIVE);
+        }
+    }
+
+    streamingStats_.residentEntityNb += streamedChunk.entities.size();
+    streamingStats_.peakResidentEntityNb = std::max(streamingStats_.peakResidentEntityNb, streamingStats_.residentEntityNb);
+    streamingStats_.evictedBytes -= streamedChunk.evictedBytes;
+    streamingStats_.loadedChunkNb++;
+
+    streamedChunk.loadingEntities = Future<ChunkEntities>();
+    streamedChunk.isEvicted = false;
+    streamedChunk.evictedBytes = 0;
+    PokFileSystem::DeleteFile(GetEvictedChunkName(chunkIndex), FileType::EVICTED_CHUNK, FolderType::SAVE);
+}
 } //namespace chunk
-} //namespace poke
\ No newline at end of file
+} //namespace poke
@@ -23,7 +23,7 @@ ChunksSystem::ChunksSystem(Engine& engine)
     ObserveEntityRemoveComponent();
 
     ChunksManagerLocator::Get().RegisterObserverNewActiveChunk(
-        [this](const chunk::ChunkBitSet chunkIndex) { OnChangeActiveChunk(chunkIndex); });
+        [this](const chunk::ChunkIndex chunkIndex) { OnChangeActiveChunk(chunkIndex); });
 
     SceneManagerLocator::Get().AddOnUnloadObserver([this]() { OnUnloadScene(); });
 }
@@ -32,6 +32,8 @@ void ChunksSystem::OnUpdate()
 {
     pok_BeginProfiling(Chunk_System, 0);
 
+    chunksManager_.UpdateStreaming();
+
     //If there is no chunk, then everything is active and visible
     if (chunksManager_.GetChunkNb() == 0) {
         for (auto entity : updateEntities_) {
@@ -68,7 +70,7 @@ void ChunksSystem::OnUpdate()
                 transformsManager_.GetWorldPosition(newEntity));
         }
 
-        if (chunkIndex_[newEntity] == chunk::Chunk::kNullIndex) {
+        if (chunkIndex_[newEntity].IsEmpty()) {
             ecsManager_.SetActive(newEntity, ecs::EntityStatus::INACTIVE);
             ecsManager_.SetEntityVisible(newEntity, ecs::EntityStatus::INACTIVE);
             continue;
@@ -115,7 +117,7 @@ void ChunksSystem::OnUpdate()
     pok_BeginProfiling(Active_Chunk, 0);
 
     for (auto entity : updateEntities_) {
-        if (chunkIndex_[entity] == chunk::Chunk::kNullIndex) {
+        if (chunkIndex_[entity].IsEmpty()) {
             ecsManager_.SetActive(entity, ecs::EntityStatus::INACTIVE);
             ecsManager_.SetEntityVisible(entity, ecs::EntityStatus::INACTIVE);
             continue;
@@ -144,6 +146,13 @@ void ChunksSystem::OnUpdate()
 void ChunksSystem::OnEntityDestroy(const ecs::EntityIndex entityIndex)
 {
     destroyedEntities_.insert(entityIndex);
+
+    //The index can be reused in the same frame by the chunks streaming
+    const auto newEntityIt = newEntities_.find(entityIndex);
+    if (newEntityIt != newEntities_.end() && *newEntityIt == entityIndex) { newEntities_.erase(newEntityIt); }
+
+    const auto updateEntityIt = updateEntities_.find(entityIndex);
+    if (updateEntityIt != updateEntities_.end() && *updateEntityIt == entityIndex) { updateEntities_.erase(updateEntityIt); }
 }
 
 void ChunksSystem::OnEntityAddComponent(
@@ -183,7 +192,7 @@ void ChunksSystem::OnUnloadScene()
     updateEntities_.clear();
 }
 
-void ChunksSystem::OnChangeActiveChunk(const chunk::ChunkBitSet chunkIndex)
+void ChunksSystem::OnChangeActiveChunk(const chunk::ChunkIndex chunkIndex)
 {
     for (ecs::EntityIndex i = 0; i < maxEntityIndex_; i++) {
 		if (updateEntities_.exist(i)) { continue; }
@@ -198,7 +207,7 @@ void ChunksSystem::OnChangeActiveChunk(const chunk::ChunkBitSet chunkIndex)
             chunkIndex_[i] = chunksManager_.AddEntity(transformsManager_.GetWorldPosition(i));
         }
 
-        if (chunkIndex_[i] == chunk::Chunk::kNullIndex) {
+        if (chunkIndex_[i].IsEmpty()) {
             ecsManager_.SetActive(i, ecs::EntityStatus::INACTIVE);
             ecsManager_.SetEntityVisible(i, ecs::EntityStatus::INACTIVE);
             continue;
@@ -1,5 +1,7 @@
 #include <CoreEngine/CoreSystems/draw_system.h>
 
+#include <algorithm>
+
 #include <CoreEngine/engine.h>
 #include <CoreEngine/ServiceLocator/service_locator_definition.h>
 #include <Utility/profiler.h>
@@ -46,25 +48,41 @@ void DrawSystem::OnDraw()
     pok_BeginProfiling(Draw_System, 0);
 
 	pok_BeginProfiling(Entities, 0);
+	auto& instanceDrawInfos = instanceDrawInfos_.GetWriteBuffer();
 	entitiesToDraw_.reserve(entities_.size());
+
+	auto& camera = CameraLocator::Get();
+	const math::Vec3 cameraPosition = camera.GetPosition();
+	const float projectionScale = camera.GetProjectionMatrix()[1][1];
+
     for (const ecs::EntityIndex entityIndex : entities_) {
         if (ecsManager_.IsEntityVisible(entityIndex)) {
-            //Compute aabb
+            const math::Vec3 worldPosition = transformsManager_.GetWorldPosition(entityIndex);
+
+            //Compute aabb, the extent of a mesh shape doesn't depend on the rotation
 			pok_BeginProfiling(Compute_aabb, 0);
             const auto aabb = meshShapes_[entityIndex].ComputeAABB(
-                transformsManager_.GetWorldPosition(entityIndex),
+                worldPosition,
                 transformsManager_.GetWorldScale(entityIndex),
-                transformsManager_.GetWorldRotation(entityIndex)
+                math::Vec3(0, 0, 0)
             );
 			pok_EndProfiling(Compute_aabb);
 
+            //Level of detail from the size of the aabb on the screen
+            const InstancingIndexes& instancingIndexes = instancingIndexes_[entityIndex];
+            const size_t lod = graphics::SelectLod(
+                graphics::GetLodRadius(aabb.worldExtent),
+                math::Vec3::GetDistance(worldPosition, cameraPosition),
+                projectionScale,
+                instancingIndexes.lodCount);
+
             //Add Drawing command
 			pok_BeginProfiling(Add_drawing_cmd, 0);
-            instanceDrawInfos1_[instancingIndexes_[entityIndex]].instances.push_back(
+            instanceDrawInfos[instancingIndexes.lods[lod]].instances.push_back(
                 {
                     transformsManager_.GetLocalToWorldMatrix(entityIndex),
                     aabb,
-                    transformsManager_.GetWorldPosition(entityIndex),
+                    worldPosition,
                     entityIndex
                 });
 
@@ -75,8 +93,9 @@ void DrawSystem::OnDraw()
 	pok_EndProfiling(Entities);
 
 	pok_BeginProfiling(Forced_drawn_entities, 0);
+	auto& forwardDrawInfos = forwardDrawInfos_.GetWriteBuffer();
     for (ecs::EntityIndex entityIndex : forcedDrawEntities_) {
-        forwardDrawInfo1_.emplace_back(
+        forwardDrawInfos.emplace_back(
             BlockDrawForwardInfo{
                 transformsManager_.GetLocalToWorldMatrix(entityIndex),
                 modelsManager_.GetComponent(entityIndex),
@@ -93,9 +112,6 @@ void DrawSystem::OnEndOfFrame()
 {
     pok_BeginProfiling(Draw_System, 0);
 
-    //TODO(@Nico) create field.
-    auto& meshManagerLocator = MeshManagerLocator::Get();
-
     //Get InstancesIndex for new entities
     if (newEntities_.size() > 0) {
         if (instancingIndexes_.size() < newEntities_.back() + 1) {
@@ -110,16 +126,12 @@ void DrawSystem::OnEndOfFrame()
 
             const auto& mat = MaterialsManagerLocator::Get().GetMaterial(model.materialID);
 
-            const auto& mesh = meshManagerLocator.GetMesh(model.meshID);
-            const auto index = modelCommandBuffer_.GetModelInstanceIndex(mat, mesh);
-            if (instanceDrawInfos1_.size() < index + 1) { instanceDrawInfos1_.resize(index + 1); }
-
-            instancingIndexes_[newEntity] = index;
+            auto& mesh = SetInstancingIndexes(newEntity, mat, model.meshID);
 
             entities_.insert(newEntity);
 
 			if (meshShapes_.size() < newEntity + 1) meshShapes_.resize(newEntity + 1);
-			meshShapes_[newEntity] = physics::MeshShape(meshManagerLocator.GetMesh(modelsManager_.GetComponent(newEntity).meshID));
+			meshShapes_[newEntity] = physics::MeshShape(mesh);
         }
         newEntities_.clear();
     }
@@ -145,14 +157,22 @@ void DrawSystem::OnEndOfFrame()
     };
     GraphicsEngineLocator::Get().SetCameraData(cameraData);
     ecsManager_.SetVisibleEntities(drawnEntities_);
-    drawnEntities_ = entitiesToDraw_;
+    std::swap(drawnEntities_, entitiesToDraw_);
     entitiesToDraw_.clear();
 
-    instanceDrawInfos2_ = instanceDrawInfos1_;
-    for (auto& infos1 : instanceDrawInfos1_) { infos1.instances.clear(); }
+    //Hand the frame to the render thread, it is fetched by the culling. Only buffer indexes are exchanged
+    const size_t instancingCount = instanceDrawInfos_.GetWriteBuffer().size();
+    instanceDrawInfos_.Publish();
+
+    //The buffer given back contains an old frame and can be smaller than the current one
+    auto& instanceDrawInfos = instanceDrawInfos_.GetWriteBuffer();
+    if (instanceDrawInfos.size() < instancingCount) {
+        instanceDrawInfos.resize(instancingCount);
+    }
+    for (auto& infos : instanceDrawInfos) { infos.instances.clear(); }
 
-    forwardDrawInfo2_ = forwardDrawInfo1_;
-    forwardDrawInfo1_.clear();
+    forwardDrawInfos_.Publish();
+    forwardDrawInfos_.GetWriteBuffer().clear();
 
     pok_EndProfiling(Draw_System);
 }
@@ -161,13 +181,19 @@ void DrawSystem::OnCulling()
 {
     //Check only object that are visible
     pok_BeginProfiling(Draw_System, 0);
-    std::vector<ecs::EntityIndex> visibleEntities;
-    visibleEntities.reserve(instanceDrawInfos2_.size());
+    //Last frame published by the main thread, the previous one is drawn again if there is none
+    instanceDrawInfos_.Fetch();
+    forwardDrawInfos_.Fetch();
+
+    auto& instanceDrawInfos = instanceDrawInfos_.GetReadBuffer();
+    //Filled in place, the vector keeps its capacity from one frame to another
+    drawnEntities_.clear();
+    drawnEntities_.reserve(instanceDrawInfos.size());
 
     const auto frustumPlanes = CameraLocator::Get().GetFrustumPlanes();
     //Forced entities
-    for (auto& model : forwardDrawInfo2_) {
-        visibleEntities.emplace_back(model.entityIndex);
+    for (auto& model : forwardDrawInfos_.GetReadBuffer()) {
+        drawnEntities_.emplace_back(model.entityIndex);
         modelCommandBuffer_.Draw(
             model.worldMatrix,
             model.model,
@@ -177,36 +203,34 @@ void DrawSystem::OnCulling()
     const auto cameraPos = CameraLocator::Get().GetPosition();
 
     //Opaque entities
-    for (auto i = 0; i < instanceDrawInfos2_.size(); i++) {
-        if (instanceDrawInfos2_[i].frontToBackSorting) {
+    for (auto i = 0; i < instanceDrawInfos.size(); i++) {
+        if (instanceDrawInfos[i].frontToBackSorting) {
             std::sort(
-                instanceDrawInfos2_[i].instances.begin(),
-                instanceDrawInfos2_[i].instances.end(),
+                instanceDrawInfos[i].instances.begin(),
+                instanceDrawInfos[i].instances.end(),
                 [cameraPos](const BlockDrawInstanceInfo& a, const BlockDrawInstanceInfo& b) {
                     return math::Vec3::GetDistanceManhattan(a.worldPosition, cameraPos) < math::Vec3
                            ::GetDistanceManhattan(b.worldPosition, cameraPos);
                 });
         } else {
             std::sort(
-                instanceDrawInfos2_[i].instances.begin(),
-                instanceDrawInfos2_[i].instances.end(),
+                instanceDrawInfos[i].instances.begin(),
+                instanceDrawInfos[i].instances.end(),
                 [cameraPos](const BlockDrawInstanceInfo& a, const BlockDrawInstanceInfo& b) {
                     return math::Vec3::GetDistanceManhattan(a.worldPosition, cameraPos) > math::Vec3
                            ::GetDistanceManhattan(b.worldPosition, cameraPos);
                 });
         }
 
-        for (const auto& info : instanceDrawInfos2_[i].instances) {
+        for (const auto& info : instanceDrawInfos[i].instances) {
             if (CullAABB(info.aabb, frustumPlanes)) {
-                visibleEntities.emplace_back(info.entityIndex);
+                drawnEntities_.emplace_back(info.entityIndex);
 
                 modelCommandBuffer_.Draw(info.worldMatrix, i);
             }
         }
     }
 
-    drawnEntities_ = visibleEntities;
-
     pok_EndProfiling(Draw_System);
 }
 
@@ -214,10 +238,8 @@ void DrawSystem::OnRender() { GraphicsEngineLocator::Get().Render(); }
 
 void DrawSystem::OnUnloadScene()
 {
-    forwardDrawInfo1_.clear();
-    forwardDrawInfo2_.clear();
-    instanceDrawInfos1_.clear();
-    instanceDrawInfos2_.clear();
+    forwardDrawInfos_.ForEach([](std::vector<BlockDrawForwardInfo>& infos) { infos.clear(); });
+    instanceDrawInfos_.ForEach([](std::vector<DrawInstancesInfo>& infos) { infos.clear(); });
     instancingIndexes_.clear();
     forwardIndexes_.clear();
 }
@@ -268,17 +290,9 @@ void DrawSystem::OnUpdateComponent(
         switch (mat.GetType()) {
         case graphics::MaterialType::DIFFUSE: {
             if (entities_.exist(entityIndex)) {
-                const auto& mesh = MeshManagerLocator::Get().GetMesh(model.meshID);
-                instancingIndexes_[entityIndex] = GraphicsEngineLocator::Get()
-                                                  .GetModelCommandBuffer().GetModelInstanceIndex(
-                                                      mat,
-                                                      mesh);
-
-                if (instanceDrawInfos1_.size() < instancingIndexes_[entityIndex] + 1) {
-                    instanceDrawInfos1_.resize(instancingIndexes_[entityIndex] + 1);
-                }
+                auto& mesh = SetInstancingIndexes(entityIndex, mat, model.meshID);
 
-                meshShapes_[entityIndex] = physics::MeshShape(MeshManagerLocator::Get().GetMesh(modelsManager_.GetComponent(entityIndex).meshID));
+                meshShapes_[entityIndex] = physics::MeshShape(mesh);
             }
         }
         break;
@@ -297,6 +311,35 @@ void DrawSystem::OnUpdateComponent(
     }
 }
 
+graphics::Mesh& DrawSystem::SetInstancingIndexes(
+    const ecs::EntityIndex entityIndex,
+    const graphics::Material& material,
+    const ResourceID meshID)
+{
+    auto& meshManager = MeshManagerLocator::Get();
+
+    //Unknown meshes are drawn with the default mesh, without levels of detail
+    const ResourceHandle meshHandle = meshManager.GetMeshHandle(meshID);
+    auto& mesh = meshHandle != kInvalidResourceHandle ?
+        meshManager.GetMeshByHandle(meshHandle) :
+        meshManager.GetMesh(meshID);
+
+    InstancingIndexes& instancingIndexes = instancingIndexes_[entityIndex];
+    instancingIndexes.lodCount = meshHandle != kInvalidResourceHandle ?
+        std::min(meshManager.GetMeshLodCount(meshHandle), graphics::kMaxLodCount) :
+        1;
+
+    auto& instanceDrawInfos = instanceDrawInfos_.GetWriteBuffer();
+    for (size_t lod = 0; lod < instancingIndexes.lodCount; lod++) {
+        const auto& lodMesh = lod == 0 ? mesh : meshManager.GetMeshLodByHandle(meshHandle, lod);
+        const auto index = modelCommandBuffer_.GetModelInstanceIndex(material, mesh, lodMesh, lod);
+        if (instanceDrawInfos.size() < index + 1) { instanceDrawInfos.resize(index + 1); }
+
+        instancingIndexes.lods[lod] = index;
+    }
+    return mesh;
+}
+
 bool DrawSystem::CullAABB(
     const physics::AABB aabb,
     const FrustumPlanes& frustumPlanes)
@@ -1,9 +1,13 @@
 #include <CoreEngine/CoreSystems/particles_system.h>
 
+#include <algorithm>
+
 #include <CoreEngine/engine.h>
 #include <Utility/time_custom.h>
 #include <GraphicsEngine/Particles/particle.h>
+#include <GraphicsEngine/Particles/particle_kernels.h>
 #include <Utility/profiler.h>
+#include <Memory/frame_arena.h>
 
 namespace poke {
 ParticlesSystem::ParticlesSystem(Engine& engine)
@@ -15,7 +19,8 @@ ParticlesSystem::ParticlesSystem(Engine& engine)
       transformsManager_(ecsManager_.GetComponentsManager<ecs::TransformsManager>()),
       materialManager_(MaterialsManagerLocator::Get()),
       camera_(CameraLocator::Get()),
-      particleCommandBuffer_(GraphicsEngineLocator::Get().GetParticleCommandBuffer())
+      particleCommandBuffer_(GraphicsEngineLocator::Get().GetParticleCommandBuffer()),
+      jobPool_(engine.GetJobPool())
 {
     engine_.AddObserver(
         observer::MainLoopSubject::UPDATE,
@@ -85,39 +90,37 @@ void ParticlesSystem::OnDraw()
     pok_BeginProfiling(Particle_System, 0);
 
     const float dt = Time::Get().deltaTime.count() / 1000.0f;
+    simulationDeltaTime_ = dt;
+    simulationCameraPosition_ = camera_.GetPosition();
 
-    const auto camPos = camera_.GetPosition();
+    //The buffer given back by the render thread can be from an older frame, every packet is rewritten
+    auto& drawPackets = drawPackets_.GetWriteBuffer();
+    drawPackets.resize(particleSystems_.size());
 
-    //Check life time and emit time
+    //Emission uses the components managers and the random generator, it stays on the main thread
+    auto particleSystemComponents = particleSystemsManager_.GetComponentsView();
     for (size_t i = 0; i < particleSystems_.size(); i++) {
         const auto entityIndex = particleSystems_[i];
+        drawPackets[i].instanceIndex = particleInstanceIndexes_[i];
+        particles_[i].isSimulated = false;
 #pragma region EMIT
         pok_BeginProfiling(Emit, 0);
-        auto particleSystem = particleSystemsManager_.GetComponent(entityIndex);
+        auto& particleSystem = particleSystemComponents[entityIndex];
 
         //Check lifetime
         pok_BeginProfiling(Check_lifetime, 0);
+        const float lifetime = particleSystem.lifetime;
         if (!particleSystem.UpdateLifetime(dt)) {
-			auto& fillingVector = particlesDrawing_[i];
-			fillingVector.clear();
+            //A finished system keeps its lifetime, it would start again otherwise
+            particleSystem.lifetime = lifetime;
+            drawPackets[i].particles.clear();
             pok_EndProfiling(Check_lifetime);
             pok_EndProfiling(Emit);
             continue;
         }
         pok_EndProfiling(Check_lifetime);
-        auto& numberOfRows = particles_[i].numberOfRows;
-        auto& originalColor = particles_[i].originalColor;
-        auto& colorOffset = particles_[i].colorOffset;
-        auto& colorOverLifetime = particles_[i].colorOverLifetime;
-        auto& position = particles_[i].position;
-        auto& velocity = particles_[i].velocity;
-        auto& imageOffset1 = particles_[i].imageOffset1;
-        auto& imageOffset2 = particles_[i].imageOffset2;
-        auto& lifetime = particles_[i].lifetime;
-        auto& scale = particles_[i].scale;
-        auto& elapsedTime = particles_[i].elapsedTime;
-        auto& transparency = particles_[i].transparency;
-        auto& imageBlendFactor = particles_[i].imageBlendFactor;
+        auto& particles = particles_[i];
+        particles.SetRingBuffer(particleSystem.minLifetime == particleSystem.maxLifetime);
 
         //Check Rate over Time Emit
         pok_BeginProfiling(Check_rate_over_time, 0);
@@ -130,49 +133,10 @@ void ParticlesSystem::OnDraw()
             if (particleSystem.timeEmit > rate) {
                 const auto worldPos = transformsManager_.GetWorldPosition(entityIndex);
                 while (particleSystem.timeEmit > rate) {
-                    auto particle = particleSystem.EmitParticle(worldPos);
+                    const auto particle = particleSystem.EmitParticle(worldPos);
                     particleSystem.timeEmit -= rate;
 
-                    if (particles_[i].nbParticles >= particleSystem.maxParticles)
-                        continue;
-                    const size_t index = particles_[i].nbParticles++;
-                    /*if (particles_[particleSystemIndex].nbParticles % 500 == 0) {
-                        LogDebug(std::to_string(particles_[particleSystemIndex].nbParticles) + " -> dt = " + std::to_string(dt));
-                    }*/
-
-                    if (numberOfRows.size() <= index) {
-                        const size_t newSize = std::min(
-                            index * 2 + 1,
-                            static_cast<size_t>(particleSystem.maxParticles));
-
-                        numberOfRows.resize(newSize);
-                        originalColor.resize(newSize);
-                        colorOffset.resize(newSize);
-                        colorOverLifetime.resize(newSize);
-                        position.resize(newSize);
-                        velocity.resize(newSize);
-                        imageOffset1.resize(newSize);
-                        imageOffset2.resize(newSize);
-                        lifetime.resize(newSize);
-                        scale.resize(newSize);
-                        elapsedTime.resize(newSize);
-                        transparency.resize(newSize);
-                        imageBlendFactor.resize(newSize);
-                    }
-
-                    numberOfRows[index] = particle.numberOfRows;
-                    originalColor[index] = particle.originalColor;
-                    colorOffset[index] = particle.colorOffset;
-                    colorOverLifetime[index] = particle.colorOverLifetime;
-                    position[index] = particle.position;
-                    velocity[index] = particle.velocity;
-                    imageOffset1[index] = particle.imageOffset1;
-                    imageOffset2[index] = particle.imageOffset2;
-                    lifetime[index] = particle.lifetime;
-                    scale[index] = particle.scale;
-                    elapsedTime[index] = 0;
-                    transparency[index] = particle.transparency;
-                    imageBlendFactor[index] = particle.imageBlendFactor;
+                    particles.Emit(particle, particleSystem.maxParticles);
                 }
             }
         }
@@ -190,124 +154,150 @@ void ParticlesSystem::OnDraw()
 
             if (particleSystem.distanceEmit > particleSystem.rateOverDistance) {
                 while (particleSystem.distanceEmit > particleSystem.rateOverDistance) {
-                    auto particle = particleSystem.EmitParticle(worldPos);
+                    const auto particle = particleSystem.EmitParticle(worldPos);
                     particleSystem.distanceEmit -= 1.0f / particleSystem.rateOverDistance;
 
-                    if (particles_[i].nbParticles >= particleSystem.maxParticles)
-                        continue;
-                    const size_t index = particles_[i].nbParticles++;
-
-                    if (numberOfRows.size() <= index) {
-                        const size_t newSize = std::min(
-                            index * 2 + 1,
-                            static_cast<size_t>(particleSystem.maxParticles));
-
-                        numberOfRows.resize(newSize);
-                        originalColor.resize(newSize);
-                        colorOffset.resize(newSize);
-                        colorOverLifetime.resize(newSize);
-                        position.resize(newSize);
-                        velocity.resize(newSize);
-                        imageOffset1.resize(newSize);
-                        imageOffset2.resize(newSize);
-                        lifetime.resize(newSize);
-                        scale.resize(newSize);
-                        elapsedTime.resize(newSize);
-                        transparency.resize(newSize);
-                        imageBlendFactor.resize(newSize);
-                    }
-
-                    numberOfRows[index] = particle.numberOfRows;
-                    originalColor[index] = particle.originalColor;
-                    colorOffset[index] = particle.colorOffset;
-                    colorOverLifetime[index] = particle.colorOverLifetime;
-                    position[index] = particle.position;
-                    velocity[index] = particle.velocity;
-                    imageOffset1[index] = particle.imageOffset1;
-                    imageOffset2[index] = particle.imageOffset2;
-                    lifetime[index] = particle.lifetime;
-                    scale[index] = particle.scale;
-                    elapsedTime[index] = 0;
-                    transparency[index] = particle.transparency;
-                    imageBlendFactor[index] = particle.imageBlendFactor;
+                    particles.Emit(particle, particleSystem.maxParticles);
                 }
             }
         }
-        particleSystemsManager_.SetComponent(entityIndex, particleSystem);
         pok_EndProfiling(Check_rate_over_distance);
         pok_EndProfiling(Emit);
 #pragma endregion
-        if (particles_[i].nbParticles <= 0)
+        if (particles_[i].nbParticles <= 0) {
+            drawPackets[i].particles.clear();
             continue;
-        //Update particle system
-        pok_BeginProfiling(Update_particle_system, 0);
-        //Check alive
-        pok_BeginProfiling(Age, 0);
-        const int size = particles_[i].nbParticles;
-        for (size_t i = 0; i < size; ++i) { elapsedTime[i] += dt; }
-        pok_EndProfiling(Age);
-        pok_BeginProfiling(Check_alive, 0);
-
-        auto upperBound = particles_[i].nbParticles;
-        for (auto j = size - 1; j >= 0; --j) {
-            if (elapsedTime[j] < lifetime[j]) {
-                upperBound = j + 1;
-                break;
-            }
         }
 
-        for (auto i = 0; i < upperBound; i++) {
-            if (elapsedTime[i] >= lifetime[i]) {
-                //Swap dead and living particles
-                const auto index = upperBound - 1;
-                std::swap(numberOfRows[i], numberOfRows[index]);
-                std::swap(originalColor[i], originalColor[index]);
-                std::swap(colorOffset[i], colorOffset[index]);
-                std::swap(colorOverLifetime[i], colorOverLifetime[index]);
-                std::swap(position[i], position[index]);
-                std::swap(velocity[i], velocity[index]);
-                std::swap(imageOffset1[i], imageOffset1[index]);
-                std::swap(imageOffset2[i], imageOffset2[index]);
-                std::swap(lifetime[i], lifetime[index]);
-                std::swap(scale[i], scale[index]);
-                std::swap(elapsedTime[i], elapsedTime[index]);
-                std::swap(transparency[i], transparency[index]);
-                std::swap(imageBlendFactor[i], imageBlendFactor[index]);
-
-                for (auto j = upperBound - 1; j >= 0; --j) {
-                    if (elapsedTime[j] < lifetime[j]) {
-                        upperBound = j + 1;
-                        break;
-                    }
-                }
-            }
+        particles_[i].isSimulated = true;
+    }
+
+    pok_BeginProfiling(Simulate_particles, 0);
+    SimulateParticleSystems(drawPackets);
+    pok_EndProfiling(Simulate_particles);
+
+    pok_EndProfiling(Particle_System);
+}
+
+void ParticlesSystem::SimulateParticleSystems(std::vector<ParticlesDrawPacket>& drawPackets)
+{
+    size_t particlesCount = 0;
+    for (const auto& particle : particles_) {
+        if (particle.isSimulated) { particlesCount += particle.nbParticles; }
+    }
+
+    //Emitters are split in contiguous ranges of roughly the same number of particles,
+    //the first range is simulated by the main thread
+    const size_t rangesCount = jobPool_.GetWorkerCount() + 1;
+    const size_t particlesPerRange = std::max(
+        kMinParticlesPerRange,
+        (particlesCount + rangesCount - 1) / rangesCount);
+
+    simulationRanges_.clear();
+    size_t rangeBegin = 0;
+    size_t rangeParticles = 0;
+    for (size_t i = 0; i < particles_.size(); i++) {
+        if (particles_[i].isSimulated) { rangeParticles += particles_[i].nbParticles; }
+
+        if (rangeParticles >= particlesPerRange && simulationRanges_.size() + 1 < rangesCount) {
+            simulationRanges_.emplace_back(rangeBegin, i + 1);
+            rangeBegin = i + 1;
+            rangeParticles = 0;
         }
-        particles_[i].nbParticles = upperBound;
-        pok_EndProfiling(Check_alive);
-        if (upperBound <= 0) {
-            pok_BeginProfiling(Update_particle_system, 0);
-            continue;
+    }
+    if (rangeBegin < particles_.size()) { simulationRanges_.emplace_back(rangeBegin, particles_.size()); }
+
+    for (size_t range = 1; range < simulationRanges_.size(); range++) {
+        jobPool_.GetWorker(range - 1).DoAsync([this, range, &drawPackets]() {
+            pok_BeginProfiling(Particle_System_Worker, 0);
+            for (size_t i = simulationRanges_[range].first; i < simulationRanges_[range].second; i++) {
+                if (particles_[i].isSimulated) { SimulateParticleSystem(i, drawPackets[i]); }
+            }
+            pok_EndProfiling(Particle_System_Worker);
+        });
+    }
+
+    if (!simulationRanges_.empty()) {
+        for (size_t i = simulationRanges_[0].first; i < simulationRanges_[0].second; i++) {
+            if (particles_[i].isSimulated) { SimulateParticleSystem(i, drawPackets[i]); }
         }
-        //Update velocity
-        pok_BeginProfiling(Update_velocity, 0);
-        const auto gravityFactor = -10.0f * particleSystem.gravityModifier * dt;
-
-        for (int j = 0; j < upperBound; j++) { velocity[j].y += gravityFactor; }
-        pok_EndProfiling(Update_velocity);
-        //Update position
-        pok_BeginProfiling(Update_position, 0);
-        for (int j = 0; j < upperBound; j++) { position[j] += velocity[j] * dt; }
-        pok_EndProfiling(Update_position);
-        //Update
-        pok_BeginProfiling(Update, 0);
-        for (int j = 0; j < upperBound; j++) {
-            //Color
-            const auto lifeFactor = elapsedTime[j] / lifetime[j];
-            colorOffset[j] = originalColor[j] * particleSystem.colorOverLifetime.GetColorAt(
-                                 lifeFactor);
+    }
+
+    for (size_t range = 1; range < simulationRanges_.size(); range++) {
+        jobPool_.GetWorker(range - 1).Wait();
+    }
+}
 
-            transparency[j] = colorOffset[j].a;
+void ParticlesSystem::SimulateParticleSystem(const size_t particleIndex, ParticlesDrawPacket& drawPacket)
+{
+    using namespace graphics::particle_kernels;
+
+    pok_BeginProfiling(Update_particle_system, 0);
+    const float dt = simulationDeltaTime_;
+    auto& particles = particles_[particleIndex];
+
+    //Alive particles are in one segment, or two if the ring buffer wraps around
+    pok_BeginProfiling(Age, 0);
+    const auto forEachSegment = [&particles](auto function) {
+        const size_t end = particles.firstParticle + particles.nbParticles;
+        const size_t firstEnd = std::min(end, particles.GetCapacity());
+        function(particles.firstParticle, firstEnd - particles.firstParticle);
+        if (end > firstEnd) { function(size_t(0), end - firstEnd); }
+    };
+
+    forEachSegment([&particles, dt](const size_t begin, const size_t count) {
+        AgeParticles(particles.elapsedTime.data() + begin, count, dt);
+    });
+    pok_EndProfiling(Age);
+
+    pok_BeginProfiling(Check_alive, 0);
+    particles.RemoveDeadParticles();
+    pok_EndProfiling(Check_alive);
+    if (particles.nbParticles <= 0) {
+        drawPacket.particles.clear();
+        pok_EndProfiling(Update_particle_system);
+        return;
+    }
 
+    auto& originalColor = particles.originalColor;
+    auto& colorOffset = particles.colorOffset;
+    auto& position = particles.position;
+    auto& velocity = particles.velocity;
+    auto& imageOffset1 = particles.imageOffset1;
+    auto& imageOffset2 = particles.imageOffset2;
+    auto& lifetime = particles.lifetime;
+    auto& scale = particles.scale;
+    auto& elapsedTime = particles.elapsedTime;
+    auto& transparency = particles.transparency;
+    auto& imageBlendFactor = particles.imageBlendFactor;
+
+    //Update velocity
+    pok_BeginProfiling(Update_velocity, 0);
+    const float gravity = -10.0f * particles.gravityModifier * dt;
+    forEachSegment([&velocity, gravity](const size_t begin, const size_t count) {
+        ApplyGravity(velocity.data() + begin, count, gravity);
+    });
+    pok_EndProfiling(Update_velocity);
+    //Update position
+    pok_BeginProfiling(Update_position, 0);
+    forEachSegment([&position, &velocity, dt](const size_t begin, const size_t count) {
+        IntegratePositions(position.data() + begin, velocity.data() + begin, count, dt);
+    });
+    pok_EndProfiling(Update_position);
+    //Update
+    pok_BeginProfiling(Update, 0);
+    forEachSegment([&](const size_t begin, const size_t count) {
+        ComputeColorsOverLifetime(
+            particles.colorOverLifetime,
+            elapsedTime.data() + begin,
+            lifetime.data() + begin,
+            originalColor.data() + begin,
+            colorOffset.data() + begin,
+            transparency.data() + begin,
+            count);
+
+        for (size_t j = begin; j < begin + count; j++) {
+            const auto lifeFactor = elapsedTime[j] / lifetime[j];
             const auto stageCount = static_cast<int32_t>(pow(1, 2));
             const auto atlasProgression = 0 * lifeFactor * stageCount;
             //TODO(@Nico) replace 0 with stage cycles
@@ -318,58 +308,62 @@ void ParticlesSystem::OnDraw()
             imageOffset1[j] = CalculateImageOffset(index1);
             imageOffset2[j] = CalculateImageOffset(index2);
         }
-        pok_EndProfiling(Update);
-        pok_BeginProfiling(Compute_distance, 0);
-        //Sort particles
-        std::vector<std::pair<float, size_t>> sortedIndex(upperBound);
-        for (int j = 0; j < upperBound; j++) {
+    });
+    pok_EndProfiling(Update);
+    pok_BeginProfiling(Compute_distance, 0);
+    //Sort particles
+    const size_t particlesCount = particles.nbParticles;
+    const auto camPos = simulationCameraPosition_;
+    FrameVector<std::pair<float, size_t>> sortedIndex;
+    sortedIndex.reserve(particlesCount);
+    forEachSegment([&sortedIndex, &position, camPos](const size_t begin, const size_t count) {
+        for (size_t j = begin; j < begin + count; j++) {
             const auto distance = math::Vec3::GetDistanceManhattan(camPos, position[j]);
-            sortedIndex[j] = std::pair<float, size_t>(distance, j);
+            sortedIndex.emplace_back(distance, j);
         }
-        pok_EndProfiling(Compute_distance);
-        pok_BeginProfiling(Sort_particles, 0);
-        std::sort(
-            sortedIndex.begin(),
-            sortedIndex.end(),
-            [](const std::pair<float, size_t>& d1, const std::pair<float, size_t>& d2) {
-                return d1 < d2;
-            });
-        pok_EndProfiling(Sort_particles);
-        //Prepare vector for receiving drawing data
-        pok_BeginProfiling(Draw_particles, 0);
-        auto& fillingVector = particlesDrawing_[i];
-        fillingVector.clear();
-        fillingVector.resize(upperBound);
-
-        //Create drawing info
-        for (size_t particleIndex = 0; particleIndex < upperBound; particleIndex++) {
-            auto index = sortedIndex[particleIndex].second;
-            fillingVector[upperBound - index - 1] =
-                graphics::ParticleDrawInfo{
-                    position[index],
-                    colorOffset[index],
-                    imageOffset1[index],
-                    imageBlendFactor[index],
-                    imageOffset2[index],
-                    transparency[index],
-                    scale[index]
-                };
-        }
-        pok_EndProfiling(Draw_particles);
-        pok_EndProfiling(Update_particle_system);
+    });
+    pok_EndProfiling(Compute_distance);
+    pok_BeginProfiling(Sort_particles, 0);
+    std::sort(
+        sortedIndex.begin(),
+        sortedIndex.end(),
+        [](const std::pair<float, size_t>& d1, const std::pair<float, size_t>& d2) {
+            return d1 < d2;
+        });
+    pok_EndProfiling(Sort_particles);
+    //Prepare vector for receiving drawing data
+    pok_BeginProfiling(Draw_particles, 0);
+    auto& fillingVector = drawPacket.particles;
+    fillingVector.clear();
+    fillingVector.resize(particlesCount);
+
+    //Create drawing info, from the farthest to the nearest
+    for (size_t sortedIndexPosition = 0; sortedIndexPosition < particlesCount; sortedIndexPosition++) {
+        auto index = sortedIndex[sortedIndexPosition].second;
+        fillingVector[particlesCount - sortedIndexPosition - 1] =
+            graphics::ParticleDrawInfo{
+                position[index],
+                colorOffset[index],
+                imageOffset1[index],
+                imageBlendFactor[index],
+                imageOffset2[index],
+                transparency[index],
+                scale[index]
+            };
     }
-
-    pok_EndProfiling(Particle_System);
+    pok_EndProfiling(Draw_particles);
+    pok_EndProfiling(Update_particle_system);
 }
 
 void ParticlesSystem::OnCulling()
 {
     pok_BeginProfiling(Particle_System, 0);
 
-    for (size_t i = 0; i < particlesRendering_.size(); i++) {
+    drawPackets_.Fetch();
+    for (const auto& drawPacket : drawPackets_.GetReadBuffer()) {
         particleCommandBuffer_.DrawParticles(
-            particleInstanceIndexRendering_[i],
-            particlesRendering_[i]);
+            drawPacket.instanceIndex,
+            drawPacket.particles);
     }
     pok_EndProfiling(Particle_System);
 }
@@ -387,15 +381,19 @@ void ParticlesSystem::OnEndOfFrame()
         particleSystems.previousPos = transformsManager_.GetWorldPosition(newEntity);
         particleSystemsManager_.SetComponent(newEntity, particleSystems);
 
-        particlesDrawing_.insert(
-            particlesDrawing_.begin() + index,
-            {graphics::ParticleDrawInfo()});
-        particles_.insert(particles_.begin() + index, {Particle()});
+        particles_.insert(particles_.begin() + index, {graphics::ParticlesStorage()});
+        particles_[index].gravityModifier = particleSystems.gravityModifier;
+        particles_[index].colorOverLifetime = particleSystems.colorOverLifetime;
 
         auto& mat = materialManager_.GetMaterial(particleSystems.materialID);
-        particleInstanceIndexDrawing_.insert(
-            particleInstanceIndexDrawing_.begin() + index,
+        particleInstanceIndexes_.insert(
+            particleInstanceIndexes_.begin() + index,
             particleCommandBuffer_.AddParticleInstance(mat));
+
+        auto& drawPackets = drawPackets_.GetWriteBuffer();
+        drawPackets.insert(
+            drawPackets.begin() + index,
+            ParticlesDrawPacket{particleInstanceIndexes_[index], {}});
     }
     newEntities_.clear();
 
@@ -410,15 +408,16 @@ void ParticlesSystem::OnEndOfFrame()
         const auto index = std::distance(particleSystems_.begin(), it);
 
         particleSystems_.erase(it);
-        particleInstanceIndexDrawing_.erase(particleInstanceIndexDrawing_.begin() + index);
+        particleInstanceIndexes_.erase(particleInstanceIndexes_.begin() + index);
         particles_.erase(particles_.begin() + index);
-        particlesDrawing_.erase(particlesDrawing_.begin() + index);
+
+        auto& drawPackets = drawPackets_.GetWriteBuffer();
+        drawPackets.erase(drawPackets.begin() + index);
     }
     destroyedEntities_.clear();
 
-    particleInstanceIndexRendering_ = particleInstanceIndexDrawing_;
-
-    particlesRendering_ = particlesDrawing_;
+    //Hand the frame to the render thread, it is fetched by the culling. Only buffer indexes are exchanged
+    drawPackets_.Publish();
 
 	pok_EndProfiling(Particle_System);
 }
@@ -443,7 +442,9 @@ void ParticlesSystem::OnEntityUpdateComponent(
     const ecs::EntityIndex entityIndex,
     const ecs::ComponentMask component)
 {
-    if ((component & ecs::ComponentType::PARTICLE_SYSTEM) == ecs::ComponentType::PARTICLE_SYSTEM) {
+    //The emitters not added yet read their component when they are
+    if ((component & ecs::ComponentType::PARTICLE_SYSTEM) == ecs::ComponentType::PARTICLE_SYSTEM &&
+        particleSystems_.exist(entityIndex)) {
         const auto particleSystems = particleSystemsManager_.GetComponent(entityIndex);
         const auto& mat = materialManager_.GetMaterial(particleSystems.materialID);
 
@@ -451,8 +452,10 @@ void ParticlesSystem::OnEntityUpdateComponent(
             particleSystems_.begin(),
             std::find(particleSystems_.begin(), particleSystems_.end(), entityIndex));
 
-        particleInstanceIndexDrawing_[particleIndex] = particleCommandBuffer_.AddParticleInstance(
+        particleInstanceIndexes_[particleIndex] = particleCommandBuffer_.AddParticleInstance(
             mat);
+        particles_[particleIndex].gravityModifier = particleSystems.gravityModifier;
+        particles_[particleIndex].colorOverLifetime = particleSystems.colorOverLifetime;
     }
 }
 
@@ -460,11 +463,9 @@ void ParticlesSystem::OnUnloadScene()
 {
     particleSystems_.clear();
 
-    particleInstanceIndexDrawing_.clear();
-    particleInstanceIndexRendering_.clear();
+    particleInstanceIndexes_.clear();
 
-    particlesRendering_.clear();
-    particlesDrawing_.clear();
+    drawPackets_.ForEach([](std::vector<ParticlesDrawPacket>& drawPackets) { drawPackets.clear(); });
     particles_.clear();
 }
 } // namespace poke
@@ -1,5 +1,7 @@
 #include <CoreEngine/CoreSystems/spline_follower_system.h>
 
+#include <algorithm>
+
 #include <CoreEngine/engine.h>
 #include <CoreEngine/ServiceLocator/service_locator_definition.h>
 #include <Utility/time_custom.h>
@@ -56,29 +58,26 @@ void SplineFollowerSystem::OnUpdate()
     auto dt = Time::Get().deltaTime.count();
     dt /= 1000.0f;
 
+    auto splineFollowers = splinesManager_.GetComponentsView();
     for(size_t i = 0; i < entities_.size(); i++){
 		const auto entity = entities_[i];
-        auto splineFollower = splinesManager_.GetComponent(entity);
-        auto spline = splineFollower.spline;
+        auto& splineFollower = splineFollowers[entity];
+        const math::SplinePath& path = splineFollower.spline.GetPath();
 
-        if (spline.GetSize() < kMinSpline_) { break; }
+        if (path.GetSegmentCount() == 0 || path.GetLength() <= 0.0f) { continue; }
 
-        if (splineFollower.segmentPercentage < 1) {
-			const float distance = splineFollower.speed * dt;
-            splineFollower.segmentPercentage += distance / spline.GetSegmentLength(splineFollower.lastPoint);
-			splineFollower.totalPercentage += distance / spline.GetTotalLength();
+        //The distance is along the curve, the speed is the same on every segment
+        if (splineFollower.distance >= path.GetLength()) {
+            //The end was reached at the previous update, it starts again from the first point
+            splineFollower.distance = 0;
         } else {
-
-            splineFollower.segmentPercentage = 0;
-            if (splineFollower.lastPoint + kMinSpline_ - 1 < spline.GetSize()) {
-                splineFollower.lastPoint++;
-            } else {
-                splineFollower.lastPoint = 1;
-				splineFollower.totalPercentage = 0;
-            }
+            splineFollower.distance = std::min(splineFollower.distance + splineFollower.speed * static_cast<float>(dt), path.GetLength());
         }
 
-        splinesManager_.SetComponent(entity, splineFollower);
+        const math::SplineLocation location = path.Locate(splineFollower.distance);
+        splineFollower.lastPoint = location.segment + 1;
+        splineFollower.segmentPercentage = location.percentage;
+        splineFollower.totalPercentage = splineFollower.distance / path.GetLength();
     }
     pok_EndProfiling(Spline_System);
 }
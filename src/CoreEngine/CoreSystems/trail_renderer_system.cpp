@@ -16,7 +16,8 @@ TrailRendererSystem::TrailRendererSystem(Engine& engine)
 	  modelCommandBuffer_(GraphicsEngineLocator::Get().GetModelCommandBuffer()),
 	  meshIDs_(1000),
 	  forwardIndexes_(1000),
-      dynamicMeshIndex_(1000)
+      dynamicMeshIndex_(1000),
+      ringIndexes_(ecs::TrailRenderer::GenerateRingIndexes())
 {
     engine_.AddObserver(observer::MainLoopSubject::UPDATE, [this]() { OnUpdate(); });
 
@@ -57,29 +58,31 @@ void TrailRendererSystem::OnEntitySetInactive(const ecs::EntityIndex entityIndex
 void TrailRendererSystem::OnUpdate()
 {
     pok_BeginProfiling(Trail_renderer_system, 0);
-	drawInfosDrawing_.clear();
-	drawInfosDrawing_.reserve(entities_.size());
-	meshesToUpdates_.reserve(entities_.size());
+	auto& drawInfos = drawInfos_.GetWriteBuffer();
+	drawInfos.clear();
+	drawInfos.reserve(entities_.size());
+	if (meshesToUpdates_.size() < meshesToUpdateCount_ + entities_.size()) {
+		meshesToUpdates_.resize(meshesToUpdateCount_ + entities_.size());
+	}
+	auto trailRenderers = trailRendererManager_.GetComponentsView();
+	const float dt = Time::Get().deltaTime.count() / 1000.0f;
+	const math::Vec3 cameraFront = CameraLocator::Get().GetFront();
 	for (size_t i = 0; i < entities_.size(); i++) {
 		const auto entity = entities_[i];
-        auto trailRenderer = trailRendererManager_.GetComponent(entity);
+        auto& trailRenderer = trailRenderers[entity];
 
         if (!trailRenderer.isPaused) {
             const auto worldPosition = transformManager_.GetWorldPosition(entity);
-            if (trailRenderer.Update(worldPosition)) {
-                const auto meshInfo = trailRenderer.GenerateMesh();
-                meshesToUpdates_.emplace_back(
-					MeshRebuildInfo{
-					    dynamicMeshIndex_[i],
-					    meshInfo.first,
-					    meshInfo.second});
+            if (trailRenderer.Update(worldPosition, dt, cameraFront)) {
+                //Vectors are reused from one frame to another to avoid allocations
+                auto& meshToUpdate = meshesToUpdates_[meshesToUpdateCount_++];
+                meshToUpdate.dynamicMeshIndex = dynamicMeshIndex_[i];
+                meshToUpdate.vertices.resize(ecs::TrailRenderer::kMaxVertexPairs * 2);
+                meshToUpdate.meshRange = trailRenderer.WriteMesh(meshToUpdate.vertices.data());
             }
-
         }
 
-        trailRendererManager_.SetComponent(entity, trailRenderer);
-
-		drawInfosDrawing_.emplace_back(TrailDrawInfos{
+		drawInfos.emplace_back(TrailDrawInfos{
 			trailRenderer.materialID,
 			meshIDs_[i],
 			forwardIndexes_[i]
@@ -91,7 +94,9 @@ void TrailRendererSystem::OnUpdate()
 void TrailRendererSystem::OnCulling()
 {
 	pok_BeginProfiling(Trail_renderer_system, 0);
-    for (const auto drawInfos : drawInfosRendering_) {
+	//Last frame published by the main thread
+	drawInfos_.Fetch();
+    for (const auto drawInfos : drawInfos_.GetReadBuffer()) {
         modelCommandBuffer_.Draw(
             math::Matrix4::Identity(),
             graphics::Model{
@@ -128,23 +133,26 @@ void TrailRendererSystem::OnEndOfFrame()
 	pok_BeginProfiling(Trail_renderer_system, 0);
 	//Update mesh
 	pok_BeginProfiling(Update_meshes, 0);
-	for (const auto& meshesToUpdate : meshesToUpdates_) {
+	for (size_t i = 0; i < meshesToUpdateCount_; i++) {
+		const ecs::TrailMeshRange& meshRange = meshesToUpdates_[i].meshRange;
 		meshManager_.UpdateDynamicMesh(
-			meshesToUpdate.dynamicMeshIndex,
-			meshesToUpdate.vertices,
-			meshesToUpdate.indexes);
+			meshesToUpdates_[i].dynamicMeshIndex,
+			meshesToUpdates_[i].vertices,
+			meshRange.firstVertex,
+			meshRange.vertexCount,
+			meshRange.firstIndex,
+			meshRange.indexCount);
 	}
 
-	meshesToUpdates_.clear();
+	meshesToUpdateCount_ = 0;
 	pok_EndProfiling(Update_meshes);
 
     //Destroy entities
 	pok_BeginProfiling(Destroy_entities, 0);
-    
+    auto& drawInfos = drawInfos_.GetWriteBuffer();
+	auto trailRenderers = trailRendererManager_.GetComponentsView();
     for (const auto destroyedEntity : destroyedEntities_) {
-		auto trailRenderer = trailRendererManager_.GetComponent(destroyedEntity);
-		trailRenderer.Clear();
-		trailRendererManager_.SetComponent(destroyedEntity, trailRenderer);
+		trailRenderers[destroyedEntity].Clear();
 
 		const auto it = entities_.find(destroyedEntity);
 		const auto index = std::distance(entities_.begin(), it);
@@ -157,16 +165,14 @@ void TrailRendererSystem::OnEndOfFrame()
 		dynamicMeshIndex_.erase(dynamicMeshIndex_.begin() + index);
 		meshIDs_.erase(meshIDs_.begin() + index);
 		forwardIndexes_.erase(forwardIndexes_.begin() + index);
-		drawInfosDrawing_.erase(drawInfosDrawing_.begin() + index);
+		drawInfos.erase(drawInfos.begin() + index);
     }
 	destroyedEntities_.clear();
 	pok_EndProfiling(Destroy_entities);
 
     //Draw active entities
 	pok_BeginProfiling(Transfert_data, 0);
-	drawInfosRendering_.clear();
-	drawInfosRendering_ = drawInfosDrawing_;
-	drawInfosDrawing_.clear();
+	drawInfos_.Publish();
 	pok_EndProfiling(Transfert_data);
 
     //Add new entities
@@ -175,7 +181,9 @@ void TrailRendererSystem::OnEndOfFrame()
 		const auto it = entities_.insert(newEntity);
 		const auto dist = std::distance(entities_.begin(), it);
 
-		const auto dynamicMeshId = meshManager_.CreateDynamicMesh();
+		const auto dynamicMeshId = meshManager_.CreateDynamicMesh(
+			static_cast<uint32_t>(ecs::TrailRenderer::kMaxVertexPairs * 2),
+			ringIndexes_);
 		dynamicMeshIndex_.insert(dynamicMeshIndex_.begin() + dist, dynamicMeshId);
 		meshIDs_.insert(meshIDs_.begin() + dist, meshManager_.GetDynamicMeshResourceID(dynamicMeshId));
 		forwardIndexes_.insert(forwardIndexes_.begin() + dist, modelCommandBuffer_.GetForwardIndex());
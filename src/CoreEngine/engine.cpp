@@ -2,11 +2,14 @@
 
 #include <Utility/log.h>
 #include <Utility/time_custom.h>
+#include <thread>
 #include <CoreEngine/ServiceLocator/service_locator_definition.h>
 
 namespace poke {
 Engine::Engine(const EngineSetting& engineSettings)
     : engineSettings_(engineSettings),
+      frameLimiter_(engineSettings.GetFrameRate()),
+      jobPool_(JobPool::ComputeWorkerCount(std::thread::hardware_concurrency())),
       subjectsContainer_(
           {
               observer::MainLoopSubject::ENGINE_BUILD,
@@ -276,4 +279,35 @@ void Engine::Wait(const ThreadType type)
     default: ;
     }
 }
+void Engine::SetFrameTasks(std::vector<std::function<void()>> frameTasks, const ThreadType type)
+{
+    switch (type) {
+    case ThreadType::MAIN:
+        mainThread_.SetFrameTasks(std::move(frameTasks));
+        break;
+    case ThreadType::RENDER:
+        drawThread_.SetFrameTasks(std::move(frameTasks));
+        break;
+    case ThreadType::WORKER:
+        workerThread_.SetFrameTasks(std::move(frameTasks));
+        break;
+    default: ;
+    }
+}
+
+void Engine::RunFrameTasks(const ThreadType type)
+{
+    switch (type) {
+    case ThreadType::MAIN:
+        mainThread_.RunFrameTasks();
+        break;
+    case ThreadType::RENDER:
+        drawThread_.RunFrameTasks();
+        break;
+    case ThreadType::WORKER:
+        workerThread_.RunFrameTasks();
+        break;
+    default: ;
+    }
+}
 } //namespace poke
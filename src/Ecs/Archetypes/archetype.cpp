@@ -3,71 +3,57 @@
 
 namespace poke {
 namespace ecs {
-Archetype::Archetype() {
-	transform.SetLocalPosition(math::Vec3{ 1000000 });
-}
-
 void Archetype::SetFromJson(const json& archetypeJson)
 {
 	//Editor Component
 	if (CheckJsonExists(archetypeJson, "objectName")) {
 		const std::string name = archetypeJson["objectName"];
-		editorComponent.name = name;
-		AddComponent(ComponentType::EDITOR_COMPONENT);
+		EmplaceComponent<EditorComponent>(ComponentType::EDITOR_COMPONENT).name = name;
 	}
 	
 	//Transform
 	if (CheckJsonExists(archetypeJson, "transform")) {
-		transform.SetFromJson(archetypeJson["transform"]);
-		AddComponent(ComponentType::TRANSFORM);
+		EmplaceComponent<math::Transform>(ComponentType::TRANSFORM).SetFromJson(archetypeJson["transform"]);
 	}
 
 	//Model
 	if (CheckJsonExists(archetypeJson, "model")) {
-		model.SetFromJson(archetypeJson["model"]);
-		AddComponent(ComponentType::MODEL);
+		EmplaceComponent<graphics::Model>(ComponentType::MODEL).SetFromJson(archetypeJson["model"]);
 	}
 
 	//Spline
 	if (CheckJsonExists(archetypeJson, "spline")) {
-		spline.SetFromJson(archetypeJson["spline"]);
-		AddComponent(ComponentType::SPLINE_FOLLOWER);
+		EmplaceComponent<SplineFollower>(ComponentType::SPLINE_FOLLOWER).SetFromJson(archetypeJson["spline"]);
 	}
 
 	//Rigidbody
 	if (CheckJsonExists(archetypeJson, "rigidbody")) {
-		rigidbody.SetFromJson(archetypeJson["rigidbody"]);
-		AddComponent(ComponentType::RIGIDBODY);
+		EmplaceComponent<physics::Rigidbody>(ComponentType::RIGIDBODY).SetFromJson(archetypeJson["rigidbody"]);
 	}
 
 	//Collider
 	if (CheckJsonExists(archetypeJson, "collider")) {
-		collider.SetFromJson(archetypeJson["collider"]);
-	    AddComponent(ComponentType::COLLIDER);
+		EmplaceComponent<physics::Collider>(ComponentType::COLLIDER).SetFromJson(archetypeJson["collider"]);
 	}
 
 	//Light
 	if (CheckJsonExists(archetypeJson, "light")) {
-		light.SetFromJson(archetypeJson["light"]);
-		AddComponent(ComponentType::LIGHT);
+		EmplaceComponent<Light>(ComponentType::LIGHT).SetFromJson(archetypeJson["light"]);
 	}
 
 	//particleSystem
 	if (CheckJsonExists(archetypeJson, "particleSystem")) {
-		particleSystem.SetFromJson(archetypeJson["particleSystem"]);
-		AddComponent(ComponentType::PARTICLE_SYSTEM);
+		EmplaceComponent<graphics::ParticleSystem>(ComponentType::PARTICLE_SYSTEM).SetFromJson(archetypeJson["particleSystem"]);
 	}
 
 	//Trail renderer
 	if (CheckJsonExists(archetypeJson, "trailRenderer")) {
-		trailRenderer.SetFromJson(archetypeJson["trailRenderer"]);
-		AddComponent(ComponentType::TRAIL_RENDERER);
+		EmplaceComponent<TrailRenderer>(ComponentType::TRAIL_RENDERER).SetFromJson(archetypeJson["trailRenderer"]);
 	}
 
 	//AudioSource
 	if (CheckJsonExists(archetypeJson, "audioSource")) {
-		audioSource.SetFromJson(archetypeJson["audioSource"]);
-		AddComponent(ComponentType::AUDIO_SOURCE);
+		EmplaceComponent<audio::AudioSource>(ComponentType::AUDIO_SOURCE).SetFromJson(archetypeJson["audioSource"]);
 	}
 
 }
@@ -78,44 +64,44 @@ json Archetype::ToJson() const
 
 	//Transform
 	if (HasComponent(ComponentType::TRANSFORM)) {
-		archetypeJson["transform"] = transform.ToJson();
+		archetypeJson["transform"] = GetComponent<math::Transform>(ComponentType::TRANSFORM).ToJson();
 	}
 
 	//Model
 	if (HasComponent(ComponentType::MODEL)) {
-		archetypeJson["model"] = model.ToJson();
+		archetypeJson["model"] = GetComponent<graphics::Model>(ComponentType::MODEL).ToJson();
 	}
 
 	//Spline
 	if (HasComponent(ComponentType::SPLINE_FOLLOWER)) {
-		archetypeJson["spline"] = spline.ToJson();
+		archetypeJson["spline"] = GetComponent<SplineFollower>(ComponentType::SPLINE_FOLLOWER).ToJson();
 	}
 
 	//Rigidbody
 	if (HasComponent(ComponentType::RIGIDBODY)) {
-		archetypeJson["rigidbody"] = rigidbody.ToJson();
+		archetypeJson["rigidbody"] = GetComponent<physics::Rigidbody>(ComponentType::RIGIDBODY).ToJson();
 	}
 
 	//Collider
 	if (HasComponent(ComponentType::COLLIDER)) {
-		archetypeJson["collider"] = collider.ToJson();
+		archetypeJson["collider"] = GetComponent<physics::Collider>(ComponentType::COLLIDER).ToJson();
 	}
 	//Light
 	if (HasComponent(ComponentType::LIGHT)) {
-		archetypeJson["light"] = light.ToJson();
+		archetypeJson["light"] = GetComponent<Light>(ComponentType::LIGHT).ToJson();
 	}
 	//ParticleSystem
 	if (HasComponent(ComponentType::PARTICLE_SYSTEM)) {
-		archetypeJson["particleSystem"] = particleSystem.ToJson();
+		archetypeJson["particleSystem"] = GetComponent<graphics::ParticleSystem>(ComponentType::PARTICLE_SYSTEM).ToJson();
 	}
 	//AudioSource
 	if (HasComponent(ComponentType::AUDIO_SOURCE)) {
-		archetypeJson["audioSource"] = audioSource.ToJson();
+		archetypeJson["audioSource"] = GetComponent<audio::AudioSource>(ComponentType::AUDIO_SOURCE).ToJson();
 	}
 
 	//Trail renderer
 	if (HasComponent(ComponentType::TRAIL_RENDERER)) {
-		archetypeJson["trailRenderer"] = trailRenderer.ToJson();
+		archetypeJson["trailRenderer"] = GetComponent<TrailRenderer>(ComponentType::TRAIL_RENDERER).ToJson();
 	}
 
 	return archetypeJson;
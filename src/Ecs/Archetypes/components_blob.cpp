@@ -0,0 +1,118 @@
+#include <Ecs/Archetypes/components_blob.h>
+
+namespace poke {
+namespace ecs {
+namespace {
+size_t AlignOffset(const size_t offset, const size_t alignment)
+{
+    return (offset + alignment - 1) / alignment * alignment;
+}
+
+std::unique_ptr<std::max_align_t[]> AllocateData(const size_t size)
+{
+    return std::unique_ptr<std::max_align_t[]>(
+        new std::max_align_t[(size + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t)]);
+}
+} //namespace
+
+ComponentsBlob::~ComponentsBlob()
+{
+    Clear();
+}
+
+ComponentsBlob::ComponentsBlob(const ComponentsBlob& other)
+    : entries_(other.entries_),
+      size_(other.size_)
+{
+    if (size_ == 0) { return; }
+
+    data_ = AllocateData(size_);
+    char* data = reinterpret_cast<char*>(data_.get());
+    const char* otherData = reinterpret_cast<const char*>(other.data_.get());
+    for (const Entry& entry : entries_) {
+        entry.ops->copy(data + entry.offset, otherData + entry.offset);
+    }
+}
+
+ComponentsBlob::ComponentsBlob(ComponentsBlob&& other) noexcept
+    : entries_(std::move(other.entries_)),
+      data_(std::move(other.data_)),
+      size_(other.size_)
+{
+    other.entries_.clear();
+    other.size_ = 0;
+}
+
+ComponentsBlob& ComponentsBlob::operator=(const ComponentsBlob& other)
+{
+    if (this != &other) {
+        ComponentsBlob copy(other);
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
+ComponentsBlob& ComponentsBlob::operator=(ComponentsBlob&& other) noexcept
+{
+    if (this != &other) {
+        Clear();
+        entries_ = std::move(other.entries_);
+        data_ = std::move(other.data_);
+        size_ = other.size_;
+
+        other.entries_.clear();
+        other.size_ = 0;
+    }
+    return *this;
+}
+
+const ComponentsBlob::Entry* ComponentsBlob::FindEntry(const ComponentType::ComponentType type) const
+{
+    for (const Entry& entry : entries_) {
+        if (entry.type == type) { return &entry; }
+    }
+    return nullptr;
+}
+
+const void* ComponentsBlob::GetData(const Entry& entry) const
+{
+    return reinterpret_cast<const char*>(data_.get()) + entry.offset;
+}
+
+void* ComponentsBlob::GetData(const Entry& entry)
+{
+    return reinterpret_cast<char*>(data_.get()) + entry.offset;
+}
+
+void* ComponentsBlob::Add(const ComponentType::ComponentType type, const ComponentOps* ops)
+{
+    //The blob is reallocated to its exact size, components are only added while building an archetype
+    const size_t offset = AlignOffset(size_, ops->alignment);
+    const size_t newSize = offset + ops->size;
+    std::unique_ptr<std::max_align_t[]> newData = AllocateData(newSize);
+
+    char* data = reinterpret_cast<char*>(data_.get());
+    char* newDataBytes = reinterpret_cast<char*>(newData.get());
+    for (const Entry& entry : entries_) {
+        entry.ops->move(newDataBytes + entry.offset, data + entry.offset);
+        entry.ops->destroy(data + entry.offset);
+    }
+
+    ops->construct(newDataBytes + offset);
+    entries_.push_back(Entry{ type, offset, ops });
+    data_ = std::move(newData);
+    size_ = newSize;
+    return newDataBytes + offset;
+}
+
+void ComponentsBlob::Clear()
+{
+    char* data = reinterpret_cast<char*>(data_.get());
+    for (const Entry& entry : entries_) { entry.ops->destroy(data + entry.offset); }
+
+    entries_.clear();
+    data_.reset();
+    size_ = 0;
+}
+} //namespace ecs
+} //namespace poke
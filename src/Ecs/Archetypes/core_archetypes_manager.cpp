@@ -138,42 +138,42 @@ json CoreArchetypesManager::ToJson() const
 		int j = 0;
 		for (size_t entityIndex = pool.firstEntity; entityIndex < pool.lastEntity; entityIndex++) {
 			if (archetypes_[i].HasComponent(ComponentType::COLLIDER) &&
-				collidersManager.GetComponent(entityIndex) != archetypes_[i].collider) {
+				collidersManager.GetComponent(entityIndex) != archetypes_[i].GetComponent<physics::Collider>(ComponentType::COLLIDER)) {
 
 				archetypesJson["entities"][j]["collider"] = collidersManager.GetJsonFromComponent(entityIndex);
 			}
 
 			if (archetypes_[i].HasComponent(ComponentType::MODEL) &&
-				modelsManager.GetComponent(entityIndex) != archetypes_[i].model ) {
+				modelsManager.GetComponent(entityIndex) != archetypes_[i].GetComponent<graphics::Model>(ComponentType::MODEL) ) {
 
 				archetypesJson["entities"][j]["model"] = modelsManager.GetJsonFromComponent(entityIndex);
 			}
 
 			if (archetypes_[i].HasComponent(ComponentType::RIGIDBODY) && 
-				rigidbodyManager.GetComponent(entityIndex) != archetypes_[i].rigidbody) {
+				rigidbodyManager.GetComponent(entityIndex) != archetypes_[i].GetComponent<physics::Rigidbody>(ComponentType::RIGIDBODY)) {
 
 				archetypesJson["entities"][j]["rigidbody"] = rigidbodyManager.GetJsonFromComponent(entityIndex);
 			}
 
 			if (archetypes_[i].HasComponent(ComponentType::SPLINE_FOLLOWER) &&
-				splinesManager.GetComponent(entityIndex) != archetypes_[i].spline ) {
+				splinesManager.GetComponent(entityIndex) != archetypes_[i].GetComponent<SplineFollower>(ComponentType::SPLINE_FOLLOWER) ) {
 
 				archetypesJson["entities"][j]["spline"] = splinesManager.GetJsonFromComponent(entityIndex);
 			}
 
 			if (archetypes_[i].HasComponent(ComponentType::TRANSFORM) && 
-				transformManager.GetComponent(entityIndex) != archetypes_[i].transform ) {
+				transformManager.GetComponent(entityIndex) != archetypes_[i].GetComponent<math::Transform>(ComponentType::TRANSFORM) ) {
 
 				archetypesJson["entities"][j]["transform"] = transformManager.GetJsonFromComponent(entityIndex);
 			}
 
 			if (archetypes_[i].HasComponent(ComponentType::LIGHT) &&
-				lightsManager.GetComponent(entityIndex) != archetypes_[i].light) {
+				lightsManager.GetComponent(entityIndex) != archetypes_[i].GetComponent<Light>(ComponentType::LIGHT)) {
 				archetypesJson["entities"][j]["light"] = collidersManager.GetJsonFromComponent(entityIndex);
 			}
 
 			if (archetypes_[i].HasComponent(ComponentType::AUDIO_SOURCE) &&
-				audioSourcesManager.GetComponent(entityIndex) != archetypes_[i].audioSource) {
+				audioSourcesManager.GetComponent(entityIndex) != archetypes_[i].GetComponent<audio::AudioSource>(ComponentType::AUDIO_SOURCE)) {
 				archetypesJson["entities"][j]["audioSource"] = audioSourcesManager.GetJsonFromComponent(entityIndex);
 			}
 
@@ -17,9 +17,10 @@ void AudioSourcesManager::SetWithArchetype(
     const EntityPool entityPool,
     const Archetype& archetype)
 {
+    const audio::AudioSource& audioSource = archetype.GetComponent<audio::AudioSource>(ComponentType::AUDIO_SOURCE);
     for (auto entityIndex = entityPool.firstEntity;
          entityIndex < entityPool.lastEntity; entityIndex++) {
-        audioSources_[entityIndex] = archetype.audioSource;
+        audioSources_[entityIndex] = audioSource;
     }
 }
 
@@ -37,7 +38,7 @@ void AudioSourcesManager::InsertArchetype(
     const EntityIndex entity,
     const Archetype& archetype)
 {
-    audioSources_.insert(audioSources_.begin() + entity, archetype.audioSource);
+    audioSources_.insert(audioSources_.begin() + entity, archetype.GetComponent<audio::AudioSource>(ComponentType::AUDIO_SOURCE));
 }
 
 void AudioSourcesManager::EraseEntities(
@@ -21,9 +21,10 @@ void CollidersManager::SetWithArchetype(
     const EntityPool entityPool,
     const Archetype& archetype)
 {
+    const physics::Collider& collider = archetype.GetComponent<physics::Collider>(ComponentType::COLLIDER);
     for (EntityIndex entityIndex = entityPool.firstEntity;
          entityIndex < entityPool.lastEntity; entityIndex++) {
-        colliders_[entityIndex] = archetype.collider;
+        colliders_[entityIndex] = collider;
     }
 }
 
@@ -31,7 +32,7 @@ void CollidersManager::InsertArchetype(
     const EntityIndex entity,
     const Archetype& archetype)
 {
-    colliders_.insert(colliders_.begin() + entity, archetype.collider);
+    colliders_.insert(colliders_.begin() + entity, archetype.GetComponent<physics::Collider>(ComponentType::COLLIDER));
 }
 
 void CollidersManager::EraseEntities(
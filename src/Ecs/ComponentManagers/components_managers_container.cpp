@@ -39,6 +39,19 @@ void ComponentsManagersContainer::SetWithArchetype(const EntityPool archetypeDat
 	}
 }
 
+void ComponentsManagersContainer::SetWithArchetype(
+    const EntityPool archetypeData,
+    const Archetype& archetype,
+    const ComponentMask components)
+{
+	//The managers are stored at the index of their component type
+	for (size_t i = 0; i < componentsManagers_.size(); i++) {
+		if ((components & (1u << i)) && componentsManagers_[i]) {
+			componentsManagers_[i]->SetWithArchetype(archetypeData, archetype);
+		}
+	}
+}
+
 void ComponentsManagersContainer::InsertArchetype(
     const EntityIndex entity,
     const Archetype& archetype)
@@ -59,5 +72,12 @@ void ComponentsManagersContainer::EraseArchetype(const EntityPool pool, const si
     }
 }
 
-
+IComponentsManager* ComponentsManagersContainer::FindComponentsManager(const ComponentMask componentType) const
+{
+	const size_t componentsManagerIndex = math::log2(componentType);
+	if (componentType == ComponentType::EMPTY || componentsManagerIndex >= componentsManagers_.size()) {
+		return nullptr;
+	}
+	return componentsManagers_[componentsManagerIndex].get();
+}
 }//namespace poke::ecs
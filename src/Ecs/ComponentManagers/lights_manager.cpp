@@ -19,9 +19,10 @@ void LightsManager::SetWithArchetype(
     const EntityPool entityPool,
     const Archetype& archetype)
 {
+    const Light& light = archetype.GetComponent<Light>(ComponentType::LIGHT);
     for (auto entityIndex = entityPool.firstEntity;
 		entityIndex < entityPool.lastEntity; entityIndex++) {
-		lights_[entityIndex]= archetype.light;
+		lights_[entityIndex]= light;
 	}
 }
 
@@ -29,7 +30,7 @@ void LightsManager::InsertArchetype(
     const EntityIndex entity,
     const Archetype& archetype)
 {
-	lights_.insert(lights_.begin() + entity, archetype.light);
+	lights_.insert(lights_.begin() + entity, archetype.GetComponent<Light>(ComponentType::LIGHT));
 }
 
 void LightsManager::EraseEntities(const EntityPool pool, const size_t nbObjectToErase)
@@ -25,18 +25,19 @@ void ModelsManager::SetWithArchetype(
     const EntityPool entityPool,
     const Archetype& archetype)
 {
+    const graphics::Model& model = archetype.GetComponent<graphics::Model>(ComponentType::MODEL);
     for (EntityIndex entityIndex = entityPool.firstEntity;
          entityIndex < entityPool.lastEntity; entityIndex++) {
-        models_[entityIndex].materialID = archetype.model.materialID;
+        models_[entityIndex].materialID = model.materialID;
 
-		if (archetype.model.materialID != 0) {
+		if (model.materialID != 0) {
 
-			MaterialsManagerLocator::Get().GetMaterial(archetype.model.materialID).
+			MaterialsManagerLocator::Get().GetMaterial(model.materialID).
 				CreatePipeline(
 					GetVertexInput());
 		}
 
-        models_[entityIndex].meshID = archetype.model.meshID;
+        models_[entityIndex].meshID = model.meshID;
     }
 }
 
@@ -44,14 +45,17 @@ void ModelsManager::InsertArchetype(
     const EntityIndex entity,
     const Archetype& archetype)
 {
+	const graphics::Model& model = archetype.GetComponent<graphics::Model>(ComponentType::MODEL);
 	models_.insert(models_.begin() + entity, graphics::Model());
-	models_[entity].materialID = archetype.model.materialID;
-	models_[entity].meshID = archetype.model.meshID;
+	models_[entity].materialID = model.materialID;
+	models_[entity].meshID = model.meshID;
+	dirtyEntities_.Clear();
 }
 
 void ModelsManager::EraseEntities(const EntityPool pool, const size_t nbObjectToErase)
 {
 	models_.erase(models_.begin() + pool.firstEntity, models_.begin() + pool.firstEntity + nbObjectToErase);
+	dirtyEntities_.Clear();
 }
 
 void ModelsManager::SetComponent(
@@ -74,7 +78,7 @@ json ModelsManager::GetJsonFromComponent(const EntityIndex entityIndex)
     return models_[entityIndex].ToJson();
 }
 
-graphics::Model ModelsManager::GetComponent(const EntityIndex entityIndex)
+const graphics::Model& ModelsManager::GetComponent(const EntityIndex entityIndex) const
 {
     return models_[entityIndex];
 }
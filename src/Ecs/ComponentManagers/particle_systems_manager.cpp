@@ -27,9 +27,10 @@ void ecs::ParticleSystemsManager::SetWithArchetype(
     const EntityPool entityPool,
     const Archetype& archetype)
 {
+	const graphics::ParticleSystem& particleSystem = archetype.GetComponent<graphics::ParticleSystem>(ComponentType::PARTICLE_SYSTEM);
 	for (EntityIndex entityIndex = entityPool.firstEntity; entityIndex < entityPool.lastEntity;
 		entityIndex++) {
-		particleSystems_[entityIndex] = archetype.particleSystem;
+		particleSystems_[entityIndex] = particleSystem;
 	}
 }
 
@@ -37,7 +38,8 @@ void ecs::ParticleSystemsManager::InsertArchetype(
     const EntityIndex entity,
     const Archetype& archetype)
 {
-	particleSystems_.insert(particleSystems_.begin() + entity, archetype.particleSystem);
+	particleSystems_.insert(particleSystems_.begin() + entity, archetype.GetComponent<graphics::ParticleSystem>(ComponentType::PARTICLE_SYSTEM));
+	dirtyEntities_.Clear();
 }
 
 void ecs::ParticleSystemsManager::EraseEntities(
@@ -47,6 +49,7 @@ void ecs::ParticleSystemsManager::EraseEntities(
 	particleSystems_.erase(
 		particleSystems_.begin() + pool.firstEntity,
 		particleSystems_.begin() + pool.firstEntity + nbObjectToErase);
+	dirtyEntities_.Clear();
 }
 
 
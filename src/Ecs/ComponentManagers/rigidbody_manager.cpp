@@ -20,9 +20,10 @@ void RigidbodyManager::SetWithArchetype(
     const EntityPool entityPool,
     const Archetype& archetype)
 {
+    const physics::Rigidbody& rigidbody = archetype.GetComponent<physics::Rigidbody>(ComponentType::RIGIDBODY);
     for (EntityIndex entityIndex = entityPool.firstEntity;
          entityIndex < entityPool.lastEntity; entityIndex++) {
-        rigidbodies_[entityIndex] = archetype.rigidbody;
+        rigidbodies_[entityIndex] = rigidbody;
     }
 }
 
@@ -30,7 +31,7 @@ void RigidbodyManager::InsertArchetype(
     const EntityIndex entity,
     const Archetype& archetype)
 {
-    rigidbodies_.insert(rigidbodies_.begin() + entity, archetype.rigidbody);
+    rigidbodies_.insert(rigidbodies_.begin() + entity, archetype.GetComponent<physics::Rigidbody>(ComponentType::RIGIDBODY));
 }
 
 void RigidbodyManager::EraseEntities(
@@ -16,14 +16,15 @@ void SegmentRendererManager::SetWithArchetype(
     const EntityPool entityPool,
     const Archetype& archetype)
 {
+    const SegmentRenderer& segmentRenderer = archetype.GetComponent<SegmentRenderer>(ComponentType::SEGMENT_RENDERER);
     for (auto entityIndex = entityPool.firstEntity;
          entityIndex < entityPool.lastEntity;
-         entityIndex++) { segmentRenderers_[entityIndex] = archetype.segmentRenderer; }
+         entityIndex++) { segmentRenderers_[entityIndex] = segmentRenderer; }
 }
 
 void SegmentRendererManager::InsertArchetype(const EntityIndex entity, const Archetype& archetype)
 {
-    segmentRenderers_.insert(segmentRenderers_.begin() + entity, archetype.segmentRenderer);
+    segmentRenderers_.insert(segmentRenderers_.begin() + entity, archetype.GetComponent<SegmentRenderer>(ComponentType::SEGMENT_RENDERER));
 }
 
 void SegmentRendererManager::EraseEntities(const EntityPool pool, const size_t nbObjectToErase)
@@ -15,16 +15,17 @@ void SplineFollowersManager::SetWithArchetype(
     const EntityPool entityPool,
     const Archetype& archetype)
 {
+    const SplineFollower& splineFollower = archetype.GetComponent<SplineFollower>(ComponentType::SPLINE_FOLLOWER);
     for (EntityIndex entityIndex = entityPool.firstEntity;
          entityIndex < entityPool.lastEntity;
-         entityIndex++) { splineFollowers_[entityIndex] = archetype.spline; }
+         entityIndex++) { splineFollowers_[entityIndex] = splineFollower; }
 }
 
 void SplineFollowersManager::InsertArchetype(
     const EntityIndex entity,
     const Archetype& archetype)
 {
-    splineFollowers_.insert(splineFollowers_.begin() + entity, archetype.spline);
+    splineFollowers_.insert(splineFollowers_.begin() + entity, archetype.GetComponent<SplineFollower>(ComponentType::SPLINE_FOLLOWER));
 }
 
 void SplineFollowersManager::EraseEntities(const EntityPool pool, const size_t nbObjectToErase)
@@ -12,14 +12,15 @@ void TrailRendererManager::ClearEntity(const EntityIndex entityIndex)
 
 void TrailRendererManager::SetWithArchetype(const EntityPool entityPool, const Archetype& archetype)
 {
+    const TrailRenderer& trailRenderer = archetype.GetComponent<TrailRenderer>(ComponentType::TRAIL_RENDERER);
     for (auto entityIndex = entityPool.firstEntity;
          entityIndex < entityPool.lastEntity;
-         entityIndex++) { trailRenderers_[entityIndex] = archetype.trailRenderer; }
+         entityIndex++) { trailRenderers_[entityIndex] = trailRenderer; }
 }
 
 void TrailRendererManager::InsertArchetype(const EntityIndex entity, const Archetype& archetype)
 {
-    trailRenderers_.insert(trailRenderers_.begin() + entity, archetype.trailRenderer);
+    trailRenderers_.insert(trailRenderers_.begin() + entity, archetype.GetComponent<TrailRenderer>(ComponentType::TRAIL_RENDERER));
 }
 
 void TrailRendererManager::EraseEntities(const EntityPool pool, const size_t nbObjectToErase)
@@ -28,9 +28,10 @@ void TransformsManager::SetWithArchetype(
     const EntityPool entityPool,
     const Archetype& archetype)
 {
+    const math::Transform& transform = archetype.GetComponent<math::Transform>(ComponentType::TRANSFORM);
     for (EntityIndex entityIndex = entityPool.firstEntity; entityIndex < entityPool.lastEntity;
          entityIndex++) {
-        transforms_[entityIndex] = archetype.transform;
+        transforms_[entityIndex] = transform;
         parents_[entityIndex] = kNoParent;
     }
 }
@@ -39,7 +40,7 @@ void TransformsManager::InsertArchetype(
     const EntityIndex entity,
     const Archetype& archetype)
 {
-    transforms_.insert(transforms_.begin() + entity, archetype.transform);
+    transforms_.insert(transforms_.begin() + entity, archetype.GetComponent<math::Transform>(ComponentType::TRANSFORM));
     worldToLocalMatrices_.insert(worldToLocalMatrices_.begin() + entity, math::Matrix4::Identity());
     localToWorldMatrices_.insert(localToWorldMatrices_.begin() + entity, math::Matrix4::Identity());
 
@@ -110,23 +111,23 @@ void TransformsManager::SetComponentFromWorldTransform(
             entityIndex,
             worldTransform.GetLocalScale());
 
-        //Works fine
-        const auto localRotation = GetLocalRotationFromWorldRotation(
+        const auto localOrientation = GetLocalOrientationFromWorldOrientation(
             entityIndex,
-            worldTransform.GetLocalRotation());
+            worldTransform.GetLocalOrientation());
 
-        SetComponent(entityIndex, math::Transform(localPos, localRotation, localScale));
+        math::Transform localTransform(localPos, math::Vec3(0, 0, 0), localScale);
+        localTransform.SetLocalOrientation(localOrientation);
+        SetComponent(entityIndex, localTransform);
     }
 }
 
-math::Vec3 TransformsManager::GetLocalRotationFromWorldRotation(
+math::Quaternion TransformsManager::GetLocalOrientationFromWorldOrientation(
     const EntityIndex entityIndex,
-    const math::Vec3 rotation) const
+    const math::Quaternion orientation) const
 {
-    if (parents_[entityIndex] == kNoParent) { return rotation; }
+    if (parents_[entityIndex] == kNoParent) { return orientation; }
 
-    const auto rot = rotation - transforms_[parents_[entityIndex]].GetLocalRotation();
-    return GetLocalRotationFromWorldRotation(parents_[entityIndex], rot);
+    return GetWorldOrientation(parents_[entityIndex]).GetConjugate() * orientation;
 }
 
 math::Vec3 TransformsManager::GetLocalScaleFromWorldScale(
@@ -219,17 +220,24 @@ math::Vec3 TransformsManager::GetWorldScale(const EntityIndex entityIndex)
 
 math::Vec3 TransformsManager::GetWorldRotation(const EntityIndex entityIndex)
 {
-    if (parents_[entityIndex] == kNoParent) { return transforms_[entityIndex].GetLocalRotation(); }
-    return transforms_[entityIndex].GetLocalRotation() + GetWorldRotation(parents_[entityIndex]);
+    return GetWorldOrientation(entityIndex).GetEulerAngles();
+}
+
+math::Quaternion TransformsManager::GetWorldOrientation(const EntityIndex entityIndex) const
+{
+    if (parents_[entityIndex] == kNoParent) { return transforms_[entityIndex].GetLocalOrientation(); }
+    return GetWorldOrientation(parents_[entityIndex]) * transforms_[entityIndex].GetLocalOrientation();
 }
 
 math::Transform TransformsManager::GetWorldTransform(const EntityIndex entityIndex)
 {
     if (parents_[entityIndex] == kNoParent) { return transforms_[entityIndex]; } else {
-        return math::Transform(
+        math::Transform worldTransform(
             GetWorldPosition(entityIndex),
-            GetWorldRotation(entityIndex),
+            math::Vec3(0, 0, 0),
             GetWorldScale(entityIndex));
+        worldTransform.SetLocalOrientation(GetWorldOrientation(entityIndex));
+        return worldTransform;
     }
 }
 
@@ -304,34 +312,6 @@ void TransformsManager::SetDirty(const EntityIndex entityIndex)
 math::Matrix4 TransformsManager::CalculateLocalToParentMatrix(
     const EntityIndex entityIndex) const
 {
-    const auto transform = transforms_[entityIndex];
-
-    auto parentMatrix = math::Matrix4::Identity();
-    parentMatrix = math::Matrix4::Translate(
-        parentMatrix,
-        transform.GetLocalPosition());
-
-    const auto localRotation = transform.GetLocalRotation();
-
-    parentMatrix = math::Matrix4::Rotate(
-        parentMatrix,
-        localRotation.x,
-        math::Vec3(1, 0, 0));
-
-    parentMatrix = math::Matrix4::Rotate(
-        parentMatrix,
-        localRotation.y,
-        math::Vec3(0, 1, 0));
-
-    parentMatrix = math::Matrix4::Rotate(
-        parentMatrix,
-        localRotation.z,
-        math::Vec3(0, 0, 1));
-
-    parentMatrix = math::Matrix4::Scale(
-        parentMatrix,
-        transform.GetLocalScale());
-
-    return parentMatrix;
+    return transforms_[entityIndex].GetLocalMatrix();
 }
 } // namespace poke::ecs
@@ -23,7 +23,7 @@ bool SplineFollower::operator!=(const SplineFollower& other) const
 json SplineFollower::ToJson() const
 {
     json splineJson;
-    auto points = spline.GetPoints();
+    const auto& points = spline.GetPoints();
 	splineJson["points"] = json::value_t::array;
 	for (size_t i = 0; i < points.size(); i++) {
         splineJson["points"][i] = points[i].ToJson();
@@ -33,11 +33,12 @@ json SplineFollower::ToJson() const
 
 void SplineFollower::SetFromJson(const json& splineJson)
 {
-	for (int i = 0; i < splineJson["points"].size(); i++) {
-		math::Vec3 pos;
-		pos.SetFromJson(splineJson["points"][i]);
-		spline.AddPoint(pos);
+	//The points are registered once, each new point would bake a new spline
+	std::vector<math::Vec3> points(splineJson["points"].size());
+	for (size_t i = 0; i < points.size(); i++) {
+		points[i].SetFromJson(splineJson["points"][i]);
 	}
+	spline.SetPoints(points);
 }
 } //namespace ecs
 } //namespace poke
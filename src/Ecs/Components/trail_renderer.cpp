@@ -6,47 +6,61 @@ namespace poke {
 namespace ecs {
 bool TrailRenderer::operator==(const TrailRenderer& other) const
 {
-    return materialID == other.materialID
-           && lifetime == other.lifetime
-           && changeTime == other.changeTime
-           && widthStart == other.widthStart
-           && widthEnd == other.widthEnd
-           && vertexDistanceMin == other.vertexDistanceMin
-           && renderDirection == other.renderDirection
-           && isPaused == other.isPaused
-           && centerPositions_ == other.centerPositions_
-           && leftVertices_ == other.leftVertices_
-           && rightVertices_ == other.rightVertices_;
+    if (materialID != other.materialID
+        || lifetime != other.lifetime
+        || changeTime != other.changeTime
+        || widthStart != other.widthStart
+        || widthEnd != other.widthEnd
+        || vertexDistanceMin != other.vertexDistanceMin
+        || renderDirection != other.renderDirection
+        || isPaused != other.isPaused
+        || hasCenterPosition_ != other.hasCenterPosition_
+        || (hasCenterPosition_ && lastCenterPosition_ != other.lastCenterPosition_)
+        || count_ != other.count_) { return false; }
+
+    //The rings can start at different slots
+    for (size_t i = 0; i < count_; i++) {
+        if (leftVertices_[GetSlot(i)] != other.leftVertices_[other.GetSlot(i)] ||
+            rightVertices_[GetSlot(i)] != other.rightVertices_[other.GetSlot(i)]) { return false; }
+    }
+    return true;
 }
 
 bool TrailRenderer::operator!=(const TrailRenderer& other) const { return !(*this == other); }
 
 bool TrailRenderer::Update(const math::Vec3 worldPos)
 {
-	if (centerPositions_.empty()) {
-		centerPositions_.push_back(worldPos);
-		return false;
-	}
-
     const float dt = Time::Get().deltaTime.count() / 1000.0f;
+    return Update(worldPos, dt, CameraLocator::Get().GetFront());
+}
 
-    for (auto& leftVertex : leftVertices_) { leftVertex.timeAlive += dt; }
+bool TrailRenderer::Update(const math::Vec3 worldPos, const float dt, const math::Vec3 cameraFront)
+{
+	if (!hasCenterPosition_) {
+		lastCenterPosition_ = worldPos;
+		hasCenterPosition_ = true;
+		return false;
+	}
 
-    for (auto& rightVertex : rightVertices_) { rightVertex.timeAlive += dt; }
+    for (size_t i = 0; i < count_; i++) {
+        leftVertices_[GetSlot(i)].timeAlive += dt;
+        rightVertices_[GetSlot(i)].timeAlive += dt;
+    }
 
     //set the mesh and adjust widths if vertices were added or removed
-    if (TryAddVertices(worldPos) | TryRemoveVertices() | SetVertexWidth()) {
+    if (TryAddVertices(worldPos, cameraFront) | TryRemoveVertices() | SetVertexWidth()) {
 		return true;
     }
 	return false;
 }
 
-size_t TrailRenderer::GetNumberOfPoints() const { return centerPositions_.size(); }
+size_t TrailRenderer::GetNumberOfPoints() const { return hasCenterPosition_ ? count_ + 1 : 0; }
 
 void TrailRenderer::Clear()
 {
-    centerPositions_.clear();
-    centerPositions_.shrink_to_fit();
+    hasCenterPosition_ = false;
+    head_ = 0;
+    count_ = 0;
     leftVertices_.clear();
     leftVertices_.shrink_to_fit();
     rightVertices_.clear();
@@ -83,25 +97,36 @@ json TrailRenderer::ToJson() const
     return trailRendererJson;
 }
 
-bool TrailRenderer::TryAddVertices(const math::Vec3 worldPos)
+bool TrailRenderer::TryAddVertices(const math::Vec3 worldPos, const math::Vec3 cameraFront)
 {
-	const auto cameraFront = CameraLocator::Get().GetFront();
-
-    if (math::Vec3::GetDistanceManhattan(centerPositions_.back(), worldPos) > vertexDistanceMin * vertexDistanceMin) {
+    if (math::Vec3::GetDistanceManhattan(lastCenterPosition_, worldPos) > vertexDistanceMin * vertexDistanceMin) {
         //Calculate the normalized direction from the ) most recent position of vertex creation to the 2) current position
-        const math::Vec3 dirToCurrentPos = (worldPos - centerPositions_.back()).Normalize();
+        const math::Vec3 dirToCurrentPos = (worldPos - lastCenterPosition_).Normalize();
 
         //Calculate the positions of the left and right vertices -> they are perpendicular to 'dirToCurrentPos' and 'renderDirection'
         const math::Vec3 cross = math::Vec3::Cross(cameraFront, dirToCurrentPos);
         const math::Vec3 leftPos = worldPos + cross * -widthStart * 0.5f;
         const math::Vec3 rightPos = worldPos + cross * widthStart * 0.5f;
 
+        if (leftVertices_.empty()) {
+            leftVertices_.resize(kMaxVertexPairs);
+            rightVertices_.resize(kMaxVertexPairs);
+        }
+
+        //A full ring retires its oldest vertices
+        if (count_ == kMaxVertexPairs) {
+            head_ = GetSlot(1);
+            count_--;
+        }
+
         //Calculate left and right pos
-        leftVertices_.emplace_back(leftPos, worldPos, (leftPos - worldPos).Normalize());
-        rightVertices_.emplace_back(rightPos, worldPos, (rightPos - worldPos).Normalize());
+        const size_t slot = GetSlot(count_);
+        leftVertices_[slot] = TrailRendererVertex(leftPos, worldPos, (leftPos - worldPos).Normalize());
+        rightVertices_[slot] = TrailRendererVertex(rightPos, worldPos, (rightPos - worldPos).Normalize());
+        count_++;
 
         //Add new position
-        centerPositions_.push_back(worldPos);
+        lastCenterPosition_ = worldPos;
         return true;
     }
 
@@ -112,10 +137,9 @@ bool TrailRenderer::TryRemoveVertices()
 {
 	bool vertexRemoved = false;
 
-    while(!leftVertices_.empty() && leftVertices_.front().timeAlive > lifetime) {
-		leftVertices_.erase(leftVertices_.begin());
-		rightVertices_.erase(rightVertices_.begin());
-		centerPositions_.erase(centerPositions_.begin());
+    while(count_ > 0 && leftVertices_[head_].timeAlive > lifetime) {
+		head_ = GetSlot(1);
+		count_--;
 
 		vertexRemoved = true;
     }
@@ -129,68 +153,78 @@ bool TrailRenderer::SetVertexWidth()
     const float widthDelta = widthStart - widthEnd;
     const float timeDelta = lifetime - changeTime;
 
-    for (size_t i = 0; i < leftVertices_.size(); i++) {
-        if (leftVertices_[i].timeAlive > changeTime) {
-            const float width = widthStart - (widthDelta * ((leftVertices_[i].timeAlive - changeTime) / (timeDelta + 0.00001f)));
+    for (size_t i = 0; i < count_; i++) {
+        const size_t slot = GetSlot(i);
+        if (leftVertices_[slot].timeAlive > changeTime) {
+            const float width = widthStart - (widthDelta * ((leftVertices_[slot].timeAlive - changeTime) / (timeDelta + 0.00001f)));
 
             const float halfWidth = width * 0.5f;
 
-            leftVertices_[i].AdjustWidth(halfWidth);
-            rightVertices_[i].AdjustWidth(halfWidth);
+            leftVertices_[slot].AdjustWidth(halfWidth);
+            rightVertices_[slot].AdjustWidth(halfWidth);
         }
     }
 
     return true;
 }
 
-std::pair<std::vector<graphics::VertexMesh>, std::vector<uint32_t>> TrailRenderer::GenerateMesh()
+TrailMeshRange TrailRenderer::WriteMesh(graphics::VertexMesh* ringVertices) const
 {
+	TrailMeshRange meshRange;
+
 	//Only continue if there are at least two center positions in the collection
-	if (leftVertices_.size() < 2) {
-		return {};
+	if (count_ < 2) {
+		return meshRange;
 	}
 
-	std::vector<graphics::VertexMesh> vertices(leftVertices_.size() * 2);
-	std::vector<uint32_t> indexes((leftVertices_.size() - 1) * 6);
-
 	//Get the change in time between the first and last pair of vertices.
-	const float timeDelta = leftVertices_.back().timeAlive - leftVertices_.front().timeAlive + 0.0001f;
+	const float timeDelta = leftVertices_[GetSlot(count_ - 1)].timeAlive - leftVertices_[head_].timeAlive + 0.0001f;
 
-	//Iterate through all the pairs of vertices (left + right).
-	for (size_t i = 0, j = 0; i < leftVertices_.size(); i++, j += 2) {
-		const auto leftVertex = leftVertices_[i];
-		const auto rightVertex = rightVertices_[i];
+	//The uv depend on the age, every pair of vertices alive is written
+	for (size_t i = 0; i < count_; i++) {
+		const size_t slot = GetSlot(i);
+		const auto& leftVertex = leftVertices_[slot];
+		const auto& rightVertex = rightVertices_[slot];
 
 		const float uvValue = leftVertex.timeAlive / timeDelta;
 
-		vertices[j] = graphics::VertexMesh(
+		ringVertices[slot * 2] = graphics::VertexMesh(
 			leftVertex.position,
 			math::Vec2(uvValue, 0),
 			{0, 0, 0}
 			);
 
-		vertices[j + 1] = graphics::VertexMesh(
+		ringVertices[slot * 2 + 1] = graphics::VertexMesh(
 			rightVertex.position,
 			math::Vec2(uvValue, 1),
 			{0, 0, 0}
 		);
-
-		//trail position
-		const int vertexIndex = i * 2;
-
-		//trail triangles
-		if (i > 0) {
-			const int triIndex = (i - 1) * 6;
-			indexes[triIndex] = vertexIndex - 2;
-			indexes[triIndex + 1] = vertexIndex - 1;
-			indexes[triIndex + 2] = vertexIndex + 1;
-			indexes[triIndex + 3] = vertexIndex - 2;
-			indexes[triIndex + 4] = vertexIndex + 1;
-			indexes[triIndex + 5] = vertexIndex;
-		}
 	}
 
-	return {vertices, indexes};
+	meshRange.firstVertex = static_cast<uint32_t>(head_ * 2);
+	meshRange.vertexCount = static_cast<uint32_t>(count_ * 2);
+	meshRange.firstIndex = static_cast<uint32_t>(head_ * 6);
+	meshRange.indexCount = static_cast<uint32_t>((count_ - 1) * 6);
+	return meshRange;
+}
+
+std::vector<uint32_t> TrailRenderer::GenerateRingIndexes()
+{
+	std::vector<uint32_t> indexes(kMaxVertexPairs * 2 * 6);
+	for (size_t i = 0; i < kMaxVertexPairs * 2; i++) {
+		//trail triangles between the slot and the next one
+		const uint32_t previousIndex = static_cast<uint32_t>(i % kMaxVertexPairs * 2);
+		const uint32_t vertexIndex = static_cast<uint32_t>((i + 1) % kMaxVertexPairs * 2);
+
+		const size_t triIndex = i * 6;
+		indexes[triIndex] = previousIndex;
+		indexes[triIndex + 1] = previousIndex + 1;
+		indexes[triIndex + 2] = vertexIndex + 1;
+		indexes[triIndex + 3] = previousIndex;
+		indexes[triIndex + 4] = vertexIndex + 1;
+		indexes[triIndex + 5] = vertexIndex;
+	}
+	return indexes;
 }
 } //namespace ecs
 } //namespace poke
@@ -30,7 +30,9 @@ void EnginePrefab::SetFromJson(const json& prefabJson)
 
         parentIndexes_[i] = prefabJson[i]["transform"]["parent"];
 		
-        names_[i] = prefabJson[i]["objectName"].get<std::string>();
+        if (CheckJsonExists(prefabJson[i], "objectName")) {
+            names_[i] = prefabJson[i]["objectName"].get<std::string>();
+        }
     }
 }
 
@@ -1,13 +1,30 @@
 #include <Ecs/core_ecs_manager.h>
 
+#include <algorithm>
+
 #include <CoreEngine/engine.h>
 #include <Utility/log.h>
 #include <CoreEngine/ServiceLocator/service_locator_definition.h>
 #include <Utility/time_custom.h>
 #include <Ecs/ComponentManagers/trail_renderer_manager.h>
 #include <Ecs/ComponentManagers/segment_renderer_manager.h>
+#include <Scenes/binary_scene.h>
 
 namespace poke::ecs {
+namespace {
+//Components read by Archetype::SetFromJson, with their key
+const std::vector<std::pair<ComponentMask, const char*>> kPrefabComponentKeys{
+	{ ComponentType::MODEL, "model" },
+	{ ComponentType::SPLINE_FOLLOWER, "spline" },
+	{ ComponentType::RIGIDBODY, "rigidbody" },
+	{ ComponentType::COLLIDER, "collider" },
+	{ ComponentType::LIGHT, "light" },
+	{ ComponentType::PARTICLE_SYSTEM, "particleSystem" },
+	{ ComponentType::TRAIL_RENDERER, "trailRenderer" },
+	{ ComponentType::AUDIO_SOURCE, "audioSource" }
+};
+} //namespace
+
 CoreEcsManager::CoreEcsManager(Engine& engine, const size_t defaultPoolSize)
     : subjectsContainer_(
         {},
@@ -116,6 +133,21 @@ void CoreEcsManager::SetEntityWithArchetype(
 void CoreEcsManager::DestroyEntity(const EntityIndex entityIndex, const float timeInSecond)
 {
 	if (timeInSecond <= 0.0f) {
+		//The entities of a prefab pool are kept for the next instantiation
+		const auto pooledEntity = pooledEntities_.find(entityIndex);
+		if (pooledEntity != pooledEntities_.end()) {
+			PrefabPool& pool = prefabPools_[pooledEntity->second.poolIndex];
+			PrefabInstance& instance = pool.instances[pooledEntity->second.instanceIndex];
+			if (pool.parentIndexes[pooledEntity->second.objectIndex] == kNoParent) {
+				ReleasePrefabInstance(pool, pooledEntity->second.instanceIndex);
+			} else if (instance.isActive && IsEntityActive(entityIndex)) {
+				subjectsContainer_.NotifySubject(observer::EntitiesSubjects::DESTROY, entityIndex);
+				SetActive(entityIndex, EntityStatus::INACTIVE);
+				instance.isReset = false;
+			}
+			return;
+		}
+
 		auto& transformManager = GetComponentsManager<TransformsManager>();
 		transformManager.SetParent(entityIndex, kNoParent);
 
@@ -527,13 +559,20 @@ void CoreEcsManager::OnAppBuild()
 {
 	GraphicsEngineLocator::Get().GetEngine().AddObserver(
 		observer::MainLoopSubject::UPDATE,
-		[this]() {UpdateDestroyedEntities(); });
+		[this]() {
+		    UpdateDestroyedEntities();
+		    NotifyUpdatedComponents();
+		});
 
     componentsManagersContainer_.Init();
 }
 
 void CoreEcsManager::OnUnloadScene()
 {
+    //The pools are filled again by the next scene
+    prefabPools_.clear();
+    pooledEntities_.clear();
+
     //Clear all entities.
     for (size_t entityIndex = 0; entityIndex < entities_.size(); entityIndex++) {
         DestroyEntity(entityIndex);
@@ -576,6 +615,120 @@ std::vector<EntityIndex> CoreEcsManager::InstantiatePrefab(const Prefab& prefab)
 	return entities;
 }
 
+void CoreEcsManager::AddPrefabPool(
+    const ResourceID prefabID,
+    const Prefab& prefab,
+    const size_t instancesCount)
+{
+	//The objects from an archetype already use the pool of the archetype
+	const auto& archetypesIDs = prefab.GetArchetypesID();
+	if (std::any_of(archetypesIDs.begin(), archetypesIDs.end(), [](const ArchetypeID archetypeID) { return archetypeID != 0; })) {
+		LogWarning("A prefab with archetypes can't be pooled, its archetypes are already pooled", LogType::ECS_LOG);
+		return;
+	}
+
+	auto poolIt = std::find_if(prefabPools_.begin(), prefabPools_.end(), [prefabID](const PrefabPool& pool) {
+		return pool.prefabID == prefabID;
+	});
+	if (poolIt == prefabPools_.end()) {
+		poolIt = prefabPools_.insert(prefabPools_.end(), PrefabPool{ prefabID, prefab.GetParentIndexes() });
+	}
+	const size_t poolIndex = std::distance(prefabPools_.begin(), poolIt);
+
+	for (size_t i = poolIt->instances.size(); i < instancesCount; i++) {
+		PrefabInstance instance;
+		instance.entities = InstantiatePrefab(prefab);
+
+		for (size_t objectIndex = 0; objectIndex < instance.entities.size(); objectIndex++) {
+			pooledEntities_[instance.entities[objectIndex]] = PooledEntity{ poolIndex, i, objectIndex };
+			if (poolIt->parentIndexes[objectIndex] == kNoParent) {
+				SetActive(instance.entities[objectIndex], EntityStatus::INACTIVE);
+			}
+		}
+
+		poolIt->instances.push_back(std::move(instance));
+		poolIt->freeInstances.push_back(i);
+	}
+}
+
+std::vector<EntityIndex> CoreEcsManager::InstantiatePooledPrefab(const ResourceID prefabID, const Prefab& prefab)
+{
+	const auto poolIt = std::find_if(prefabPools_.begin(), prefabPools_.end(), [prefabID](const PrefabPool& pool) {
+		return pool.prefabID == prefabID;
+	});
+	//A prefab edited since the pool was created is instantiated normally
+	if (poolIt == prefabPools_.end() ||
+		poolIt->freeInstances.empty() ||
+		poolIt->parentIndexes != prefab.GetParentIndexes()) { return InstantiatePrefab(prefab); }
+
+	PrefabInstance& instance = poolIt->instances[poolIt->freeInstances.back()];
+	poolIt->freeInstances.pop_back();
+
+	if (!instance.isReset) { ResetPrefabInstance(*poolIt, instance, prefab); }
+	instance.isActive = true;
+	instance.isReset = false;
+
+	//Same notifications than AddEntity, without the add component ones
+	for (size_t i = 0; i < instance.entities.size(); i++) {
+		if (poolIt->parentIndexes[i] == kNoParent) { SetActive(instance.entities[i], EntityStatus::ACTIVE); }
+	}
+	for (const EntityIndex entityIndex : instance.entities) {
+		subjectsContainer_.NotifySubject(observer::EntitiesSubjects::INIT, entityIndex);
+	}
+
+	return instance.entities;
+}
+
+void CoreEcsManager::ReleasePrefabInstance(PrefabPool& pool, const size_t instanceIndex)
+{
+	PrefabInstance& instance = pool.instances[instanceIndex];
+	if (!instance.isActive) { return; }
+
+	auto& transformManager = componentsManagersContainer_.GetComponentsManager<TransformsManager>();
+	for (size_t i = 0; i < instance.entities.size(); i++) {
+		subjectsContainer_.NotifySubject(observer::EntitiesSubjects::DESTROY, instance.entities[i]);
+	}
+	for (size_t i = 0; i < instance.entities.size(); i++) {
+		if (pool.parentIndexes[i] != kNoParent) { continue; }
+
+		//A free instance must not be destroyed with the entity it was attached to
+		transformManager.SetParent(instance.entities[i], kNoParent);
+		SetActive(instance.entities[i], EntityStatus::INACTIVE);
+	}
+
+	instance.isActive = false;
+	instance.isReset = false;
+	pool.freeInstances.push_back(instanceIndex);
+}
+
+void CoreEcsManager::ResetPrefabInstance(const PrefabPool& pool, PrefabInstance& instance, const Prefab& prefab)
+{
+	auto& transformManager = componentsManagersContainer_.GetComponentsManager<TransformsManager>();
+
+	for (size_t i = 0; i < instance.entities.size(); i++) {
+		const EntityIndex entityIndex = instance.entities[i];
+		const Archetype& archetype = prefab.GetObject(i);
+		//The masks also hold the flags of the entities
+		const ComponentMask prefabComponents = archetype.GetComponentMask() & (ComponentType::LENGTH - 1);
+		const ComponentMask components = entities_[entityIndex].GetComponentMask() & (ComponentType::LENGTH - 1);
+
+		//The transform manager would lose the children, the parent is set back instead
+		componentsManagersContainer_.SetWithArchetype(
+			EntityPool{ entityIndex, entityIndex + 1 },
+			archetype,
+			prefabComponents & ~ComponentType::TRANSFORM);
+		transformManager.SetComponent(entityIndex, archetype.GetComponent<math::Transform>(ComponentType::TRANSFORM));
+
+		const EntityIndex parent = pool.parentIndexes[i] == kNoParent ? kNoParent : instance.entities[pool.parentIndexes[i]];
+		if (transformManager.GetParent(entityIndex) != parent) { transformManager.SetParent(entityIndex, parent); }
+
+		//Only the components added or removed by the gameplay are notified
+		if (components & ~prefabComponents) { RemoveComponent(entityIndex, components & ~prefabComponents); }
+		if (prefabComponents & ~components) { AddComponent(entityIndex, prefabComponents & ~components); }
+	}
+	instance.isReset = true;
+}
+
 void CoreEcsManager::AllocatePoolMemory(const size_t sizeToAdd)
 {
 	const size_t newSize = entities_.size() + sizeToAdd;
@@ -756,12 +909,239 @@ std::map<ecs::EntityIndex, ecs::EntityIndex> CoreEcsManager::SetEntitiesFromJson
 	return sceneIdToEntityId;
 }
 
+std::map<ecs::EntityIndex, ecs::EntityIndex> CoreEcsManager::SetEntitiesFromBinary(const scene::BinarySceneView& sceneView)
+{
+	namespace binary_scene = scene::binary_scene;
+
+	auto& transformManager = componentsManagersContainer_.GetComponentsManager<TransformsManager>();
+	auto& modelsManager = componentsManagersContainer_.GetComponentsManager<ModelsManager>();
+	auto& rigidbodyManager = componentsManagersContainer_.GetComponentsManager<RigidbodyManager>();
+	auto& collidersManager = componentsManagersContainer_.GetComponentsManager<CollidersManager>();
+
+	//Typed records are copied straight into the managers
+	const auto setComponentFromRecord = [&](
+		const EntityIndex entityIndex,
+		const scene::BinaryComponentBlock& block,
+		const uint32_t recordIndex) {
+		switch (block.componentType) {
+		case ComponentType::MODEL: {
+			const auto& record = block.GetRecord<binary_scene::ModelRecord>(recordIndex);
+			modelsManager.SetComponent(entityIndex, graphics::Model(record.materialID, record.meshID));
+			break;
+		}
+		case ComponentType::RIGIDBODY: {
+			const auto& record = block.GetRecord<binary_scene::RigidbodyRecord>(recordIndex);
+			physics::Rigidbody rigidbody;
+			rigidbody.linearVelocity = record.linearVelocity;
+			rigidbody.angularVelocity = record.angularVelocity;
+			rigidbody.linearDrag = record.linearDrag;
+			rigidbody.angularDrag = record.angularDrag;
+			rigidbody.type = static_cast<physics::RigidbodyType>(record.type);
+			rigidbodyManager.SetComponent(entityIndex, rigidbody);
+			break;
+		}
+		case ComponentType::COLLIDER: {
+			const auto& record = block.GetRecord<binary_scene::ColliderRecord>(recordIndex);
+			physics::Collider collider;
+			collider.isTrigger = record.isTrigger != 0;
+			switch (static_cast<physics::ShapeType>(record.shapeType)) {
+			case physics::ShapeType::BOX:
+				collider.SetShape(physics::BoxShape(record.positionOffset, record.extent));
+				break;
+			case physics::ShapeType::SPHERE:
+				collider.SetShape(physics::SphereShape(record.positionOffset, record.radius));
+				break;
+			case physics::ShapeType::ELLIPSOID:
+				collider.SetShape(physics::EllipsoidShape(record.positionOffset, record.radius));
+				break;
+			case physics::ShapeType::MESH: {
+				physics::MeshShape meshShape;
+				meshShape.SetMeshExtent(record.extent);
+				meshShape.SetOffset(record.positionOffset);
+				collider.SetShape(meshShape);
+				break;
+			}
+			default:
+				collider.shapeType = static_cast<physics::ShapeType>(record.shapeType);
+			}
+			collidersManager.SetComponent(entityIndex, collider);
+			break;
+		}
+		default: ;
+		}
+	};
+
+	//Components are stored by type, each block is walked once along the entities
+	struct ComponentBlockLoader {
+		const scene::BinaryComponentBlock* block;
+		IComponentsManager* componentsManager;
+		ComponentType::ComponentType componentType;
+		uint32_t cursor;
+	};
+	std::vector<ComponentBlockLoader> componentLoaders;
+	componentLoaders.reserve(sceneView.GetComponentBlockCount());
+	for (size_t i = 0; i < sceneView.GetComponentBlockCount(); i++) {
+		const scene::BinaryComponentBlock& block = sceneView.GetComponentBlock(i);
+		IComponentsManager* componentsManager = componentsManagersContainer_.FindComponentsManager(block.componentType);
+		if (componentsManager != nullptr) {
+			componentLoaders.push_back(ComponentBlockLoader{&block, componentsManager, block.componentType, 0});
+		}
+	}
+
+	//Same as the json, prefabs only take their spline from the scene
+	const auto setComponents = [this, &componentLoaders, &setComponentFromRecord](
+		const uint32_t sceneEntity,
+		const EntityIndex entityIndex,
+		const bool isPrefab,
+		const bool isSplinePass) {
+		for (ComponentBlockLoader& loader : componentLoaders) {
+			const bool isSpline = loader.componentType == ComponentType::SPLINE_FOLLOWER;
+			if (isSpline != isSplinePass) { continue; }
+
+			const scene::BinaryComponentBlock& block = *loader.block;
+			if (loader.cursor >= block.entityCount || block.entities[loader.cursor] != sceneEntity) { continue; }
+
+			if (!isPrefab || isSpline) {
+				if (block.IsTyped()) {
+					setComponentFromRecord(entityIndex, block, loader.cursor);
+				} else {
+					loader.componentsManager->SetComponentFromJson(entityIndex, block.GetComponentJson(loader.cursor));
+				}
+				AddComponent(entityIndex, loader.componentType);
+			}
+			loader.cursor++;
+		}
+	};
+
+	const uint8_t* flags = sceneView.GetFlags();
+	const EntityTag* tags = sceneView.GetTags();
+	const uint32_t* prefabs = sceneView.GetPrefabs();
+	const EntityIndex* parents = sceneView.GetParents();
+	const math::Vec3* positions = sceneView.GetPositions();
+	const math::Vec3* rotations = sceneView.GetRotations();
+	const math::Vec3* scales = sceneView.GetScales();
+
+	int parentOffset = 0;
+	ecs::EntityIndex lastGeneratedEntityIndex = -1;
+	std::map<ecs::EntityIndex, ecs::EntityIndex> baseParentIdToOffsetParentId;
+	std::map<ecs::EntityIndex, ecs::EntityIndex> sceneIdToEntityId;
+	for (uint32_t sceneEntity = 0; sceneEntity < sceneView.GetEntityCount(); sceneEntity++) {
+		ecs::EntityIndex entityIndex;
+		const bool isPrefab = prefabs[sceneEntity] != binary_scene::kNoString;
+		if (isPrefab) {
+			const nonstd::string_view prefabName = sceneView.GetString(prefabs[sceneEntity]);
+			const std::vector<ecs::EntityIndex> instantiatedObjects = InstantiateScenePrefab(
+				std::string(prefabName.data(), prefabName.size()));
+
+			entityIndex = instantiatedObjects[0];
+
+			parentOffset += entityIndex - lastGeneratedEntityIndex - 1;
+
+			baseParentIdToOffsetParentId[entityIndex] = entityIndex + parentOffset;
+
+			parentOffset += instantiatedObjects.size() - 1;
+			lastGeneratedEntityIndex = instantiatedObjects[instantiatedObjects.size() - 1];
+
+			for (int i = entityIndex - parentOffset; i < baseParentIdToOffsetParentId.size(); i++) {
+				const int currentParent = baseParentIdToOffsetParentId.at(i);
+				if (currentParent >= entityIndex) {
+					baseParentIdToOffsetParentId[i] += instantiatedObjects.size() - 1;
+				}
+			}
+
+			for (int i = 1; i < instantiatedObjects.size(); i++) {
+				baseParentIdToOffsetParentId[instantiatedObjects[i]] = instantiatedObjects[i] + parentOffset;
+			}
+		}
+		else {
+			entityIndex = AddEntity();
+			parentOffset += entityIndex - lastGeneratedEntityIndex - 1;
+			lastGeneratedEntityIndex = entityIndex;
+			baseParentIdToOffsetParentId[entityIndex] = entityIndex + parentOffset;
+		}
+
+		setComponents(sceneEntity, entityIndex, isPrefab, false);
+
+		//Generic parameters
+		if (flags[sceneEntity] & binary_scene::EntityFlag::HAS_TRANSFORM) {
+			EntityIndex parent = parents[sceneEntity];
+			const auto parentIt = baseParentIdToOffsetParentId.find(parent);
+			if (parentIt != baseParentIdToOffsetParentId.end()) {
+				parent = parentIt->second;
+			}
+
+			transformManager.SetComponent(
+				entityIndex,
+				math::Transform(positions[sceneEntity], rotations[sceneEntity], scales[sceneEntity]));
+			transformManager.SetParent(entityIndex, parent);
+
+			AddComponent(entityIndex, ComponentType::TRANSFORM);
+		}
+		if (flags[sceneEntity] & binary_scene::EntityFlag::HAS_TAG) {
+			SetTag(entityIndex, tags[sceneEntity]);
+		}
+		if ((flags[sceneEntity] & binary_scene::EntityFlag::HAS_ACTIVE) && !(flags[sceneEntity] & binary_scene::EntityFlag::IS_ACTIVE)) {
+			SetActive(entityIndex, EntityStatus::INACTIVE);
+		}
+
+		setComponents(sceneEntity, entityIndex, isPrefab, true);
+
+		sceneIdToEntityId[sceneEntity] = entityIndex;
+	}
+	return sceneIdToEntityId;
+}
+
+std::vector<EntityIndex> CoreEcsManager::InstantiateScenePrefab(const std::string& prefabName)
+{
+	return PrefabsManagerLocator::Get().Instantiate(prefabName);
+}
+
 std::tuple<json, std::map<ecs::EntityIndex, ecs::EntityIndex>> CoreEcsManager::EntitiesToJson()
 {
 	cassert(false, "Core Ecs Manager shouldn't be saving scenes.");
 	return std::make_tuple(json(), std::map<ecs::EntityIndex, ecs::EntityIndex>());
 }
 
+json CoreEcsManager::EntitiesToPrefabJson(const std::vector<EntityIndex>& entities)
+{
+	auto& transformsManager = componentsManagersContainer_.GetComponentsManager<TransformsManager>();
+
+	json prefabJson = json::array();
+	for (size_t i = 0; i < entities.size(); i++) {
+		const EntityIndex entity = entities[i];
+		json objectJson;
+
+		if (HasComponent(entity, ComponentType::TRANSFORM)) {
+			objectJson["transform"] = transformsManager.GetJsonFromComponent(entity);
+
+			//Parents outside of the list are lost
+			const auto parentIt = std::find(
+				entities.begin(),
+				entities.begin() + i,
+				transformsManager.GetParent(entity));
+			objectJson["transform"]["parent"] = parentIt == entities.begin() + i ?
+				kNoParent : static_cast<int>(parentIt - entities.begin());
+		}
+
+		for (const auto& componentKey : kPrefabComponentKeys) {
+			if (!HasComponent(entity, componentKey.first)) { continue; }
+
+			IComponentsManager* componentsManager = componentsManagersContainer_.FindComponentsManager(componentKey.first);
+			if (componentsManager) {
+				objectJson[componentKey.second] = componentsManager->GetJsonFromComponent(entity);
+			}
+		}
+
+		IComponentsManager* editorComponentManager = componentsManagersContainer_.FindComponentsManager(ComponentType::EDITOR_COMPONENT);
+		if (editorComponentManager && HasComponent(entity, ComponentType::EDITOR_COMPONENT)) {
+			objectJson["objectName"] = editorComponentManager->GetJsonFromComponent(entity)["name"];
+		}
+
+		prefabJson.push_back(objectJson);
+	}
+	return prefabJson;
+}
+
 void CoreEcsManager::RegisterObserverAddComponent(
     const std::function<void(EntityIndex, ComponentMask)>& callback)
 {
@@ -924,4 +1304,20 @@ void CoreEcsManager::UpdateDestroyedEntities()
     }
 }
 
+void CoreEcsManager::NotifyUpdatedComponents()
+{
+    const auto notify = [this](DirtyEntities& dirtyEntities, const ComponentMask component) {
+        //Entities flagged by the observers are notified in the same pass
+        const std::vector<EntityIndex>& entities = dirtyEntities.GetEntities();
+        for (size_t i = 0; i < entities.size(); i++) {
+            subjectUpdateComponent_.Notify(entities[i], component);
+        }
+        dirtyEntities.Clear();
+    };
+
+    notify(componentsManagersContainer_.GetComponentsManager<ModelsManager>().GetDirtyEntities(), ComponentType::MODEL);
+    notify(
+        componentsManagersContainer_.GetComponentsManager<ParticleSystemsManager>().GetDirtyEntities(),
+        ComponentType::PARTICLE_SYSTEM);
+}
 } //namespace poke::ecs
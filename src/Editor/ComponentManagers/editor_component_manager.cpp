@@ -41,7 +41,7 @@ void EditorComponentManager::SetWithArchetype(
 {
 	for (EntityIndex entityIndex = entityPool.firstEntity; entityIndex < entityPool.lastEntity;
 		entityIndex++) {
-		editorComponents_[entityIndex] = archetype.editorComponent;
+		editorComponents_[entityIndex] = archetype.GetComponent<ecs::EditorComponent>(ecs::ComponentType::EDITOR_COMPONENT);
 	}
 }
 
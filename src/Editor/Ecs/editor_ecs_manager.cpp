@@ -151,19 +151,7 @@ std::map<ecs::EntityIndex, ecs::EntityIndex> EditorEcsManager::SetEntitiesFromJs
 
 			const std::string nameString = entityJson["prefabName"].get<std::string>();
 
-			// <Temporary>
-			std::vector<ecs::EntityIndex> instantiatedObjects;
-			/******************************** Game prefab construction ********************************/
-			if (nameString == "Player")
-				instantiatedObjects = reinterpret_cast<game::GamePrefabsManager&>(poke::PrefabsManagerLocator::Get()).InstantiatePlayer();
-			else if (nameString == "LightFighter")
-				instantiatedObjects = reinterpret_cast<game::GamePrefabsManager&>(poke::PrefabsManagerLocator::Get()).InstantiateLightFighter();
-			else if (nameString == "Destroyer")
-				instantiatedObjects = reinterpret_cast<game::GamePrefabsManager&>(poke::PrefabsManagerLocator::Get()).InstantiateDestroyer();
-			else
-				instantiatedObjects = PrefabsManagerLocator::Get().Instantiate(nameString);
-			/******************************************************************************************/
-			// </Temporary>
+			const std::vector<ecs::EntityIndex> instantiatedObjects = InstantiateScenePrefab(nameString);
 
 			entityIndex = instantiatedObjects[0];
 
@@ -13,11 +13,10 @@ EditorPrefabsManager::EditorPrefabsManager() {}
 std::vector<ecs::EntityIndex> EditorPrefabsManager::Instantiate(
 	const nonstd::string_view& prefabName) const
 {
-	const auto hash = math::HashString(prefabName);
-	for (size_t i = 0; i < prefabsID_.size(); i++) {
-		if (hash == prefabsID_[i]) {
-			return EcsManagerLocator::Get().InstantiatePrefab(prefabs_[i]);
-		}
+	const ResourceID prefabID = math::HashString(prefabName);
+	const ResourceHandle handle = prefabIndex_.Find(prefabID);
+	if (handle != kInvalidResourceHandle) {
+		return EcsManagerLocator::Get().InstantiatePooledPrefab(prefabID, prefabs_[handle]);
 	}
 
 	LogWarning(
@@ -32,9 +31,9 @@ void EditorPrefabsManager::AddPrefab(const std::string& prefabName)
 {
 	const auto hash = math::HashString(prefabName);
 
-	const auto it = std::find(prefabsID_.begin(), prefabsID_.end(), hash);
-	if (it != prefabsID_.end()) return;
+	if (prefabIndex_.Find(hash) != kInvalidResourceHandle) return;
 
+	prefabIndex_.Insert(hash, static_cast<ResourceHandle>(prefabsID_.size()));
     prefabsID_.push_back(hash);
 
 	json prefabJson = LoadJson(
@@ -50,18 +49,21 @@ void EditorPrefabsManager::AddPrefab(const std::string& prefabName)
     prefabsNames_.push_back(prefabName);
 }
 
+void EditorPrefabsManager::AddPrefabPool(const std::string& prefabName, const size_t instancesCount)
+{
+	AddPrefab(prefabName);
+
+	const ResourceID prefabID = math::HashString(prefabName);
+	EcsManagerLocator::Get().AddPrefabPool(prefabID, prefabs_[prefabIndex_.Find(prefabID)], instancesCount);
+}
+
 const ecs::Prefab& EditorPrefabsManager::GetPrefab(
 	const nonstd::string_view& prefabName) const
 {
-	const auto hash = math::HashString(prefabName);
-	const auto it = std::find(
-		prefabsID_.begin(),
-		prefabsID_.end(),
-		hash);
+	const ResourceHandle handle = prefabIndex_.Find(math::HashString(prefabName));
+	cassert(handle != kInvalidResourceHandle, "The prefab " << prefabName << " doesn't exist");
 
-	const auto index = std::distance(prefabsID_.begin(), it);
-
-	return prefabs_[index];
+	return prefabs_[handle];
 }
 
 const std::vector<ResourceID>& EditorPrefabsManager::GetPrefabsIDs() const
@@ -74,6 +76,7 @@ void EditorPrefabsManager::Clear()
     prefabsID_.clear();
     prefabs_.clear();
     prefabsNames_.clear();
+    prefabIndex_.Clear();
 }
 
 void EditorPrefabsManager::Resize(const size_t newSize)
@@ -81,6 +84,11 @@ void EditorPrefabsManager::Resize(const size_t newSize)
 	prefabsID_.resize(newSize);
 	prefabs_.resize(newSize);
 	prefabsNames_.resize(newSize);
+
+	prefabIndex_.Clear();
+	for (size_t i = 0; i < prefabsID_.size(); i++) {
+		prefabIndex_.Insert(prefabsID_[i], static_cast<ResourceHandle>(i));
+	}
 }
 
 json EditorPrefabsManager::ToJson()
@@ -125,17 +133,15 @@ void EditorPrefabsManager::SetPrefab(
     const editor::EditorPrefab& prefab,
     const ResourceID prefabID)
 {
-    for (size_t i = 0; i < prefabsID_.size(); i++) {
-        if (prefabID == prefabsID_[i]) {
-            prefabs_[i] = prefab;
-
-            PokFileSystem::WriteFile(
-                prefabsNames_[i],
-                prefab.ToJson(),
-                FileType::PREFAB);
-            return;
-        }
-    }
+    const ResourceHandle handle = prefabIndex_.Find(prefabID);
+    if (handle == kInvalidResourceHandle) { return; }
+
+    prefabs_[handle] = prefab;
+
+    PokFileSystem::WriteFile(
+        prefabsNames_[handle],
+        prefab.ToJson(),
+        FileType::PREFAB);
 }
 
 void EditorPrefabsManager::AddPrefab(
@@ -153,6 +159,7 @@ void EditorPrefabsManager::AddPrefab(
 
     prefabs_.push_back(prefab);
     prefabsNames_.push_back(name);
+    prefabIndex_.Insert(math::HashString(name), static_cast<ResourceHandle>(prefabsID_.size()));
     prefabsID_.push_back(math::HashString(name));
 
 	PokFileSystem::WriteFile(
@@ -4,11 +4,14 @@
 namespace poke {
 namespace editor {
 
-ResourcesManagerContainer::ResourcesManagerContainer() {}
+ResourcesManagerContainer::ResourcesManagerContainer(ResourceLoader& resourceLoader)
+    : hotReloader(editorMeshesManager, editorTexturesManager, editorMaterialsManager, resourceLoader) {}
 void ResourcesManagerContainer::Init()
 {
 	SceneManagerLocator::Get().AddOnUnloadObserver([this]() {OnUnloadScene(); });
 	editorMeshesManager.Init();
+
+	hotReloader.Start();
 }
 
 void ResourcesManagerContainer::OnUnloadScene()
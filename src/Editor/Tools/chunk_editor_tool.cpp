@@ -69,7 +69,8 @@ void ChunkEditorTool::OnDrawImgui()
 
 	//for add new chunk
 	if (ImGui::Button("Add Chunk")) {
-		auto chunkIndex = chunkManager_.CreateChunk();
+		chunkManager_.CreateChunk();
+		chunkArray_.resize(chunkManager_.GetChunkNb());
 		chunkManager_.SetChunks(chunkArray_, chunkManager_.GetChunkNb());
 		SetChunkNames();		
 	}
@@ -224,7 +225,7 @@ void ChunkEditorTool::SetChunkValues(chunk::Chunk chunk)
 		if (ImGui::BeginPopup("remove chunk to destroy")) {
 			for (auto i = 0; i < chunkManager_.GetChunkNb(); i++) {
 
-				if (chunkArray_[selectedIndex_].GetChunksToDestroy()[i]) {
+				if (chunkArray_[selectedIndex_].GetChunksToDestroy().Contains(i)) {
 					if (ImGui::MenuItem(chunkNames_[i].c_str())) {
 						chunkArray_[selectedIndex_].RemoveChunkToDestroy(i);
 					}
@@ -235,7 +236,7 @@ void ChunkEditorTool::SetChunkValues(chunk::Chunk chunk)
 		}
 		if (ImGui::BeginMenu("Chunk to destroy")) {
 			for (int i = 0; i < chunkManager_.GetChunkNb(); i++) {
-				if (chunkArray_[selectedIndex_].GetChunksToDestroy()[i]) {
+				if (chunkArray_[selectedIndex_].GetChunksToDestroy().Contains(i)) {
 					ImGui::Text(chunkNames_[i].c_str());
 				}
 			}
@@ -263,7 +264,7 @@ void ChunkEditorTool::SetChunkValues(chunk::Chunk chunk)
 		if (ImGui::BeginPopup("remove chunk to hide")) {
 			for (auto i = 0; i < chunkManager_.GetChunkNb(); i++) {
 
-				if (chunkArray_[selectedIndex_].GetChunksToHide()[i]) {
+				if (chunkArray_[selectedIndex_].GetChunksToHide().Contains(i)) {
 					if (ImGui::MenuItem(chunkNames_[i].c_str())) {
 						chunkArray_[selectedIndex_].RemoveChunkToHide(i);
 					}
@@ -274,7 +275,7 @@ void ChunkEditorTool::SetChunkValues(chunk::Chunk chunk)
 
 		if (ImGui::BeginMenu("Chunk to hide")) {
 			for (int i = 0; i < chunkManager_.GetChunkNb(); i++) {
-				if (chunkArray_[selectedIndex_].GetChunksToHide()[i]) {
+				if (chunkArray_[selectedIndex_].GetChunksToHide().Contains(i)) {
 					ImGui::Text(chunkNames_[i].c_str());
 				}
 			}
@@ -302,7 +303,7 @@ void ChunkEditorTool::SetChunkValues(chunk::Chunk chunk)
 		if (ImGui::BeginPopup("remove chunk to show")) {
 			for (auto i = 0; i < chunkManager_.GetChunkNb(); i++) {
 
-				if (chunkArray_[selectedIndex_].GetChunksToShow()[i]) {
+				if (chunkArray_[selectedIndex_].GetChunksToShow().Contains(i)) {
 					if (ImGui::MenuItem(chunkNames_[i].c_str())) {
 						chunkArray_[selectedIndex_].RemoveChunkToShow(i);
 					}
@@ -312,7 +313,7 @@ void ChunkEditorTool::SetChunkValues(chunk::Chunk chunk)
 		}
 		if (ImGui::BeginMenu("Chunk to show")) {
 			for (int i = 0; i < chunkManager_.GetChunkNb(); i++) {
-				if (chunkArray_[selectedIndex_].GetChunksToShow()[i]) {
+				if (chunkArray_[selectedIndex_].GetChunksToShow().Contains(i)) {
 					ImGui::Text(chunkNames_[i].c_str());
 				}
 			}
@@ -359,8 +360,8 @@ void ChunkEditorTool::SetChunkValues(chunk::Chunk chunk)
 		if (ImGui::Button("Reset")) {
 			debugVisibleChunkIndexes_.erase(it);
 
-			if (chunkManager_.GetChunkStatus(selectedIndex_) == chunk::ChunkStatus::HIDDEN ||
-				chunkManager_.GetChunkStatus(selectedIndex_) == chunk::ChunkStatus::DESTROYED) {
+			if (chunkManager_.GetChunkStatus({ static_cast<chunk::ChunkIndex>(selectedIndex_) }) == chunk::ChunkStatus::HIDDEN ||
+				chunkManager_.GetChunkStatus({ static_cast<chunk::ChunkIndex>(selectedIndex_) }) == chunk::ChunkStatus::DESTROYED) {
 				chunkManager_.DebugHideChunk(selectedIndex_);
 			}
 			else {
@@ -381,8 +382,8 @@ void ChunkEditorTool::SetChunkValues(chunk::Chunk chunk)
 			if (ImGui::Button("Reset")) {
 				debugHiddenChunkIndexes_.erase(it);
 
-                if(chunkManager_.GetChunkStatus(selectedIndex_) == chunk::ChunkStatus::HIDDEN ||
-				   chunkManager_.GetChunkStatus(selectedIndex_) == chunk::ChunkStatus::DESTROYED) {
+                if(chunkManager_.GetChunkStatus({ static_cast<chunk::ChunkIndex>(selectedIndex_) }) == chunk::ChunkStatus::HIDDEN ||
+				   chunkManager_.GetChunkStatus({ static_cast<chunk::ChunkIndex>(selectedIndex_) }) == chunk::ChunkStatus::DESTROYED) {
 					chunkManager_.DebugHideChunk(selectedIndex_);
                 }else {
 					chunkManager_.DebugDisplayChunk(selectedIndex_);
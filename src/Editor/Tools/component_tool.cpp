@@ -407,8 +407,7 @@ void ComponentTool::DisplayComponent(
 			ComponentUtility::DisplayRemoveComponentButton(componentType);
 
 			if (newModel != model) {
-				modelsManager_.SetComponent(entityIndex, newModel);
-				editorEcsManager_.UpdateComponent(entityIndex, ecs::ComponentType::MODEL);
+				modelsManager_.GetComponentsView().Update(entityIndex) = newModel;
 			}
 			break;
 		}
@@ -442,7 +441,7 @@ void ComponentTool::DisplayComponent(
 			ComponentUtility::DisplayRemoveComponentButton(componentType);
 
 			if (newParticle != particle) {
-				particleSystemsManager_.SetComponent(entityIndex, newParticle);
+				particleSystemsManager_.GetComponentsView().Update(entityIndex) = newParticle;
 			}
 			break;
 		}
@@ -89,7 +89,7 @@ void GizmoDisplayTool::OnDrawImgui() {
 			}
 		}
 
-		const uint8_t nbChunks = ChunksManagerLocator::Get().GetChunkNb();
+		const chunk::ChunkIndex nbChunks = ChunksManagerLocator::Get().GetChunkNb();
         if(nbChunks) {
 	        ImGui::Text("Chunks to display : ");
 		    std::vector<int> newNbChunks;
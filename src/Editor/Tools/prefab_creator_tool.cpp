@@ -572,8 +572,8 @@ void PrefabCreatorTool::SavePrefab(
 				switch (componentType) {
 				case ecs::ComponentType::TRANSFORM: {
 					gameArchetypes[i].AddComponent(ecs::ComponentType::TRANSFORM);
-					gameArchetypes[i].transform = transformsManager_.
-						GetComponent(prefabEntities_[i]);
+					gameArchetypes[i].SetComponent(ecs::ComponentType::TRANSFORM, transformsManager_.
+						GetComponent(prefabEntities_[i]));
 
 					size_t parentIndex;
 
@@ -593,111 +593,111 @@ void PrefabCreatorTool::SavePrefab(
 													break;
 				case ecs::ComponentType::RIGIDBODY: {
 					gameArchetypes[i].AddComponent(ecs::ComponentType::RIGIDBODY);
-					gameArchetypes[i].rigidbody = rigidbodyManager_.
-						GetComponent(prefabEntities_[i]);
+					gameArchetypes[i].SetComponent(ecs::ComponentType::RIGIDBODY, rigidbodyManager_.
+						GetComponent(prefabEntities_[i]));
 				}
 													break;
 				case ecs::ComponentType::COLLIDER: {
 					gameArchetypes[i].AddComponent(ecs::ComponentType::COLLIDER);
-					gameArchetypes[i].collider = collidersManager_.
-						GetComponent(prefabEntities_[i]);
+					gameArchetypes[i].SetComponent(ecs::ComponentType::COLLIDER, collidersManager_.
+						GetComponent(prefabEntities_[i]));
 				}
 												   break;
 				case ecs::ComponentType::MODEL: {
 					gameArchetypes[i].AddComponent(ecs::ComponentType::MODEL);
-					gameArchetypes[i].model = modelsManager_.
-						GetComponent(prefabEntities_[i]);
+					gameArchetypes[i].SetComponent(ecs::ComponentType::MODEL, modelsManager_.
+						GetComponent(prefabEntities_[i]));
 				}
 												break;
 				case ecs::ComponentType::SPLINE_FOLLOWER: {
 					gameArchetypes[i].AddComponent(ecs::ComponentType::SPLINE_FOLLOWER);
-					gameArchetypes[i].spline = splineFollowersManager_.
-						GetComponent(prefabEntities_[i]);
+					gameArchetypes[i].SetComponent(ecs::ComponentType::SPLINE_FOLLOWER, splineFollowersManager_.
+						GetComponent(prefabEntities_[i]));
 				}
 														  break;
 				case ecs::ComponentType::LIGHT: {
 					gameArchetypes[i].AddComponent(ecs::ComponentType::LIGHT);
-					gameArchetypes[i].light = lightManager_.GetComponent(prefabEntities_[i]);
+					gameArchetypes[i].SetComponent(ecs::ComponentType::LIGHT, lightManager_.GetComponent(prefabEntities_[i]));
 				}
 												break;
 				case ecs::ComponentType::PARTICLE_SYSTEM: {
 					gameArchetypes[i].AddComponent(ecs::ComponentType::PARTICLE_SYSTEM);
-					gameArchetypes[i].particleSystem = particlesManager_.
-						GetComponent(prefabEntities_[i]);
+					gameArchetypes[i].SetComponent(ecs::ComponentType::PARTICLE_SYSTEM, particlesManager_.
+						GetComponent(prefabEntities_[i]));
 				}
 														  break;
 				case ecs::ComponentType::AUDIO_SOURCE: {
 					gameArchetypes[i].AddComponent(ecs::ComponentType::AUDIO_SOURCE);
-					gameArchetypes[i].audioSource = audioSourceManager_.
-						GetComponent(prefabEntities_[i]);
+					gameArchetypes[i].SetComponent(ecs::ComponentType::AUDIO_SOURCE, audioSourceManager_.
+						GetComponent(prefabEntities_[i]));
 				}
 													   break;
 				case ecs::ComponentType::TRAIL_RENDERER: {
 					gameArchetypes[i].AddComponent(ecs::ComponentType::TRAIL_RENDERER);
-					gameArchetypes[i].trailRenderer = trailRendererManager_.
-						GetComponent(prefabEntities_[i]);
+					gameArchetypes[i].SetComponent(ecs::ComponentType::TRAIL_RENDERER, trailRendererManager_.
+						GetComponent(prefabEntities_[i]));
 				}
 														 break;
 				case ecs::ComponentType::SEGMENT_RENDERER: {
 
 					gameArchetypes[i].AddComponent(ecs::ComponentType::SEGMENT_RENDERER);
-					gameArchetypes[i].segmentRenderer = segmentRendererManager_.
-						GetComponent(prefabEntities_[i]);
+					gameArchetypes[i].SetComponent(ecs::ComponentType::SEGMENT_RENDERER, segmentRendererManager_.
+						GetComponent(prefabEntities_[i]));
 				}
 				break;
 
 				case ecs::ComponentType::ENEMY: {
 					gameArchetypes[i].AddComponent(ecs::ComponentType::ENEMY);
-					gameArchetypes[i].enemy = enemiesManager_.
-						GetComponent(prefabEntities_[i]);
+					gameArchetypes[i].SetComponent(ecs::ComponentType::ENEMY, enemiesManager_.
+						GetComponent(prefabEntities_[i]));
 				}
 												break;
 				case ecs::ComponentType::PLAYER: {
 					gameArchetypes[i].AddComponent(ecs::ComponentType::PLAYER);
-					gameArchetypes[i].player = playerManager_.
-						GetComponent(prefabEntities_[i]);
+					gameArchetypes[i].SetComponent(ecs::ComponentType::PLAYER, playerManager_.
+						GetComponent(prefabEntities_[i]));
 				}
 												 break;
 				case ecs::ComponentType::DESTRUCTIBLE_ELEMENT: {
 					gameArchetypes[i].AddComponent(ecs::ComponentType::DESTRUCTIBLE_ELEMENT);
-					gameArchetypes[i].destructibleElement = destructibleElementManager_.
-						GetComponent(prefabEntities_[i]);
+					gameArchetypes[i].SetComponent(ecs::ComponentType::DESTRUCTIBLE_ELEMENT, destructibleElementManager_.
+						GetComponent(prefabEntities_[i]));
 				}
 															   break;
 				case ecs::ComponentType::WEAPON: {
 					gameArchetypes[i].AddComponent(ecs::ComponentType::WEAPON);
-					gameArchetypes[i].weapon = weaponManager_.
-						GetComponent(prefabEntities_[i]);
+					gameArchetypes[i].SetComponent(ecs::ComponentType::WEAPON, weaponManager_.
+						GetComponent(prefabEntities_[i]));
 				}
 												 break;
 				case ecs::ComponentType::PROJECTILE: {
 					gameArchetypes[i].AddComponent(ecs::ComponentType::PROJECTILE);
-					gameArchetypes[i].projectile = projectileManager_.
-						GetComponent(prefabEntities_[i]);
+					gameArchetypes[i].SetComponent(ecs::ComponentType::PROJECTILE, projectileManager_.
+						GetComponent(prefabEntities_[i]));
 				}
 													 break;
 				case ecs::ComponentType::MISSILE: {
 					gameArchetypes[i].AddComponent(ecs::ComponentType::MISSILE);
-					gameArchetypes[i].missile = missileManager_.
-						GetComponent(prefabEntities_[i]);
+					gameArchetypes[i].SetComponent(ecs::ComponentType::MISSILE, missileManager_.
+						GetComponent(prefabEntities_[i]));
 				}
 												  break;
 				case ecs::ComponentType::SPECIAL_ATTACK: {
 					gameArchetypes[i].AddComponent(ecs::ComponentType::SPECIAL_ATTACK);
-					gameArchetypes[i].specialAttack = specialAttackManager_.
-						GetComponent(prefabEntities_[i]);
+					gameArchetypes[i].SetComponent(ecs::ComponentType::SPECIAL_ATTACK, specialAttackManager_.
+						GetComponent(prefabEntities_[i]));
 				}
 														 break;
 				case ecs::ComponentType::JIGGLE: {
 					gameArchetypes[i].AddComponent(ecs::ComponentType::JIGGLE);
-					gameArchetypes[i].jiggle = jiggleManager_.
-						GetComponent(prefabEntities_[i]);
+					gameArchetypes[i].SetComponent(ecs::ComponentType::JIGGLE, jiggleManager_.
+						GetComponent(prefabEntities_[i]));
 				}
 												 break;
 				case ecs::ComponentType::GAME_CAMERA: {
 					gameArchetypes[i].AddComponent(ecs::ComponentType::GAME_CAMERA);
-					gameArchetypes[i].gameCamera = gameCameraManager_.
-						GetComponent(prefabEntities_[i]);
+					gameArchetypes[i].SetComponent(ecs::ComponentType::GAME_CAMERA, gameCameraManager_.
+						GetComponent(prefabEntities_[i]));
 				}
 													  break;
 													  break;
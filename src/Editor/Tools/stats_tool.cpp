@@ -5,6 +5,9 @@
 #include <imgui.h>
 
 #include <Utility/time_custom.h>
+#include <Memory/frame_arena.h>
+#include <CoreEngine/ServiceLocator/service_locator_definition.h>
+#include <GraphicsEngine/Models/model_command_buffer.h>
 
 
 namespace poke::editor{
@@ -27,6 +30,21 @@ void StatsTool::OnDrawImgui()
 		"%s fps", 
 		std::to_string(1.0f / Time::Get().deltaTime.count() * 1000.0f).c_str()
 	);
+	ImGui::Text(
+		"Frame arena peak %s KB",
+		std::to_string(FrameArena::GetLastFramePeakSize() / 1024).c_str()
+	);
+
+	const auto& drawStats = GraphicsEngineLocator::Get().GetModelCommandBuffer().GetDrawStats();
+	ImGui::Text(
+		"Instances %s",
+		std::to_string(drawStats.instanceCount).c_str()
+	);
+	ImGui::Text(
+		"Triangles %s (%s at full detail)",
+		std::to_string(drawStats.triangleCount).c_str(),
+		std::to_string(drawStats.fullDetailTriangleCount).c_str()
+	);
 
     ImGui::End();
 }
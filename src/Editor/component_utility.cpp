@@ -375,11 +375,14 @@ const graphics::Model ComponentUtility::DisplayAndModifyModel(
 
         if(ImGui::Button("Change Material")) {
 			const std::string path = PokFileSystem::GetPath(FileType::MATERIAL, FolderType::ROM);
-			comboBoxElements_ = PokFileSystem::GetAllFilesInDirectories(path, true, true);
+			comboBoxElements_.clear();
+
+			//Only the .obj, the folder also contains the cooked meshes
+			for (const std::string& element : PokFileSystem::GetAllFilesInDirectories(path, true, true)) {
+				if (element.size() < 4 || element.substr(element.size() - 4, 4) != ".obj") { continue; }
 
-			for (std::string& element : comboBoxElements_) {
 				size_t nameSize = element.size() - path.size();
-				element = element.substr(path.size(), nameSize);
+				comboBoxElements_.push_back(element.substr(path.size(), nameSize));
 			}
 
 			std::string extension = PokFileSystem::GetExtension(FileType::MATERIAL);
@@ -480,11 +483,14 @@ const graphics::Model ComponentUtility::DisplayAndModifyModel(
 		if (ImGui::Button("Select mesh")) {
 			//Add all meshes from folder
 			std::string path = PokFileSystem::GetPath(FileType::MESH, FolderType::ROM);
-			comboBoxElements_ = PokFileSystem::GetAllFilesInDirectories(path, true, true);
+			comboBoxElements_.clear();
+
+			//Only the .obj, the folder also contains the cooked meshes
+			for (const std::string& element : PokFileSystem::GetAllFilesInDirectories(path, true, true)) {
+				if (element.size() < 4 || element.substr(element.size() - 4, 4) != ".obj") { continue; }
 
-			for (std::string& element : comboBoxElements_) {
 				size_t nameSize = element.size() - path.size();
-				element = element.substr(path.size(), nameSize);
+				comboBoxElements_.push_back(element.substr(path.size(), nameSize));
 			}
 
 			ImGui::OpenPopup("Select_mesh");
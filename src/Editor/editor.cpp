@@ -25,6 +25,8 @@
 #include <CoreEngine/ServiceLocator/service_locator_definition.h>
 #include <Utility/profiler.h>
 #include <Utility/time_custom.h>
+#include <Memory/frame_arena.h>
+#include <Scenes/binary_scene.h>
 
 namespace poke {
 namespace editor {
@@ -34,6 +36,7 @@ Editor::Editor(Engine& engine, const std::string& fileName)
       inputManager_(engine.GetModuleManager().inputManager),
       sceneManager_(engine.GetModuleManager().sceneManager),
       scenes_(engine.GetModuleManager().sceneManager.GetScenes()),
+      resourcesManagerContainer_(engine.GetModuleManager().resourcesManagerContainer.resourceLoader),
       game_(engine, ""),
       editorEcsManager_(engine, game_, engine.GetEngineSettings().GetDefaultPoolSize()),
       gameCameraCopy_(engine)
@@ -309,6 +312,9 @@ void Editor::OnEndOfFrame()
         *game_.GetCameraPtr() = gameCameraCopy_;
         CameraLocator::Assign(&camera_);
     }
+
+    //Every thread finished the frame, the resources can be swapped
+    resourcesManagerContainer_.hotReloader.Update();
 }
 
 void Editor::LoadApp()
@@ -325,8 +331,10 @@ void Editor::Run()
     state_ = AppState::RUNNING;
 
     while (state_ != AppState::STOP) {
-        if (state_ == AppState::PAUSE)
+        if (state_ == AppState::PAUSE) {
+            engine_.GetFrameLimiter().Idle();
             continue;
+        }
 
         const bool gameIsPause = game_.GetState() != AppState::RUNNING;
 
@@ -504,8 +512,10 @@ void Editor::Run()
         if (!gameIsPause) { game_.NotifyEndFrame(); }
         pok_EndProfiling(End_Frame);
 
-        //There is more constancy doing this than doing a Sleep().
-        while (Time::Get().GetFrameElapsedTime() < 16.65f) {}
+        //Transient data of the frame are not used anymore
+        FrameArena::ResetAll();
+
+        engine_.GetFrameLimiter().WaitEndOfFrame();
 
         Time::Get().EndFrame();
 
@@ -803,11 +813,16 @@ void Editor::OnDrawImGui()
 							newSceneName_,
 							newSceneName_);
 
+						const json sceneJson = sceneManager_.GetActiveScene().ToJson();
 						PokFileSystem::WriteFile(
 							newSceneName_,
-							sceneManager_.GetActiveScene().ToJson(),
+							sceneJson,
 							FileType::SCENE,
 							FolderType::SAVE_IN_ROM);
+						scene::ExportBinaryScene(
+							sceneJson,
+							newSceneName_,
+							FolderType::SAVE_IN_ROM);
 
 						sceneManager_.AddScene(newScene);
 						sceneManager_.LoadScene(newScene.GetSceneIndex());
@@ -26,7 +26,7 @@ const void GizmoUtility::DisplayAabbGizmo(
 const void GizmoUtility::DisplayAllChunksGizmo() {
 
 	std::vector<chunk::ChunkIndex> chunkIndexes = ChunkEditorTool::GetChunksToDisplay();
-	const uint8_t nbChunks = ChunksManagerLocator::Get().GetChunkNb();
+	const chunk::ChunkIndex nbChunks = ChunksManagerLocator::Get().GetChunkNb();
 
 	if (chunkIndexes.size() <= 0) {
 		for (int i = 0; i < nbChunks; i++) {
@@ -41,9 +41,9 @@ const void GizmoUtility::DisplayAllChunksGizmo() {
 	}
 }
 
-const void poke::editor::GizmoUtility::DisplayChunkGizmo(uint8_t chunkIndex) {
+const void poke::editor::GizmoUtility::DisplayChunkGizmo(chunk::ChunkIndex chunkIndex) {
 
-    const uint8_t nbChunks = ChunksManagerLocator::Get().GetChunkNb();
+    const chunk::ChunkIndex nbChunks = ChunksManagerLocator::Get().GetChunkNb();
 	if (gizmoFlags_ & GIZMO_FLAG_CHUNK &&
 		chunkIndex < nbChunks) 
 	{
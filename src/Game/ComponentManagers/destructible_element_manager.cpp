@@ -16,10 +16,10 @@ DestructibleElement DestructibleElementManager::GetComponent(const ecs::EntityIn
 
 void DestructibleElementManager::SetWithArchetype(const ecs::EntityPool entityPool,
 												  const ecs::Archetype& archetype) {
-	const GameArchetype& gameArchetype = *static_cast<const GameArchetype*>(&archetype);
+	const DestructibleElement& destructibleElement = archetype.GetComponent<DestructibleElement>(ecs::ComponentType::DESTRUCTIBLE_ELEMENT);
 
 	for (ecs::EntityIndex entityIndex = entityPool.firstEntity; entityIndex < entityPool.lastEntity; entityIndex++) {
-		destructibleElements_[entityIndex] = gameArchetype.destructibleElement;
+		destructibleElements_[entityIndex] = destructibleElement;
 	}
 }
 
@@ -53,7 +53,7 @@ void DestructibleElementManager::InsertArchetype(
     const ecs::EntityIndex entity,
     const ecs::Archetype& archetype)
 {
-	const GameArchetype& gameArchetype = static_cast<const GameArchetype&>(archetype);
-	destructibleElements_.insert(destructibleElements_.begin() + entity, gameArchetype.destructibleElement);
+	const DestructibleElement& destructibleElement = archetype.GetComponent<DestructibleElement>(ecs::ComponentType::DESTRUCTIBLE_ELEMENT);
+	destructibleElements_.insert(destructibleElements_.begin() + entity, destructibleElement);
 }
 }// namespace poke::game
@@ -12,14 +12,14 @@ void EnemiesManager::ClearEntity(const ecs::EntityIndex entityIndex) {
 }
 
 void EnemiesManager::SetWithArchetype(const ecs::EntityPool entityPool, const ecs::Archetype& archetype) {
-	const GameArchetype& gameArchetype = *static_cast<const GameArchetype*>(&archetype);
+	const Enemy& enemy = archetype.GetComponent<Enemy>(ecs::ComponentType::ENEMY);
 
 	for (ecs::EntityIndex entityIndex = entityPool.firstEntity; entityIndex < entityPool.lastEntity; entityIndex++) {
-		enemies_[entityIndex] = gameArchetype.enemy;
+		enemies_[entityIndex] = enemy;
 	}
 }
 
-Enemy EnemiesManager::GetComponent(const ecs::EntityIndex entityIndex) {
+const Enemy& EnemiesManager::GetComponent(const ecs::EntityIndex entityIndex) const {
 	return enemies_[entityIndex];
 }
 void EnemiesManager::SetComponent(const ecs::EntityIndex entityIndex, Enemy enemy) {
@@ -36,8 +36,8 @@ void EnemiesManager::InsertArchetype(
 	ecs::EntityIndex entity,
 	const ecs::Archetype& archetype)
 {
-	const GameArchetype& gameArchetype = static_cast<const GameArchetype&>(archetype);
-	enemies_.insert(enemies_.begin() + entity, gameArchetype.enemy);
+	const Enemy& enemy = archetype.GetComponent<Enemy>(ecs::ComponentType::ENEMY);
+	enemies_.insert(enemies_.begin() + entity, enemy);
 }
 
 json EnemiesManager::GetJsonFromComponent(ecs::EntityIndex entityIndex) {
@@ -15,10 +15,10 @@ GameCamera GameCameraManager::GetComponent(const ecs::EntityIndex entityIndex) {
 }
 
 void GameCameraManager::SetWithArchetype(const ecs::EntityPool entityPool, const ecs::Archetype& archetype) {
-	const GameArchetype& gameArchetype = *static_cast<const GameArchetype*>(&archetype);
+	const GameCamera& gameCamera = archetype.GetComponent<GameCamera>(ecs::ComponentType::GAME_CAMERA);
 
 	for (ecs::EntityIndex entityIndex = entityPool.firstEntity; entityIndex < entityPool.lastEntity; entityIndex++) {
-		gameCameras_[entityIndex] = gameArchetype.gameCamera;
+		gameCameras_[entityIndex] = gameCamera;
 	}
 }
 	
@@ -48,7 +48,7 @@ void GameCameraManager::EraseEntities(
 void GameCameraManager::InsertArchetype(
 	const ecs::EntityIndex entity,
 	const ecs::Archetype& archetype) {
-	const GameArchetype& gameArchetype = static_cast<const GameArchetype&>(archetype);
-	gameCameras_.insert(gameCameras_.begin() + entity, gameArchetype.gameCamera);
+	const GameCamera& gameCamera = archetype.GetComponent<GameCamera>(ecs::ComponentType::GAME_CAMERA);
+	gameCameras_.insert(gameCameras_.begin() + entity, gameCamera);
 }
 }
@@ -16,11 +16,10 @@ void JiggleManager::ClearEntity(const ecs::EntityIndex entityIndex) {
 void JiggleManager::SetWithArchetype(
     const ecs::EntityPool entityPool,
     const ecs::Archetype& archetype) {
-    const GameArchetype& gameArchetype = 
-		*static_cast<const GameArchetype*>(&archetype);
+    const Jiggle& jiggle = archetype.GetComponent<Jiggle>(ecs::ComponentType::JIGGLE);
     for (ecs::EntityIndex entityIndex = entityPool.firstEntity;
          entityIndex < entityPool.lastEntity; entityIndex++) {
-        jiggles_[entityIndex] = gameArchetype.jiggle;
+        jiggles_[entityIndex] = jiggle;
     }
 }
 
@@ -31,9 +30,9 @@ void JiggleManager::EraseEntities(const ecs::EntityPool pool, const size_t nbObj
 }
 
 void JiggleManager::InsertArchetype(const ecs::EntityIndex entity, const ecs::Archetype& archetype) {
-	const GameArchetype& gameArchetype = static_cast<const GameArchetype&>(archetype);
+	const Jiggle& jiggle = archetype.GetComponent<Jiggle>(ecs::ComponentType::JIGGLE);
 
-	jiggles_.insert(jiggles_.begin() + entity, gameArchetype.jiggle);
+	jiggles_.insert(jiggles_.begin() + entity, jiggle);
 }
 
 void JiggleManager::SetComponentFromJson(const ecs::EntityIndex entityIndex, const json& componentJson) {
@@ -22,10 +22,10 @@ void MissilesManager::SetComponent(ecs::EntityIndex entityIndex, Missile missile
 
 
 void MissilesManager::SetWithArchetype(const ecs::EntityPool entityPool, const ecs::Archetype& archetype) {
-	const GameArchetype& gameArchetype = *static_cast<const GameArchetype*>(&archetype);
+	const Missile& missile = archetype.GetComponent<Missile>(ecs::ComponentType::MISSILE);
 
 	for (ecs::EntityIndex entityIndex = entityPool.firstEntity; entityIndex < entityPool.lastEntity; entityIndex++) {
-		missiles_[entityIndex] = gameArchetype.missile;
+		missiles_[entityIndex] = missile;
 	}
 }
 
@@ -38,9 +38,9 @@ void MissilesManager::EraseEntities(
 void MissilesManager::InsertArchetype(
     ecs::EntityIndex entity,
     const ecs::Archetype& archetype) {
-	const GameArchetype& gameArchetype = static_cast<const GameArchetype&>(archetype);
+	const Missile& missile = archetype.GetComponent<Missile>(ecs::ComponentType::MISSILE);
 
-	missiles_.insert(missiles_.begin() + entity, gameArchetype.missile);
+	missiles_.insert(missiles_.begin() + entity, missile);
 }
 
 void MissilesManager::SetComponentFromJson(
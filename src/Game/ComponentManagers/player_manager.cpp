@@ -16,10 +16,10 @@ Player PlayerManager::GetComponent(const ecs::EntityIndex entityIndex) {
 }
 
 void PlayerManager::SetWithArchetype(const ecs::EntityPool entityPool, const ecs::Archetype& archetype) {
-	const GameArchetype& gameArchetype = *static_cast<const GameArchetype*>(&archetype);
+	const Player& player = archetype.GetComponent<Player>(ecs::ComponentType::PLAYER);
 
 	for (ecs::EntityIndex entityIndex = entityPool.firstEntity; entityIndex < entityPool.lastEntity; entityIndex++) {
-		players_[entityIndex] = gameArchetype.player;
+		players_[entityIndex] = player;
 	}
 }
 
@@ -51,8 +51,8 @@ void PlayerManager::InsertArchetype(
     const ecs::EntityIndex entity,
     const ecs::Archetype& archetype)
 {
-	const GameArchetype& gameArchetype = static_cast<const GameArchetype&>(archetype);
+	const Player& player = archetype.GetComponent<Player>(ecs::ComponentType::PLAYER);
 
-	players_.insert(players_.begin() + entity, gameArchetype.player);
+	players_.insert(players_.begin() + entity, player);
 }
 }// namespace poke::game
\ No newline at end of file
@@ -16,10 +16,10 @@ Projectile ProjectileManager::GetComponent(const ecs::EntityIndex entityIndex) {
 
 void ProjectileManager::SetWithArchetype(const ecs::EntityPool entityPool,
 										 const ecs::Archetype& archetype) {
-	const GameArchetype& gameArchetype = *static_cast<const GameArchetype*>(&archetype);
+	const Projectile& projectile = archetype.GetComponent<Projectile>(ecs::ComponentType::PROJECTILE);
 
 	for (ecs::EntityIndex entityIndex = entityPool.firstEntity; entityIndex < entityPool.lastEntity; entityIndex++) {
-		projectiles_[entityIndex] = gameArchetype.projectile;
+		projectiles_[entityIndex] = projectile;
 	}
 }
 
@@ -52,7 +52,7 @@ void ProjectileManager::InsertArchetype(
     const ecs::EntityIndex entity,
     const ecs::Archetype& archetype)
 {
-	const GameArchetype& gameArchetype = static_cast<const GameArchetype&>(archetype);
-	projectiles_.insert(projectiles_.begin() + entity, gameArchetype.projectile);
+	const Projectile& projectile = archetype.GetComponent<Projectile>(ecs::ComponentType::PROJECTILE);
+	projectiles_.insert(projectiles_.begin() + entity, projectile);
 }
 }// namespace poke::game
@@ -15,11 +15,11 @@ SpecialAttack& SpecialAttackManager::GetComponent(const ecs::EntityIndex entityI
 }
 
 void SpecialAttackManager::SetWithArchetype(const ecs::EntityPool entityPool, const ecs::Archetype& archetype) {
-	const GameArchetype& gameArchetype = *static_cast<const GameArchetype*>(&archetype);
+	const SpecialAttack& specialAttack = archetype.GetComponent<SpecialAttack>(ecs::ComponentType::SPECIAL_ATTACK);
 
 	for (ecs::EntityIndex entityIndex = entityPool.firstEntity; entityIndex < entityPool.lastEntity; entityIndex++) {
-		specialAttacks_[entityIndex].expansionSpeed = gameArchetype.specialAttack.expansionSpeed;
-		specialAttacks_[entityIndex].maxRadius = gameArchetype.specialAttack.maxRadius;
+		specialAttacks_[entityIndex].expansionSpeed = specialAttack.expansionSpeed;
+		specialAttacks_[entityIndex].maxRadius = specialAttack.maxRadius;
 	}
 }
 
@@ -52,7 +52,7 @@ void SpecialAttackManager::InsertArchetype(
     const ecs::EntityIndex entity,
     const ecs::Archetype& archetype)
 {
-	const auto& gameArchetype = static_cast<const GameArchetype&>(archetype);
-	specialAttacks_.insert(specialAttacks_.begin() + entity, gameArchetype.specialAttack);
+	const SpecialAttack& specialAttack = archetype.GetComponent<SpecialAttack>(ecs::ComponentType::SPECIAL_ATTACK);
+	specialAttacks_.insert(specialAttacks_.begin() + entity, specialAttack);
 }
 }
@@ -14,10 +14,10 @@ void SplineStateManager::ClearEntity(const ecs::EntityIndex entityIndex) {
 }
 
 void SplineStateManager::SetWithArchetype(ecs::EntityPool entityPool, const ecs::Archetype& archetype) {
-	const GameArchetype& gameArchetype = *static_cast<const GameArchetype*>(&archetype);
+	const SplineStates& splineStates = archetype.GetComponent<SplineStates>(ecs::ComponentType::SPLINE_STATES);
 
 	for (ecs::EntityIndex entityIndex = entityPool.firstEntity; entityIndex < entityPool.lastEntity; entityIndex++) {
-		splineStates_[entityIndex] = gameArchetype.splineStates;
+		splineStates_[entityIndex] = splineStates;
 	}
 }
 
@@ -28,9 +28,9 @@ void SplineStateManager::EraseEntities(ecs::EntityPool pool, size_t nbObjectToEr
 }
 
 void SplineStateManager::InsertArchetype(const ecs::EntityIndex entity, const ecs::Archetype& archetype) {
-	const GameArchetype& gameArchetype = static_cast<const GameArchetype&>(archetype);
+	const SplineStates& splineStates = archetype.GetComponent<SplineStates>(ecs::ComponentType::SPLINE_STATES);
 
-	splineStates_.insert(splineStates_.begin() + entity, gameArchetype.splineStates);
+	splineStates_.insert(splineStates_.begin() + entity, splineStates);
 }
 
 void SplineStateManager::SetComponentFromJson(const ecs::EntityIndex entityIndex, const json& componentJson) {
@@ -40,7 +40,7 @@ json SplineStateManager::GetJsonFromComponent(const ecs::EntityIndex entityIndex
 	return splineStates_[entityIndex].ToJson();
 }
 
-SplineStates SplineStateManager::GetComponent(const ecs::EntityIndex entityIndex) {
+const SplineStates& SplineStateManager::GetComponent(const ecs::EntityIndex entityIndex) const {
 	return splineStates_[entityIndex];
 }
 
@@ -10,15 +10,15 @@ void WeaponManager::ClearEntity(const ecs::EntityIndex entityIndex) {
 	weapons_[entityIndex] = Weapon();
 }
 
-Weapon WeaponManager::GetComponent(const ecs::EntityIndex entityIndex) {
+const Weapon& WeaponManager::GetComponent(const ecs::EntityIndex entityIndex) const {
 	return weapons_[entityIndex];
 }
 
 void WeaponManager::SetWithArchetype(const ecs::EntityPool entityPool, const ecs::Archetype& archetype) {
-	const GameArchetype& gameArchetype = *static_cast<const GameArchetype*>(&archetype);
+	const Weapon& weapon = archetype.GetComponent<Weapon>(ecs::ComponentType::WEAPON);
 
 	for (ecs::EntityIndex entityIndex = entityPool.firstEntity; entityIndex < entityPool.lastEntity; entityIndex++) {
-		weapons_[entityIndex] = gameArchetype.weapon;
+		weapons_[entityIndex] = weapon;
 	}
 }
 
@@ -50,7 +50,7 @@ void WeaponManager::InsertArchetype(
     const ecs::EntityIndex entity,
     const ecs::Archetype& archetype)
 {
-	const GameArchetype& gameArchetype = static_cast<const GameArchetype&>(archetype);
-	weapons_.insert(weapons_.begin() + entity, gameArchetype.weapon);
+	const Weapon& weapon = archetype.GetComponent<Weapon>(ecs::ComponentType::WEAPON);
+	weapons_.insert(weapons_.begin() + entity, weapon);
 }
 }
@@ -10,62 +10,52 @@ void GameArchetype::SetFromJson(const json& archetypeJson)
 
     //Player
 	if (CheckJsonExists(archetypeJson, "player")) {
-		AddComponent(ecs::ComponentType::PLAYER);
-		player.SetFromJson(archetypeJson["player"]);
+		EmplaceComponent<Player>(ecs::ComponentType::PLAYER).SetFromJson(archetypeJson["player"]);
 	}
 
     //Destructible Element
 	if (CheckJsonExists(archetypeJson, "destructibleElement")) {
-		AddComponent(ecs::ComponentType::DESTRUCTIBLE_ELEMENT);
-		destructibleElement.SetFromJson(archetypeJson["destructibleElement"]);
+		EmplaceComponent<DestructibleElement>(ecs::ComponentType::DESTRUCTIBLE_ELEMENT).SetFromJson(archetypeJson["destructibleElement"]);
 	}
 
     //enemy
 	if (CheckJsonExists(archetypeJson, "enemy")) {
-		AddComponent(ecs::ComponentType::ENEMY);
-		enemy.SetFromJson(archetypeJson["enemy"]);
+		EmplaceComponent<Enemy>(ecs::ComponentType::ENEMY).SetFromJson(archetypeJson["enemy"]);
 	}
 
     //Missile
 	if (CheckJsonExists(archetypeJson, "missile")) {
-		missile.SetFromJson(archetypeJson["missile"]);
-		AddComponent(ecs::ComponentType::MISSILE);
+		EmplaceComponent<Missile>(ecs::ComponentType::MISSILE).SetFromJson(archetypeJson["missile"]);
 	}
 
     //Projectile
 	if (CheckJsonExists(archetypeJson, "projectile")) {
-		projectile.SetFromJson(archetypeJson["projectile"]);
-		AddComponent(ecs::ComponentType::PROJECTILE);
+		EmplaceComponent<Projectile>(ecs::ComponentType::PROJECTILE).SetFromJson(archetypeJson["projectile"]);
 	}
 
 	//Weapon
 	if (CheckJsonExists(archetypeJson, "weapon")) {
-		weapon.SetFromJson(archetypeJson["weapon"]);
-		AddComponent(ecs::ComponentType::WEAPON);
+		EmplaceComponent<Weapon>(ecs::ComponentType::WEAPON).SetFromJson(archetypeJson["weapon"]);
 	}
 
 	//Spline States
 	if (CheckJsonExists(archetypeJson, "splineStates")) {
-		splineStates.SetFromJson(archetypeJson["splineStates"]);
-		AddComponent(ecs::ComponentType::SPLINE_STATES);
+		EmplaceComponent<SplineStates>(ecs::ComponentType::SPLINE_STATES).SetFromJson(archetypeJson["splineStates"]);
 	}
 
 	//specialAttackIndex
 	if (CheckJsonExists(archetypeJson, "specialAttack")) {
-		specialAttack.SetFromJson(archetypeJson["specialAttack"]);
-		AddComponent(ecs::ComponentType::SPECIAL_ATTACK);
+		EmplaceComponent<SpecialAttack>(ecs::ComponentType::SPECIAL_ATTACK).SetFromJson(archetypeJson["specialAttack"]);
 	}
 
 	//Jiggle component
 	if (CheckJsonExists(archetypeJson, "jiggle")) {
-		jiggle.SetFromJson(archetypeJson["jiggle"]);
-		AddComponent(ecs::ComponentType::JIGGLE);
+		EmplaceComponent<Jiggle>(ecs::ComponentType::JIGGLE).SetFromJson(archetypeJson["jiggle"]);
 	}
 
 	//Game Camera component
 	if (CheckJsonExists(archetypeJson, "gameCamera")) {
-		gameCamera.SetFromJson(archetypeJson["gameCamera"]);
-		AddComponent(ecs::ComponentType::GAME_CAMERA);
+		EmplaceComponent<GameCamera>(ecs::ComponentType::GAME_CAMERA).SetFromJson(archetypeJson["gameCamera"]);
 	}
 }
 
@@ -74,47 +64,47 @@ json GameArchetype::ToJson() const
     json archetypeJson = Archetype::ToJson();
 
 	if (HasComponent(ecs::ComponentType::PLAYER)) {
-		archetypeJson["player"] = player.ToJson();
+		archetypeJson["player"] = GetComponent<Player>(ecs::ComponentType::PLAYER).ToJson();
 	}
 
 	if (HasComponent(ecs::ComponentType::DESTRUCTIBLE_ELEMENT)) {
 		archetypeJson["destructibleElement"] =
-			destructibleElement.ToJson();
+			GetComponent<DestructibleElement>(ecs::ComponentType::DESTRUCTIBLE_ELEMENT).ToJson();
 	}
 
 	if (HasComponent(ecs::ComponentType::ENEMY)) {
-		archetypeJson["enemy"] = enemy.ToJson();
+		archetypeJson["enemy"] = GetComponent<Enemy>(ecs::ComponentType::ENEMY).ToJson();
 	}
 
 	if (HasComponent(ecs::ComponentType::MISSILE)) {
-		archetypeJson["missile"] = missile.ToJson();
+		archetypeJson["missile"] = GetComponent<Missile>(ecs::ComponentType::MISSILE).ToJson();
 	}
 
 	if (HasComponent(ecs::ComponentType::PROJECTILE)) {
-		archetypeJson["projectile"] = projectile.ToJson();
+		archetypeJson["projectile"] = GetComponent<Projectile>(ecs::ComponentType::PROJECTILE).ToJson();
 	}
 
 	if (HasComponent(ecs::ComponentType::WEAPON)) {
-		archetypeJson["weapon"] = weapon.ToJson();
+		archetypeJson["weapon"] = GetComponent<Weapon>(ecs::ComponentType::WEAPON).ToJson();
 	}
 
 	//Spline States
     if(HasComponent(ecs::ComponentType::SPLINE_STATES)) {
-		archetypeJson["splineStates"] = splineStates.ToJson();
+		archetypeJson["splineStates"] = GetComponent<SplineStates>(ecs::ComponentType::SPLINE_STATES).ToJson();
     }
 
 	//specialAttack
 	if (HasComponent(ecs::ComponentType::SPECIAL_ATTACK)) {
-		archetypeJson["specialAttack"] = specialAttack.ToJson();
+		archetypeJson["specialAttack"] = GetComponent<SpecialAttack>(ecs::ComponentType::SPECIAL_ATTACK).ToJson();
 	}
 
 	//Jiggle
 	if (HasComponent(ecs::ComponentType::JIGGLE)) {
-		archetypeJson["jiggle"] = jiggle.ToJson();
+		archetypeJson["jiggle"] = GetComponent<Jiggle>(ecs::ComponentType::JIGGLE).ToJson();
 	}
 	//Game camera
 	if (HasComponent(ecs::ComponentType::GAME_CAMERA)) {
-		archetypeJson["gameCamera"] = gameCamera.ToJson();
+		archetypeJson["gameCamera"] = GetComponent<GameCamera>(ecs::ComponentType::GAME_CAMERA).ToJson();
 	}
 
 	return archetypeJson;
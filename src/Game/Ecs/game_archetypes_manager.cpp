@@ -197,91 +197,91 @@ json GameArchetypesManager::ToJson() const {
 		int j = 0;
 		for (size_t entityIndex = pool.firstEntity; entityIndex < pool.lastEntity; entityIndex++) {
 			if (gameArchetypes_[i].HasComponent(ecs::ComponentType::COLLIDER) &&
-				collidersManager.GetComponent(entityIndex) != gameArchetypes_[i].collider) {
+				collidersManager.GetComponent(entityIndex) != gameArchetypes_[i].GetComponent<physics::Collider>(ecs::ComponentType::COLLIDER)) {
 
 				archetypesJson["entities"][j]["collider"][0] = collidersManager.GetJsonFromComponent(entityIndex);
 			}
 
 			if (gameArchetypes_[i].HasComponent(ecs::ComponentType::MODEL) &&
-				modelsManager.GetComponent(entityIndex).materialID != gameArchetypes_[i].model.materialID &&
-				modelsManager.GetComponent(entityIndex).meshID != gameArchetypes_[i].model.meshID) {
+				modelsManager.GetComponent(entityIndex).materialID != gameArchetypes_[i].GetComponent<graphics::Model>(ecs::ComponentType::MODEL).materialID &&
+				modelsManager.GetComponent(entityIndex).meshID != gameArchetypes_[i].GetComponent<graphics::Model>(ecs::ComponentType::MODEL).meshID) {
 
 				archetypesJson["entities"][j]["model"] = modelsManager.GetJsonFromComponent(entityIndex);
 			}
 
 			if (gameArchetypes_[i].HasComponent(ecs::ComponentType::RIGIDBODY) &&
-				rigidbodyManager.GetComponent(entityIndex).type != gameArchetypes_[i].rigidbody.type &&
-				rigidbodyManager.GetComponent(entityIndex).angularDrag != gameArchetypes_[i].rigidbody.angularDrag &&
-				rigidbodyManager.GetComponent(entityIndex).linearDrag != gameArchetypes_[i].rigidbody.linearDrag) {
+				rigidbodyManager.GetComponent(entityIndex).type != gameArchetypes_[i].GetComponent<physics::Rigidbody>(ecs::ComponentType::RIGIDBODY).type &&
+				rigidbodyManager.GetComponent(entityIndex).angularDrag != gameArchetypes_[i].GetComponent<physics::Rigidbody>(ecs::ComponentType::RIGIDBODY).angularDrag &&
+				rigidbodyManager.GetComponent(entityIndex).linearDrag != gameArchetypes_[i].GetComponent<physics::Rigidbody>(ecs::ComponentType::RIGIDBODY).linearDrag) {
 
 				archetypesJson["entities"][j]["rigidbody"] = rigidbodyManager.GetJsonFromComponent(entityIndex);
 			}
 
 			if (gameArchetypes_[i].HasComponent(ecs::ComponentType::SPLINE_FOLLOWER) &&
-				splinesManager.GetComponent(entityIndex).spline == gameArchetypes_[i].spline.spline &&
-				splinesManager.GetComponent(entityIndex).speed == gameArchetypes_[i].spline.speed) {
+				splinesManager.GetComponent(entityIndex).spline == gameArchetypes_[i].GetComponent<ecs::SplineFollower>(ecs::ComponentType::SPLINE_FOLLOWER).spline &&
+				splinesManager.GetComponent(entityIndex).speed == gameArchetypes_[i].GetComponent<ecs::SplineFollower>(ecs::ComponentType::SPLINE_FOLLOWER).speed) {
 
 				archetypesJson["entities"][j]["spline"] = splinesManager.GetJsonFromComponent(entityIndex);
 			}
 
 			if (gameArchetypes_[i].HasComponent(ecs::ComponentType::TRANSFORM) &&
-				transformManager.GetComponent(entityIndex).GetLocalPosition() != gameArchetypes_[i].transform.GetLocalPosition() &&
-				transformManager.GetComponent(entityIndex).GetLocalRotation() != gameArchetypes_[i].transform.GetLocalRotation() &&
-				transformManager.GetComponent(entityIndex).GetLocalScale() != gameArchetypes_[i].transform.GetLocalScale()) {
+				transformManager.GetComponent(entityIndex).GetLocalPosition() != gameArchetypes_[i].GetComponent<math::Transform>(ecs::ComponentType::TRANSFORM).GetLocalPosition() &&
+				transformManager.GetComponent(entityIndex).GetLocalOrientation() != gameArchetypes_[i].GetComponent<math::Transform>(ecs::ComponentType::TRANSFORM).GetLocalOrientation() &&
+				transformManager.GetComponent(entityIndex).GetLocalScale() != gameArchetypes_[i].GetComponent<math::Transform>(ecs::ComponentType::TRANSFORM).GetLocalScale()) {
 
 				archetypesJson["entities"][j]["transform"] = transformManager.GetJsonFromComponent(entityIndex);
 			}
 
 			if (gameArchetypes_[i].HasComponent(ecs::ComponentType::LIGHT) &&
-				lightsManager.GetComponent(entityIndex) != gameArchetypes_[i].light) {
+				lightsManager.GetComponent(entityIndex) != gameArchetypes_[i].GetComponent<ecs::Light>(ecs::ComponentType::LIGHT)) {
 				archetypesJson["entities"][j]["light"] = collidersManager.GetJsonFromComponent(entityIndex);
 			}
 
 			if (gameArchetypes_[i].HasComponent(ecs::ComponentType::AUDIO_SOURCE) &&
-				audioSourcesManager.GetComponent(entityIndex) != gameArchetypes_[i].audioSource) {
+				audioSourcesManager.GetComponent(entityIndex) != gameArchetypes_[i].GetComponent<audio::AudioSource>(ecs::ComponentType::AUDIO_SOURCE)) {
 				archetypesJson["entities"][j]["audioSource"] = audioSourcesManager.GetJsonFromComponent(entityIndex);
 			}
 
 			//--------------------------------- Game Components Part ---------------------------------------
 
             if(gameArchetypes_[i].HasComponent(ecs::ComponentType::PLAYER) &&
-				playerManager.GetComponent(entityIndex) != gameArchetypes_[i].player) {
+				playerManager.GetComponent(entityIndex) != gameArchetypes_[i].GetComponent<Player>(ecs::ComponentType::PLAYER)) {
 				archetypesJson["entities"][j]["player"] = playerManager.GetJsonFromComponent(entityIndex);
             }
 
             if(gameArchetypes_[i].HasComponent(ecs::ComponentType::DESTRUCTIBLE_ELEMENT) && 
-				destructibleElementManager.GetComponent(entityIndex) != gameArchetypes_[i].destructibleElement) {
+				destructibleElementManager.GetComponent(entityIndex) != gameArchetypes_[i].GetComponent<DestructibleElement>(ecs::ComponentType::DESTRUCTIBLE_ELEMENT)) {
 				archetypesJson["entities"][j]["destructibleElement"] =
 					destructibleElementManager.GetJsonFromComponent(entityIndex);
             }
 
 			if (gameArchetypes_[i].HasComponent(ecs::ComponentType::ENEMY) &&
-				enemyManager.GetComponent(entityIndex) != gameArchetypes_[i].enemy) {
+				enemyManager.GetComponent(entityIndex) != gameArchetypes_[i].GetComponent<Enemy>(ecs::ComponentType::ENEMY)) {
 				archetypesJson["entities"][j]["enemy"] = enemyManager.GetJsonFromComponent(entityIndex);
 			}
 
 			if (gameArchetypes_[i].HasComponent(ecs::ComponentType::MISSILE) &&
-				missileManager.GetComponent(entityIndex) != gameArchetypes_[i].missile) {
+				missileManager.GetComponent(entityIndex) != gameArchetypes_[i].GetComponent<Missile>(ecs::ComponentType::MISSILE)) {
 				archetypesJson["entities"][j]["missile"] = missileManager.GetJsonFromComponent(entityIndex);
 			}
 
 			if (gameArchetypes_[i].HasComponent(ecs::ComponentType::PROJECTILE) &&
-				projectileManager.GetComponent(entityIndex) != gameArchetypes_[i].projectile) {
+				projectileManager.GetComponent(entityIndex) != gameArchetypes_[i].GetComponent<Projectile>(ecs::ComponentType::PROJECTILE)) {
 				archetypesJson["entities"][j]["projectile"] = projectileManager.GetJsonFromComponent(entityIndex);
 			}
 
 			if (gameArchetypes_[i].HasComponent(ecs::ComponentType::WEAPON) &&
-				weaponManager.GetComponent(entityIndex) != gameArchetypes_[i].weapon) {
+				weaponManager.GetComponent(entityIndex) != gameArchetypes_[i].GetComponent<Weapon>(ecs::ComponentType::WEAPON)) {
 				archetypesJson["entities"][j]["weapon"] = weaponManager.GetJsonFromComponent(entityIndex);
 			}
 
 			if (gameArchetypes_[i].HasComponent(ecs::ComponentType::SPLINE_STATES) &&
-				splineStateManager.GetComponent(entityIndex) != gameArchetypes_[i].splineStates) {
+				splineStateManager.GetComponent(entityIndex) != gameArchetypes_[i].GetComponent<SplineStates>(ecs::ComponentType::SPLINE_STATES)) {
 				archetypesJson["entities"][j]["splineStates"] = splineStateManager.GetJsonFromComponent(entityIndex);
 			}
 
 			if (gameArchetypes_[i].HasComponent(ecs::ComponentType::JIGGLE) &&
-				jiggleManager.GetComponent(entityIndex) != gameArchetypes_[i].jiggle) {
+				jiggleManager.GetComponent(entityIndex) != gameArchetypes_[i].GetComponent<Jiggle>(ecs::ComponentType::JIGGLE)) {
 				archetypesJson["entities"][j]["jiggle"] = jiggleManager.GetJsonFromComponent(entityIndex);
 			}
 			//-------------------------------------- End Game Part -------------------------------------------
@@ -64,19 +64,7 @@ std::map<ecs::EntityIndex, ecs::EntityIndex> GameEcsManager::SetEntitiesFromJson
 
 			const std::string nameString = entityJson["prefabName"].get<std::string>();
 
-		    // <Temporary>
-			std::vector<ecs::EntityIndex> instantiatedObjects;
-			/******************************** Game prefab construction ********************************/
-			if (nameString == "Player")
-				instantiatedObjects = reinterpret_cast<game::GamePrefabsManager&>(poke::PrefabsManagerLocator::Get()).InstantiatePlayer();
-			else if (nameString == "LightFighter")
-				instantiatedObjects = reinterpret_cast<game::GamePrefabsManager&>(poke::PrefabsManagerLocator::Get()).InstantiateLightFighter();
-			else if (nameString == "Destroyer")
-				instantiatedObjects = reinterpret_cast<game::GamePrefabsManager&>(poke::PrefabsManagerLocator::Get()).InstantiateDestroyer();
-			else
-				instantiatedObjects = PrefabsManagerLocator::Get().Instantiate(nameString);
-			/******************************************************************************************/
-			// </Temporary>
+			const std::vector<ecs::EntityIndex> instantiatedObjects = InstantiateScenePrefab(nameString);
 			entityIndex = instantiatedObjects[0];
 
 			parentOffset += entityIndex - lastGeneratedEntityIndex - 1;
@@ -257,6 +245,20 @@ std::map<ecs::EntityIndex, ecs::EntityIndex> GameEcsManager::SetEntitiesFromJson
 	return sceneIdToEntityId;
 }
 
+std::vector<ecs::EntityIndex> GameEcsManager::InstantiateScenePrefab(const std::string& prefabName)
+{
+	// <Temporary>
+	/******************************** Game prefab construction ********************************/
+	auto& prefabsManager = reinterpret_cast<game::GamePrefabsManager&>(PrefabsManagerLocator::Get());
+	if (prefabName == "Player") { return prefabsManager.InstantiatePlayer(); }
+	if (prefabName == "LightFighter") { return prefabsManager.InstantiateLightFighter(); }
+	if (prefabName == "Destroyer") { return prefabsManager.InstantiateDestroyer(); }
+	/******************************************************************************************/
+	// </Temporary>
+
+	return CoreEcsManager::InstantiateScenePrefab(prefabName);
+}
+
 std::tuple<json, std::map<ecs::EntityIndex, ecs::EntityIndex>> GameEcsManager::EntitiesToJson()
 {
 	cassert(false, "Game Ecs Manager shouldn't be saving scenes.");
@@ -145,11 +145,10 @@ std::vector<ecs::EntityIndex> GamePrefabsManager::InstantiateDestroyer() const {
 std::vector<ecs::EntityIndex> GamePrefabsManager::Instantiate(
     const nonstd::string_view& prefabName) const
 {
-    const auto hash = math::HashString(prefabName);
-    for (size_t i = 0; i < prefabsID_.size(); i++) {
-        if (hash == prefabsID_[i]) {
-            return EcsManagerLocator::Get().InstantiatePrefab(prefabs_[i]);
-        }
+    const ResourceID prefabID = math::HashString(prefabName);
+    const ResourceHandle handle = prefabIndex_.Find(prefabID);
+    if (handle != kInvalidResourceHandle) {
+        return EcsManagerLocator::Get().InstantiatePooledPrefab(prefabID, prefabs_[handle]);
     }
 
     LogWarning(
@@ -164,9 +163,9 @@ void GamePrefabsManager::AddPrefab(const std::string& prefabName)
 {
     const auto hash = math::HashString(prefabName);
 
-	const auto it = std::find(prefabsID_.begin(), prefabsID_.end(), hash);
-	if (it != prefabsID_.end()) return;
+	if (prefabIndex_.Find(hash) != kInvalidResourceHandle) return;
 
+    prefabIndex_.Insert(hash, static_cast<ResourceHandle>(prefabsID_.size()));
     prefabsID_.push_back(hash);
 
     auto prefabJson = LoadJson(
@@ -180,18 +179,21 @@ void GamePrefabsManager::AddPrefab(const std::string& prefabName)
     prefabs_.back().SetFromJson(prefabJson);
 }
 
+void GamePrefabsManager::AddPrefabPool(const std::string& prefabName, const size_t instancesCount)
+{
+    AddPrefab(prefabName);
+
+    const ResourceID prefabID = math::HashString(prefabName);
+    EcsManagerLocator::Get().AddPrefabPool(prefabID, prefabs_[prefabIndex_.Find(prefabID)], instancesCount);
+}
+
 const ecs::Prefab& GamePrefabsManager::GetPrefab(
     const nonstd::string_view& prefabName) const
 {
-    const auto hash = math::HashString(prefabName);
-    const auto it = std::find(
-        prefabsID_.begin(),
-        prefabsID_.end(),
-        hash);
-
-    const auto index = std::distance(prefabsID_.begin(), it);
+    const ResourceHandle handle = prefabIndex_.Find(math::HashString(prefabName));
+    cassert(handle != kInvalidResourceHandle, "The prefab " << prefabName << " doesn't exist");
 
-    return prefabs_[index];
+    return prefabs_[handle];
 }
 
 const std::vector<ResourceID>& GamePrefabsManager::GetPrefabsIDs() const
@@ -219,12 +221,18 @@ void GamePrefabsManager::Clear()
 {
 	prefabs_.clear();
 	prefabsID_.clear();
+	prefabIndex_.Clear();
 }
 
 void GamePrefabsManager::Resize(const size_t newSize)
 {
 	prefabsID_.resize(newSize);
 	prefabs_.resize(newSize);
+
+	prefabIndex_.Clear();
+	for (size_t i = 0; i < prefabsID_.size(); i++) {
+		prefabIndex_.Insert(prefabsID_[i], static_cast<ResourceHandle>(i));
+	}
 }
 } //namespace game
 } //namespace poke
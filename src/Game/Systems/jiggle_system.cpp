@@ -61,7 +61,8 @@ void JiggleSystem::OnUpdate() {
 			
 			math::Transform transform = transformsManager_.GetComponent(entityIndexes_[index]);
 			//Rotate around an axis
-			transform.SetLocalRotation(transform.GetLocalRotation() + kRotation_ * jiggle.rotationSpeed);
+			transform.SetLocalOrientation(
+				transform.GetLocalOrientation() * math::Quaternion::RotateAroundAxis(kRotation_, jiggle.rotationSpeed));
 			transformsManager_.SetComponent(entityIndexes_[index], transform);
 		}
     }
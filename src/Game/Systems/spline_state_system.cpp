@@ -38,9 +38,10 @@ void SplineStateSystem::OnUpdate() {
 		gameCamera = gameCameraManager_.GetComponent(cameraIndex_);
     }
 
+    auto splineFollowers = splineFollowersManager_.GetComponentsView();
     for(ecs::EntityIndex entityIndex : entityIndexes_) {
-		SplineStates splineStates = splineStatesManager_.GetComponent(entityIndex);
-		ecs::SplineFollower splineFollower = splineFollowersManager_.GetComponent(entityIndex);
+		const SplineStates& splineStates = splineStatesManager_.GetComponent(entityIndex);
+		ecs::SplineFollower& splineFollower = splineFollowers[entityIndex];
 
 		const PointState newPointState = splineStates.pointStates[splineFollower.lastPoint + 1];
 		const PointState oldPointState = splineStates.pointStates[splineFollower.lastPoint];
@@ -58,8 +59,6 @@ void SplineStateSystem::OnUpdate() {
 		//		splineStates.currentPointState = 1;
 		//	}
 		//}
-
-		splineFollowersManager_.SetComponent(entityIndex, splineFollower);
     }
 
     if(cameraIndex_ != ecs::kNoEntity) {
@@ -93,7 +93,7 @@ void AimingAidSystem::OnUpdate() {
 			(targetSightPositions_[playerIndex] - playerPositions_[playerIndex]).Normalize();
 	}
 
-	SelectVisibleEntities();
+	const SpatialHash& targetsSpatialHash = game_.GetTargetsSpatialHash();
 
 	for (size_t playerIndex = 0; playerIndex < players_.size(); playerIndex++) {
 		size_t enemyIndex = kNoEntitySelected_;
@@ -102,47 +102,29 @@ void AimingAidSystem::OnUpdate() {
 
 		// Check if the current player already has a target locked
 		if (enemyIndex == kNoEntitySelected_) {
-			beaconConfirmedTargetNb_ = 0;
-			for (size_t index = 0; index < beaconTargetNb_; index++) {
-				const math::Vec3 targetDirection =
-					(targetPositions_[index] - playerPositions_[playerIndex]).Normalize();
-
-				float angle = atan2(
-					math::Vec3::Cross(aimDirections_[playerIndex], targetDirection).GetMagnitude(),
-					aimDirections_[playerIndex] * targetDirection);
-
-				angle = angle * math::kRad2Deg;
-
-				//inversion of the angle
-				if (angle > kDefaultAngle_) {
-					angle = (angle - kDefaultAngle_ * 2) * -1.0f;
-				}
-
-				// return true if the angle is less wider than the max angle
-				const bool isLockable = angle < kMaxAimAngle_;
-
-				if (isLockable) {
-					selectedTargets_[beaconConfirmedTargetNb_] = index;
-					selectedTargetAngles_[beaconConfirmedTargetNb_] = angle;
-					beaconConfirmedTargetNb_++;
-				}
-			}
+			//Only the targets of the cells in the aim of the player are tested
+			targetsSpatialHash.QueryCone(
+				playerPositions_[playerIndex],
+				aimDirections_[playerIndex],
+				kMaxAimAngle_,
+				kMaxTargetDistance_,
+				lockableTargets_);
 
 			float previousDistanceToTarget = kMaxTargetDistance_;
 			
-			for (size_t index = 0; index < beaconConfirmedTargetNb_; index++) {
-				const float distanceToTarget = math::Vec3::GetDistanceManhattan(targetPositions_[selectedTargets_[index]], playerPositions_[playerIndex]);
+			for (size_t index = 0; index < lockableTargets_.size(); index++) {
+				const float distanceToTarget = math::Vec3::GetDistanceManhattan(lockableTargets_[index].position, playerPositions_[playerIndex]);
 				if (distanceToTarget < previousDistanceToTarget) {
-					targetSightPositions_[playerIndex] = targetPositions_[selectedTargets_[index]];
+					targetSightPositions_[playerIndex] = lockableTargets_[index].position;
 					enemyIndex = index;
 					previousDistanceToTarget = distanceToTarget;
 				}
 			}
 
 			if (enemyIndex != kNoEntitySelected_) {
-				playersDatas_[playerIndex].currentTarget = targets_[selectedTargets_[enemyIndex]];
+				playersDatas_[playerIndex].currentTarget = lockableTargets_[enemyIndex].entityIndex;
 				playersDatas_[playerIndex].fireDirection =
-					(targetPositions_[selectedTargets_[enemyIndex]] - playerPositions_[playerIndex]).Normalize();
+					(lockableTargets_[enemyIndex].position - playerPositions_[playerIndex]).Normalize();
 				newTargetSightStates_[playerIndex] = TargetSightState::LOCK;
 			}
 			else {
@@ -264,38 +246,13 @@ void AimingAidSystem::OnUpdate() {
 	pok_EndProfiling(AimingAid_System);
 }
 
-void AimingAidSystem::SelectVisibleEntities() {
-	beaconTargetNb_ = 0;
-	const std::vector<ecs::EntityIndex>& visibleEntities = ecsManager_.GetDrawnEntities();
-	
-	//Select only visible entities that are destructible elements
-	for (const ecs::EntityIndex entityIndex : visibleEntities) {
-		if (beaconTargetNb_ >= maxTargetNb) { break; }
-		if (ecsManager_.HasComponent(entityIndex, ecs::ComponentType::DESTRUCTIBLE_ELEMENT)) {
-			// Avoid locking indestructible element
-			if (ecsManager_.GetComponentsManager<DestructibleElementManager>().GetComponent(entityIndex).isIndestructible)
-				continue;
-
-			targetPositions_[beaconTargetNb_] = transformsManager_.GetWorldPosition(entityIndex);
-
-			if (math::Vec3::GetDistanceManhattan(
-				targetPositions_[beaconTargetNb_], playerPositions_[0]) <
-				kMaxTargetDistance_)
-			{
-				targets_[beaconTargetNb_] = entityIndex;
-				beaconTargetNb_++;
-			}
-		}
-	}
-}
-
 void AimingAidSystem::LookAtCamera(const ecs::EntityIndex entityIndex) {
 	math::Transform transform = transformsManager_.GetWorldTransform(entityIndex);
 
-	transform.SetLocalRotation(
+	transform.SetLocalOrientation(
 		math::Quaternion::LookRotation(
 			camera_.GetFront(), 
-			camera_.GetUp()).GetEulerAngles());
+			camera_.GetUp()));
 	transformsManager_.SetComponentFromWorldTransform(entityIndex, transform);
 }
 
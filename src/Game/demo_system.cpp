@@ -130,9 +130,11 @@ void DemoSystem::InitializeScene() {
 
 		splineFollower.speed = kEnemyApproachSpeed_;
 		
+		std::vector<math::Vec3> points = splineFollower.spline.GetPoints();
 		for (size_t i = 0; i < kEnemySplines_[0].size(); i++) {
-			splineFollower.spline.AddPoint(kEnemySplines_[index][i]);
+			points.push_back(kEnemySplines_[index][i]);
 		}
+		splineFollower.spline.SetPoints(points);
 
 		math::Transform transform = transformsManager_.GetComponent(enemyIndex);
 		transform.SetLocalPosition(kEnemySplines_[index][1]);
@@ -159,9 +161,11 @@ void DemoSystem::InitializeScene() {
 
 		splineFollower.speed = kDestroyerApproachSpeed_;
 
+		std::vector<math::Vec3> points = splineFollower.spline.GetPoints();
 		for (size_t i = 0; i < kDestroyerSplines_[0].size(); i++) {
-			splineFollower.spline.AddPoint(kDestroyerSplines_[index][i]);
+			points.push_back(kDestroyerSplines_[index][i]);
 		}
+		splineFollower.spline.SetPoints(points);
 
 		math::Transform transform = transformsManager_.GetComponent(enemyIndex);
 		transform.SetLocalPosition(kDestroyerSplines_[index][1]);
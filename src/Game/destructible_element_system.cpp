@@ -1,4 +1,8 @@
 #include <Game/destructible_element_system.h>
+
+#include <algorithm>
+#include <cmath>
+
 #include <CoreEngine/engine.h>
 #include <Game/game.h>
 #include <Game/ComponentManagers/destructible_element_manager.h>
@@ -45,8 +49,13 @@ DestructibleElementSystem::DestructibleElementSystem(Engine& engineExport, Game
 }
 
 void DestructibleElementSystem::OnLoadScene() {
-	gamePrefabsManager_.AddPrefab("ParticleAsteroid");
-	gamePrefabsManager_.AddPrefab("ParticleTurret");
+	//The ships and the turrets use the same particle
+	gamePrefabsManager_.AddPrefabPool(
+		"ParticleAsteroid",
+		static_cast<size_t>(std::ceil(kMaxDestructionsPerSecond_ * kParticleTimeAsteroid_)));
+	gamePrefabsManager_.AddPrefabPool(
+		"ParticleTurret",
+		static_cast<size_t>(std::ceil(kMaxDestructionsPerSecond_ * std::max(kParticleTimeShip_, kParticleTimeTurret_))));
 
 	//Creation of an archetype
 	// Prepare the components values
@@ -58,7 +67,7 @@ void DestructibleElementSystem::OnLoadScene() {
 
 	physics::Rigidbody rigid;
 	rigid.type = physics::RigidbodyType::DYNAMIC;
-	debrisArchetype.rigidbody = rigid;
+	debrisArchetype.SetComponent(ecs::ComponentType::RIGIDBODY, rigid);
 
 	graphics::Model projectileModel;
 	std::string materialName = "asteroid_mat";
@@ -68,8 +77,8 @@ void DestructibleElementSystem::OnLoadScene() {
 	auto meshHash = poke::math::HashString("Asteroides/SM_astero6_LOD00.obj");
 	poke::MeshManagerLocator::Get().AddMesh(meshName);
 	projectileModel = graphics::Model{ materialHash, meshHash };
-	debrisArchetype.model = projectileModel;
-	debrisArchetype.transform.SetLocalPosition({ 1000000 });
+	debrisArchetype.SetComponent(ecs::ComponentType::MODEL, projectileModel);
+	debrisArchetype.EmplaceComponent<math::Transform>(ecs::ComponentType::TRANSFORM).SetLocalPosition({ 1000000 });
 	ArchetypesManagerLocator::Get().AddArchetype(debrisArchetype, "debris", kMaxArchetypeDebrisNb_);
 
 	debrisArchetypeId_ = ArchetypesManagerLocator::Get().GetArchetypeID("debris");
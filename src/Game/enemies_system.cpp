@@ -69,8 +69,11 @@ void EnemiesSystem::OnUpdate() {
     }
 
     // Main behavior of enemies
+	auto enemies = enemiesManager_.GetComponentsView();
+	auto weapons = weaponManager_.GetComponentsView();
+	auto splineFollowers = splineFollowersManager_.GetComponentsView();
     for (const ecs::EntityIndex entityIndex : enemyIndexes_) {
-		Enemy enemy = enemiesManager_.GetComponent(entityIndex);
+		Enemy& enemy = enemies[entityIndex];
 
 		math::Transform enemyTransform = transformsManager_.GetComponent(entityIndex);
 
@@ -80,18 +83,15 @@ void EnemiesSystem::OnUpdate() {
         switch (enemy.state) {
 		    case Enemy::State::LAUNCH: {
 				enemy.state = Enemy::State::APPROACH;
-				enemiesManager_.SetComponent(entityIndex, enemy);
 			    break;
 		    }
 		    case Enemy::State::APPROACH: {
-				auto splineFollower = splineFollowersManager_.GetComponent(entityIndex);
+				auto& splineFollower = splineFollowers[entityIndex];
 				splineFollower.speed = splineFollower.speed + (enemy.approachSpeed - splineFollower.speed) * kLerpSpeedFactor_ * deltaTime;
-			    if (splineFollowersManager_.GetComponent(entityIndex).lastPoint >= enemy.splineFireStartPoint) {
+			    if (splineFollower.lastPoint >= enemy.splineFireStartPoint) {
 					enemy.state = Enemy::State::ATTACK;
-					enemiesManager_.SetComponent(entityIndex, enemy);
 					splineFollower.speed = enemy.attackSpeed;
 			    }
-				splineFollowersManager_.SetComponent(entityIndex, splineFollower);
 			    break;
 		    }
 			case Enemy::State::ATTACK: {
@@ -99,12 +99,12 @@ void EnemiesSystem::OnUpdate() {
                 if(players_.size() > 0) {
 					pok_BeginProfiling(Enemy_Fire, 0);
 					for (ecs::EntityIndex enemyWeaponIndex : enemy.weapons) {
-						Weapon weapon = weaponManager_.GetComponent(enemyWeaponIndex);
+						Weapon& weapon = weapons[enemyWeaponIndex];
 						const math::Vec3 weaponPos = transformsManager_.GetWorldPosition(weapon.gunPositions[weapon.activeGunID]);
 						math::Vec3 playerFuturePos(0);
 						for (size_t i = 0; i < futurePosNb; i++) {
-							if ((playerFuturePositions_[i] - weaponPos).GetMagnitude() <
-								projectileFutureDistances_[i]) {
+							const math::Vec3 toFuturePos = playerFuturePositions_[i] - weaponPos;
+							if (toFuturePos * toFuturePos < projectileFutureSqrDistances_[i]) {
 								playerFuturePos = playerFuturePositions_[i];
 								break;
 							}
@@ -123,58 +123,45 @@ void EnemiesSystem::OnUpdate() {
 						weapon.origin = ecs::kNoEntity;
 						weapon.shootDirection = aimDirection;
 						weapon.targets[0] = players_[0];
-						weaponManager_.SetComponent(enemyWeaponIndex, weapon);
 					}
 					pok_EndProfiling(Enemies_Fire);
                 }
 
-				auto splineFollower = splineFollowersManager_.GetComponent(entityIndex);
+				auto& splineFollower = splineFollowers[entityIndex];
 				splineFollower.speed = splineFollower.speed + (enemy.attackSpeed - splineFollower.speed) * kLerpSpeedFactor_ * deltaTime;
 				if (splineFollower.lastPoint >= enemy.splineFireEndPoint) {
 					enemy.state = Enemy::State::FLEE;
-					enemiesManager_.SetComponent(entityIndex, enemy);
 				}
-				splineFollowersManager_.SetComponent(entityIndex, splineFollower);
 				break;
 			}
             case Enemy::State::FLEE: {
-				auto splineFollower = splineFollowersManager_.GetComponent(entityIndex);
+				auto& splineFollower = splineFollowers[entityIndex];
 				splineFollower.speed = splineFollower.speed + (enemy.fleeSpeed - splineFollower.speed) * kLerpSpeedFactor_ * deltaTime;
 				if (splineFollower.totalPercentage >= kPercentageFullCheck) {
 					enemy.state = Enemy::State::RESET;
-					enemiesManager_.SetComponent(entityIndex, enemy);
 					splineFollower.speed = 0.0f;
 				}
-				splineFollowersManager_.SetComponent(entityIndex, splineFollower);
 
 				//Stop firing 
 				for (ecs::EntityIndex enemyWeaponIndex : enemy.weapons) {
-    				Weapon weapon = weaponManager_.GetComponent(enemyWeaponIndex);
-    				weapon.isShooting = false;
-    				weaponManager_.SetComponent(enemyWeaponIndex, weapon);
+    				weapons[enemyWeaponIndex].isShooting = false;
 				}
 				break;
 			}
 			case Enemy::State::DYING: {
 				enemy.state = Enemy::State::RESET;
-				enemiesManager_.SetComponent(entityIndex, enemy);
 
 				//Stop firing 
 				for (ecs::EntityIndex enemyWeaponIndex : enemy.weapons) {
-					Weapon weapon = weaponManager_.GetComponent(enemyWeaponIndex);
-					weapon.isShooting = false;
-					weaponManager_.SetComponent(enemyWeaponIndex, weapon);
+					weapons[enemyWeaponIndex].isShooting = false;
 				}
 				break;
 		    }
             case Enemy::State::RESET: {
 				enemy.state = Enemy::State::INACTIVE;
-				enemiesManager_.SetComponent(entityIndex, enemy);
 
 				//Stop firing in death case
-				Weapon weapon = weaponManager_.GetComponent(entityIndex);
-				weapon.isShooting = false;
-				weaponManager_.SetComponent(entityIndex, weapon);
+				weapons[entityIndex].isShooting = false;
 		        break;
             }
 			case Enemy::State::INACTIVE: {
@@ -187,8 +174,8 @@ void EnemiesSystem::OnUpdate() {
     }
 
 	for (ecs::EntityIndex entityIndex : enemySplineIndexes_) {
-		ecs::SplineFollower splineFollower = splineFollowersManager_.GetComponent(entityIndex);
-		Enemy enemy = enemiesManager_.GetComponent(entityIndex);
+		const ecs::SplineFollower& splineFollower = splineFollowersManager_.GetComponent(entityIndex);
+		const Enemy& enemy = enemiesManager_.GetComponent(entityIndex);
 		math::Transform transform = transformsManager_.GetComponent(entityIndex);
 		if (enemy.state != Enemy::State::DYING ||
 			enemy.state != Enemy::State::RESET ||
@@ -196,7 +183,7 @@ void EnemiesSystem::OnUpdate() {
 		{
 			transform.SetLocalPosition(splineFollower.spline.Lerp(splineFollower.lastPoint, splineFollower.segmentPercentage));
 			size_t lastpoint = splineFollower.lastPoint;
-			const size_t length = splineFollower.spline.GetPoints().size();
+			const size_t length = splineFollower.spline.GetSize();
 			float percentage = splineFollower.segmentPercentage;
             if(lastpoint == length - 2 && percentage > kMaxPercentage_) {
 				lastpoint++;
@@ -209,11 +196,11 @@ void EnemiesSystem::OnUpdate() {
 					lastpoint++;
                 }
             }
-			transform.SetLocalRotation(
+			transform.SetLocalOrientation(
                 math::Quaternion::FromToRotation(
 					{ 0.0f, 0.0f, 1.0f },
 					(splineFollower.spline.Lerp(lastpoint, percentage) - transform.GetLocalPosition()).Normalize() 
-				).GetEulerAngles()
+				)
 			);
 			
 			transformsManager_.SetComponentFromWorldTransform(entityIndex, transform);
@@ -306,7 +293,8 @@ void EnemiesSystem::OnEntityAddComponent(const ecs::EntityIndex entityIndex, con
 			projectileSpeedIsSet_ = true;
 
             for(float i = 0; i < futurePosNb; i++) {
-				projectileFutureDistances_[i] = projectileSpeed_ * kTimeBetweenCheck_ * i;
+				const float projectileFutureDistance = projectileSpeed_ * kTimeBetweenCheck_ * i;
+				projectileFutureSqrDistances_[i] = projectileFutureDistance * projectileFutureDistance;
             }
         }
         return;
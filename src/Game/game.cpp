@@ -4,6 +4,7 @@
 #include <Utility/file_system.h>
 #include <Utility/profiler.h>
 #include <Utility/time_custom.h>
+#include <Memory/frame_arena.h>
 
 #include <Game/app_components_managers_container.h>
 
@@ -25,6 +26,8 @@ void Game::Build() {
 	ArchetypesManagerLocator::Assign(&gameArchetypesManager_);
 	resourcesManagerContainer_.Init();
 	CameraLocator::Assign(&camera_);
+	//The editor saves the whole scene, only the game evicts chunks
+	ChunksManagerLocator::Get().SetStreaming(true);
 	ecs::AppComponentsManagersContainer::Init();
 	PrefabsContainer::Init();
 
@@ -33,7 +36,18 @@ void Game::Build() {
 
 void Game::OnUpdate()
 {
-	
+	//Registered before the systems, the targets are indexed once for all of them
+	auto& transformsManager = gameEcsManager_.GetComponentsManager<ecs::TransformsManager>();
+	const auto destructibleElements = gameEcsManager_.GetComponentsManager<DestructibleElementManager>().GetComponentsView();
+
+	targetsSpatialHash_.Clear();
+	for (const ecs::EntityIndex entityIndex : gameEcsManager_.GetDrawnEntities()) {
+		if (!gameEcsManager_.HasComponent(entityIndex, ecs::ComponentType::DESTRUCTIBLE_ELEMENT) ||
+			destructibleElements[entityIndex].isIndestructible) { continue; }
+
+		targetsSpatialHash_.Insert(entityIndex, transformsManager.GetWorldPosition(entityIndex));
+	}
+	targetsSpatialHash_.Build();
 }
 
 void Game::LoadApp() {
@@ -49,91 +63,95 @@ void Game::Pause()
 void Game::Run()
 {
 	state_ = AppState::RUNNING;
+	SetFrameTasks();
 
-	while (state_ != AppState::STOP) {
-		if (state_ == AppState::PAUSE) continue;
+	const char* loadingTitles[] = { "[=          ]", "[ =         ]", "[  =        ]", "[   =       ]", "[    =      ]", "[     =     ]", "[      =    ]", "[       =   ]", "[        =  ]", "[         = ]", "[          =]", "[         = ]", "[        =  ]", "[       =   ]", "[      =    ]", "[     =     ]", "[    =      ]", "[   =       ]", "[  =        ]", "[ =         ]" };
+	const size_t loadingTitlesCount = sizeof(loadingTitles) / sizeof(loadingTitles[0]);
 
-		std::vector<std::string> loadingTitle = { "[=          ]", "[ =         ]", "[  =        ]", "[   =       ]", "[    =      ]", "[     =     ]", "[      =    ]", "[       =   ]", "[        =  ]", "[         = ]", "[          =]", "[         = ]", "[        =  ]", "[       =   ]", "[      =    ]", "[     =     ]", "[    =      ]", "[   =       ]", "[  =        ]", "[ =         ]" };
-		std::string title = SceneManagerLocator::Get().GetActiveScene().GetSceneName();
+	while (state_ != AppState::STOP) {
+		if (state_ == AppState::PAUSE) {
+			engine_.GetFrameLimiter().Idle();
+			continue;
+		}
 
 		static int iteration = 0;
-		GraphicsEngineLocator::Get().SetTitle((loadingTitle[iteration++ % loadingTitle.size()] + " " + title).c_str());
+		windowTitle_.assign(loadingTitles[iteration++ % loadingTitlesCount]);
+		windowTitle_ += ' ';
+		windowTitle_ += SceneManagerLocator::Get().GetActiveScene().GetSceneName();
+		GraphicsEngineLocator::Get().SetTitle(windowTitle_.c_str());
 
 		pok_BeginFrame(0);
 
 		Time::Get().StartFrame();
 		subjectInputs_.Notify();
 
-		//Begin profiling threads
+		engine_.RunFrameTasks(ThreadType::MAIN);
+		engine_.RunFrameTasks(ThreadType::RENDER);
 
-		//Main thread
-		//Being profiling main thread
-		engine_.AddAsync([] { pok_BeginProfiling(App_Thread, 0) }, ThreadType::MAIN);
+		//Wait end of frame
+		engine_.Wait(ThreadType::MAIN);
+		engine_.Wait(ThreadType::RENDER);
+		engine_.Wait(ThreadType::WORKER);
 
+		//End frame
+		subjectEndFrame_.Notify();
+
+		//Transient data of the frame are not used anymore
+		FrameArena::ResetAll();
+
+		engine_.GetFrameLimiter().WaitEndOfFrame();
+
+		Time::Get().EndFrame();
+
+		pok_EndFrame();
+	}
+}
+
+void Game::SetFrameTasks()
+{
+	//Main thread
+	engine_.SetFrameTasks({
+		[] { pok_BeginProfiling(App_Thread, 0) },
 		//PhyscisUpdate
-		engine_.AddAsync([this] {
+		[this] {
 			pok_BeginProfiling(Update_Physics, 0);
 			subjectPhysicsUpdate_.Notify();
 			pok_EndProfiling(Update_Physics);
-		}, ThreadType::MAIN);
-
+		},
 		//Update
-		engine_.AddAsync([this] {
+		[this] {
 			pok_BeginProfiling(Update, 0);
 			subjectUpdate_.Notify();
 			pok_EndProfiling(Update);
-		}, ThreadType::MAIN);
-
+		},
 		//Draw
-		engine_.AddAsync([this] {
+		[this] {
 			pok_BeginProfiling(Draw, 0);
 			subjectDraw_.Notify();
 			pok_EndProfiling(Draw);
-		}, ThreadType::MAIN);
-
-		//End profiling main thread
-		engine_.AddAsync([this] {
-			pok_EndProfiling(App_Thread);
-		}, ThreadType::MAIN);
-
-		//Draw thread
-		//Begin profiling render thread
-		engine_.AddAsync([] { pok_BeginProfiling(Render_Thread, 0) }, ThreadType::RENDER);
+		},
+		[] { pok_EndProfiling(App_Thread) }
+	}, ThreadType::MAIN);
 
+	//Draw thread
+	engine_.SetFrameTasks({
+		[] { pok_BeginProfiling(Render_Thread, 0) },
 		//Culling
-		engine_.AddAsync([this] {
+		[this] {
 			pok_BeginProfiling(Culling, 0);
 			subjectCulling_.Notify();
 			pok_EndProfiling(Culling);
-		}, ThreadType::RENDER);
-
+		},
 		//Render
-		engine_.AddAsync([this] {
+		[this] {
 			pok_BeginProfiling(Render, 0);
 			subjectRender_.Notify();
 			pok_EndProfiling(Render);
-		}, ThreadType::RENDER);
-
-		//End profiling render thread
-		engine_.AddAsync([] { pok_EndProfiling(Render_Thread) }, ThreadType::RENDER);
-
-		//End profiling threads
-		//Wait end of frame
-		engine_.Wait(ThreadType::MAIN);
-		engine_.Wait(ThreadType::RENDER);
-		engine_.Wait(ThreadType::WORKER);
-
-		//End frame
-		subjectEndFrame_.Notify();
-
-		//There is more constancy doing this than doing a Sleep().
-		while (Time::Get().GetFrameElapsedTime() < 16.66f) {}
-
-		Time::Get().EndFrame();
-
-		pok_EndFrame();
-	}
+		},
+		[] { pok_EndProfiling(Render_Thread) }
+	}, ThreadType::RENDER);
 }
+
 void Game::Stop()
 {
 	state_ = AppState::STOP;
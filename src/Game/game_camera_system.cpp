@@ -59,11 +59,11 @@ namespace poke::game {
 				math::Matrix4::LookAt(transform.GetLocalPosition(), splineFollower.spline.Lerp(lastpoint, percentage), gameCameraData_.Up));
 
 
-			transform.SetLocalRotation(
+			transform.SetLocalOrientation(
 				math::Quaternion::LookRotation(
 				(splineFollower.spline.Lerp(lastpoint, percentage) - transform.GetLocalPosition()).Normalize(),
 					gameCameraData_.Up
-				).GetEulerAngles()
+				)
 			);
 
 			transformsManager_.SetComponent(entityIndex, transform);
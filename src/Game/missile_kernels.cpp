@@ -0,0 +1,150 @@
+#include <Game/missile_kernels.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include <Math/quaternion.h>
+
+#if defined(_M_X64) || defined(__SSE2__)
+#define POK_MISSILES_SSE
+#include <emmintrin.h>
+#endif
+
+namespace poke {
+namespace game {
+namespace missile_kernels {
+void MissilesBatch::Resize(const size_t count)
+{
+    for (std::vector<float>* values : {
+        &positionsX, &positionsY, &positionsZ,
+        &targetsX, &targetsY, &targetsZ,
+        &directionsX, &directionsY, &directionsZ,
+        &speeds, &lifeTimes,
+        &velocitiesX, &velocitiesY, &velocitiesZ }) {
+        values->resize(count);
+    }
+    hasTurned.resize(count);
+    rotations.resize(count);
+}
+
+namespace {
+#ifdef POK_MISSILES_SSE
+__m128 Select(const __m128 mask, const __m128 ifTrue, const __m128 ifFalse)
+{
+    return _mm_or_ps(_mm_and_ps(mask, ifTrue), _mm_andnot_ps(mask, ifFalse));
+}
+#endif
+} //namespace
+
+void UpdateMissiles(
+    MissilesBatch& missiles,
+    const size_t begin,
+    const size_t end,
+    const float deltaTime,
+    const float cosMaxAngle,
+    const float lerpValue)
+{
+    size_t i = begin;
+#ifdef POK_MISSILES_SSE
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 cosMax = _mm_set1_ps(cosMaxAngle);
+    const __m128 lerp = _mm_set1_ps(lerpValue);
+    const __m128 dt = _mm_set1_ps(deltaTime);
+    for (; i + 4 <= end; i += 4) {
+        __m128 targetX = _mm_sub_ps(_mm_loadu_ps(&missiles.targetsX[i]), _mm_loadu_ps(&missiles.positionsX[i]));
+        __m128 targetY = _mm_sub_ps(_mm_loadu_ps(&missiles.targetsY[i]), _mm_loadu_ps(&missiles.positionsY[i]));
+        __m128 targetZ = _mm_sub_ps(_mm_loadu_ps(&missiles.targetsZ[i]), _mm_loadu_ps(&missiles.positionsZ[i]));
+
+        //A missile on its target gets a null target direction, like with Vec3::Normalize
+        const __m128 sqrDistance = _mm_add_ps(
+            _mm_add_ps(_mm_mul_ps(targetX, targetX), _mm_mul_ps(targetY, targetY)),
+            _mm_mul_ps(targetZ, targetZ));
+        const __m128 invDistance = _mm_and_ps(
+            _mm_cmpgt_ps(sqrDistance, zero),
+            _mm_div_ps(one, _mm_sqrt_ps(sqrDistance)));
+        targetX = _mm_mul_ps(targetX, invDistance);
+        targetY = _mm_mul_ps(targetY, invDistance);
+        targetZ = _mm_mul_ps(targetZ, invDistance);
+
+        const __m128 directionX = _mm_loadu_ps(&missiles.directionsX[i]);
+        const __m128 directionY = _mm_loadu_ps(&missiles.directionsY[i]);
+        const __m128 directionZ = _mm_loadu_ps(&missiles.directionsZ[i]);
+        const __m128 cosAngle = _mm_add_ps(
+            _mm_add_ps(_mm_mul_ps(directionX, targetX), _mm_mul_ps(directionY, targetY)),
+            _mm_mul_ps(directionZ, targetZ));
+
+        const __m128 turnedX = _mm_add_ps(directionX, _mm_mul_ps(_mm_sub_ps(targetX, directionX), lerp));
+        const __m128 turnedY = _mm_add_ps(directionY, _mm_mul_ps(_mm_sub_ps(targetY, directionY), lerp));
+        const __m128 turnedZ = _mm_add_ps(directionZ, _mm_mul_ps(_mm_sub_ps(targetZ, directionZ), lerp));
+        const __m128 sqrTurnedLength = _mm_add_ps(
+            _mm_add_ps(_mm_mul_ps(turnedX, turnedX), _mm_mul_ps(turnedY, turnedY)),
+            _mm_mul_ps(turnedZ, turnedZ));
+        const __m128 invTurnedLength = _mm_div_ps(one, _mm_sqrt_ps(sqrTurnedLength));
+
+        const __m128 hasTurned = _mm_and_ps(_mm_cmpgt_ps(cosAngle, cosMax), _mm_cmpgt_ps(sqrTurnedLength, zero));
+        const __m128 newDirectionX = Select(hasTurned, _mm_mul_ps(turnedX, invTurnedLength), directionX);
+        const __m128 newDirectionY = Select(hasTurned, _mm_mul_ps(turnedY, invTurnedLength), directionY);
+        const __m128 newDirectionZ = Select(hasTurned, _mm_mul_ps(turnedZ, invTurnedLength), directionZ);
+        _mm_storeu_ps(&missiles.directionsX[i], newDirectionX);
+        _mm_storeu_ps(&missiles.directionsY[i], newDirectionY);
+        _mm_storeu_ps(&missiles.directionsZ[i], newDirectionZ);
+
+        const __m128 speed = _mm_loadu_ps(&missiles.speeds[i]);
+        _mm_storeu_ps(&missiles.velocitiesX[i], _mm_mul_ps(newDirectionX, speed));
+        _mm_storeu_ps(&missiles.velocitiesY[i], _mm_mul_ps(newDirectionY, speed));
+        _mm_storeu_ps(&missiles.velocitiesZ[i], _mm_mul_ps(newDirectionZ, speed));
+
+        _mm_storeu_ps(&missiles.lifeTimes[i], _mm_max_ps(_mm_sub_ps(_mm_loadu_ps(&missiles.lifeTimes[i]), dt), zero));
+
+        const int turnedMask = _mm_movemask_ps(hasTurned);
+        for (int lane = 0; lane < 4; lane++) { missiles.hasTurned[i + lane] = static_cast<uint8_t>(turnedMask >> lane & 1); }
+    }
+#endif
+    for (; i < end; i++) {
+        float targetX = missiles.targetsX[i] - missiles.positionsX[i];
+        float targetY = missiles.targetsY[i] - missiles.positionsY[i];
+        float targetZ = missiles.targetsZ[i] - missiles.positionsZ[i];
+        const float sqrDistance = targetX * targetX + targetY * targetY + targetZ * targetZ;
+        const float invDistance = sqrDistance > 0.0f ? 1.0f / std::sqrt(sqrDistance) : 0.0f;
+        targetX *= invDistance;
+        targetY *= invDistance;
+        targetZ *= invDistance;
+
+        const float directionX = missiles.directionsX[i];
+        const float directionY = missiles.directionsY[i];
+        const float directionZ = missiles.directionsZ[i];
+        const float cosAngle = directionX * targetX + directionY * targetY + directionZ * targetZ;
+
+        const float turnedX = directionX + (targetX - directionX) * lerpValue;
+        const float turnedY = directionY + (targetY - directionY) * lerpValue;
+        const float turnedZ = directionZ + (targetZ - directionZ) * lerpValue;
+        const float sqrTurnedLength = turnedX * turnedX + turnedY * turnedY + turnedZ * turnedZ;
+
+        const bool hasTurned = cosAngle > cosMaxAngle && sqrTurnedLength > 0.0f;
+        if (hasTurned) {
+            const float invTurnedLength = 1.0f / std::sqrt(sqrTurnedLength);
+            missiles.directionsX[i] = turnedX * invTurnedLength;
+            missiles.directionsY[i] = turnedY * invTurnedLength;
+            missiles.directionsZ[i] = turnedZ * invTurnedLength;
+        }
+        missiles.velocitiesX[i] = missiles.directionsX[i] * missiles.speeds[i];
+        missiles.velocitiesY[i] = missiles.directionsY[i] * missiles.speeds[i];
+        missiles.velocitiesZ[i] = missiles.directionsZ[i] * missiles.speeds[i];
+
+        missiles.lifeTimes[i] = std::max(missiles.lifeTimes[i] - deltaTime, 0.0f);
+        missiles.hasTurned[i] = hasTurned ? 1 : 0;
+    }
+
+    //Only the missiles that turned need a new rotation
+    for (i = begin; i < end; i++) {
+        if (!missiles.hasTurned[i]) { continue; }
+
+        missiles.rotations[i] = math::Quaternion::FromToRotation(
+            math::Vec3(0, 0, 1),
+            math::Vec3(missiles.directionsX[i], missiles.directionsY[i], missiles.directionsZ[i]));
+    }
+}
+} //namespace missile_kernels
+} //namespace game
+} //namespace poke
@@ -1,5 +1,8 @@
 #include <Game/missiles_system.h>
 
+#include <algorithm>
+#include <cmath>
+
 #include <Ecs/core_ecs_manager.h>
 #include <Utility/time_custom.h>
 #include <CoreEngine/engine.h>
@@ -15,7 +18,8 @@ MissilesSystem::MissilesSystem(Engine& engine, Game& game) :
 	missilesManager_(ecsManager_.GetComponentsManager<MissilesManager>()),
 	destructibleElementManager_(ecsManager_.GetComponentsManager<DestructibleElementManager>()),
 	particleSystemsManager_(ecsManager_.GetComponentsManager<ecs::ParticleSystemsManager>()),
-	gamePrefabsManager_(static_cast<GamePrefabsManager&>(PrefabsManagerLocator::Get()))
+	gamePrefabsManager_(static_cast<GamePrefabsManager&>(PrefabsManagerLocator::Get())),
+	jobPool_(engine.GetJobPool())
 {
 	game.RegisterObserverUpdate([this] { this->OnUpdate(); });
 	
@@ -31,100 +35,140 @@ MissilesSystem::MissilesSystem(Engine& engine, Game& game) :
 		[this](ecs::EntityIndex entityIndex, ecs::ComponentMask componentMask)
 	    {this->OnEntityRemoveComponent(entityIndex, componentMask); }
 	);
-
-	missiles_.resize(kMaxMissileNb_);
-	rigidbodies_.resize(kMaxMissileNb_);
-	transforms_.resize(kMaxMissileNb_);
-	missileTargetDirections_.resize(kMaxMissileNb_);
 }
 
 void MissilesSystem::OnLoadScene() {
-	gamePrefabsManager_.AddPrefab("ParticleMissile");
+	destroyedMissiles_.clear();
+	gamePrefabsManager_.AddPrefabPool(
+		"ParticleMissile",
+		static_cast<size_t>(std::ceil(kMaxExplosionsPerSecond_ * kParticleTime_)));
 }
 
 void MissilesSystem::OnUpdate() {
 	pok_BeginProfiling(Missile_System, 0);
-	flagEndData_ = entityIndexes_.size();
+	auto missiles = missilesManager_.GetComponentsView();
+	auto rigidbodies = rigidbodyManager_.GetComponentsView();
+	const float deltaTime = static_cast<float>(Time::Get().deltaTime.count() / 1000.0);
 
-    //Get missiles
-	for (size_t index = 0; index < flagEndData_; index++) {
-		missiles_[index] = missilesManager_.GetComponent(entityIndexes_[index]);
+	//The missiles waiting to be shot are moved in the hierarchy, they stay out of the batch
+	batchEntities_.clear();
+	for (const ecs::EntityIndex entityIndex : entityIndexes_) {
+		Missile& missile = missiles[entityIndex];
+		if (!missile.hasBeenShot) {
+			missile.shootDelay -= deltaTime;
+			if (missile.shootDelay > 0.0f) { continue; }
+
+			math::Transform transform = transformsManager_.GetComponent(entityIndex);
+			const math::Vec3 worldPos = transformsManager_.GetWorldPosition(entityIndex);
+			transformsManager_.SetParent(entityIndex, -1);
+			transform.SetLocalPosition(worldPos);
+			transform.SetLocalScale({0.02f, 0.02f, 0.02f});
+			transformsManager_.SetComponent(entityIndex, transform);
+			missile.hasBeenShot = true;
+		} else if (missile.lifeTime <= 0.0f) {
+			//Exploded, it is already waiting to be destroyed
+			continue;
+		}
+		batchEntities_.push_back(entityIndex);
 	}
 
-	for (size_t index = 0; index < flagEndData_; index++) {
-		rigidbodies_[index] = rigidbodyManager_.GetComponent(entityIndexes_[index]);
-	}
+	batch_.Resize(batchEntities_.size());
+	ecs::EntityIndex lastTarget = ecs::kNoEntity;
+	math::Vec3 lastTargetPosition;
+	for (size_t index = 0; index < batchEntities_.size(); index++) {
+		const Missile& missile = missiles[batchEntities_[index]];
+
+		//The missiles shot have no parent, their local position is their world position
+		const math::Vec3 position = transformsManager_.GetComponent(batchEntities_[index]).GetLocalPosition();
+
+		//The missiles of a salvo follow each other and share their target
+		math::Vec3 targetPosition = position;
+		if (missile.target != ecs::kNoEntity) {
+			if (missile.target != lastTarget) {
+				lastTarget = missile.target;
+				lastTargetPosition = transformsManager_.GetWorldPosition(missile.target);
+			}
+			targetPosition = lastTargetPosition;
+		}
 
-	for (size_t index = 0; index < flagEndData_; index++) {
-		transforms_[index] = transformsManager_.GetComponent(entityIndexes_[index]);
+		batch_.positionsX[index] = position.x;
+		batch_.positionsY[index] = position.y;
+		batch_.positionsZ[index] = position.z;
+		batch_.targetsX[index] = targetPosition.x;
+		batch_.targetsY[index] = targetPosition.y;
+		batch_.targetsZ[index] = targetPosition.z;
+		batch_.directionsX[index] = missile.direction.x;
+		batch_.directionsY[index] = missile.direction.y;
+		batch_.directionsZ[index] = missile.direction.z;
+		batch_.speeds[index] = missile.speed;
+		batch_.lifeTimes[index] = missile.lifeTime;
 	}
 
-	for (size_t index = 0; index < flagEndData_; index++) {
-		missileTargetDirections_[index] =
-			(transformsManager_.GetWorldPosition(missiles_[index].target)
-				- transforms_[index].GetLocalPosition()).Normalize();
-	}
+	UpdateMissilesBatch(deltaTime);
 
-	std::vector<ecs::EntityIndex> deactivatedEntities;
-	const float deltaTime = static_cast<float>(Time::Get().deltaTime.count() / 1000.0);
-    for (size_t index = 0; index < flagEndData_; index++) {
-		const ecs::EntityIndex entityIndex = entityIndexes_[index];
-
-		if(!missiles_[index].hasBeenShot) {
-			missiles_[index].shootDelay -= deltaTime;
-
-			if (missiles_[index].shootDelay <= 0.0f) {
-				const math::Vec3 worldPos = transformsManager_.GetWorldPosition(entityIndex);
-				transformsManager_.SetParent(entityIndex, -1);
-				transforms_[index].SetLocalPosition(worldPos);
-				transforms_[index].SetLocalScale({0.02f, 0.02f, 0.02f});
-				missiles_[index].hasBeenShot = true;
-			}
-			else
-				continue;
-		}
-    	
-		if (IsInFieldOfAim(missiles_[index].direction, missileTargetDirections_[index], kMaxAngle_)) {
-			missiles_[index].direction = 
-				(missiles_[index].direction +
-				(missileTargetDirections_[index] - missiles_[index].direction) * kLerpValue_
-					).Normalize();
-
-			transforms_[index].SetLocalRotation(
-				//Look at
-				math::Quaternion::FromToRotation(
-					math::Vec3(0, 0, 1),
-					missiles_[index].direction
-				).GetEulerAngles()
-			);
+	for (size_t index = 0; index < batchEntities_.size(); index++) {
+		const ecs::EntityIndex entityIndex = batchEntities_[index];
+		Missile& missile = missiles[entityIndex];
+		missile.direction = math::Vec3(batch_.directionsX[index], batch_.directionsY[index], batch_.directionsZ[index]);
+		missile.lifeTime = batch_.lifeTimes[index];
+		rigidbodies[entityIndex].linearVelocity =
+			math::Vec3(batch_.velocitiesX[index], batch_.velocitiesY[index], batch_.velocitiesZ[index]);
+
+		if (batch_.hasTurned[index]) {
+			math::Transform transform = transformsManager_.GetComponent(entityIndex);
+			transform.SetLocalOrientation(batch_.rotations[index]);
+			transformsManager_.SetComponent(entityIndex, transform);
 		}
 
-		rigidbodies_[index].linearVelocity = missiles_[index].direction * missiles_[index].speed;
-    	
-		missiles_[index].lifeTime -= deltaTime;
+		if (missile.lifeTime <= 0.0f) { destroyedMissiles_.push_back(entityIndex); }
+	}
 
-        if(missiles_[index].lifeTime <= 0) {
-			missiles_[index].lifeTime = 0;
-			deactivatedEntities.push_back(entityIndexes_[index]);
-        }
-    }
+	DestroyMissiles();
+	pok_EndProfiling(Missile_System);
+}
 
-	for (size_t index = 0; index < flagEndData_; index++) {
-		rigidbodyManager_.SetComponent(entityIndexes_[index], rigidbodies_[index]);
+void MissilesSystem::UpdateMissilesBatch(const float deltaTime) {
+	const float cosMaxAngle = std::cos(kMaxAngle_ * math::kDeg2Rad);
+	const size_t missilesCount = batch_.GetSize();
+	const size_t rangesCount = std::min(
+		jobPool_.GetWorkerCount() + 1,
+		std::max(static_cast<size_t>(1), missilesCount / kMinMissilesPerRange));
+	const size_t missilesPerRange = (missilesCount + rangesCount - 1) / rangesCount;
+
+	for (size_t range = 1; range < rangesCount; range++) {
+		const size_t begin = range * missilesPerRange;
+		const size_t end = std::min(begin + missilesPerRange, missilesCount);
+		jobPool_.GetWorker(range - 1).DoAsync([this, begin, end, deltaTime, cosMaxAngle]() {
+			pok_BeginProfiling(Missile_System_Worker, 0);
+			missile_kernels::UpdateMissiles(batch_, begin, end, deltaTime, cosMaxAngle, kLerpValue_);
+			pok_EndProfiling(Missile_System_Worker);
+		});
 	}
 
-	for (size_t index = 0; index < flagEndData_; index++) {
-		missilesManager_.SetComponent(entityIndexes_[index], missiles_[index]);
-	}
+	missile_kernels::UpdateMissiles(
+		batch_,
+		0,
+		std::min(missilesPerRange, missilesCount),
+		deltaTime,
+		cosMaxAngle,
+		kLerpValue_);
 
-	for (size_t index = 0; index < flagEndData_; index++) {
-		transformsManager_.SetComponent(entityIndexes_[index], transforms_[index]);
+	for (size_t range = 1; range < rangesCount; range++) {
+		jobPool_.GetWorker(range - 1).Wait();
 	}
+}
+
+void MissilesSystem::DestroyMissiles() {
+	//A missile can explode and run out of life time in the same frame
+	std::sort(destroyedMissiles_.begin(), destroyedMissiles_.end());
+	destroyedMissiles_.erase(
+		std::unique(destroyedMissiles_.begin(), destroyedMissiles_.end()),
+		destroyedMissiles_.end());
 
-	for (ecs::EntityIndex entityIndex : deactivatedEntities) {
+	for (const ecs::EntityIndex entityIndex : destroyedMissiles_) {
 		ecsManager_.DestroyEntity(entityIndex);
 	}
-	pok_EndProfiling(Missile_System);
+	destroyedMissiles_.clear();
 }
 
 void MissilesSystem::OnEntitySetActive(const ecs::EntityIndex entityIndex) {
@@ -202,6 +246,9 @@ void MissilesSystem::OnEntityRemoveComponent(
 }
 
 void MissilesSystem::OnTriggerEnter(const ecs::EntityIndex entityIndex, const physics::Collision collision) {
+	//Already exploded, it is destroyed at the next update
+	if (std::find(destroyedMissiles_.begin(), destroyedMissiles_.end(), entityIndex) != destroyedMissiles_.end()) { return; }
+
 	if (ecsManager_.HasComponent(collision.otherEntity, ecs::ComponentType::DESTRUCTIBLE_ELEMENT)) {
 		DestructibleElement destructibleElement = destructibleElementManager_.GetComponent(collision.otherEntity);
 		Missile missile = missilesManager_.GetComponent(entityIndex);
@@ -233,28 +280,7 @@ void MissilesSystem::MissileExplosion(const ecs::EntityIndex entityIndex) {
 
 	ecsManager_.DestroyEntity(particleIndex, kParticleTime_);
 
-	ecsManager_.DestroyEntity(entityIndex);
-}
-
-bool MissilesSystem::IsInFieldOfAim(
-	const math::Vec3 missileDirection,
-	const math::Vec3 targetDirection,
-	const float maxAngle) const
-{
-	const math::Vec3 mdNormalized = missileDirection.Normalize(); 
-	const math::Vec3 tdNormalized = targetDirection.Normalize();
-
-	float angleBetween = atan2(math::Vec3::Cross(mdNormalized, tdNormalized).GetMagnitude(), mdNormalized * tdNormalized);
-
-	angleBetween = angleBetween * math::kRad2Deg;
-
-	//inversion of the angle
-	if (angleBetween > 180.0f) {
-		angleBetween = (angleBetween - 360.0f) * -1.0f;  
-	}
-
-	// return true if the angle is less wider than the max angle
-	return angleBetween < maxAngle;
+	destroyedMissiles_.push_back(entityIndex);
 }
 }//namespace game  
 }//namespace poke
@@ -32,13 +32,14 @@ PlayerController::PlayerController(Engine& engine, Game& game)
 
 void PlayerController::OnLoadScene()
 {
-	gamePrefabsManager_.AddPrefab("ParticleFire");
-	gamePrefabsManager_.AddPrefab("ParticleExplo");
+	//One fire for each damage area and the explosion, instantiated when the player is hit
+	gamePrefabsManager_.AddPrefabPool("ParticleFire", 3);
+	gamePrefabsManager_.AddPrefabPool("ParticleExplo", 1);
 
 	if (!archetypeAlreadyLoad_) {
 		archetypeTarget_ = reinterpret_cast<const GameArchetype&>(
 			PrefabsManagerLocator::Get().GetPrefab(kTargetPrefabName_).GetObject(0));
-		archetypeTarget_.transform.SetLocalPosition({ 1000000 });
+		archetypeTarget_.EmplaceComponent<math::Transform>(ecs::ComponentType::TRANSFORM).SetLocalPosition({ 1000000 });
 		ArchetypesManagerLocator::Get().AddArchetype(archetypeTarget_, kTargetPrefabName_, kTargetNb_);
 		targetId_ = ArchetypesManagerLocator::Get().GetArchetypeID(kTargetPrefabName_);
 		archetypeAlreadyLoad_ = true;
@@ -628,10 +629,10 @@ void PlayerController::IncreaseSpecialCapacity(const ecs::EntityIndex entityInde
 					const ecs::EntityIndex targetSight = ecsManager_.AddEntity(targetId_);
 					ecsManager_.SetEntityVisible(targetSight, ecs::EntityStatus::ACTIVE);
 					math::Transform targetSightTransform = transformsManager_.GetComponent(targetSight);
-					targetSightTransform.SetLocalRotation(
+					targetSightTransform.SetLocalOrientation(
 						math::Quaternion::LookRotation(
 							CameraLocator::Get().GetFront(),
-							CameraLocator::Get().GetUp()).GetEulerAngles());
+							CameraLocator::Get().GetUp()));
 					targetSightTransform.SetLocalPosition(visibleEntityPosition);
 					targetSightTransform.SetLocalScale({ 10.0f });
 					transformsManager_.SetComponent(targetSight, targetSightTransform);
@@ -1,6 +1,7 @@
 #include <Game/projectile_system.h>
 
 #include <algorithm>
+#include <cmath>
 
 #include <Utility/log.h>
 #include <Utility/profiler.h>
@@ -40,24 +41,30 @@ ProjectileSystem::ProjectileSystem(Engine& engine, Game& game)
 }
 
 void ProjectileSystem::OnLoadScene() {
-	gamePrefabsManager_.AddPrefab("ParticleProj");
+	destroyedProjectiles_.clear();
+	//An impact particle is alive during kParticleTime_
+	gamePrefabsManager_.AddPrefabPool(
+		"ParticleProj",
+		static_cast<size_t>(std::ceil(kMaxImpactsPerSecond_ * kParticleTime_)));
 }
 
 void ProjectileSystem::OnUpdate() {
 	pok_BeginProfiling(Projectile_System, 0);
-	std::vector<ecs::EntityIndex> entitiesToDestroy;
+	const auto projectiles = projectileManager_.GetComponentsView();
+	const float time = time_.GetTime();
     for(const ecs::EntityIndex projectileIndex : entityIndexes_) {
-		const Projectile projectile = projectileManager_.GetComponent(projectileIndex);
+		const Projectile& projectile = projectiles[projectileIndex];
 
-		if (time_.GetTime() >= projectile.shootAtTime + projectile.durationLifeTime) {
-			entitiesToDestroy.emplace_back(projectileIndex);
+		if (time >= projectile.shootAtTime + projectile.durationLifeTime && !IsDestroyed(projectileIndex)) {
+			DestroyProjectile(projectileIndex);
 		}
     }
 
-    for (auto toDestroy : entitiesToDestroy) {
-		DestroyProjectile(toDestroy);
+	//Destroyed once the loop over the projectiles is done
+    for (const ecs::EntityIndex projectileIndex : destroyedProjectiles_) {
+		ecsManager_.DestroyEntity(projectileIndex);
     }
-	entitiesToDestroy.clear();
+	destroyedProjectiles_.clear();
 	pok_EndProfiling(Projectile_System);
 }
 
@@ -104,6 +111,9 @@ void ProjectileSystem::OnRemoveComponent(
 }
 
 void ProjectileSystem::OnTriggerEnter(const ecs::EntityIndex entityIndex, const physics::Collision collision) {
+	//Already hit, it is destroyed at the next update
+	if (IsDestroyed(entityIndex)) { return; }
+
 	if (ecsManager_.HasComponent(collision.otherEntity, ecs::ComponentType::DESTRUCTIBLE_ELEMENT)) {
 		Projectile projectile = projectileManager_.GetComponent(entityIndex);
 		DestructibleElement destructibleElement = destructibleElementManager_.GetComponent(collision.otherEntity);
@@ -140,7 +150,11 @@ void ProjectileSystem::DestroyProjectile(
 	rigidbodyManager_.SetComponent(entityIndex, rigidbody);
 	
 	ecsManager_.DestroyEntity(particleIndex, kParticleTime_);
-	ecsManager_.DestroyEntity(entityIndex);
+	destroyedProjectiles_.push_back(entityIndex);
+}
+
+bool ProjectileSystem::IsDestroyed(const ecs::EntityIndex entityIndex) const {
+	return std::find(destroyedProjectiles_.begin(), destroyedProjectiles_.end(), entityIndex) != destroyedProjectiles_.end();
 }
 
 
@@ -0,0 +1,191 @@
+#include <Game/spatial_hash.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include <Math/math.h>
+
+namespace poke {
+namespace game {
+namespace {
+const size_t kMinBucketNb = 64;
+
+//Positions far from the level, like the pooled entities, are kept in the range of the cells
+const float kMaxCellCoordinate = static_cast<float>(1 << 30);
+
+int GetCellCoordinate(const float coordinate, const float inverseCellSize)
+{
+    const float cellCoordinate = std::max(std::min(coordinate * inverseCellSize, kMaxCellCoordinate), -kMaxCellCoordinate);
+
+    //Floor without std::floor, it isn't inlined by every compiler
+    const int truncatedCoordinate = static_cast<int>(cellCoordinate);
+    return truncatedCoordinate - (cellCoordinate < static_cast<float>(truncatedCoordinate) ? 1 : 0);
+}
+} //namespace
+
+SpatialHash::SpatialHash(const float cellSize) : inverseCellSize_(1.0f / cellSize) {}
+
+void SpatialHash::Clear()
+{
+    entries_.clear();
+    bucketStarts_.clear();
+}
+
+void SpatialHash::Insert(const ecs::EntityIndex entityIndex, const math::Vec3 position)
+{
+    entries_.push_back(Entry{ entityIndex, position });
+}
+
+void SpatialHash::Build()
+{
+    size_t bucketNb = kMinBucketNb;
+    while (bucketNb < entries_.size()) { bucketNb <<= 1; }
+
+    //Count then fill backward, bucketStarts_[i] ends at the start of the bucket i
+    bucketStarts_.assign(bucketNb + 1, 0);
+    entryCells_.resize(entries_.size());
+    entryBuckets_.resize(entries_.size());
+    for (size_t i = 0; i < entries_.size(); i++) {
+        entryCells_[i] = GetCell(entries_[i].position);
+        entryBuckets_[i] = GetBucketIndex(entryCells_[i]);
+        bucketStarts_[entryBuckets_[i]]++;
+    }
+    for (size_t i = 1; i < bucketStarts_.size(); i++) { bucketStarts_[i] += bucketStarts_[i - 1]; }
+
+    sortedEntries_.resize(entries_.size());
+    sortedEntryCells_.resize(entries_.size());
+    for (size_t i = entries_.size(); i > 0; i--) {
+        const uint32_t sortedIndex = --bucketStarts_[entryBuckets_[i - 1]];
+        sortedEntries_[sortedIndex] = entries_[i - 1];
+        sortedEntryCells_[sortedIndex] = entryCells_[i - 1];
+    }
+
+    entries_.swap(sortedEntries_);
+    entryCells_.swap(sortedEntryCells_);
+}
+
+template<typename Function>
+void SpatialHash::ForEachInBounds(const math::Vec3 min, const math::Vec3 max, Function function) const
+{
+    if (bucketStarts_.empty()) { return; }
+
+    const Cell minCell = GetCell(min);
+    const Cell maxCell = GetCell(max);
+    double cellNb = 1;
+    for (int i = 0; i < 3; i++) { cellNb *= static_cast<double>(maxCell[i]) - minCell[i] + 1; }
+
+    //Wide bounds have more cells than entities
+    if (cellNb > static_cast<double>(entries_.size())) {
+        for (const Entry& entry : entries_) {
+            if (entry.position.x >= min.x && entry.position.x <= max.x &&
+                entry.position.y >= min.y && entry.position.y <= max.y &&
+                entry.position.z >= min.z && entry.position.z <= max.z) {
+                function(entry);
+            }
+        }
+        return;
+    }
+
+    //Cells sharing a bucket are told apart by the cell of each entity
+    Cell cell;
+    for (cell[0] = minCell[0]; cell[0] <= maxCell[0]; cell[0]++) {
+        for (cell[1] = minCell[1]; cell[1] <= maxCell[1]; cell[1]++) {
+            for (cell[2] = minCell[2]; cell[2] <= maxCell[2]; cell[2]++) {
+                const uint32_t bucketIndex = GetBucketIndex(cell);
+                for (uint32_t i = bucketStarts_[bucketIndex]; i < bucketStarts_[bucketIndex + 1]; i++) {
+                    if (entryCells_[i] == cell) { function(entries_[i]); }
+                }
+            }
+        }
+    }
+}
+
+void SpatialHash::QueryRadius(const math::Vec3 center, const float radius, std::vector<Entry>& results) const
+{
+    results.clear();
+
+    const float sqrRadius = radius * radius;
+    const math::Vec3 extent(radius, radius, radius);
+    ForEachInBounds(center - extent, center + extent, [&](const Entry& entry) {
+        const math::Vec3 toEntry = entry.position - center;
+        if (toEntry * toEntry <= sqrRadius) { results.push_back(entry); }
+    });
+}
+
+void SpatialHash::QueryCone(
+    const math::Vec3 origin,
+    const math::Vec3 direction,
+    const float maxAngle,
+    const float maxDistance,
+    std::vector<Entry>& results) const
+{
+    results.clear();
+
+    const math::Vec3 axis = direction.Normalize();
+    const float cosAngle = std::cos(maxAngle * math::kDeg2Rad);
+    const float sqrCosAngle = cosAngle * cosAngle;
+    const float sqrMaxDistance = maxDistance * maxDistance;
+
+    //Bounds of the origin and of the disc at the end of the cone
+    const math::Vec3 end = origin + axis * maxDistance;
+    const float endRadius = maxDistance * std::tan(maxAngle * math::kDeg2Rad);
+    math::Vec3 min;
+    math::Vec3 max;
+    for (int i = 0; i < 3; i++) {
+        min[i] = std::min(origin[i], end[i]) - endRadius;
+        max[i] = std::max(origin[i], end[i]) + endRadius;
+    }
+
+    //The angle is compared through its squared cosine, without normalizing each direction
+    ForEachInBounds(min, max, [&](const Entry& entry) {
+        const math::Vec3 toEntry = entry.position - origin;
+        const float sqrDistance = toEntry * toEntry;
+        if (sqrDistance > sqrMaxDistance) { return; }
+
+        const float projection = toEntry * axis;
+        if (sqrDistance == 0.0f ||
+            (projection > 0.0f && projection * projection >= sqrCosAngle * sqrDistance)) {
+            results.push_back(entry);
+        }
+    });
+}
+
+void SpatialHash::QueryNearest(
+    const math::Vec3 position,
+    const size_t count,
+    const float maxDistance,
+    std::vector<Entry>& results) const
+{
+    QueryRadius(position, maxDistance, results);
+
+    const auto isCloser = [position](const Entry& left, const Entry& right) {
+        const math::Vec3 toLeft = left.position - position;
+        const math::Vec3 toRight = right.position - position;
+        return toLeft * toLeft < toRight * toRight;
+    };
+    if (results.size() > count) {
+        std::partial_sort(results.begin(), results.begin() + count, results.end(), isCloser);
+        results.resize(count);
+    } else {
+        std::sort(results.begin(), results.end(), isCloser);
+    }
+}
+
+SpatialHash::Cell SpatialHash::GetCell(const math::Vec3 position) const
+{
+    return Cell{
+        GetCellCoordinate(position.x, inverseCellSize_),
+        GetCellCoordinate(position.y, inverseCellSize_),
+        GetCellCoordinate(position.z, inverseCellSize_) };
+}
+
+uint32_t SpatialHash::GetBucketIndex(const Cell& cell) const
+{
+    const uint32_t hash =
+        static_cast<uint32_t>(cell[0]) * 73856093u ^
+        static_cast<uint32_t>(cell[1]) * 19349663u ^
+        static_cast<uint32_t>(cell[2]) * 83492791u;
+    return hash & static_cast<uint32_t>(bucketStarts_.size() - 2);
+}
+} //namespace game
+} //namespace poke
@@ -65,19 +65,19 @@ void WeaponSystem::OnLoadScene() {
 	    //TODO (@Robin) if the vertical slice can't load with this method to get the value of each prefab, Create the projectile and missile by hand for all four
 	    archetypeMissilePlayer_ = reinterpret_cast<const GameArchetype&>(
 		    PrefabsManagerLocator::Get().GetPrefab(kMissilePlayerName_).GetObject(0));
-		archetypeMissilePlayer_.transform.SetLocalPosition({ 1000000 });
+		archetypeMissilePlayer_.EmplaceComponent<math::Transform>(ecs::ComponentType::TRANSFORM).SetLocalPosition({ 1000000 });
     	
 	    archetypeMissile_ = reinterpret_cast<const GameArchetype&>(
 		    PrefabsManagerLocator::Get().GetPrefab(kMissileName_).GetObject(0));
-		archetypeMissile_.transform.SetLocalPosition({ 1000000 });
+		archetypeMissile_.EmplaceComponent<math::Transform>(ecs::ComponentType::TRANSFORM).SetLocalPosition({ 1000000 });
 
 	    archetypeProjectilePlayer_ = reinterpret_cast<const GameArchetype&>(
 		    PrefabsManagerLocator::Get().GetPrefab(kProjectilePlayerName_).GetObject(0));
-		archetypeProjectilePlayer_.transform.SetLocalPosition({ 1000000 });
+		archetypeProjectilePlayer_.EmplaceComponent<math::Transform>(ecs::ComponentType::TRANSFORM).SetLocalPosition({ 1000000 });
 
 	    archetypeProjectile_ = reinterpret_cast<const GameArchetype&>(
 		    PrefabsManagerLocator::Get().GetPrefab(kProjectileName_).GetObject(0));
-		archetypeProjectile_.transform.SetLocalPosition({ 1000000 });
+		archetypeProjectile_.EmplaceComponent<math::Transform>(ecs::ComponentType::TRANSFORM).SetLocalPosition({ 1000000 });
 	    //End part to replace if trouble
 
 	    ArchetypesManagerLocator::Get().AddArchetype(archetypeMissilePlayer_, kMissilePlayerName_, kMissilePlayerNb_);
@@ -146,7 +146,7 @@ void WeaponSystem::ShootProjectile(const ecs::EntityIndex entityIndex) {
 	math::Transform currentGunLocalPosition;
 	math::Vec3 currentProjectileScale = transformsManager_.GetComponent(projectileIndex).GetLocalScale();
 	currentGunWorldPosition.SetLocalPosition(transformsManager_.GetWorldPosition(weapon.gunPositions[weapon.activeGunID]));
-	currentGunWorldPosition.SetLocalRotation(transformsManager_.GetWorldRotation(weapon.gunPositions[weapon.activeGunID]));
+	currentGunWorldPosition.SetLocalOrientation(transformsManager_.GetWorldOrientation(weapon.gunPositions[weapon.activeGunID]));
 	currentGunWorldPosition.SetLocalScale(currentProjectileScale);
 	currentGunLocalPosition.SetLocalPosition(transformsManager_.GetComponent(weapon.gunPositions[weapon.activeGunID]).GetLocalPosition());
 	transformsManager_.SetComponent(projectileIndex, currentGunWorldPosition);
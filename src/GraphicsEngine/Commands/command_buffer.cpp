@@ -51,6 +51,21 @@ void CommandBuffer::Begin(const VkCommandBufferUsageFlags usage)
     running_ = true;
 }
 
+void CommandBuffer::Begin(
+    const VkCommandBufferInheritanceInfo& inheritanceInfo,
+    const VkCommandBufferUsageFlags usage)
+{
+    if (running_) { return; }
+    VkCommandBufferBeginInfo beginInfo = {};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags = usage;
+    beginInfo.pInheritanceInfo = &inheritanceInfo;
+
+    CheckVk(vkBeginCommandBuffer(commandBuffer_, &beginInfo));
+
+    running_ = true;
+}
+
 void CommandBuffer::End()
 {
     if (!running_) { return; }
@@ -0,0 +1,62 @@
+#include <GraphicsEngine/Commands/record_job.h>
+
+#include <algorithm>
+
+namespace poke {
+namespace graphics {
+uint32_t ComputeRecordWorkerCount(const uint32_t hardwareConcurrency)
+{
+    //Keep half of the cores for the main and render threads
+    return std::clamp(hardwareConcurrency / 2, 1u, kMaxRecordWorkers);
+}
+
+VkViewport ComputeViewport(const math::Vec2Int& size)
+{
+    VkViewport viewport;
+    viewport.x = 0.0f;
+    viewport.y = static_cast<float>(size.y);
+    viewport.width = static_cast<float>(size.x);
+    viewport.height = -static_cast<float>(size.y);
+    viewport.minDepth = 0.0f;
+    viewport.maxDepth = 1.0f;
+
+    return viewport;
+}
+
+VkRect2D ComputeScissor(const math::Vec2Int& size)
+{
+    VkRect2D scissor = {};
+    scissor.offset = {0, 0};
+    scissor.extent = {
+        static_cast<uint32_t>(size.x),
+        static_cast<uint32_t>(size.y)
+    };
+
+    return scissor;
+}
+
+RecordJob CreateRecordJob(
+    const Pipeline::Stage& stage,
+    const int subrendererIndex,
+    const uint32_t slot,
+    const uint32_t workerCount,
+    const RecordJobTarget& target)
+{
+    RecordJob job;
+    job.stage = stage;
+    job.subrendererIndex = subrendererIndex;
+    job.slot = slot;
+    job.workerIndex = slot % std::max(workerCount, 1u);
+
+    job.inheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+    job.inheritanceInfo.renderPass = target.renderPass;
+    job.inheritanceInfo.subpass = stage.second;
+    job.inheritanceInfo.framebuffer = target.framebuffer;
+
+    job.viewport = ComputeViewport(target.size);
+    job.scissor = ComputeScissor(target.size);
+
+    return job;
+}
+} //namespace graphics
+} //namespace poke
@@ -54,11 +54,7 @@ void GizmoCommandBuffer::DrawLine(const math::Vec3 start, const math::Vec3 end)
 	auto p2 = end - start;
 	p2 = p2.Normalize();
 
-	const math::Quaternion quat = math::Quaternion::FromToRotation(p1, p2);
-    
-	const math::Vec3 rotation = quat.GetEulerAngles();
-
-	transform.SetLocalRotation(rotation);
+	transform.SetLocalOrientation(math::Quaternion::FromToRotation(p1, p2));
 
 	const auto mat = transform.GetWorldMatrix();
 	AddCmdToDraw(mat, color_, GizmoType::LINE);
@@ -127,7 +127,7 @@ bool GizmoInstances::CmdRender(
         commandBuffer,
         kMesh_.GetIndexBuffer().GetBuffer(),
         0,
-        Mesh::GetIndexType());
+        kMesh_.GetIndexType());
     vkCmdDrawIndexed(
         commandBuffer,
         kMesh_.GetIndexCount(),
@@ -0,0 +1,152 @@
+#include <GraphicsEngine/Images/cooked_texture.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include <Math/hash.h>
+#include <Utility/file_system.h>
+
+namespace poke {
+namespace cooked_texture {
+uint64_t HashSource(const uint8_t* data, const size_t size)
+{
+	return XXH64(data, size, math::kHashSeed);
+}
+} //namespace cooked_texture
+
+namespace {
+using namespace cooked_texture;
+
+//A 32 bits extent can't have more levels
+const uint32_t kMaxMipCount = 32;
+
+size_t AlignDataSize(const size_t size)
+{
+	return (size + kDataAlignment - 1) & ~(kDataAlignment - 1);
+}
+
+bool IsDataInBounds(const uint64_t offset, const uint64_t size, const size_t dataSize)
+{
+	return offset % kDataAlignment == 0 && offset <= dataSize && size <= dataSize - offset;
+}
+} //namespace
+
+bool CookedTextureView::SetData(const uint8_t* data, const size_t size)
+{
+	data_ = nullptr;
+	header_ = nullptr;
+	mips_ = nullptr;
+
+	if (data == nullptr || size < sizeof(Header)) { return false; }
+
+	const Header* header = reinterpret_cast<const Header*>(data);
+	if (header->magic != kMagic || header->version != kVersion) { return false; }
+	if (header->width == 0 || header->height == 0) { return false; }
+	if (header->format > static_cast<uint32_t>(texture_compressor::TextureFormat::BC3)) { return false; }
+	if (header->mipCount == 0 || header->mipCount > kMaxMipCount) { return false; }
+	if (!IsDataInBounds(AlignDataSize(sizeof(Header)), uint64_t(header->mipCount) * sizeof(Mip), size)) { return false; }
+
+	const texture_compressor::TextureFormat format = static_cast<texture_compressor::TextureFormat>(header->format);
+	const Mip* mips = reinterpret_cast<const Mip*>(data + AlignDataSize(sizeof(Header)));
+	for (uint32_t i = 0; i < header->mipCount; i++) {
+		const Mip& mip = mips[i];
+		if (mip.width != std::max(header->width >> i, 1u) || mip.height != std::max(header->height >> i, 1u)) { return false; }
+		if (mip.size != texture_compressor::GetLevelSize(format, mip.width, mip.height)) { return false; }
+		if (!IsDataInBounds(mip.offset, mip.size, size)) { return false; }
+		if (i > 0 && mip.offset < mips[i - 1].offset + mips[i - 1].size) { return false; }
+	}
+
+	data_ = data;
+	header_ = header;
+	mips_ = mips;
+	return true;
+}
+
+bool CookedTextureView::IsUpToDate(const uint64_t sourceHash, const uint64_t sourceSize) const
+{
+	return IsValid() && header_->sourceHash == sourceHash && header_->sourceSize == sourceSize;
+}
+
+size_t CookedTextureView::GetMipsSize(const size_t mipCount) const
+{
+	return mips_[mipCount - 1].offset + mips_[mipCount - 1].size - mips_[0].offset;
+}
+
+bool CookedTextureFile::Open(const std::string& filePath)
+{
+	Close();
+	if (!file_.Open(filePath)) { return false; }
+
+	if (!view_.SetData(file_.GetData(), file_.GetSize())) {
+		file_.Close();
+		return false;
+	}
+	return true;
+}
+
+void CookedTextureFile::Close()
+{
+	view_ = CookedTextureView();
+	file_.Close();
+}
+
+std::vector<uint8_t> CookTexture(
+	const uint8_t* pixels,
+	const uint32_t width,
+	const uint32_t height,
+	const uint64_t sourceHash,
+	const uint64_t sourceSize)
+{
+	using namespace texture_compressor;
+
+	const std::vector<MipLevel> levels = GenerateMipChain(pixels, width, height);
+
+	TextureFormat format = HasAlpha(pixels, size_t(width) * height) ? TextureFormat::BC3 : TextureFormat::BC1;
+	std::vector<std::vector<uint8_t>> levelsData(levels.size());
+	levelsData[0] = CompressLevel(pixels, width, height, format);
+
+	//The full size level is the one seen the most, it decides for the whole chain
+	const std::vector<uint8_t> decompressedPixels = DecompressLevel(levelsData[0].data(), width, height, format);
+	if (ComputePsnr(pixels, decompressedPixels.data(), decompressedPixels.size()) < kMinCompressedPsnr) {
+		format = TextureFormat::RGBA8;
+		levelsData[0] = levels[0].pixels;
+	}
+	for (size_t i = 1; i < levels.size(); i++) {
+		levelsData[i] = CompressLevel(levels[i].pixels.data(), levels[i].width, levels[i].height, format);
+	}
+
+	Header header{};
+	header.magic = kMagic;
+	header.version = kVersion;
+	header.sourceHash = sourceHash;
+	header.sourceSize = sourceSize;
+	header.width = width;
+	header.height = height;
+	header.format = static_cast<uint32_t>(format);
+	header.mipCount = static_cast<uint32_t>(levels.size());
+
+	std::vector<Mip> mips(levels.size());
+	size_t offset = AlignDataSize(AlignDataSize(sizeof(Header)) + mips.size() * sizeof(Mip));
+	for (size_t i = 0; i < mips.size(); i++) {
+		mips[i].width = levels[i].width;
+		mips[i].height = levels[i].height;
+		mips[i].offset = offset;
+		mips[i].size = levelsData[i].size();
+		offset = AlignDataSize(offset + levelsData[i].size());
+	}
+
+	std::vector<uint8_t> bytes(offset, 0);
+	std::memcpy(bytes.data(), &header, sizeof(Header));
+	std::memcpy(bytes.data() + AlignDataSize(sizeof(Header)), mips.data(), mips.size() * sizeof(Mip));
+	for (size_t i = 0; i < mips.size(); i++) {
+		std::memcpy(bytes.data() + mips[i].offset, levelsData[i].data(), levelsData[i].size());
+	}
+	return bytes;
+}
+
+bool WriteCookedTexture(const std::vector<uint8_t>& bytes, const std::string& filePath)
+{
+	//The file can be mapped by another load of the same resource
+	return PokFileSystem::WriteFileAtomically(filePath, bytes.data(), bytes.size());
+}
+} //namespace poke
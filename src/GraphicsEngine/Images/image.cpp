@@ -81,32 +81,34 @@ LoadedImageInfos Image::LoadPixelsFromFile(const std::string& filename, const Fi
 {
     auto file = PokFileSystem::ReadFile(filename, fileType);
 
-    LoadedImageInfos loadedPixelInfo;
-
     cassert(!file.empty(), "image " << filename << " could not be loaded");
 
-    std::unique_ptr<uint8_t> stbiData =
-        std::unique_ptr<uint8_t>(
-            stbi_load_from_memory(
-                reinterpret_cast<stbi_uc const*>(file.data()),
-                static_cast<uint32_t>(file.size()),
-                reinterpret_cast<int32_t*>(&loadedPixelInfo.width),
-                reinterpret_cast<int32_t*>(&loadedPixelInfo.height),
-                reinterpret_cast<int32_t*>(&loadedPixelInfo.components),
-                STBI_rgb_alpha));
+    return LoadPixelsFromMemory(reinterpret_cast<const uint8_t*>(file.data()), file.size());
+}
 
+LoadedImageInfos Image::LoadPixelsFromMemory(const uint8_t* data, const size_t size)
+{
+    LoadedImageInfos loadedPixelInfo;
 
-    loadedPixelInfo.components = 4;
-    loadedPixelInfo.pixels.resize(
-        loadedPixelInfo.width * loadedPixelInfo.height
-        * loadedPixelInfo.components);
+    std::unique_ptr<stbi_uc, void(*)(void*)> stbiData(
+        stbi_load_from_memory(
+            data,
+            static_cast<int32_t>(size),
+            reinterpret_cast<int32_t*>(&loadedPixelInfo.width),
+            reinterpret_cast<int32_t*>(&loadedPixelInfo.height),
+            reinterpret_cast<int32_t*>(&loadedPixelInfo.components),
+            STBI_rgb_alpha),
+        stbi_image_free);
+
+    if (!stbiData) {
+        std::cout << "Unable to load image\n";
+        return LoadedImageInfos();
+    }
 
-    std::memcpy(
-        loadedPixelInfo.pixels.data(),
+    loadedPixelInfo.components = 4;
+    loadedPixelInfo.pixels.assign(
         stbiData.get(),
-        loadedPixelInfo.pixels.size());
-
-    if (loadedPixelInfo.pixels.empty()) { std::cout << "Unable to load image\n"; }
+        stbiData.get() + loadedPixelInfo.width * loadedPixelInfo.height * loadedPixelInfo.components);
 
     return loadedPixelInfo;
 }
@@ -581,6 +583,42 @@ void Image::CopyBufferToImage(
     commandBuffer.SubmitIdle();
 }
 
+void Image::CopyBufferToImageMips(
+    const VkBuffer& buffer,
+    const VkImage& image,
+    const VkExtent3D extent,
+    const std::vector<VkDeviceSize>& mipOffsets)
+{
+    auto commandBuffer = CommandBuffer();
+
+    std::vector<VkBufferImageCopy> regions(mipOffsets.size());
+    for (uint32_t i = 0; i < regions.size(); i++) {
+        VkBufferImageCopy& region = regions[i];
+        region.bufferOffset = mipOffsets[i];
+        region.bufferRowLength = 0;
+        region.bufferImageHeight = 0;
+        region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        region.imageSubresource.mipLevel = i;
+        region.imageSubresource.baseArrayLayer = 0;
+        region.imageSubresource.layerCount = 1;
+        region.imageOffset = {0, 0, 0};
+        region.imageExtent = {
+            std::max(extent.width >> i, 1u),
+            std::max(extent.height >> i, 1u),
+            1
+        };
+    }
+    vkCmdCopyBufferToImage(
+        commandBuffer,
+        buffer,
+        image,
+        VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+        static_cast<uint32_t>(regions.size()),
+        regions.data());
+
+    commandBuffer.SubmitIdle();
+}
+
 bool Image::CopyImage(
     const VkImage& srcImage,
     VkImage& dstImage,
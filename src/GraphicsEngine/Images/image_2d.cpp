@@ -1,9 +1,32 @@
 #include <GraphicsEngine/Images/image_2d.h>
 
 #include <CoreEngine/ServiceLocator/service_locator_definition.h>
+#include <Utility/mapped_file.h>
 
 namespace poke {
 namespace graphics {
+namespace {
+VkFormat GetTextureFormat(const texture_compressor::TextureFormat format)
+{
+    switch (format) {
+        case texture_compressor::TextureFormat::BC1: return VK_FORMAT_BC1_RGBA_UNORM_BLOCK;
+        case texture_compressor::TextureFormat::BC3: return VK_FORMAT_BC3_UNORM_BLOCK;
+        default: return VK_FORMAT_R8G8B8A8_UNORM;
+    }
+}
+
+bool IsSampledFormatSupported(const VkFormat format)
+{
+    VkFormatProperties formatProperties;
+    vkGetPhysicalDeviceFormatProperties(
+        GraphicsEngineLocator::Get().GetPhysicalDevice(),
+        format,
+        &formatProperties);
+
+    return (formatProperties.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT) != 0;
+}
+} //namespace
+
 Image2d::Image2d(
     const std::string& filename,
     const VkFilter filter,
@@ -89,16 +112,77 @@ Image2d::Image2d(
 	Load();
 }
 
+void Image2d::Load(LoadedImageInfos&& loadedImage)
+{
+    tmpPixelsContainer_ = std::move(loadedImage.pixels);
+    tmpCookedTexture_ = std::move(loadedImage.cookedTexture);
+    width_ = loadedImage.width;
+    height_ = loadedImage.height;
+    components_ = loadedImage.components;
+
+    Load();
+}
+
+LoadedImageInfos Image2d::LoadData(const std::string& filename)
+{
+    const std::string cookedPath = PokFileSystem::GetFullPath(
+        filename,
+        FileType::COOKED_TEXTURE,
+        FolderType::SAVE_IN_ROM);
+
+    LoadedImageInfos loadedImage;
+
+    //Builds can ship the cooked textures without their source
+    MappedFile sourceFile;
+    if (!sourceFile.Open(PokFileSystem::GetFullPath(filename, FileType::TEXTURE))) {
+        if (!loadedImage.cookedTexture.Open(cookedPath)) { return LoadPixelsFromFile(filename, FileType::TEXTURE); }
+    } else {
+        const uint64_t sourceHash = cooked_texture::HashSource(sourceFile.GetData(), sourceFile.GetSize());
+        const uint64_t sourceSize = sourceFile.GetSize();
+
+        if (!loadedImage.cookedTexture.Open(cookedPath) ||
+            !loadedImage.cookedTexture.GetView().IsUpToDate(sourceHash, sourceSize)) {
+            loadedImage = LoadPixelsFromMemory(sourceFile.GetData(), sourceFile.GetSize());
+            sourceFile.Close();
+            if (loadedImage.pixels.empty()) { return loadedImage; }
+
+            //Not being able to write the cache only costs a decoding at the next launch
+            const bool isCooked = WriteCookedTexture(
+                CookTexture(
+                    reinterpret_cast<const uint8_t*>(loadedImage.pixels.data()),
+                    loadedImage.width,
+                    loadedImage.height,
+                    sourceHash,
+                    sourceSize),
+                cookedPath);
+            if (!isCooked || !loadedImage.cookedTexture.Open(cookedPath)) { return loadedImage; }
+
+            std::vector<char>().swap(loadedImage.pixels);
+        }
+    }
+
+    loadedImage.width = loadedImage.cookedTexture.GetView().GetWidth();
+    loadedImage.height = loadedImage.cookedTexture.GetView().GetHeight();
+    loadedImage.components = 4;
+    return loadedImage;
+}
+
 void Image2d::Load()
 {
-    if (!filename_.empty() && tmpPixelsContainer_.empty()) {
-        auto loadedImage = LoadPixelsFromFile(filename_, FileType::TEXTURE);
+    if (!filename_.empty() && tmpPixelsContainer_.empty() && !tmpCookedTexture_.IsOpen()) {
+        auto loadedImage = LoadData(filename_);
         tmpPixelsContainer_ = std::move(loadedImage.pixels);
+        tmpCookedTexture_ = std::move(loadedImage.cookedTexture);
         width_ = loadedImage.width;
         height_ = loadedImage.height;
         components_ = loadedImage.components;
     }
 
+    if (tmpCookedTexture_.IsOpen()) {
+        LoadCooked();
+        return;
+    }
+
     if (width_ == 0 && height_ == 0) { return; }
 
     mipLevels_ = mipmap_ ? GetMipLevels({width_, height_, 1}) : 1;
@@ -199,5 +283,109 @@ void Image2d::Load()
     tmpPixelsContainer_.clear();
     tmpPixelsContainer_.resize(0);
 }
+
+void Image2d::LoadCooked()
+{
+    const CookedTextureView& cookedTexture = tmpCookedTexture_.GetView();
+
+    width_ = cookedTexture.GetWidth();
+    height_ = cookedTexture.GetHeight();
+    components_ = 4;
+    mipLevels_ = mipmap_ ? cookedTexture.GetMipCount() : 1;
+    format_ = GetTextureFormat(cookedTexture.GetFormat());
+
+    const uint8_t* data = cookedTexture.GetMipData(0);
+    size_t dataSize = cookedTexture.GetMipsSize(mipLevels_);
+    std::vector<VkDeviceSize> mipOffsets(mipLevels_);
+    for (uint32_t i = 0; i < mipLevels_; i++) {
+        mipOffsets[i] = cookedTexture.GetMip(i).offset - cookedTexture.GetMip(0).offset;
+    }
+
+    //Devices without block compression get the decompressed levels
+    std::vector<uint8_t> decompressedData;
+    if (format_ != VK_FORMAT_R8G8B8A8_UNORM && !IsSampledFormatSupported(format_)) {
+        for (uint32_t i = 0; i < mipLevels_; i++) {
+            const cooked_texture::Mip& mip = cookedTexture.GetMip(i);
+            const std::vector<uint8_t> pixels = texture_compressor::DecompressLevel(
+                cookedTexture.GetMipData(i),
+                mip.width,
+                mip.height,
+                cookedTexture.GetFormat());
+
+            mipOffsets[i] = decompressedData.size();
+            decompressedData.insert(decompressedData.end(), pixels.begin(), pixels.end());
+        }
+        data = decompressedData.data();
+        dataSize = decompressedData.size();
+        format_ = VK_FORMAT_R8G8B8A8_UNORM;
+    }
+
+    image_ = CreateImage(
+        memory_,
+        {width_, height_, 1},
+        format_,
+        sample_,
+        VK_IMAGE_TILING_OPTIMAL,
+        usage_,
+        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+        mipLevels_,
+        1,
+        VK_IMAGE_TYPE_2D);
+
+    sampler_ = CreateImageSampler(
+        filter_,
+        addressMode_,
+        anisotropic_,
+        mipLevels_);
+
+    view_ = CreateImageView(
+        image_,
+        VK_IMAGE_VIEW_TYPE_2D,
+        format_,
+        VK_IMAGE_ASPECT_COLOR_BIT,
+        mipLevels_,
+        0,
+        1,
+        0);
+
+    TransitionImageLayout(
+        image_,
+        VK_IMAGE_LAYOUT_UNDEFINED,
+        VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+        VK_IMAGE_ASPECT_COLOR_BIT,
+        mipLevels_,
+        0,
+        1,
+        0);
+
+    const Buffer stagingBuffer(
+        dataSize,
+        VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+        VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+    char* stagingData;
+    stagingBuffer.MapMemory(&stagingData);
+    std::memcpy(stagingData, data, dataSize);
+    stagingBuffer.UnmapMemory();
+
+    CopyBufferToImageMips(
+        stagingBuffer.GetBuffer(),
+        image_,
+        {width_, height_, 1},
+        mipOffsets);
+
+    TransitionImageLayout(
+        image_,
+        VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+        layout_,
+        VK_IMAGE_ASPECT_COLOR_BIT,
+        mipLevels_,
+        0,
+        arrayLayers_,
+        0);
+
+    tmpCookedTexture_.Close();
+}
 } //namespace graphics
 } //namespace poke
@@ -0,0 +1,471 @@
+#include <GraphicsEngine/Images/texture_compressor.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace poke {
+namespace texture_compressor {
+namespace {
+const size_t kBlockPixelCount = kBlockDimension * kBlockDimension;
+const size_t kColorBlockSize = 8;
+const size_t kAlphaBlockSize = 8;
+const int kLeastSquaresIterations = 2;
+
+uint16_t PackColor565(const float* color)
+{
+	const auto quantize = [](const float value, const float maxValue) {
+		return static_cast<uint16_t>(std::lround(std::min(std::max(value, 0.0f), 255.0f) * maxValue / 255.0f));
+	};
+	return static_cast<uint16_t>(
+		quantize(color[0], 31.0f) << 11 |
+		quantize(color[1], 63.0f) << 5 |
+		quantize(color[2], 31.0f));
+}
+
+void UnpackColor565(const uint16_t color, uint8_t* rgb)
+{
+	const uint8_t r = (color >> 11) & 0x1F;
+	const uint8_t g = (color >> 5) & 0x3F;
+	const uint8_t b = color & 0x1F;
+	rgb[0] = static_cast<uint8_t>(r << 3 | r >> 2);
+	rgb[1] = static_cast<uint8_t>(g << 2 | g >> 4);
+	rgb[2] = static_cast<uint8_t>(b << 3 | b >> 2);
+}
+
+/**
+ * \brief Colors of a block, the third color is an average and the fourth is transparent without isFourColors.
+ */
+void GetColorPalette(const uint16_t color0, const uint16_t color1, const bool isFourColors, uint8_t palette[4][4])
+{
+	UnpackColor565(color0, palette[0]);
+	UnpackColor565(color1, palette[1]);
+	for (size_t channel = 0; channel < 3; channel++) {
+		const int value0 = palette[0][channel];
+		const int value1 = palette[1][channel];
+		if (isFourColors) {
+			palette[2][channel] = static_cast<uint8_t>((2 * value0 + value1) / 3);
+			palette[3][channel] = static_cast<uint8_t>((value0 + 2 * value1) / 3);
+		} else {
+			palette[2][channel] = static_cast<uint8_t>((value0 + value1) / 2);
+			palette[3][channel] = 0;
+		}
+	}
+	palette[0][3] = 255;
+	palette[1][3] = 255;
+	palette[2][3] = 255;
+	palette[3][3] = isFourColors ? 255 : 0;
+}
+
+/**
+ * \brief Closest palette color of every pixel.
+ * \return Squared error of the block.
+ */
+int AssignColorIndices(const uint8_t* block, const uint8_t palette[4][4], uint8_t* indices)
+{
+	int blockError = 0;
+	for (size_t i = 0; i < kBlockPixelCount; i++) {
+		int bestError = std::numeric_limits<int>::max();
+		for (uint8_t paletteIndex = 0; paletteIndex < 4; paletteIndex++) {
+			int error = 0;
+			for (size_t channel = 0; channel < 3; channel++) {
+				const int delta = block[i * 4 + channel] - palette[paletteIndex][channel];
+				error += delta * delta;
+			}
+			if (error < bestError) {
+				bestError = error;
+				indices[i] = paletteIndex;
+			}
+		}
+		blockError += bestError;
+	}
+	return blockError;
+}
+
+/**
+ * \brief Quantize the endpoints and find the indices of their palette, always in the four colors mode.
+ * \return Squared error of the block.
+ */
+int FitColorEndpoints(
+	const uint8_t* block,
+	const float* endpoint0,
+	const float* endpoint1,
+	uint16_t& color0,
+	uint16_t& color1,
+	uint8_t* indices)
+{
+	color0 = PackColor565(endpoint0);
+	color1 = PackColor565(endpoint1);
+	if (color0 < color1) { std::swap(color0, color1); }
+
+	uint8_t palette[4][4];
+	if (color0 == color1) {
+		//Single color, the first entry is the same in both modes
+		GetColorPalette(color0, color1, false, palette);
+		std::fill(indices, indices + kBlockPixelCount, 0);
+
+		int blockError = 0;
+		for (size_t i = 0; i < kBlockPixelCount; i++) {
+			for (size_t channel = 0; channel < 3; channel++) {
+				const int delta = block[i * 4 + channel] - palette[0][channel];
+				blockError += delta * delta;
+			}
+		}
+		return blockError;
+	}
+
+	GetColorPalette(color0, color1, true, palette);
+	return AssignColorIndices(block, palette, indices);
+}
+
+/**
+ * \brief Endpoints along the principal axis of the colors, then refined by least squares.
+ */
+void EncodeColorBlock(const uint8_t* block, uint8_t* output)
+{
+	float mean[3] = { 0.0f, 0.0f, 0.0f };
+	for (size_t i = 0; i < kBlockPixelCount; i++) {
+		for (size_t channel = 0; channel < 3; channel++) { mean[channel] += block[i * 4 + channel]; }
+	}
+	for (float& value : mean) { value /= kBlockPixelCount; }
+
+	//rr, rg, rb, gg, gb, bb
+	float covariance[6] = {};
+	for (size_t i = 0; i < kBlockPixelCount; i++) {
+		const float r = block[i * 4] - mean[0];
+		const float g = block[i * 4 + 1] - mean[1];
+		const float b = block[i * 4 + 2] - mean[2];
+		covariance[0] += r * r;
+		covariance[1] += r * g;
+		covariance[2] += r * b;
+		covariance[3] += g * g;
+		covariance[4] += g * b;
+		covariance[5] += b * b;
+	}
+
+	//Power iterations
+	float axis[3] = { 1.0f, 1.0f, 1.0f };
+	for (int iteration = 0; iteration < 4; iteration++) {
+		const float x = axis[0] * covariance[0] + axis[1] * covariance[1] + axis[2] * covariance[2];
+		const float y = axis[0] * covariance[1] + axis[1] * covariance[3] + axis[2] * covariance[4];
+		const float z = axis[0] * covariance[2] + axis[1] * covariance[4] + axis[2] * covariance[5];
+		const float length = std::max(std::abs(x), std::max(std::abs(y), std::abs(z)));
+		if (length < std::numeric_limits<float>::epsilon()) { break; }
+
+		axis[0] = x / length;
+		axis[1] = y / length;
+		axis[2] = z / length;
+	}
+
+	float minProjection = std::numeric_limits<float>::max();
+	float maxProjection = -std::numeric_limits<float>::max();
+	size_t minPixel = 0;
+	size_t maxPixel = 0;
+	for (size_t i = 0; i < kBlockPixelCount; i++) {
+		const float projection =
+			block[i * 4] * axis[0] + block[i * 4 + 1] * axis[1] + block[i * 4 + 2] * axis[2];
+		if (projection < minProjection) {
+			minProjection = projection;
+			minPixel = i;
+		}
+		if (projection > maxProjection) {
+			maxProjection = projection;
+			maxPixel = i;
+		}
+	}
+
+	//Inset the endpoints, the extremes are often isolated pixels
+	float endpoint0[3];
+	float endpoint1[3];
+	for (size_t channel = 0; channel < 3; channel++) {
+		const float maxValue = block[maxPixel * 4 + channel];
+		const float minValue = block[minPixel * 4 + channel];
+		const float inset = (maxValue - minValue) / 16.0f;
+		endpoint0[channel] = maxValue - inset;
+		endpoint1[channel] = minValue + inset;
+	}
+
+	uint16_t color0;
+	uint16_t color1;
+	uint8_t indices[kBlockPixelCount];
+	int blockError = FitColorEndpoints(block, endpoint0, endpoint1, color0, color1, indices);
+
+	//Weight of the first endpoint for each palette index
+	const float kWeights[4] = { 1.0f, 0.0f, 2.0f / 3.0f, 1.0f / 3.0f };
+	for (int iteration = 0; iteration < kLeastSquaresIterations && blockError > 0 && color0 != color1; iteration++) {
+		float weight00 = 0.0f;
+		float weight01 = 0.0f;
+		float weight11 = 0.0f;
+		float sum0[3] = { 0.0f, 0.0f, 0.0f };
+		float sum1[3] = { 0.0f, 0.0f, 0.0f };
+		for (size_t i = 0; i < kBlockPixelCount; i++) {
+			const float weight0 = kWeights[indices[i]];
+			const float weight1 = 1.0f - weight0;
+			weight00 += weight0 * weight0;
+			weight01 += weight0 * weight1;
+			weight11 += weight1 * weight1;
+			for (size_t channel = 0; channel < 3; channel++) {
+				sum0[channel] += weight0 * block[i * 4 + channel];
+				sum1[channel] += weight1 * block[i * 4 + channel];
+			}
+		}
+
+		const float determinant = weight00 * weight11 - weight01 * weight01;
+		if (std::abs(determinant) < std::numeric_limits<float>::epsilon()) { break; }
+
+		for (size_t channel = 0; channel < 3; channel++) {
+			endpoint0[channel] = (sum0[channel] * weight11 - sum1[channel] * weight01) / determinant;
+			endpoint1[channel] = (sum1[channel] * weight00 - sum0[channel] * weight01) / determinant;
+		}
+
+		uint16_t refinedColor0;
+		uint16_t refinedColor1;
+		uint8_t refinedIndices[kBlockPixelCount];
+		const int refinedError = FitColorEndpoints(block, endpoint0, endpoint1, refinedColor0, refinedColor1, refinedIndices);
+		if (refinedError >= blockError) { break; }
+
+		blockError = refinedError;
+		color0 = refinedColor0;
+		color1 = refinedColor1;
+		std::memcpy(indices, refinedIndices, kBlockPixelCount);
+	}
+
+	uint32_t packedIndices = 0;
+	for (size_t i = 0; i < kBlockPixelCount; i++) { packedIndices |= uint32_t(indices[i]) << (i * 2); }
+
+	output[0] = static_cast<uint8_t>(color0 & 0xFF);
+	output[1] = static_cast<uint8_t>(color0 >> 8);
+	output[2] = static_cast<uint8_t>(color1 & 0xFF);
+	output[3] = static_cast<uint8_t>(color1 >> 8);
+	for (size_t i = 0; i < 4; i++) { output[4 + i] = static_cast<uint8_t>(packedIndices >> (i * 8)); }
+}
+
+void DecodeColorBlock(const uint8_t* input, const bool isBc1, uint8_t* block)
+{
+	const uint16_t color0 = static_cast<uint16_t>(input[0] | input[1] << 8);
+	const uint16_t color1 = static_cast<uint16_t>(input[2] | input[3] << 8);
+	const uint32_t packedIndices = input[4] | input[5] << 8 | input[6] << 16 | uint32_t(input[7]) << 24;
+
+	//BC3 colors are always in the four colors mode
+	uint8_t palette[4][4];
+	GetColorPalette(color0, color1, !isBc1 || color0 > color1, palette);
+
+	for (size_t i = 0; i < kBlockPixelCount; i++) {
+		std::memcpy(block + i * 4, palette[(packedIndices >> (i * 2)) & 0x3], 4);
+	}
+}
+
+void GetAlphaPalette(const uint8_t alpha0, const uint8_t alpha1, uint8_t palette[8])
+{
+	palette[0] = alpha0;
+	palette[1] = alpha1;
+	if (alpha0 > alpha1) {
+		for (int i = 2; i < 8; i++) {
+			palette[i] = static_cast<uint8_t>(((8 - i) * alpha0 + (i - 1) * alpha1) / 7);
+		}
+	} else {
+		for (int i = 2; i < 6; i++) {
+			palette[i] = static_cast<uint8_t>(((6 - i) * alpha0 + (i - 1) * alpha1) / 5);
+		}
+		palette[6] = 0;
+		palette[7] = 255;
+	}
+}
+
+/**
+ * \brief Alpha between the minimum and the maximum of the block, in the eight values mode.
+ */
+void EncodeAlphaBlock(const uint8_t* block, uint8_t* output)
+{
+	uint8_t minAlpha = 255;
+	uint8_t maxAlpha = 0;
+	for (size_t i = 0; i < kBlockPixelCount; i++) {
+		minAlpha = std::min(minAlpha, block[i * 4 + 3]);
+		maxAlpha = std::max(maxAlpha, block[i * 4 + 3]);
+	}
+
+	std::memset(output, 0, kAlphaBlockSize);
+	output[0] = maxAlpha;
+	output[1] = minAlpha;
+	if (maxAlpha == minAlpha) { return; }
+
+	uint8_t palette[8];
+	GetAlphaPalette(maxAlpha, minAlpha, palette);
+
+	uint64_t packedIndices = 0;
+	for (size_t i = 0; i < kBlockPixelCount; i++) {
+		int bestError = std::numeric_limits<int>::max();
+		uint64_t bestIndex = 0;
+		for (uint64_t paletteIndex = 0; paletteIndex < 8; paletteIndex++) {
+			const int error = std::abs(block[i * 4 + 3] - palette[paletteIndex]);
+			if (error < bestError) {
+				bestError = error;
+				bestIndex = paletteIndex;
+			}
+		}
+		packedIndices |= bestIndex << (i * 3);
+	}
+	for (size_t i = 0; i < 6; i++) { output[2 + i] = static_cast<uint8_t>(packedIndices >> (i * 8)); }
+}
+
+void DecodeAlphaBlock(const uint8_t* input, uint8_t* block)
+{
+	uint8_t palette[8];
+	GetAlphaPalette(input[0], input[1], palette);
+
+	uint64_t packedIndices = 0;
+	for (size_t i = 0; i < 6; i++) { packedIndices |= uint64_t(input[2 + i]) << (i * 8); }
+
+	for (size_t i = 0; i < kBlockPixelCount; i++) {
+		block[i * 4 + 3] = palette[(packedIndices >> (i * 3)) & 0x7];
+	}
+}
+
+size_t GetBlockSize(const TextureFormat format)
+{
+	return format == TextureFormat::BC1 ? kColorBlockSize : kColorBlockSize + kAlphaBlockSize;
+}
+} //namespace
+
+std::vector<MipLevel> GenerateMipChain(const uint8_t* pixels, const uint32_t width, const uint32_t height)
+{
+	std::vector<MipLevel> levels(1);
+	levels[0].width = width;
+	levels[0].height = height;
+	levels[0].pixels.assign(pixels, pixels + size_t(width) * height * 4);
+
+	while (levels.back().width > 1 || levels.back().height > 1) {
+		const MipLevel& source = levels.back();
+
+		MipLevel level;
+		level.width = std::max(source.width / 2, 1u);
+		level.height = std::max(source.height / 2, 1u);
+		level.pixels.resize(size_t(level.width) * level.height * 4);
+
+		for (uint32_t y = 0; y < level.height; y++) {
+			const uint32_t y0 = std::min(y * 2, source.height - 1);
+			const uint32_t y1 = std::min(y * 2 + 1, source.height - 1);
+			for (uint32_t x = 0; x < level.width; x++) {
+				const uint32_t x0 = std::min(x * 2, source.width - 1);
+				const uint32_t x1 = std::min(x * 2 + 1, source.width - 1);
+
+				for (size_t channel = 0; channel < 4; channel++) {
+					const uint32_t sum =
+						source.pixels[(size_t(y0) * source.width + x0) * 4 + channel] +
+						source.pixels[(size_t(y0) * source.width + x1) * 4 + channel] +
+						source.pixels[(size_t(y1) * source.width + x0) * 4 + channel] +
+						source.pixels[(size_t(y1) * source.width + x1) * 4 + channel];
+					level.pixels[(size_t(y) * level.width + x) * 4 + channel] = static_cast<uint8_t>((sum + 2) / 4);
+				}
+			}
+		}
+		levels.push_back(std::move(level));
+	}
+	return levels;
+}
+
+bool IsCompressed(const TextureFormat format)
+{
+	return format == TextureFormat::BC1 || format == TextureFormat::BC3;
+}
+
+size_t GetLevelSize(const TextureFormat format, const uint32_t width, const uint32_t height)
+{
+	if (!IsCompressed(format)) { return size_t(width) * height * 4; }
+
+	const size_t blocksX = (width + kBlockDimension - 1) / kBlockDimension;
+	const size_t blocksY = (height + kBlockDimension - 1) / kBlockDimension;
+	return blocksX * blocksY * GetBlockSize(format);
+}
+
+bool HasAlpha(const uint8_t* pixels, const size_t pixelCount)
+{
+	for (size_t i = 0; i < pixelCount; i++) {
+		if (pixels[i * 4 + 3] != 255) { return true; }
+	}
+	return false;
+}
+
+std::vector<uint8_t> CompressLevel(
+	const uint8_t* pixels,
+	const uint32_t width,
+	const uint32_t height,
+	const TextureFormat format)
+{
+	if (!IsCompressed(format)) { return std::vector<uint8_t>(pixels, pixels + GetLevelSize(format, width, height)); }
+
+	std::vector<uint8_t> data(GetLevelSize(format, width, height));
+	uint8_t* output = data.data();
+
+	uint8_t block[kBlockPixelCount * 4];
+	for (uint32_t blockY = 0; blockY < height; blockY += kBlockDimension) {
+		for (uint32_t blockX = 0; blockX < width; blockX += kBlockDimension) {
+			for (uint32_t y = 0; y < kBlockDimension; y++) {
+				const uint32_t pixelY = std::min(blockY + y, height - 1);
+				for (uint32_t x = 0; x < kBlockDimension; x++) {
+					const uint32_t pixelX = std::min(blockX + x, width - 1);
+					std::memcpy(block + (y * kBlockDimension + x) * 4, pixels + (size_t(pixelY) * width + pixelX) * 4, 4);
+				}
+			}
+
+			if (format == TextureFormat::BC3) {
+				EncodeAlphaBlock(block, output);
+				output += kAlphaBlockSize;
+			}
+			EncodeColorBlock(block, output);
+			output += kColorBlockSize;
+		}
+	}
+	return data;
+}
+
+std::vector<uint8_t> DecompressLevel(
+	const uint8_t* data,
+	const uint32_t width,
+	const uint32_t height,
+	const TextureFormat format)
+{
+	if (!IsCompressed(format)) { return std::vector<uint8_t>(data, data + GetLevelSize(format, width, height)); }
+
+	std::vector<uint8_t> pixels(size_t(width) * height * 4);
+	const uint8_t* input = data;
+
+	uint8_t block[kBlockPixelCount * 4];
+	for (uint32_t blockY = 0; blockY < height; blockY += kBlockDimension) {
+		for (uint32_t blockX = 0; blockX < width; blockX += kBlockDimension) {
+			if (format == TextureFormat::BC3) {
+				DecodeColorBlock(input + kAlphaBlockSize, false, block);
+				DecodeAlphaBlock(input, block);
+			} else {
+				DecodeColorBlock(input, true, block);
+			}
+			input += GetBlockSize(format);
+
+			for (uint32_t y = 0; y < kBlockDimension && blockY + y < height; y++) {
+				for (uint32_t x = 0; x < kBlockDimension && blockX + x < width; x++) {
+					std::memcpy(
+						pixels.data() + (size_t(blockY + y) * width + blockX + x) * 4,
+						block + (y * kBlockDimension + x) * 4,
+						4);
+				}
+			}
+		}
+	}
+	return pixels;
+}
+
+float ComputePsnr(const uint8_t* values, const uint8_t* otherValues, const size_t size)
+{
+	double squaredError = 0.0;
+	for (size_t i = 0; i < size; i++) {
+		const double delta = double(values[i]) - double(otherValues[i]);
+		squaredError += delta * delta;
+	}
+	if (squaredError == 0.0 || size == 0) { return std::numeric_limits<float>::infinity(); }
+
+	const double meanSquaredError = squaredError / size;
+	return static_cast<float>(10.0 * std::log10(255.0 * 255.0 / meanSquaredError));
+}
+} //namespace texture_compressor
+} //namespace poke
@@ -13,14 +13,14 @@ bool Mesh::CmdRender(
 {
 	if (!vertexBuffer_) return false;
     VkBuffer vertexBuffers[] = {vertexBuffer_->GetBuffer()};
-    VkDeviceSize offsets[] = {0};
+    VkDeviceSize offsets[] = {sizeof(VertexMesh) * vertexCount_ * vertexRegion_};
     vkCmdBindVertexBuffers(commandBuffer, 0, 1, vertexBuffers, offsets);
     vkCmdBindIndexBuffer(
         commandBuffer,
         indexBuffer_->GetBuffer(),
         0,
         GetIndexType());
-    vkCmdDrawIndexed(commandBuffer, indexCount_, instance, 0, 0, 0);
+    vkCmdDrawIndexed(commandBuffer, drawnIndexCount_, instance, firstDrawnIndex_, 0, 0);
 
     return true;
 }
@@ -55,10 +55,17 @@ std::vector<uint32_t> Mesh::GetIndices(const size_t offset) const {
 	indexStaging.MapMemory(&indicesMemory);
 	std::vector<uint32_t> indices(indexCount_);
 
-	const auto sizeOfSrcT = indexStaging.GetSize() / indexCount_;
-
-	for (uint32_t i = 0; i < indexCount_; i++) {
-		std::memcpy(&indices[i], static_cast<char *>(indicesMemory) + (i * sizeOfSrcT) + offset, sizeof(uint32_t));
+	//16 bits indices come from cooked meshes, they are always returned as 32 bits
+	if (indexType_ == VK_INDEX_TYPE_UINT16) {
+		for (uint32_t i = 0; i < indexCount_; i++) {
+			uint16_t index;
+			std::memcpy(&index, indicesMemory + offset + i * sizeof(uint16_t), sizeof(uint16_t));
+			indices[i] = index;
+		}
+	} else {
+		for (uint32_t i = 0; i < indexCount_; i++) {
+			std::memcpy(&indices[i], indicesMemory + offset + i * sizeof(uint32_t), sizeof(uint32_t));
+		}
 	}
 
 	indexStaging.UnmapMemory();
@@ -66,20 +73,137 @@ std::vector<uint32_t> Mesh::GetIndices(const size_t offset) const {
 }
 
 void Mesh::SetIndices(const std::vector<uint32_t> &indices) {
+	SetIndexData(
+		indices.data(),
+		sizeof(uint32_t) * indices.size(),
+		static_cast<uint32_t>(indices.size()),
+		VK_INDEX_TYPE_UINT32);
+}
+
+void Mesh::Initialize(
+	const VertexMesh* vertices,
+	const uint32_t vertexCount,
+	const void* indices,
+	const uint32_t indexCount,
+	const VkIndexType indexType,
+	const math::Vec3& minExtents,
+	const math::Vec3& maxExtents)
+{
+	const size_t indexSize = indexType == VK_INDEX_TYPE_UINT16 ? sizeof(uint16_t) : sizeof(uint32_t);
+
+	SetVertexData(vertices, sizeof(VertexMesh) * vertexCount, vertexCount);
+	SetIndexData(indices, indexSize * indexCount, indexCount, indexType);
+
+	minExtents_ = minExtents;
+	maxExtents_ = maxExtents;
+	positionOffset_ = math::Vec3(0, 0, 0);
+
+	radius_ = std::max(
+		minExtents_.GetMagnitude(),
+		maxExtents_.GetMagnitude());
+}
+
+void Mesh::InitializeDynamic(
+	const uint32_t vertexCapacity,
+	const std::vector<uint32_t>& indices,
+	const uint32_t regionCount)
+{
+	//Written by the CPU every frame, a device local copy would need a transfer for each update
+	vertexBuffer_.reset();
+	vertexCount_ = vertexCapacity;
+	vertexRegionCount_ = std::max(regionCount, 1u);
+	vertexRegion_ = 0;
+	vertexBuffer_.emplace(
+		sizeof(VertexMesh) * vertexCapacity * vertexRegionCount_,
+		VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+		VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+	SetIndices(indices);
+	SetDrawRange(0, 0);
+
+	minExtents_ = math::Vec3(0, 0, 0);
+	maxExtents_ = math::Vec3(0, 0, 0);
+	positionOffset_ = math::Vec3(0, 0, 0);
+	radius_ = 0;
+}
+
+void Mesh::NextVertexRegion()
+{
+	vertexRegion_ = (vertexRegion_ + 1) % vertexRegionCount_;
+}
+
+void Mesh::UpdateVertices(const VertexMesh* vertices, const uint32_t firstVertex, const uint32_t vertexCount)
+{
+	cassert(firstVertex + vertexCount <= vertexCount_, "Mesh::UpdateVertices => The range is out of the vertex buffer.");
+
+	char* verticesMemory;
+	vertexBuffer_->MapMemory(&verticesMemory);
+	std::memcpy(
+		verticesMemory + sizeof(VertexMesh) * (vertexCount_ * vertexRegion_ + firstVertex),
+		vertices,
+		sizeof(VertexMesh) * vertexCount);
+	vertexBuffer_->UnmapMemory();
+}
+
+void Mesh::SetDrawRange(const uint32_t firstIndex, const uint32_t indexCount)
+{
+	firstDrawnIndex_ = firstIndex;
+	drawnIndexCount_ = indexCount;
+}
+
+void Mesh::SetVertexData(const void* vertices, const size_t size, const uint32_t vertexCount)
+{
+	vertexBuffer_.reset();
+	vertexCount_ = vertexCount;
+	vertexRegionCount_ = 1;
+	vertexRegion_ = 0;
+
+	if (vertexCount == 0)
+		return;
+
+	const auto vertexStaging = Buffer(
+		size,
+		VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+		VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+		vertices);
+
+	vertexBuffer_.emplace(
+		vertexStaging.GetSize(),
+		VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+		VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+	CommandBuffer commandBuffer;
+
+	VkBufferCopy copyRegion = {};
+	copyRegion.size = vertexStaging.GetSize();
+	vkCmdCopyBuffer(commandBuffer, vertexStaging.GetBuffer(), vertexBuffer_->GetBuffer(), 1, &copyRegion);
+
+	commandBuffer.SubmitIdle();
+}
+
+void Mesh::SetIndexData(
+	const void* indices,
+	const size_t size,
+	const uint32_t indexCount,
+	const VkIndexType indexType)
+{
 	indexBuffer_.reset();
-	indexCount_ = static_cast<uint32_t>(indices.size());
+	indexCount_ = indexCount;
+	indexType_ = indexType;
+	firstDrawnIndex_ = 0;
+	drawnIndexCount_ = indexCount;
 
-	if (indices.empty())
+	if (indexCount == 0)
 		return;
 
 	const auto indexStaging = Buffer(
-		sizeof(uint32_t) * indices.size(),
+		size,
 		VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
 		VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-		indices.data());
+		indices);
 
 	indexBuffer_.emplace(
-		sizeof(uint32_t) * indexStaging.GetSize(),
+		indexStaging.GetSize(),
 		VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
 		VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
 
@@ -33,14 +33,24 @@ ModelInstanceIndex ModelCommandBuffer::GetModelInstanceIndex(
     const Material& material,
     const Mesh& mesh)
 {
-    for (size_t i = 0; i < modelInstances_.size(); i++) {
-        if (&modelInstances_[i]->GetMaterial() == &material) {
-            if (&modelInstances_[i]->GetMesh() == &mesh) { return i; }
-        }
+    return GetModelInstanceIndex(material, mesh, mesh, 0);
+}
+
+ModelInstanceIndex ModelCommandBuffer::GetModelInstanceIndex(
+    const Material& material,
+    const Mesh& mesh,
+    const Mesh& lodMesh,
+    const size_t lod)
+{
+    for (size_t i = 0; i < modelInstanceKeys_.size(); i++) {
+        if (modelInstanceKeys_[i].material == &material &&
+            modelInstanceKeys_[i].mesh == &mesh &&
+            modelInstanceKeys_[i].lod == lod) { return i; }
     }
 
     modelInstances_.push_back(nullptr);
-    modelInstances_.back() = std::make_unique<ModelInstance>(mesh, material);
+    modelInstances_.back() = std::make_unique<ModelInstance>(lodMesh, material);
+    modelInstanceKeys_.push_back(ModelInstanceKey{&material, &mesh, lod});
     instancesMatrix_.push_back({});
     return modelInstances_.size() - 1;
 }
@@ -101,7 +111,14 @@ void ModelCommandBuffer::Draw(const ForwardDrawCmd& drawCommand)
 
 void ModelCommandBuffer::PrepareData()
 {
+    drawStats_ = ModelDrawStats();
+
     for (size_t i = 0; i < modelInstances_.size(); i++) {
+        const size_t instanceCount = instancesMatrix_[i].size();
+        drawStats_.instanceCount += instanceCount;
+        drawStats_.triangleCount += instanceCount * modelInstances_[i]->GetMesh().GetIndexCount() / 3;
+        drawStats_.fullDetailTriangleCount += instanceCount * modelInstanceKeys_[i].mesh->GetIndexCount() / 3;
+
         modelInstances_[i]->Update(instancesMatrix_[i]);
 
         instancesMatrix_[i].clear();
@@ -114,6 +131,7 @@ void ModelCommandBuffer::OnUnloadScene()
     forwardDrawingCmd_.shrink_to_fit();
 
     modelInstances_.clear();
+    modelInstanceKeys_.clear();
 }
 
 void ModelCommandBuffer::Clear()
@@ -121,6 +139,7 @@ void ModelCommandBuffer::Clear()
     forwardDrawingCmd_.clear();
 
     modelInstances_.clear();
+    modelInstanceKeys_.clear();
 }
 } //namespace graphics
 } //namespace poke
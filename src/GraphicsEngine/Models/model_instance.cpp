@@ -122,7 +122,7 @@ bool ModelInstance::CmdRender(
         commandBuffer,
         kMesh_.GetIndexBuffer().GetBuffer(),
         0,
-        Mesh::GetIndexType());
+        kMesh_.GetIndexType());
 
     //DRAW
     vkCmdDrawIndexed(
@@ -0,0 +1,172 @@
+#include <GraphicsEngine/Particles/particle_kernels.h>
+
+#if defined(_M_X64) || defined(__SSE2__)
+#define POK_PARTICLES_SSE
+#include <emmintrin.h>
+#endif
+
+namespace poke {
+namespace graphics {
+namespace particle_kernels {
+static_assert(sizeof(math::Vec3) == 3 * sizeof(float), "Vec3 arrays are used as float arrays");
+static_assert(sizeof(Color) == 4 * sizeof(float), "Colors are loaded in one SSE register");
+
+void AgeParticles(float* elapsedTime, const size_t count, const float deltaTime)
+{
+    size_t i = 0;
+#ifdef POK_PARTICLES_SSE
+    const __m128 dt = _mm_set1_ps(deltaTime);
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(elapsedTime + i, _mm_add_ps(_mm_loadu_ps(elapsedTime + i), dt));
+    }
+#endif
+    for (; i < count; i++) { elapsedTime[i] += deltaTime; }
+}
+
+size_t CountDeadParticlesInRing(
+    const float* elapsedTime,
+    const float* lifetime,
+    const size_t first,
+    const size_t count,
+    const size_t capacity)
+{
+    size_t deadCount = 0;
+    size_t upper = count;
+    while (deadCount < upper) {
+        const size_t middle = deadCount + (upper - deadCount) / 2;
+        const size_t index = (first + middle) % capacity;
+        if (elapsedTime[index] >= lifetime[index]) {
+            deadCount = middle + 1;
+        } else {
+            upper = middle;
+        }
+    }
+    return deadCount;
+}
+
+size_t ComputeDeadParticlesMoves(
+    const float* elapsedTime,
+    const float* lifetime,
+    const size_t count,
+    ParticleMove* moves,
+    size_t& movesCount)
+{
+    //Once compacted, the alive particles are [0, aliveCount)
+    size_t aliveCount = 0;
+    size_t i = 0;
+#ifdef POK_PARTICLES_SSE
+    for (; i + 4 <= count; i += 4) {
+        const int aliveMask = _mm_movemask_ps(
+            _mm_cmplt_ps(_mm_loadu_ps(elapsedTime + i), _mm_loadu_ps(lifetime + i)));
+        aliveCount += (aliveMask & 1) + (aliveMask >> 1 & 1) + (aliveMask >> 2 & 1) + (aliveMask >> 3 & 1);
+    }
+#endif
+    for (; i < count; i++) { aliveCount += elapsedTime[i] < lifetime[i] ? 1 : 0; }
+
+    //Dead particles before aliveCount are filled with the alive ones after it, there are as many of both.
+    //Indexes are written without branches, the write is kept only if the particle matches.
+    size_t holesCount = 0;
+    for (i = 0; i < aliveCount; i++) {
+        moves[holesCount].destination = static_cast<uint32_t>(i);
+        holesCount += elapsedTime[i] >= lifetime[i] ? 1 : 0;
+    }
+
+    size_t fillersCount = 0;
+    for (i = aliveCount; i < count && fillersCount < holesCount; i++) {
+        moves[fillersCount].source = static_cast<uint32_t>(i);
+        fillersCount += elapsedTime[i] < lifetime[i] ? 1 : 0;
+    }
+
+    movesCount = holesCount;
+    return aliveCount;
+}
+
+void ApplyGravity(math::Vec3* velocities, const size_t count, const float gravity)
+{
+    size_t i = 0;
+#ifdef POK_PARTICLES_SSE
+    //4 Vec3 are 3 registers, the y components are at float 1, 4, 7 and 10
+    float* data = &velocities[0].x;
+    const __m128 gravity0 = _mm_setr_ps(0.0f, gravity, 0.0f, 0.0f);
+    const __m128 gravity1 = _mm_setr_ps(gravity, 0.0f, 0.0f, gravity);
+    const __m128 gravity2 = _mm_setr_ps(0.0f, 0.0f, gravity, 0.0f);
+    for (; i + 4 <= count; i += 4) {
+        float* block = data + i * 3;
+        _mm_storeu_ps(block, _mm_add_ps(_mm_loadu_ps(block), gravity0));
+        _mm_storeu_ps(block + 4, _mm_add_ps(_mm_loadu_ps(block + 4), gravity1));
+        _mm_storeu_ps(block + 8, _mm_add_ps(_mm_loadu_ps(block + 8), gravity2));
+    }
+#endif
+    for (; i < count; i++) { velocities[i].y += gravity; }
+}
+
+void IntegratePositions(
+    math::Vec3* positions,
+    const math::Vec3* velocities,
+    const size_t count,
+    const float deltaTime)
+{
+    //Components are independent, the arrays are processed as flat float arrays
+    float* position = &positions[0].x;
+    const float* velocity = &velocities[0].x;
+    const size_t floatCount = count * 3;
+
+    size_t i = 0;
+#ifdef POK_PARTICLES_SSE
+    const __m128 dt = _mm_set1_ps(deltaTime);
+    for (; i + 4 <= floatCount; i += 4) {
+        _mm_storeu_ps(
+            position + i,
+            _mm_add_ps(_mm_loadu_ps(position + i), _mm_mul_ps(_mm_loadu_ps(velocity + i), dt)));
+    }
+#endif
+    for (; i < floatCount; i++) { position[i] += velocity[i] * deltaTime; }
+}
+
+void ComputeColorsOverLifetime(
+    const ColorGradient& gradient,
+    const float* elapsedTime,
+    const float* lifetime,
+    const Color* originalColors,
+    Color* colors,
+    float* transparencies,
+    const size_t count)
+{
+    const auto& table = gradient.GetColors();
+    const float lastIndex = static_cast<float>(ColorGradient::kMaxSize - 1);
+
+    size_t i = 0;
+#ifdef POK_PARTICLES_SSE
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 scale = _mm_set1_ps(lastIndex);
+    alignas(16) int32_t indexes[4];
+    for (; i + 4 <= count; i += 4) {
+        //Same clamp and truncation as ColorGradient::GetColorAt
+        __m128 factor = _mm_div_ps(_mm_loadu_ps(elapsedTime + i), _mm_loadu_ps(lifetime + i));
+        factor = _mm_min_ps(_mm_max_ps(factor, zero), one);
+        _mm_store_si128(
+            reinterpret_cast<__m128i*>(indexes),
+            _mm_cvttps_epi32(_mm_mul_ps(factor, scale)));
+
+        for (size_t lane = 0; lane < 4; lane++) {
+            const __m128 color = _mm_mul_ps(
+                _mm_loadu_ps(&originalColors[i + lane].r),
+                _mm_loadu_ps(&table[indexes[lane]].r));
+            _mm_storeu_ps(&colors[i + lane].r, color);
+            transparencies[i + lane] = colors[i + lane].a;
+        }
+    }
+#endif
+    for (; i < count; i++) {
+        float factor = elapsedTime[i] / lifetime[i];
+        if (factor < 0.0f) { factor = 0.0f; }
+        if (factor > 1.0f) { factor = 1.0f; }
+
+        colors[i] = originalColors[i] * table[static_cast<size_t>(factor * lastIndex)];
+        transparencies[i] = colors[i].a;
+    }
+}
+} //namespace particle_kernels
+} //namespace graphics
+} //namespace poke
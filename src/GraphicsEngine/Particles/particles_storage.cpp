@@ -0,0 +1,151 @@
+#include <GraphicsEngine/Particles/particles_storage.h>
+
+#include <algorithm>
+
+#include <GraphicsEngine/Particles/particle_kernels.h>
+#include <Memory/frame_arena.h>
+
+namespace poke {
+namespace graphics {
+bool ParticlesStorage::Emit(const Particle& particle, const size_t maxParticles)
+{
+    if (nbParticles >= static_cast<int>(maxParticles)) { return false; }
+
+    size_t index;
+    if (isRingBuffer) {
+        //The ring always has its full size, it only changes when maxParticles changes
+        if (GetCapacity() != maxParticles) {
+            Linearize();
+            Resize(maxParticles);
+        }
+        index = (firstParticle + nbParticles) % maxParticles;
+    } else {
+        index = nbParticles;
+        if (GetCapacity() <= index) { Resize(std::min(index * 2 + 1, maxParticles)); }
+    }
+
+    Set(index, particle);
+    nbParticles++;
+    return true;
+}
+
+void ParticlesStorage::SetRingBuffer(const bool ringBuffer)
+{
+    if (ringBuffer == isRingBuffer) { return; }
+
+    if (ringBuffer) {
+        //Particles emitted with different lifetimes don't die in order, wait for them to die
+        if (nbParticles > 0) { return; }
+        firstParticle = 0;
+    } else {
+        Linearize();
+    }
+    isRingBuffer = ringBuffer;
+}
+
+void ParticlesStorage::RemoveDeadParticles()
+{
+    using namespace particle_kernels;
+
+    const size_t count = nbParticles;
+
+    if (isRingBuffer) {
+        //Every particle has the same lifetime, the oldest ones are at the head
+        const size_t deadCount = CountDeadParticlesInRing(
+            elapsedTime.data(),
+            lifetime.data(),
+            firstParticle,
+            count,
+            GetCapacity());
+
+        firstParticle = deadCount == count ? 0 : (firstParticle + deadCount) % GetCapacity();
+        nbParticles = static_cast<int>(count - deadCount);
+        return;
+    }
+
+    //Single pass compaction, dead particles are replaced by alive ones taken from the end
+    FrameVector<ParticleMove> moves(count / 2 + 1);
+    size_t movesCount = 0;
+    const size_t aliveCount = ComputeDeadParticlesMoves(
+        elapsedTime.data(),
+        lifetime.data(),
+        count,
+        moves.data(),
+        movesCount);
+    nbParticles = static_cast<int>(aliveCount);
+
+    //Nothing to move when no particle died or when only the last ones died
+    if (movesCount == 0) { return; }
+
+    ApplyParticlesMoves(numberOfRows.data(), moves.data(), movesCount);
+    ApplyParticlesMoves(originalColor.data(), moves.data(), movesCount);
+    ApplyParticlesMoves(colorOffset.data(), moves.data(), movesCount);
+    ApplyParticlesMoves(position.data(), moves.data(), movesCount);
+    ApplyParticlesMoves(velocity.data(), moves.data(), movesCount);
+    ApplyParticlesMoves(imageOffset1.data(), moves.data(), movesCount);
+    ApplyParticlesMoves(imageOffset2.data(), moves.data(), movesCount);
+    ApplyParticlesMoves(lifetime.data(), moves.data(), movesCount);
+    ApplyParticlesMoves(scale.data(), moves.data(), movesCount);
+    ApplyParticlesMoves(elapsedTime.data(), moves.data(), movesCount);
+    ApplyParticlesMoves(transparency.data(), moves.data(), movesCount);
+    ApplyParticlesMoves(imageBlendFactor.data(), moves.data(), movesCount);
+}
+
+void ParticlesStorage::Resize(const size_t size)
+{
+    numberOfRows.resize(size);
+    originalColor.resize(size);
+    colorOffset.resize(size);
+    position.resize(size);
+    velocity.resize(size);
+    imageOffset1.resize(size);
+    imageOffset2.resize(size);
+    lifetime.resize(size);
+    scale.resize(size);
+    elapsedTime.resize(size);
+    transparency.resize(size);
+    imageBlendFactor.resize(size);
+
+    nbParticles = std::min(nbParticles, static_cast<int>(size));
+}
+
+void ParticlesStorage::Set(const size_t index, const Particle& particle)
+{
+    numberOfRows[index] = particle.numberOfRows;
+    originalColor[index] = particle.originalColor;
+    colorOffset[index] = particle.colorOffset;
+    position[index] = particle.position;
+    velocity[index] = particle.velocity;
+    imageOffset1[index] = particle.imageOffset1;
+    imageOffset2[index] = particle.imageOffset2;
+    lifetime[index] = particle.lifetime;
+    scale[index] = particle.scale;
+    elapsedTime[index] = 0;
+    transparency[index] = particle.transparency;
+    imageBlendFactor[index] = particle.imageBlendFactor;
+}
+
+void ParticlesStorage::Linearize()
+{
+    if (firstParticle == 0) { return; }
+
+    const auto rotate = [this](auto& values) {
+        std::rotate(values.begin(), values.begin() + firstParticle, values.end());
+    };
+    rotate(numberOfRows);
+    rotate(originalColor);
+    rotate(colorOffset);
+    rotate(position);
+    rotate(velocity);
+    rotate(imageOffset1);
+    rotate(imageOffset2);
+    rotate(lifetime);
+    rotate(scale);
+    rotate(elapsedTime);
+    rotate(transparency);
+    rotate(imageBlendFactor);
+
+    firstParticle = 0;
+}
+} //namespace graphics
+} //namespace poke
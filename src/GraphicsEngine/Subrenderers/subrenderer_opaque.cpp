@@ -16,6 +16,12 @@ SubrendererOpaque::~SubrendererOpaque()
 	//std::cout << "~SubrendererOpaque();\n";
 }
 
+void SubrendererOpaque::OnPrepare()
+{
+    //Instances are shared with the transparent subrenderer, they must be updated before any recording
+	modelCmdBuffer_.PrepareData();
+}
+
 void SubrendererOpaque::OnRender(const CommandBuffer& commandBuffer)
 {
     const auto& camera = GraphicsEngineLocator::Get().GetCameraData();
@@ -23,8 +29,6 @@ void SubrendererOpaque::OnRender(const CommandBuffer& commandBuffer)
     uniformScene_.Push(kProjectionHash, camera.projectionMatrix);
     uniformScene_.Push(kViewHash, camera.viewMatrix);
 
-	modelCmdBuffer_.PrepareData();
-
     //Single Draw
     for (auto& modelDrawCommand : modelCmdBuffer_.GetForwardModels()) {
         if(modelDrawCommand.materialID != 0 && modelDrawCommand.materialID != 1)
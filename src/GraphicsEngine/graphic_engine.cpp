@@ -36,6 +36,12 @@ GraphicEngine::GraphicEngine(Engine& engine)
 	});
 
     CreatePipelineCache();
+
+    const auto recordWorkerCount = ComputeRecordWorkerCount(std::thread::hardware_concurrency());
+    recordWorkers_.reserve(recordWorkerCount);
+    for (uint32_t i = 0; i < recordWorkerCount; i++) {
+        recordWorkers_.emplace_back(std::make_unique<WorkerThread>());
+    }
 }
 
 GraphicEngine::~GraphicEngine()
@@ -44,6 +50,10 @@ GraphicEngine::~GraphicEngine()
 
     vkQueueWaitIdle(graphicsQueue);
 
+    //Secondary command buffers must be freed before the workers pools
+    secondaryCommandBuffers_.clear();
+    recordWorkers_.clear();
+
     vkDestroyPipelineCache(logicalDevice_, pipelineCache_, nullptr);
 
     for (size_t i = 0; i < inFlightFences_.size(); i++) {
@@ -84,22 +94,33 @@ void GraphicEngine::Render()
 
 	Pipeline::Stage stage;
 
+	const auto imageIndex = swapchain_->GetActiveImageIndex();
+
+	renderer_->GetRendererContainer().Prepare();
+
+	//The slots are numbered across the whole frame, every stage records its own command buffers
+	recordJobs_.clear();
     for (auto& renderStage : renderer_->GetRenderStages()) {
 		renderStage->Update();
 		if (!StartRenderpass(*renderStage)) {
 		    return;
 		}
 
-		auto &commandBuffer = commandBuffers_[swapchain_->GetActiveImageIndex()];
+		auto &commandBuffer = commandBuffers_[imageIndex];
 
+		//Every subpass of the stage is recorded at the same time on the record workers
+		const size_t firstJob = recordJobs_.size();
 		for (const auto &subpass : renderStage->GetSubpasses()) {
 			stage.second = subpass.GetBinding();
+			BuildRecordJobs(stage, recordJobs_);
+		}
+		RecordSecondaryCommandBuffers(firstJob, imageIndex);
 
-			// Renders subpass subrender pipelines.
-			renderer_->GetRendererContainer().RenderStage(stage, *commandBuffer);
+		for (const auto &subpass : renderStage->GetSubpasses()) {
+			ExecuteSecondaryCommandBuffers(firstJob, subpass.GetBinding(), imageIndex);
 
 			if (subpass.GetBinding() != renderStage->GetSubpasses().back().GetBinding()) {
-				vkCmdNextSubpass(*commandBuffer, VK_SUBPASS_CONTENTS_INLINE);
+				vkCmdNextSubpass(*commandBuffer, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
 			}
 		}
 
@@ -108,6 +129,91 @@ void GraphicEngine::Render()
     }
 }
 
+void GraphicEngine::BuildRecordJobs(const Pipeline::Stage& stage, std::vector<RecordJob>& jobs)
+{
+	const auto& renderStage = GetRenderStage(stage.first);
+
+	const RecordJobTarget target{
+		*renderStage.GetRenderPass(),
+		renderStage.GetActiveFramebuffer(swapchain_->GetActiveImageIndex()),
+		renderStage.GetSize()
+	};
+
+	renderer_->GetRendererContainer().BuildRecordJobs(
+		stage,
+		target,
+		static_cast<uint32_t>(recordWorkers_.size()),
+		jobs);
+}
+
+void GraphicEngine::RecordSecondaryCommandBuffers(const size_t firstJob, const size_t imageIndex)
+{
+	auto& secondaryCommandBuffers = secondaryCommandBuffers_[imageIndex];
+	if (secondaryCommandBuffers.size() < recordJobs_.size()) {
+		secondaryCommandBuffers.resize(recordJobs_.size());
+	}
+
+	for (size_t i = firstJob; i < recordJobs_.size(); i++) {
+		const RecordJob& job = recordJobs_[i];
+		recordWorkers_[job.workerIndex]->DoAsync([this, &job, imageIndex] {
+			RecordSecondaryCommandBuffer(job, imageIndex);
+		});
+	}
+
+	for (auto& recordWorker : recordWorkers_) {
+		recordWorker->Wait();
+	}
+}
+
+void GraphicEngine::RecordSecondaryCommandBuffer(const RecordJob& job, const size_t imageIndex)
+{
+	auto& secondaryCommandBuffer = secondaryCommandBuffers_[imageIndex][job.slot];
+	auto& commandBuffer = secondaryCommandBuffer.commandBuffer;
+
+	//Allocated from the pool of the worker's thread
+	if (!commandBuffer) {
+		commandBuffer = std::make_unique<CommandBuffer>(
+			false,
+			VK_QUEUE_GRAPHICS_BIT,
+			VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+		secondaryCommandBuffer.workerIndex = job.workerIndex;
+	}
+	cassert(
+		secondaryCommandBuffer.workerIndex == job.workerIndex,
+		"A secondary command buffer must be recorded by the worker owning its command pool");
+
+	commandBuffer->Begin(job.inheritanceInfo);
+
+	vkCmdSetViewport(*commandBuffer, 0, 1, &job.viewport);
+	vkCmdSetScissor(*commandBuffer, 0, 1, &job.scissor);
+
+	renderer_->GetRendererContainer().Record(job, *commandBuffer);
+
+	commandBuffer->End();
+}
+
+void GraphicEngine::ExecuteSecondaryCommandBuffers(
+	const size_t firstJob,
+	const uint32_t subpass,
+	const size_t imageIndex)
+{
+	secondaryHandles_.clear();
+
+	for (size_t i = firstJob; i < recordJobs_.size(); i++) {
+		const RecordJob& job = recordJobs_[i];
+		if (job.stage.second == subpass) {
+			secondaryHandles_.push_back(*secondaryCommandBuffers_[imageIndex][job.slot].commandBuffer);
+		}
+	}
+
+	if (secondaryHandles_.empty()) { return; }
+
+	vkCmdExecuteCommands(
+		*commandBuffers_[imageIndex],
+		static_cast<uint32_t>(secondaryHandles_.size()),
+		secondaryHandles_.data());
+}
+
 void GraphicEngine::OnEngineDestroy()
 {
 	//Clear drawing command buffer
@@ -156,6 +262,8 @@ void GraphicEngine::RecreateCommandBuffers()
     inFlightFences_.resize(swapchain_->GetImageCount());
 	commandBuffers_.clear();
     commandBuffers_.resize(swapchain_->GetImageCount());
+	secondaryCommandBuffers_.clear();
+	secondaryCommandBuffers_.resize(swapchain_->GetImageCount());
 
     VkSemaphoreCreateInfo semaphoreCreateInfo = {};
     semaphoreCreateInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
@@ -231,6 +339,9 @@ const IDescriptor& GraphicEngine::GetAttachment(const nonstd::string_view& name)
 
 const CommandPool& GraphicEngine::GetCommandPool(const std::thread::id& threadId)
 {
+	//Record workers ask for their own pool concurrently
+	std::lock_guard<std::mutex> lock(commandPoolsMutex_);
+
 	auto it = commandPools_.find(threadId);
 
 	if (it != commandPools_.end()) {
@@ -377,22 +488,14 @@ bool GraphicEngine::StartRenderpass(RenderStage& renderStage)
         static_cast<uint32_t>(renderStage.GetSize().y)
     };
 
-    VkViewport viewport;
-    viewport.x = 0.0f;
-    viewport.y = static_cast<float>(renderArea.extent.height);
-    viewport.width = static_cast<float>(renderArea.extent.width);
-    viewport.height = -static_cast<float>(renderArea.extent.height);
-    viewport.minDepth = 0.0f;
-    viewport.maxDepth = 1.0f;
+    const auto viewport = ComputeViewport(renderStage.GetSize());
     vkCmdSetViewport(
         *commandBuffers_[swapchain_->GetActiveImageIndex()],
         0,
         1,
         &viewport);
 
-    VkRect2D scissor = {};
-    scissor.offset = {0, 0};
-    scissor.extent = renderArea.extent;
+    const auto scissor = ComputeScissor(renderStage.GetSize());
     vkCmdSetScissor(
         *commandBuffers_[swapchain_->GetActiveImageIndex()],
         0,
@@ -413,7 +516,7 @@ bool GraphicEngine::StartRenderpass(RenderStage& renderStage)
     vkCmdBeginRenderPass(
         *commandBuffers_[swapchain_->GetActiveImageIndex()],
         &renderPassBeginInfo,
-        VK_SUBPASS_CONTENTS_INLINE);
+        VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
 
     return true;
 }
@@ -8,15 +8,12 @@ CubicHermiteSpline::CubicHermiteSpline(const std::vector<Vec3>& points) {
 		points.size() < maxSize,
 		"CubiHermiteSpline::SetPoints => The size cannot be greater than 256.");
 
-    for (const auto point : points) {
-		points_[front_] = point;
-		front_++;
-    }
+	path_ = SplineRegistry::Get().Register(points);
 }
 
 bool CubicHermiteSpline::operator==(const CubicHermiteSpline& other) const
 {
-    return front_ == other.front_ && points_ == other.points_;
+    return path_ == other.path_;
 }
 
 bool CubicHermiteSpline::operator!=(const CubicHermiteSpline& other) const
@@ -26,69 +23,36 @@ bool CubicHermiteSpline::operator!=(const CubicHermiteSpline& other) const
 
 void CubicHermiteSpline::AddPoint(const Vec3 point)
 {
-    points_[front_] = point;
-    front_++;
-
-	totalLength_ = 0;
-	for (int i = 1; i < front_ - 2; i++) {
-		totalLength_ += GetSegmentLength(i);
-	}
+	std::vector<Vec3> points = path_->GetPoints();
+	points.push_back(point);
+	SetPoints(points);
 }
 
 Vec3 CubicHermiteSpline::Lerp(const int pointIndex, const double percent) const
 {
-    const auto p0 = points_[pointIndex - 1];
-    const auto p1 = points_[pointIndex];
-    const auto p2 = points_[pointIndex + 1];
-    const auto p3 = points_[pointIndex + 2];
-
-    const auto t0 = 0.0;
-    const auto t1 = GetPortionOfDistance(t0, p0, p1);
-    const auto t2 = GetPortionOfDistance(t1, p1, p2);
-    const auto t3 = GetPortionOfDistance(t2, p0, p3);
-
-    const auto t = ((t2 - t1) * percent) + t1;
-    const auto a1 = p0 * (t1 - t) / (t1 - t0) + p1 * (t - t0) / (t1 - t0);
-    const auto a2 = p1 * (t2 - t) / (t2 - t1) + p2 * (t - t1) / (t2 - t1);
-    const auto a3 = p2 * (t3 - t) / (t3 - t2) + p3 * (t - t2) / (t3 - t2);
-
-    const auto b1 = a1 * (t2 - t) / (t2 - t0) + a2 * (t - t0) / (t2 - t0);
-    const auto b2 = a2 * (t3 - t) / (t3 - t1) + a3 * (t - t1) / (t3 - t1);
-
-	const auto c = b1 * (t2 - t) / (t2 - t1) + b2 * (t - t1) / (t2 - t1);
-    return c;
+	return path_->Evaluate(pointIndex - 1, static_cast<float>(percent));
 }
 
 float CubicHermiteSpline::GetSegmentLength(const int pointIndex) const
 {
-    if (pointIndex < front_) {
-        return Vec3::GetDistance(
-            points_[pointIndex],
-            points_[pointIndex + 1]);
-    }
-    return 0;
+	return path_->GetSegmentLength(pointIndex - 1);
 }
 
 float CubicHermiteSpline::GetTotalLength() const
 {
-	return totalLength_;
+	return path_->GetLength();
 }
 
-std::vector<Vec3> CubicHermiteSpline::GetPoints() const
+const std::vector<Vec3>& CubicHermiteSpline::GetPoints() const
 {
-    std::vector<Vec3> points(front_);
-    for (int i = 0; i < front_; i++) { points[i] = points_[i]; }
-	return points;
+	return path_->GetPoints();
 }
 
 void CubicHermiteSpline::SetPoint(const Vec3 point, const uint8_t pos)
 {
-    points_[pos] = point;
-
-	totalLength_ = 0;
-	for (int i = 1; i < front_ - 2; i++) {
-		totalLength_ += GetSegmentLength(i);
-	}
+	std::vector<Vec3> points = path_->GetPoints();
+	points[pos] = point;
+	SetPoints(points);
 }
 
 void CubicHermiteSpline::SetPoints(const std::vector<Vec3>& points)
@@ -97,25 +61,11 @@ void CubicHermiteSpline::SetPoints(const std::vector<Vec3>& points)
 		points.size() < maxSize,
         "CubiHermiteSpline::SetPoints => The size cannot be greater than 256.");
 
-    for (int i = 0; i < points.size(); i++) { points_[i] = points[i]; }
-	front_ = points.size();
-
-	totalLength_ = 0;
-	for (int i = 1; i < front_ - 2; i++) {
-		totalLength_ += GetSegmentLength(i);
-	}
+	path_ = SplineRegistry::Get().Register(points);
 }
 
-int CubicHermiteSpline::GetSize() const { return front_; }
+int CubicHermiteSpline::GetSize() const { return static_cast<int>(path_->GetPoints().size()); }
 int CubicHermiteSpline::GetMaxSize() const { return maxSize; }
-
-double CubicHermiteSpline::GetPortionOfDistance(const double t, const Vec3 p0, const Vec3 p1) const
-{
-    const auto a = pow(p1.x - p0.x, 2.0f) + pow(p1.y - p0.y, 2.0f) + pow(p1.z - p0.z, 2.0f);
-	const auto b = pow(a, 0.5f);
-	const auto c = pow(b, 1);
-
-    return c + t;
-}
+SplineID CubicHermiteSpline::GetID() const { return path_->GetID(); }
 } //namespace math
 } //namespace poke
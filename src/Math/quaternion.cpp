@@ -93,7 +93,7 @@ Matrix4 Quaternion::ToRotationMatrix4() const
 {
     return Matrix4(
         Vec4(
-            1.0f - 2.0f * (y * y) +
+            1.0f - 2.0f * (y * y) -
             2.0f * (z * z),
             2.0f * x * y +
             2.0f * z * w,
@@ -113,7 +113,7 @@ Matrix4 Quaternion::ToRotationMatrix4() const
             2.0f * y * w,
             2.0f * y * z -
             2.0f * x * w,
-            1.0f - 2.0f * (x * x) +
+            1.0f - 2.0f * (x * x) -
             2.0f * (y * y),
             0.0f),
         Vec4(0.0f, 0.0f, 0.0f, 1.0f));
@@ -154,6 +154,23 @@ Vec3 Quaternion::GetEulerAngles() const
     return ToEulerRad(*this);
 }
 
+Quaternion Quaternion::FromEulerAngles(const Vec3 eulerAngles)
+{
+    const float sinX = sinf(eulerAngles.x * 0.5f);
+    const float cosX = cosf(eulerAngles.x * 0.5f);
+    const float sinY = sinf(eulerAngles.y * 0.5f);
+    const float cosY = cosf(eulerAngles.y * 0.5f);
+    const float sinZ = sinf(eulerAngles.z * 0.5f);
+    const float cosZ = cosf(eulerAngles.z * 0.5f);
+
+    //Product of the rotations around x, y and z
+    return Quaternion(
+        sinX * cosY * cosZ + cosX * sinY * sinZ,
+        cosX * sinY * cosZ - sinX * cosY * sinZ,
+        cosX * cosY * sinZ + sinX * sinY * cosZ,
+        cosX * cosY * cosZ - sinX * sinY * sinZ);
+}
+
 Quaternion Quaternion::FromEulerRad(const math::Vec3 euler) {
 	const float yaw = euler.x;
 	const float pitch = euler.y;
@@ -0,0 +1,248 @@
+#include <Math/spline_path.h>
+
+#include <algorithm>
+
+#include <Math/hash.h>
+
+namespace poke {
+namespace math {
+namespace {
+Vec3 ToVec3(const double x, const double y, const double z)
+{
+    return Vec3(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z));
+}
+
+//Knot parameters of the segment, the distance between two points gives the next one
+struct Knots {
+    double t1;
+    double t2;
+    double t3;
+};
+
+double GetPointsDistance(const Vec3 p0, const Vec3 p1)
+{
+    const double x = p1.x - p0.x;
+    const double y = p1.y - p0.y;
+    const double z = p1.z - p0.z;
+    return std::sqrt(x * x + y * y + z * z);
+}
+
+//Same pyramid of interpolations than the previous CubicHermiteSpline::Lerp
+void Interpolate(const Vec3* p, const Knots knots, const double percent, double out[3])
+{
+    const double t1 = knots.t1;
+    const double t2 = knots.t2;
+    const double t3 = knots.t3;
+    const double t = (t2 - t1) * percent + t1;
+
+    for (int i = 0; i < 3; i++) {
+        const double a1 = p[0][i] * (t1 - t) / t1 + p[1][i] * t / t1;
+        const double a2 = p[1][i] * (t2 - t) / (t2 - t1) + p[2][i] * (t - t1) / (t2 - t1);
+        const double a3 = p[2][i] * (t3 - t) / (t3 - t2) + p[3][i] * (t - t2) / (t3 - t2);
+
+        const double b1 = a1 * (t2 - t) / t2 + a2 * t / t2;
+        const double b2 = a2 * (t3 - t) / (t3 - t1) + a3 * (t - t1) / (t3 - t1);
+
+        out[i] = b1 * (t2 - t) / (t2 - t1) + b2 * (t - t1) / (t2 - t1);
+    }
+}
+} //namespace
+
+SplinePath::SplinePath(const SplineID id, const std::vector<Vec3>& points)
+    : id_(id),
+      points_(points)
+{
+    const int segmentCount = std::max(static_cast<int>(points_.size()) - 3, 0);
+    segments_.resize(segmentCount);
+    segmentStarts_.resize(segmentCount + 1, 0.0f);
+    arcLengths_.resize(segmentCount * (kSamplesPerSegment + 1), 0.0f);
+
+    const double kMinKnotInterval = 1e-6;
+    for (int i = 0; i < segmentCount; i++) {
+        const Vec3* p = &points_[i];
+        Segment& segment = segments_[i];
+
+        Knots knots;
+        knots.t1 = GetPointsDistance(p[0], p[1]);
+        knots.t2 = knots.t1 + GetPointsDistance(p[1], p[2]);
+        knots.t3 = knots.t2 + GetPointsDistance(p[0], p[3]);
+
+        if (knots.t1 < kMinKnotInterval ||
+            knots.t2 - knots.t1 < kMinKnotInterval ||
+            knots.t3 - knots.t2 < kMinKnotInterval) {
+            //Overlapping points have no curve, the segment is a line
+            segment.a = p[1];
+            segment.b = p[2] - p[1];
+            segment.c = Vec3(0.0f);
+            segment.d = Vec3(0.0f);
+        } else {
+            //The interpolation is a cubic of the percentage, it is fitted on 4 samples with the forward differences
+            double f[4][3];
+            for (int j = 0; j < 4; j++) { Interpolate(p, knots, j / 3.0, f[j]); }
+
+            double coefficients[4][3];
+            for (int k = 0; k < 3; k++) {
+                const double d1 = f[1][k] - f[0][k];
+                const double d2 = f[2][k] - 2.0 * f[1][k] + f[0][k];
+                const double d3 = f[3][k] - 3.0 * f[2][k] + 3.0 * f[1][k] - f[0][k];
+
+                coefficients[0][k] = f[0][k];
+                coefficients[1][k] = 3.0 * (d1 - d2 / 2.0 + d3 / 3.0);
+                coefficients[2][k] = 9.0 * (d2 / 2.0 - d3 / 2.0);
+                coefficients[3][k] = 27.0 * (d3 / 6.0);
+            }
+            segment.a = ToVec3(coefficients[0][0], coefficients[0][1], coefficients[0][2]);
+            segment.b = ToVec3(coefficients[1][0], coefficients[1][1], coefficients[1][2]);
+            segment.c = ToVec3(coefficients[2][0], coefficients[2][1], coefficients[2][2]);
+            segment.d = ToVec3(coefficients[3][0], coefficients[3][1], coefficients[3][2]);
+        }
+
+        float* arcLengths = &arcLengths_[i * (kSamplesPerSegment + 1)];
+        Vec3 previousPosition = Evaluate(i, 0.0f);
+        for (int j = 1; j <= kSamplesPerSegment; j++) {
+            const Vec3 position = Evaluate(i, static_cast<float>(j) / kSamplesPerSegment);
+            arcLengths[j] = arcLengths[j - 1] + static_cast<float>(GetPointsDistance(previousPosition, position));
+            previousPosition = position;
+        }
+        segmentStarts_[i + 1] = segmentStarts_[i] + arcLengths[kSamplesPerSegment];
+    }
+}
+
+float SplinePath::GetSegmentLength(const int segment) const
+{
+    if (segment < 0 || segment >= GetSegmentCount()) { return 0.0f; }
+    return segmentStarts_[segment + 1] - segmentStarts_[segment];
+}
+
+float SplinePath::GetSegmentStart(const int segment) const
+{
+    return segmentStarts_[std::min(std::max(segment, 0), GetSegmentCount())];
+}
+
+SplineLocation SplinePath::Locate(const float distance) const
+{
+    SplineLocation location;
+    if (segments_.empty()) { return location; }
+
+    const float clampedDistance = std::min(std::max(distance, 0.0f), GetLength());
+
+    //The segments and their samples are sorted by distance
+    const auto segmentIt = std::upper_bound(segmentStarts_.begin() + 1, segmentStarts_.end() - 1, clampedDistance);
+    location.segment = static_cast<int>(segmentIt - (segmentStarts_.begin() + 1));
+
+    const float* arcLengths = &arcLengths_[location.segment * (kSamplesPerSegment + 1)];
+    const float segmentDistance = clampedDistance - segmentStarts_[location.segment];
+    const float* sampleIt = std::upper_bound(arcLengths + 1, arcLengths + kSamplesPerSegment, segmentDistance);
+    const int sample = static_cast<int>(sampleIt - (arcLengths + 1));
+
+    const float sampleLength = arcLengths[sample + 1] - arcLengths[sample];
+    const float sampleFraction = sampleLength > 0.0f
+                                     ? std::min((segmentDistance - arcLengths[sample]) / sampleLength, 1.0f)
+                                     : 0.0f;
+    location.percentage = (sample + sampleFraction) / kSamplesPerSegment;
+    return location;
+}
+
+float SplinePath::GetDistance(const SplineLocation location) const
+{
+    if (segments_.empty()) { return 0.0f; }
+    if (location.segment < 0) { return 0.0f; }
+    if (location.segment >= GetSegmentCount()) { return GetLength(); }
+
+    const float* arcLengths = &arcLengths_[location.segment * (kSamplesPerSegment + 1)];
+    const float samplePosition = std::min(std::max(location.percentage, 0.0f), 1.0f) * kSamplesPerSegment;
+    const int sample = std::min(static_cast<int>(samplePosition), kSamplesPerSegment - 1);
+    const float sampleFraction = samplePosition - sample;
+
+    return segmentStarts_[location.segment] +
+           arcLengths[sample] + (arcLengths[sample + 1] - arcLengths[sample]) * sampleFraction;
+}
+
+Vec3 SplinePath::Evaluate(int segment, float percentage) const
+{
+    if (segments_.empty()) { return points_.empty() ? Vec3(0.0f) : points_.front(); }
+
+    if (segment < 0) {
+        segment = 0;
+        percentage = 0.0f;
+    } else if (segment >= GetSegmentCount()) {
+        segment = GetSegmentCount() - 1;
+        percentage = 1.0f;
+    }
+
+    const Segment& s = segments_[segment];
+    return s.a + (s.b + (s.c + s.d * percentage) * percentage) * percentage;
+}
+
+void SplinePath::Evaluate(const float* distances, Vec3* positions, const size_t count) const
+{
+    for (size_t i = 0; i < count; i++) { positions[i] = Evaluate(Locate(distances[i])); }
+}
+
+SplineRegistry& SplineRegistry::Get()
+{
+    static SplineRegistry splineRegistry;
+    return splineRegistry;
+}
+
+SplineRegistry::SplineRegistry()
+    : emptySpline_(std::make_shared<SplinePath>(0, std::vector<Vec3>())) {}
+
+std::shared_ptr<const SplinePath> SplineRegistry::Register(const std::vector<Vec3>& points)
+{
+    if (points.empty()) { return emptySpline_; }
+
+    const uint64_t hash = XXH64(points.data(), points.size() * sizeof(Vec3), kHashSeed);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto range = splineIDs_.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+        //Expired while its last reference is being released, it is replaced
+        std::shared_ptr<const SplinePath> path = splines_[it->second].lock();
+        if (path && path->GetPoints() == points) { return path; }
+    }
+
+    const SplineID id = nextID_++;
+    std::shared_ptr<const SplinePath> path(
+        new SplinePath(id, points),
+        [this](const SplinePath* releasedPath) {
+            Unregister(releasedPath);
+            delete releasedPath;
+        });
+    splines_.emplace(id, path);
+    splineIDs_.emplace(hash, id);
+    return path;
+}
+
+void SplineRegistry::Unregister(const SplinePath* path)
+{
+    const std::vector<Vec3>& points = path->GetPoints();
+    const uint64_t hash = XXH64(points.data(), points.size() * sizeof(Vec3), kHashSeed);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    splines_.erase(path->GetID());
+    const auto range = splineIDs_.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == path->GetID()) {
+            splineIDs_.erase(it);
+            break;
+        }
+    }
+}
+
+std::shared_ptr<const SplinePath> SplineRegistry::GetSpline(const SplineID id) const
+{
+    if (id == emptySpline_->GetID()) { return emptySpline_; }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto it = splines_.find(id);
+    return it != splines_.end() ? it->second.lock() : nullptr;
+}
+
+size_t SplineRegistry::GetSplineCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return splines_.size() + 1;
+}
+} //namespace math
+} //namespace poke
@@ -7,7 +7,7 @@ Transform::Transform(
     const Vec3 rotation,
     const Vec3 scale)
     : localPosition_(position),
-      localRotation_(rotation),
+      localRotation_(Quaternion::FromEulerAngles(rotation)),
       localScale_(scale) {}
 
 bool Transform::operator==(const Transform& other) const
@@ -26,9 +26,13 @@ Vec3 Transform::GetLocalPosition() const { return localPosition_; }
 
 void Transform::SetLocalPosition(const Vec3 value) { localPosition_ = value; }
 
-Vec3 Transform::GetLocalRotation() const { return localRotation_; }
+Vec3 Transform::GetLocalRotation() const { return localRotation_.GetEulerAngles(); }
 
-void Transform::SetLocalRotation(const Vec3 value) { localRotation_ = value; }
+void Transform::SetLocalRotation(const Vec3 value) { localRotation_ = Quaternion::FromEulerAngles(value); }
+
+Quaternion Transform::GetLocalOrientation() const { return localRotation_; }
+
+void Transform::SetLocalOrientation(const Quaternion value) { localRotation_ = value; }
 
 Vec3 Transform::GetLocalScale() const { return localScale_; }
 
@@ -39,38 +43,27 @@ const json Transform::ToJson() const
     json transformJson = json();
     transformJson["position"] = localPosition_.ToJson();
     transformJson["scale"] = localScale_.ToJson();
-    transformJson["rotation"] = localRotation_.ToJson();
+    transformJson["rotation"] = GetLocalRotation().ToJson();
     return transformJson;
 }
 
 void Transform::SetFromJson(const json& transformJson)
 {
     localPosition_.SetFromJson(transformJson["position"]);
-    localRotation_.SetFromJson(transformJson["rotation"]);
+    Vec3 rotation;
+    rotation.SetFromJson(transformJson["rotation"]);
+    localRotation_ = Quaternion::FromEulerAngles(rotation);
     localScale_.SetFromJson(transformJson["scale"]);
 }
 
-Matrix4 Transform::GetWorldMatrix() const
+Matrix4 Transform::GetLocalMatrix() const
 {
-    auto parentMatrix = Matrix4::Identity();
-    parentMatrix = Matrix4::Translate(parentMatrix, localPosition_);
-
-    parentMatrix = Matrix4::Rotate(
-        parentMatrix,
-        localRotation_.x,
-        Vec3(1, 0, 0));
-    parentMatrix = Matrix4::Rotate(
-        parentMatrix,
-        localRotation_.y,
-        Vec3(0, 1, 0));
-    parentMatrix = Matrix4::Rotate(
-        parentMatrix,
-        localRotation_.z,
-        Vec3(0, 0, 1));
-
-    parentMatrix = Matrix4::Scale(parentMatrix, localScale_);
-
-    return parentMatrix;
+    //The translation only writes the last column of rotation * scale
+    Matrix4 localMatrix = Matrix4::Scale(localRotation_.ToRotationMatrix4(), localScale_);
+    localMatrix.SetColumn(3, Vec4(localPosition_.x, localPosition_.y, localPosition_.z, 1.0f));
+    return localMatrix;
 }
+
+Matrix4 Transform::GetWorldMatrix() const { return GetLocalMatrix(); }
 } //namespace math
 } //namespace poke
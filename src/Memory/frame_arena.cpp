@@ -0,0 +1,123 @@
+#include <Memory/frame_arena.h>
+
+#include <algorithm>
+#include <mutex>
+
+namespace poke
+{
+namespace memory
+{
+namespace
+{
+struct ArenaRegistry {
+	std::mutex mutex;
+	std::vector<FrameArena*> arenas;
+	size_t lastFramePeakSize = 0;
+};
+
+ArenaRegistry& GetRegistry()
+{
+	static ArenaRegistry registry;
+	return registry;
+}
+
+uint8_t* AlignPointer(uint8_t* ptr, const size_t alignment)
+{
+	const auto address = reinterpret_cast<uintptr_t>(ptr);
+	return reinterpret_cast<uint8_t*>((address + alignment - 1) & ~(alignment - 1));
+}
+} //namespace
+
+FrameArena::FrameArena(const size_t capacity)
+	: capacity_(capacity)
+{
+	stats_.capacity = capacity_;
+
+	auto& registry = GetRegistry();
+	std::lock_guard<std::mutex> lock(registry.mutex);
+	registry.arenas.push_back(this);
+}
+
+FrameArena::~FrameArena()
+{
+	auto& registry = GetRegistry();
+	std::lock_guard<std::mutex> lock(registry.mutex);
+	registry.arenas.erase(std::find(registry.arenas.begin(), registry.arenas.end(), this));
+}
+
+FrameArena& FrameArena::Get()
+{
+	thread_local FrameArena arena;
+	return arena;
+}
+
+void FrameArena::ResetAll()
+{
+	auto& registry = GetRegistry();
+	std::lock_guard<std::mutex> lock(registry.mutex);
+
+	registry.lastFramePeakSize = 0;
+	for (auto* arena : registry.arenas) {
+		registry.lastFramePeakSize = std::max(registry.lastFramePeakSize, arena->stats_.peakSize);
+		arena->Reset();
+	}
+}
+
+size_t FrameArena::GetLastFramePeakSize()
+{
+	auto& registry = GetRegistry();
+	std::lock_guard<std::mutex> lock(registry.mutex);
+	return registry.lastFramePeakSize;
+}
+
+void* FrameArena::Allocate(const size_t size, const size_t alignment)
+{
+	//The buffer is only created when the thread use it for the first time
+	if (!buffer_) { buffer_ = std::make_unique<uint8_t[]>(capacity_); }
+
+	uint8_t* ptr = AlignPointer(buffer_.get() + offset_, alignment);
+	const size_t newOffset = ptr - buffer_.get() + size;
+
+	if (newOffset <= capacity_) {
+		stats_.usedSize += newOffset - offset_;
+		offset_ = newOffset;
+	} else {
+		overflowBlocks_.emplace_back(std::make_unique<uint8_t[]>(size + alignment));
+		ptr = AlignPointer(overflowBlocks_.back().get(), alignment);
+		overflowSize_ += size + alignment;
+		stats_.usedSize += size + alignment;
+		stats_.overflowCount++;
+	}
+
+	stats_.peakSize = std::max(stats_.peakSize, stats_.usedSize);
+	stats_.highWaterMark = std::max(stats_.highWaterMark, stats_.usedSize);
+	return ptr;
+}
+
+void FrameArena::Deallocate(void* ptr, const size_t size)
+{
+	auto* bytes = static_cast<uint8_t*>(ptr);
+	if (!buffer_ || bytes + size != buffer_.get() + offset_) { return; }
+
+	const size_t newOffset = bytes - buffer_.get();
+	stats_.usedSize -= offset_ - newOffset;
+	offset_ = newOffset;
+}
+
+void FrameArena::Reset()
+{
+	//Grow the buffer so the next frames fit inside
+	if (overflowSize_ > 0) {
+		capacity_ = std::max(capacity_ * 2, stats_.peakSize);
+		buffer_ = std::make_unique<uint8_t[]>(capacity_);
+		overflowBlocks_.clear();
+		overflowSize_ = 0;
+	}
+
+	offset_ = 0;
+	stats_.usedSize = 0;
+	stats_.peakSize = 0;
+	stats_.capacity = capacity_;
+}
+} //namespace memory
+} //namespace poke
@@ -3,6 +3,7 @@
 #include <Utility/log.h>
 #include <CoreEngine/engine.h>
 #include <Utility/profiler.h>
+#include <Memory/frame_arena.h>
 
 namespace poke {
 namespace physics {
@@ -25,7 +26,7 @@ void PhysicsEngine::OnPhysicUpdate()
     //Find new collision
 	pok_BeginProfiling(Compute_aabb, 0);
 
-	std::vector<AABB> aabbs;
+	FrameVector<AABB> aabbs;
 	aabbs.resize(physicsEngineData_.entities.size());
 	for (size_t i = 0; i < physicsEngineData_.entities.size(); i++) {
 		const auto transform = physicsEngineData_.worldTransforms[i];
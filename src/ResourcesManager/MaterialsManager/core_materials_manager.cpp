@@ -1,10 +1,20 @@
 #include <ResourcesManager/MaterialsManager/core_materials_manager.h>
 
+#include <algorithm>
+
 #include <GraphicsEngine/Models/material.h>
 #include <CoreEngine/ServiceLocator/service_locator_definition.h>
 #include <Utility/log.h>
 
 namespace poke {
+namespace {
+bool IsTexture(
+    const std::experimental::optional<const graphics::Image2d&>& texture,
+    const graphics::Image2d& image2d)
+{
+    return texture && &*texture == &image2d;
+}
+} //namespace
 
 CoreMaterialsManager::CoreMaterialsManager()
 {
@@ -23,7 +33,23 @@ CoreMaterialsManager::CoreMaterialsManager()
 
 void CoreMaterialsManager::AddMaterial(const std::string& materialName)
 {
-    auto materialJson = LoadJson(materialName, FileType::MATERIAL);
+    const ResourceID materialID = math::HashString(materialName);
+    if (materialIndex_.Find(materialID) != kInvalidResourceHandle) { return; }
+
+    const auto pendingIt = std::find_if(
+        pendingMaterials_.begin(),
+        pendingMaterials_.end(),
+        [materialID](const std::pair<ResourceID, Future<json>>& pendingMaterial) {
+            return pendingMaterial.first == materialID;
+        });
+
+    json materialJson;
+    if (pendingIt != pendingMaterials_.end()) {
+        materialJson = std::move(pendingIt->second.Get());
+        pendingMaterials_.erase(pendingIt);
+    } else {
+        materialJson = LoadJson(materialName, FileType::MATERIAL);
+    }
 
     const graphics::MaterialType materialType = materialJson["materialType"];
 
@@ -36,6 +62,7 @@ void CoreMaterialsManager::AddMaterial(const std::string& materialName)
         skyboxMaterials_.back().SetFromJson(materialJson);
 
         skyboxMaterialIDs_.emplace_back(math::HashString(materialName));
+        IndexLastMaterial(graphics::MaterialType::SKYBOX, skyboxMaterialIDs_);
 
         skyboxMaterials_.back().CreatePipeline(graphics::VertexMesh::GetVertexInput(0));
     }
@@ -59,6 +86,7 @@ void CoreMaterialsManager::AddMaterial(const std::string& materialName)
         diffuseMaterials_.back().SetFromJson(materialJson);
 
         diffuseMaterialIDs_.emplace_back(math::HashString(materialName));
+        IndexLastMaterial(graphics::MaterialType::DIFFUSE, diffuseMaterialIDs_);
 
         diffuseMaterials_.back().CreatePipeline(graphics::VertexMesh::GetVertexInput(0));
     }
@@ -74,6 +102,7 @@ void CoreMaterialsManager::AddMaterial(const std::string& materialName)
         trailMaterials_.back().SetFromJson(materialJson);
 
         trailMaterialIDs_.emplace_back(math::HashString(materialName));
+        IndexLastMaterial(graphics::MaterialType::TRAIL, trailMaterialIDs_);
 
         trailMaterials_.back().CreatePipeline(graphics::VertexMesh::GetVertexInput(0));
     }
@@ -89,6 +118,7 @@ void CoreMaterialsManager::AddMaterial(const std::string& materialName)
 		particleMaterials_.back().SetFromJson(materialJson);
 
 		particleMaterialIDs_.emplace_back(math::HashString(materialName));
+		IndexLastMaterial(graphics::MaterialType::PARTICLE, particleMaterialIDs_);
 
 		particleMaterials_.back().CreatePipeline(graphics::VertexMesh::GetVertexInput(0));
 	}
@@ -105,30 +135,67 @@ graphics::Material& CoreMaterialsManager::GetMaterial(const std::string& materia
 graphics::Material& CoreMaterialsManager::GetMaterial(
     const ResourceID resourceID)
 {
-    //Diffuse materials
-    for (size_t i = 0; i < diffuseMaterialIDs_.size(); i++) {
-        if (diffuseMaterialIDs_[i] == resourceID) { return diffuseMaterials_[i]; }
-    }
+    const ResourceHandle handle = materialIndex_.Find(resourceID);
 
-    //Particles materials
-	for (size_t i = 0; i < particleMaterialIDs_.size(); i++) {
-		if (particleMaterialIDs_[i] == resourceID) { return particleMaterials_[i]; }
-	}
+    cassert(
+        handle != kInvalidResourceHandle,
+        "Impossible to get " << resourceID <<
+        " material, should be loaded before being accessed");
 
-    //Trails materials
-    for (size_t i = 0; i < trailMaterialIDs_.size(); i++) {
-        if (trailMaterialIDs_[i] == resourceID) { return trailMaterials_[i]; }
-    }
+    return GetMaterialByHandle(handle);
+}
 
-    //Skybox materials
-    for (size_t i = 0; i < skyboxMaterialIDs_.size(); i++) {
-        if (skyboxMaterialIDs_[i] == resourceID) { return skyboxMaterials_[i]; }
+ResourceHandle CoreMaterialsManager::GetMaterialHandle(const ResourceID resourceID) const
+{
+    return materialIndex_.Find(resourceID);
+}
+
+graphics::Material& CoreMaterialsManager::GetMaterialByHandle(const ResourceHandle handle)
+{
+    const size_t index = ResourceIndex::GetHandleIndex(handle);
+
+    switch (static_cast<graphics::MaterialType>(ResourceIndex::GetHandleStorage(handle))) {
+    case graphics::MaterialType::DIFFUSE:
+        return diffuseMaterials_[index];
+    case graphics::MaterialType::SKYBOX:
+        return skyboxMaterials_[index];
+    case graphics::MaterialType::TRAIL:
+        return trailMaterials_[index];
+    case graphics::MaterialType::PARTICLE:
+        return particleMaterials_[index];
+    default:
+        cassert(false, "Invalid material handle " << handle);
+        abort();
     }
+}
 
-    cassert(
-        false,
-        "Impossible to get " << resourceID <<
-        " material, should be loaded before being accessed");
+void CoreMaterialsManager::IndexLastMaterial(
+    const graphics::MaterialType materialType,
+    const std::vector<ResourceID>& materialIDs)
+{
+    materialIndex_.Insert(
+        materialIDs.back(),
+        ResourceIndex::MakeHandle(static_cast<uint8_t>(materialType), materialIDs.size() - 1));
+}
+
+void CoreMaterialsManager::RebuildIndex()
+{
+    materialIndex_.Clear();
+
+    //Same priority as the previous linear search, the first type found wins
+    const std::pair<graphics::MaterialType, const std::vector<ResourceID>*> materialLists[] = {
+        { graphics::MaterialType::SKYBOX, &skyboxMaterialIDs_ },
+        { graphics::MaterialType::TRAIL, &trailMaterialIDs_ },
+        { graphics::MaterialType::PARTICLE, &particleMaterialIDs_ },
+        { graphics::MaterialType::DIFFUSE, &diffuseMaterialIDs_ }
+    };
+    for (const auto& materialList : materialLists) {
+        for (size_t i = 0; i < materialList.second->size(); i++) {
+            materialIndex_.Insert(
+                (*materialList.second)[i],
+                ResourceIndex::MakeHandle(static_cast<uint8_t>(materialList.first), i));
+        }
+    }
 }
 
 void CoreMaterialsManager::Clear()
@@ -145,6 +212,9 @@ void CoreMaterialsManager::Clear()
 	particleMaterials_.clear();
 	particleMaterialIDs_.clear();
 
+    pendingMaterials_.clear();
+    materialIndex_.Clear();
+
     defaultMaterialIDLoaded_ = false;
     defaultMaterialSkyboxIDLoaded_ = false;
 }
@@ -161,6 +231,8 @@ void CoreMaterialsManager::Resize(const size_t newSize)
 
 		particleMaterials_.resize(newSize);
 		particleMaterialIDs_.resize(newSize);
+
+        RebuildIndex();
     } else {
         trailMaterials_.reserve(newSize);
         trailMaterialIDs_.reserve(newSize);
@@ -179,6 +251,7 @@ ResourceID CoreMaterialsManager::GetDefaultMaterialID()
         diffuseMaterials_.emplace_back(MaterialDiffuse());
 
         diffuseMaterialIDs_.emplace_back(math::HashString(kDefaultMaterialName));
+        IndexLastMaterial(graphics::MaterialType::DIFFUSE, diffuseMaterialIDs_);
 
         diffuseMaterials_.back().CreatePipeline(graphics::VertexMesh::GetVertexInput(0));
 
@@ -197,6 +270,7 @@ ResourceID CoreMaterialsManager::GetDefaultSkyboxMaterialID()
         skyboxMaterials_.back().SetTexture(defaultImageCube_);
 
         skyboxMaterialIDs_.emplace_back(math::HashString(kDefaultSkyboxMaterialName));
+        IndexLastMaterial(graphics::MaterialType::SKYBOX, skyboxMaterialIDs_);
 
         skyboxMaterials_.back().CreatePipeline(graphics::VertexMesh::GetVertexInput(0));
 
@@ -208,6 +282,8 @@ ResourceID CoreMaterialsManager::GetDefaultSkyboxMaterialID()
 
 void CoreMaterialsManager::SetFromJson(const json& materialsJson)
 {
+    PreloadMaterials(materialsJson);
+
     for (const auto& materialJson : materialsJson) 
     {
         std::string materialsName = materialJson;
@@ -216,6 +292,87 @@ void CoreMaterialsManager::SetFromJson(const json& materialsJson)
     }
 }
 
+void CoreMaterialsManager::SetResourceLoader(ResourceLoader& resourceLoader)
+{
+    resourceLoader_ = &resourceLoader;
+}
+
+void CoreMaterialsManager::ReloadMaterial(const std::string& materialName, const json& materialJson)
+{
+    const ResourceHandle handle = materialIndex_.Find(math::HashString(materialName));
+    if (handle == kInvalidResourceHandle) { return; }
+
+    const graphics::MaterialType materialType = materialJson["materialType"];
+    if (static_cast<uint8_t>(materialType) != ResourceIndex::GetHandleStorage(handle)) {
+        LogWarning("The material " + materialName + " changed of type, it will be updated with the scene");
+        return;
+    }
+
+    //Textures can be added to the material since it was loaded
+    if (materialType == graphics::MaterialType::SKYBOX) {
+        TextureManagerLocator::Get().AddTextureCube(materialJson["texture"].get<std::string>());
+    } else {
+        for (const char* textureKey : { "textureBaseColor", "textureNormal", "textureRMA" }) {
+            if (CheckJsonExists(materialJson, textureKey)) {
+                TextureManagerLocator::Get().AddTexture2D(materialJson[textureKey].get<std::string>());
+            }
+        }
+    }
+
+    GetMaterialByHandle(handle).SetFromJson(materialJson);
+}
+
+void CoreMaterialsManager::ReplaceTexture2D(
+    const graphics::Image2d& oldTexture,
+    const graphics::Image2d& newTexture)
+{
+    for (MaterialDiffuse& material : diffuseMaterials_) {
+        if (IsTexture(material.GetTextureBaseColor(), oldTexture)) { material.SetTextureBaseColor(newTexture); }
+        if (IsTexture(material.GetTextureNormal(), oldTexture)) { material.SetTextureNormal(newTexture); }
+        if (IsTexture(material.GetTextureMRA(), oldTexture)) { material.SetTextureRMA(newTexture); }
+    }
+
+    for (MaterialTrail& material : trailMaterials_) {
+        if (IsTexture(material.GetTextureBaseColor(), oldTexture)) { material.SetTextureBaseColor(newTexture); }
+    }
+
+    for (MaterialParticle& material : particleMaterials_) {
+        if (IsTexture(material.GetTextureBaseColor(), oldTexture)) { material.SetTextureBaseColor(newTexture); }
+    }
+}
+
+void CoreMaterialsManager::PreloadMaterials(const json& materialsJson)
+{
+    if (!resourceLoader_) { return; }
+
+    for (const auto& materialJson : materialsJson) {
+        const std::string materialName = materialJson;
+
+        pendingMaterials_.emplace_back(
+            math::HashString(materialName),
+            resourceLoader_->LoadAsync<json>([materialName]() {
+                return LoadJson(materialName, FileType::MATERIAL);
+            }));
+    }
+
+    //The material files are small, they are read first to know which textures to decode
+    std::vector<std::string> texturePaths;
+    for (auto& pendingMaterial : pendingMaterials_) {
+        const json& materialJson = pendingMaterial.second.Get();
+        if (!CheckJsonExists(materialJson, "materialType")) { continue; }
+
+        const graphics::MaterialType materialType = materialJson["materialType"];
+        if (materialType == graphics::MaterialType::SKYBOX) { continue; }
+
+        for (const char* textureKey : { "textureBaseColor", "textureNormal", "textureRMA" }) {
+            if (CheckJsonExists(materialJson, textureKey)) {
+                texturePaths.push_back(materialJson[textureKey].get<std::string>());
+            }
+        }
+    }
+    TextureManagerLocator::Get().PreloadTextures2D(texturePaths);
+}
+
 json CoreMaterialsManager::ToJson()
 {
     LogWarning("You're trying to save using the CoreMeshManager, nothing will be saved.");
@@ -23,6 +23,17 @@ GetMaterial(ResourceID resourceID)
 	abort();
 }
 
+ResourceHandle NullMaterialsManager::GetMaterialHandle(ResourceID resourceID) const
+{
+	return kInvalidResourceHandle;
+}
+
+graphics::Material& NullMaterialsManager::GetMaterialByHandle(ResourceHandle handle)
+{
+    cassert(false, "Impossible to acces to null material manager");
+	abort();
+}
+
 XXH64_hash_t NullMaterialsManager::GetDefaultMaterialID()
 {
 	return 0;
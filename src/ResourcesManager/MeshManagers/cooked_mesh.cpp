@@ -0,0 +1,196 @@
+#include <ResourcesManager/MeshManagers/cooked_mesh.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include <Math/hash.h>
+#include <Utility/file_system.h>
+
+namespace poke {
+namespace cooked_mesh {
+uint64_t HashSource(const uint8_t* data, const size_t size)
+{
+	return XXH64(data, size, math::kHashSeed);
+}
+} //namespace cooked_mesh
+
+namespace {
+using namespace cooked_mesh;
+
+size_t AlignDataSize(const size_t size)
+{
+	return (size + kDataAlignment - 1) & ~(kDataAlignment - 1);
+}
+
+bool IsDataInBounds(const uint64_t offset, const uint64_t size, const size_t dataSize)
+{
+	return offset % kDataAlignment == 0 && offset <= dataSize && size <= dataSize - offset;
+}
+} //namespace
+
+bool CookedMeshView::SetData(const uint8_t* data, const size_t size)
+{
+	data_ = nullptr;
+	header_ = nullptr;
+	lods_ = nullptr;
+
+	if (data == nullptr || size < sizeof(Header)) { return false; }
+
+	const Header* header = reinterpret_cast<const Header*>(data);
+	if (header->magic != kMagic || header->version != kVersion) { return false; }
+	if (header->lodCount == 0 || header->lodCount > graphics::kMaxLodCount) { return false; }
+	if (!IsDataInBounds(AlignDataSize(sizeof(Header)), uint64_t(header->lodCount) * sizeof(Lod), size)) { return false; }
+
+	const Lod* lods = reinterpret_cast<const Lod*>(data + AlignDataSize(sizeof(Header)));
+	for (uint32_t i = 0; i < header->lodCount; i++) {
+		const Lod& lod = lods[i];
+		if (lod.indexSize != sizeof(uint16_t) && lod.indexSize != sizeof(uint32_t)) { return false; }
+
+		const uint64_t verticesSize = uint64_t(lod.vertexCount) * sizeof(graphics::VertexMesh);
+		const uint64_t indicesSize = uint64_t(lod.indexCount) * lod.indexSize;
+		if (!IsDataInBounds(lod.vertexOffset, verticesSize, size) ||
+			!IsDataInBounds(lod.indexOffset, indicesSize, size)) {
+			return false;
+		}
+	}
+
+	data_ = data;
+	header_ = header;
+	lods_ = lods;
+	return true;
+}
+
+bool CookedMeshView::IsUpToDate(const uint64_t sourceHash, const uint64_t sourceSize) const
+{
+	return IsValid() && header_->sourceHash == sourceHash && header_->sourceSize == sourceSize;
+}
+
+const graphics::VertexMesh* CookedMeshView::GetVertices(const size_t lod) const
+{
+	return reinterpret_cast<const graphics::VertexMesh*>(data_ + lods_[lod].vertexOffset);
+}
+
+const void* CookedMeshView::GetIndices(const size_t lod) const
+{
+	return data_ + lods_[lod].indexOffset;
+}
+
+std::vector<uint32_t> CookedMeshView::GetIndicesUint32(const size_t lod) const
+{
+	std::vector<uint32_t> indices(lods_[lod].indexCount);
+	if (lods_[lod].indexSize == sizeof(uint32_t)) {
+		std::memcpy(indices.data(), GetIndices(lod), indices.size() * sizeof(uint32_t));
+	} else {
+		const uint16_t* indices16 = static_cast<const uint16_t*>(GetIndices(lod));
+		std::copy(indices16, indices16 + indices.size(), indices.begin());
+	}
+	return indices;
+}
+
+bool CookedMeshFile::Open(const std::string& filePath)
+{
+	Close();
+	if (!file_.Open(filePath)) { return false; }
+
+	if (!view_.SetData(file_.GetData(), file_.GetSize())) {
+		file_.Close();
+		return false;
+	}
+	return true;
+}
+
+void CookedMeshFile::Close()
+{
+	view_ = CookedMeshView();
+	file_.Close();
+}
+
+std::vector<uint8_t> CookMesh(
+	const std::vector<graphics::VertexMesh>& vertices,
+	const std::vector<uint32_t>& indices,
+	const uint64_t sourceHash,
+	const uint64_t sourceSize,
+	const std::vector<MeshLodData>& lods)
+{
+	std::vector<const std::vector<graphics::VertexMesh>*> lodVertices{ &vertices };
+	std::vector<const std::vector<uint32_t>*> lodIndices{ &indices };
+	for (size_t i = 0; i < lods.size() && lodVertices.size() < graphics::kMaxLodCount; i++) {
+		lodVertices.push_back(&lods[i].vertices);
+		lodIndices.push_back(&lods[i].indices);
+	}
+
+	Header header{};
+	header.magic = kMagic;
+	header.version = kVersion;
+	header.sourceHash = sourceHash;
+	header.sourceSize = sourceSize;
+	header.lodCount = static_cast<uint32_t>(lodVertices.size());
+
+	//Same extents than Mesh::Initialize, the MeshShape built from a cooked mesh stays the same
+	header.minExtents = math::Vec3(
+		std::numeric_limits<float>::max(),
+		std::numeric_limits<float>::max(),
+		std::numeric_limits<float>::max());
+	header.maxExtents = math::Vec3(
+		std::numeric_limits<float>::lowest(),
+		std::numeric_limits<float>::lowest(),
+		std::numeric_limits<float>::lowest());
+	for (const auto& vertex : vertices) {
+		header.minExtents = math::Vec3(
+			std::min(header.minExtents.x, vertex.position.x),
+			std::min(header.minExtents.y, vertex.position.y),
+			std::min(header.minExtents.z, vertex.position.z));
+		header.maxExtents = math::Vec3(
+			std::max(header.maxExtents.x, vertex.position.x),
+			std::max(header.maxExtents.y, vertex.position.y),
+			std::max(header.maxExtents.z, vertex.position.z));
+	}
+
+	std::vector<Lod> lodEntries(lodVertices.size());
+	size_t offset = AlignDataSize(AlignDataSize(sizeof(Header)) + lodEntries.size() * sizeof(Lod));
+	for (size_t i = 0; i < lodEntries.size(); i++) {
+		//0xFFFF is kept free, it is the primitive restart value of 16 bits indices
+		const bool useIndices16 = lodVertices[i]->size() < std::numeric_limits<uint16_t>::max();
+
+		Lod& lod = lodEntries[i];
+		lod.vertexCount = static_cast<uint32_t>(lodVertices[i]->size());
+		lod.indexCount = static_cast<uint32_t>(lodIndices[i]->size());
+		lod.indexSize = useIndices16 ? sizeof(uint16_t) : sizeof(uint32_t);
+		lod.vertexOffset = static_cast<uint32_t>(offset);
+		offset = AlignDataSize(offset + lodVertices[i]->size() * sizeof(graphics::VertexMesh));
+		lod.indexOffset = static_cast<uint32_t>(offset);
+		offset = AlignDataSize(offset + lodIndices[i]->size() * lod.indexSize);
+	}
+
+	std::vector<uint8_t> bytes(offset, 0);
+	std::memcpy(bytes.data(), &header, sizeof(Header));
+	std::memcpy(bytes.data() + AlignDataSize(sizeof(Header)), lodEntries.data(), lodEntries.size() * sizeof(Lod));
+
+	for (size_t i = 0; i < lodEntries.size(); i++) {
+		const Lod& lod = lodEntries[i];
+		const std::vector<graphics::VertexMesh>& levelVertices = *lodVertices[i];
+		const std::vector<uint32_t>& levelIndices = *lodIndices[i];
+
+		if (!levelVertices.empty()) {
+			std::memcpy(bytes.data() + lod.vertexOffset, levelVertices.data(), levelVertices.size() * sizeof(graphics::VertexMesh));
+		}
+
+		if (lod.indexSize == sizeof(uint16_t)) {
+			uint16_t* indices16 = reinterpret_cast<uint16_t*>(bytes.data() + lod.indexOffset);
+			for (size_t j = 0; j < levelIndices.size(); j++) {
+				indices16[j] = static_cast<uint16_t>(levelIndices[j]);
+			}
+		} else if (!levelIndices.empty()) {
+			std::memcpy(bytes.data() + lod.indexOffset, levelIndices.data(), levelIndices.size() * sizeof(uint32_t));
+		}
+	}
+	return bytes;
+}
+
+bool WriteCookedMesh(const std::vector<uint8_t>& bytes, const std::string& filePath)
+{
+	//The file can be mapped by another load of the same resource
+	return PokFileSystem::WriteFileAtomically(filePath, bytes.data(), bytes.size());
+}
+} //namespace poke
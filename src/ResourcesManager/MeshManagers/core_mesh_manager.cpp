@@ -1,5 +1,7 @@
 #include <ResourcesManager/MeshManagers/core_mesh_manager.h>
 
+#include <algorithm>
+
 #include <CoreEngine/cassert.h>
 #include <CoreEngine/engine.h>
 #include <Utility/log.h>
@@ -16,10 +18,14 @@ CoreMeshManager::CoreMeshManager()
       sphereGizmoPrimitive_(false)
 {
     meshes_.reserve(kMeshObjDefaultSize);
+    meshLods_.reserve(kMeshObjDefaultSize);
     meshIDs_.reserve(kMeshObjDefaultSize);
 
 	dynamicMeshes_.resize(1000);
 	dynamicMeshIDs_.resize(1000);
+
+	meshIndex_.Reserve(kMeshObjDefaultSize + dynamicMeshIDs_.size());
+	RebuildIndex();
 }
 
 void CoreMeshManager::Init()
@@ -43,46 +49,70 @@ void CoreMeshManager::AddMesh(const std::string& name)
 {
     const auto id = math::HashString(name);
 
+    const auto pendingIt = FindPendingMesh(id);
+
+    //Obj meshes can hide a primitive with the same name
+    if (HasObjMesh(id)) {
+        //The data parsed again for an already loaded mesh is dropped
+        if (pendingIt != pendingMeshes_.end()) { pendingMeshes_.erase(pendingIt); }
+        return;
+    }
+
+    meshIndex_.Insert(id, ResourceIndex::MakeHandle(static_cast<uint8_t>(MeshStorage::OBJ), meshIDs_.size()));
     meshIDs_.emplace_back(id);
 
     meshes_.emplace_back(MeshObj());
-	reinterpret_cast<MeshObj&>(meshes_.back()).Load(name);
+	auto& meshObj = reinterpret_cast<MeshObj&>(meshes_.back());
+	meshLods_.emplace_back();
+
+	if (pendingIt != pendingMeshes_.end()) {
+		const MeshObjData& meshData = pendingIt->second.Get();
+		meshObj.Load(meshData);
+		MeshObj::LoadLods(meshData, meshLods_.back());
+		pendingMeshes_.erase(pendingIt);
+	} else if (!name.empty()) {
+		const MeshObjData meshData = MeshObj::LoadData(name);
+		meshObj.Load(meshData);
+		MeshObj::LoadLods(meshData, meshLods_.back());
+	}
 }
 
-DynamicMeshIndex CoreMeshManager::CreateDynamicMesh()
+void CoreMeshManager::ReloadMesh(const std::string& name, const MeshObjData& meshData)
 {
-    //Set dynamicMeshIDs
-    
-    for (size_t i = 0; i < dynamicMeshes_.size(); i++) {
-        if (dynamicMeshIDs_[i] == 0) {
-			dynamicMeshIDs_[i] = math::HashString("DynamicMesh" + std::to_string(i));
-			return i;
-        }
-    }
-
-	std::vector<std::vector<graphics::VertexMesh>> vertices(dynamicMeshes_.size());
-	std::vector<std::vector<uint32_t>> indices(dynamicMeshes_.size());
-
-	for (size_t i = 0; i < dynamicMeshes_.size(); i++) {
-		vertices[i] = dynamicMeshes_[i].GetVertices<graphics::VertexMesh>(0);
-		indices[i] = dynamicMeshes_[i].GetIndices(0);
+	const ResourceHandle handle = meshIndex_.Find(math::HashString(name));
+	if (handle == kInvalidResourceHandle ||
+		ResourceIndex::GetHandleStorage(handle) != static_cast<uint8_t>(MeshStorage::OBJ)) {
+		return;
 	}
 
-	dynamicMeshes_.resize(dynamicMeshes_.size() * 2 + 1);
-	dynamicMeshIDs_.resize(dynamicMeshes_.size());
-	for (size_t i = 0; i < dynamicMeshes_.size(); i++) {
-		dynamicMeshes_[i].Initialize(vertices[i], indices[i]);
-	}
-	
+	//The model instances reference the meshes, they are initialized again in place
+	const size_t index = ResourceIndex::GetHandleIndex(handle);
+	reinterpret_cast<MeshObj&>(meshes_[index]).Load(meshData);
+	MeshObj::ReloadLods(meshData, meshLods_[index]);
+}
 
-	for (size_t i = 0; i < dynamicMeshes_.size(); i++) {
-		if (dynamicMeshIDs_[i] == 0) {
-			dynamicMeshIDs_[i] = math::HashString("DynamicMesh" + std::to_string(i));
-			return i;
-		}
-	}
+DynamicMeshIndex CoreMeshManager::CreateDynamicMesh(const uint32_t vertexCapacity, const std::vector<uint32_t>& indexes)
+{
+    size_t index = std::find(dynamicMeshIDs_.begin(), dynamicMeshIDs_.end(), 0) - dynamicMeshIDs_.begin();
+    if (index == dynamicMeshIDs_.size()) {
+        dynamicMeshes_.resize(dynamicMeshes_.size() * 2 + 1);
+        dynamicMeshIDs_.resize(dynamicMeshes_.size());
+        meshIndex_.Reserve(meshIDs_.size() + dynamicMeshIDs_.size());
+    }
 
-	return 0;
+    if (!dynamicMeshes_[index]) { dynamicMeshes_[index] = std::make_unique<graphics::Mesh>(); }
+    //The vertices are written at the end of the frame while the previous frames can still be drawn,
+    //one region for each frame in flight and one for the frame being written
+    dynamicMeshes_[index]->InitializeDynamic(
+        vertexCapacity,
+        indexes,
+        GraphicsEngineLocator::Get().GetSwapchain().GetImageCount() + 1);
+
+    dynamicMeshIDs_[index] = math::HashString("DynamicMesh" + std::to_string(index));
+    meshIndex_.Insert(
+        dynamicMeshIDs_[index],
+        ResourceIndex::MakeHandle(static_cast<uint8_t>(MeshStorage::DYNAMIC), index));
+    return static_cast<DynamicMeshIndex>(index);
 }
 
 ResourceID CoreMeshManager::GetDynamicMeshResourceID(const DynamicMeshIndex dynamicMeshIndex)
@@ -90,23 +120,32 @@ ResourceID CoreMeshManager::GetDynamicMeshResourceID(const DynamicMeshIndex dyna
     return dynamicMeshIDs_[dynamicMeshIndex];
 }
 
-void CoreMeshManager::UpdateDynamicMesh(const DynamicMeshIndex dynamicMeshIndex, const std::vector<graphics::VertexMesh>& vertices, const std::vector<uint32_t>& indexes)
+void CoreMeshManager::UpdateDynamicMesh(
+    const DynamicMeshIndex dynamicMeshIndex,
+    const std::vector<graphics::VertexMesh>& vertices,
+    const uint32_t firstVertex,
+    const uint32_t vertexCount,
+    const uint32_t firstIndex,
+    const uint32_t indexCount)
 {
-	dynamicMeshes_[dynamicMeshIndex].Initialize(vertices, indexes);
+	graphics::Mesh& mesh = *dynamicMeshes_[dynamicMeshIndex];
+
+	//Only the range is uploaded, in two parts when it wraps
+	mesh.NextVertexRegion();
+	const uint32_t size = static_cast<uint32_t>(vertices.size());
+	const uint32_t endCount = std::min(vertexCount, size - firstVertex);
+	mesh.UpdateVertices(vertices.data() + firstVertex, firstVertex, endCount);
+	if (endCount < vertexCount) {
+		mesh.UpdateVertices(vertices.data(), 0, vertexCount - endCount);
+	}
+	mesh.SetDrawRange(firstIndex, indexCount);
 }
 
 void CoreMeshManager::DestroyDynamicMesh(const DynamicMeshIndex dynamicMeshIndex)
 {
-	const std::vector<graphics::VertexMesh> vertices{
-	    graphics::VertexMesh(math::Vec3(0, 0, 0), math::Vec2(0, 0), math::Vec3(0, 0, 0)),
-	    graphics::VertexMesh(math::Vec3(0, 0, 0), math::Vec2(0, 0), math::Vec3(0, 0, 0)),
-	    graphics::VertexMesh(math::Vec3(0, 0, 0), math::Vec2(0, 0), math::Vec3(0, 0, 0)),
-	    graphics::VertexMesh(math::Vec3(0, 0, 0), math::Vec2(0, 0), math::Vec3(0, 0, 0))
-	};
-	const std::vector<uint32_t> indexes{
-		0, 1, 2, 3, 2, 1
-	};
-	dynamicMeshes_[dynamicMeshIndex].Initialize(vertices, indexes);
+	//The buffers are kept for the next dynamic mesh created in this slot
+	dynamicMeshes_[dynamicMeshIndex]->SetDrawRange(0, 0);
+	meshIndex_.Erase(dynamicMeshIDs_[dynamicMeshIndex]);
 	dynamicMeshIDs_[dynamicMeshIndex] = 0;
 }
 
@@ -119,42 +158,91 @@ graphics::Mesh& CoreMeshManager::GetMesh(const std::string& name)
 
 graphics::Mesh& CoreMeshManager::GetMesh(const ResourceID resourceID)
 {
-    //Look through all mesh
-    for (size_t i = 0; i < meshIDs_.size(); i++) {
-        if (meshIDs_[i] == resourceID) { return meshes_[i]; }
-    }
+	const ResourceHandle handle = meshIndex_.Find(resourceID);
+	if (handle == kInvalidResourceHandle) { return spherePrimitive_; }
 
-	//Look through all dynamic mesh
-	for (size_t i = 0; i < dynamicMeshIDs_.size(); i++) {
-		if (dynamicMeshIDs_[i] == resourceID) {
-		    return dynamicMeshes_[i];
-		}
+	return GetMeshByHandle(handle);
+}
+
+ResourceHandle CoreMeshManager::GetMeshHandle(const ResourceID resourceID) const
+{
+	return meshIndex_.Find(resourceID);
+}
+
+graphics::Mesh& CoreMeshManager::GetMeshByHandle(const ResourceHandle handle)
+{
+	const size_t index = ResourceIndex::GetHandleIndex(handle);
+
+	switch (static_cast<MeshStorage>(ResourceIndex::GetHandleStorage(handle))) {
+	case MeshStorage::OBJ:
+		return meshes_[index];
+	case MeshStorage::DYNAMIC:
+		return *dynamicMeshes_[index];
+	case MeshStorage::PRIMITIVE:
+		return GetPrimitive(static_cast<MeshPrimitive>(index));
+	default:
+		cassert(false, "The mesh doesn't exist");
+		return spherePrimitive_;
 	}
+}
+
+size_t CoreMeshManager::GetMeshLodCount(const ResourceHandle handle) const
+{
+	if (static_cast<MeshStorage>(ResourceIndex::GetHandleStorage(handle)) != MeshStorage::OBJ) { return 1; }
 
-    //Check if it's a primitive
-	if (resourceID == math::HashString("Cube")) {
+	return meshLods_[ResourceIndex::GetHandleIndex(handle)].size() + 1;
+}
+
+graphics::Mesh& CoreMeshManager::GetMeshLodByHandle(const ResourceHandle handle, const size_t lod)
+{
+	if (lod == 0) { return GetMeshByHandle(handle); }
+
+	cassert(lod < GetMeshLodCount(handle), "The level of detail doesn't exist");
+	return meshLods_[ResourceIndex::GetHandleIndex(handle)][lod - 1];
+}
+
+graphics::Mesh& CoreMeshManager::GetPrimitive(const MeshPrimitive meshPrimitive)
+{
+	switch (meshPrimitive) {
+	case MeshPrimitive::CUBE:
 		return cubePrimitive_;
-	}
-	if (resourceID == math::HashString("CubeGizmo")) {
-		return cubeGizmoPrimitive_;
-	}
-	if (resourceID == math::HashString("LineGizmo")) {
-		return lineGizmoPrimitive_;
-	}
-	if (resourceID == math::HashString("Plane")) {
+	case MeshPrimitive::PLANE:
 		return planePrimitive_;
-	}
-	if (resourceID == math::HashString("Quad")) {
+	case MeshPrimitive::QUAD:
 		return quadPrimitive_;
-	}
-	if (resourceID == math::HashString("Sphere")) {
+	case MeshPrimitive::LINE_GIZMO:
+		return lineGizmoPrimitive_;
+	case MeshPrimitive::CUBE_GIZMO:
+		return cubeGizmoPrimitive_;
+	case MeshPrimitive::SPHERE_GIZMO:
+		return sphereGizmoPrimitive_;
+	default:
 		return spherePrimitive_;
 	}
-	if (resourceID == math::HashString("SphereGizmo")) {
-		return sphereGizmoPrimitive_;
+}
+
+void CoreMeshManager::RebuildIndex()
+{
+	meshIndex_.Clear();
+
+	const auto primitiveStorage = static_cast<uint8_t>(MeshStorage::PRIMITIVE);
+	meshIndex_.Insert(GetCubeID(), ResourceIndex::MakeHandle(primitiveStorage, static_cast<size_t>(MeshPrimitive::CUBE)));
+	meshIndex_.Insert(GetSphereID(), ResourceIndex::MakeHandle(primitiveStorage, static_cast<size_t>(MeshPrimitive::SPHERE)));
+	meshIndex_.Insert(GetPlaneID(), ResourceIndex::MakeHandle(primitiveStorage, static_cast<size_t>(MeshPrimitive::PLANE)));
+	meshIndex_.Insert(GetQuadID(), ResourceIndex::MakeHandle(primitiveStorage, static_cast<size_t>(MeshPrimitive::QUAD)));
+	meshIndex_.Insert(GetLineID(), ResourceIndex::MakeHandle(primitiveStorage, static_cast<size_t>(MeshPrimitive::LINE_GIZMO)));
+	meshIndex_.Insert(GetCubeGizmoID(), ResourceIndex::MakeHandle(primitiveStorage, static_cast<size_t>(MeshPrimitive::CUBE_GIZMO)));
+	meshIndex_.Insert(GetSphereGizmoID(), ResourceIndex::MakeHandle(primitiveStorage, static_cast<size_t>(MeshPrimitive::SPHERE_GIZMO)));
+
+	for (size_t i = 0; i < dynamicMeshIDs_.size(); i++) {
+		if (dynamicMeshIDs_[i] == 0) { continue; }
+		meshIndex_.Insert(dynamicMeshIDs_[i], ResourceIndex::MakeHandle(static_cast<uint8_t>(MeshStorage::DYNAMIC), i));
+	}
+
+	//Obj meshes are indexed last, they hide the primitives with the same name
+	for (size_t i = 0; i < meshIDs_.size(); i++) {
+		meshIndex_.Insert(meshIDs_[i], ResourceIndex::MakeHandle(static_cast<uint8_t>(MeshStorage::OBJ), i));
 	}
-	return spherePrimitive_;
-    cassert(false, "The mesh doesn't exist");
 }
 
 graphics::Mesh& CoreMeshManager::GetCube() { return cubePrimitive_; }
@@ -198,14 +286,19 @@ void CoreMeshManager::Resize(const size_t newSize)
     if (meshIDs_.size() > newSize) {
         meshIDs_.resize(newSize);
         meshes_.resize(newSize);
+        meshLods_.resize(newSize);
+        RebuildIndex();
     } else {
         meshIDs_.reserve(newSize);
         meshes_.reserve(newSize);
+        meshLods_.reserve(newSize);
     }
 }
 
 void CoreMeshManager::SetFromJson(const json& meshesJson)
 {
+	PreloadMeshes(meshesJson);
+
 	for (const auto& meshJson : meshesJson) {
 		std::string meshName = meshJson;
 
@@ -213,6 +306,48 @@ void CoreMeshManager::SetFromJson(const json& meshesJson)
 	}
 }
 
+void CoreMeshManager::SetResourceLoader(ResourceLoader& resourceLoader)
+{
+	resourceLoader_ = &resourceLoader;
+}
+
+void CoreMeshManager::PreloadMeshes(const json& meshesJson)
+{
+	if (!resourceLoader_) { return; }
+
+	for (const auto& meshJson : meshesJson) {
+		const std::string meshName = meshJson;
+		const auto id = math::HashString(meshName);
+
+		//AddMesh doesn't load a mesh twice, its data would never be taken
+		if (HasObjMesh(id) || FindPendingMesh(id) != pendingMeshes_.end()) { continue; }
+
+		pendingMeshes_.emplace_back(
+			id,
+			resourceLoader_->LoadAsync<MeshObjData>([meshName]() {
+			    return MeshObj::LoadData(meshName);
+			}));
+	}
+}
+
+bool CoreMeshManager::HasObjMesh(const ResourceID resourceID) const
+{
+	const ResourceHandle handle = meshIndex_.Find(resourceID);
+	return handle != kInvalidResourceHandle &&
+		ResourceIndex::GetHandleStorage(handle) == static_cast<uint8_t>(MeshStorage::OBJ);
+}
+
+std::vector<std::pair<ResourceID, Future<MeshObjData>>>::iterator CoreMeshManager::FindPendingMesh(
+	const ResourceID resourceID)
+{
+	return std::find_if(
+		pendingMeshes_.begin(),
+		pendingMeshes_.end(),
+		[resourceID](const std::pair<ResourceID, Future<MeshObjData>>& pendingMesh) {
+		    return pendingMesh.first == resourceID;
+		});
+}
+
 json CoreMeshManager::ToJson()
 {
 	LogWarning("You're trying to save using the CoreMeshManager, nothing will be saved.");
@@ -223,6 +358,9 @@ void CoreMeshManager::Clear()
 {
     meshIDs_.clear();
     meshes_.clear();
+    meshLods_.clear();
+    pendingMeshes_.clear();
+    RebuildIndex();
 
     //TODO(@Nico) Free primitive if the core mesh manager from the engine is not used.
 }
@@ -1,10 +1,14 @@
 #include <ResourcesManager/MeshManagers/mesh_obj.h>
+#include <ResourcesManager/MeshManagers/mesh_optimizer.h>
 
+#include <algorithm>
 #include <unordered_map>
 
 #define TINYOBJLOADER_IMPLEMENTATION
 #include <tiny_obj_loader.h>
 
+#include <Utility/log.h>
+
 namespace poke {
 std::unique_ptr<MeshObj> MeshObj::Create(const std::string& filename)
 {
@@ -22,6 +26,101 @@ void MeshObj::Load(const std::string& filename)
 {
     if (filename.empty()) { return; }
 
+    Load(LoadData(filename));
+}
+
+void MeshObj::Load(const MeshObjData& meshData)
+{
+    cassert(!meshData.IsEmpty(), "The mesh data is empty");
+    LoadLevel(meshData, 0, *this);
+}
+
+void MeshObj::LoadLods(const MeshObjData& meshData, std::vector<graphics::Mesh>& lodMeshes)
+{
+    lodMeshes.resize(GetLodCount(meshData) - 1);
+    for (size_t i = 0; i < lodMeshes.size(); i++) {
+        LoadLevel(meshData, i + 1, lodMeshes[i]);
+    }
+}
+
+void MeshObj::ReloadLods(const MeshObjData& meshData, std::vector<graphics::Mesh>& lodMeshes)
+{
+    //Missing levels are replaced by the coarsest one
+    const size_t lodCount = GetLodCount(meshData);
+    for (size_t i = 0; i < lodMeshes.size(); i++) {
+        LoadLevel(meshData, std::min(i + 1, lodCount - 1), lodMeshes[i]);
+    }
+}
+
+size_t MeshObj::GetLodCount(const MeshObjData& meshData)
+{
+    if (!meshData.cookedMesh.IsOpen()) { return meshData.lods.size() + 1; }
+
+    return meshData.cookedMesh.GetView().GetLodCount();
+}
+
+void MeshObj::LoadLevel(const MeshObjData& meshData, const size_t lod, graphics::Mesh& mesh)
+{
+    if (!meshData.cookedMesh.IsOpen()) {
+        if (lod == 0) {
+            mesh.Initialize(meshData.vertices, meshData.indices);
+        } else {
+            mesh.Initialize(meshData.lods[lod - 1].vertices, meshData.lods[lod - 1].indices);
+        }
+        return;
+    }
+
+    const CookedMeshView& cookedMesh = meshData.cookedMesh.GetView();
+    mesh.Initialize(
+        cookedMesh.GetVertices(lod),
+        cookedMesh.GetVertexCount(lod),
+        cookedMesh.GetIndices(lod),
+        cookedMesh.GetIndexCount(lod),
+        cookedMesh.GetIndexSize(lod) == sizeof(uint16_t) ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32,
+        cookedMesh.GetMinExtents(),
+        cookedMesh.GetMaxExtents());
+}
+
+MeshObjData MeshObj::LoadData(const std::string& filename)
+{
+    const std::string cookedPath = PokFileSystem::GetFullPath(
+        filename,
+        FileType::COOKED_MESH,
+        FolderType::SAVE_IN_ROM);
+
+    MeshObjData meshData;
+
+    //Builds can ship the cooked meshes without their .obj
+    MappedFile sourceFile;
+    if (!sourceFile.Open(PokFileSystem::GetFullPath(filename, FileType::MESH))) {
+        if (meshData.cookedMesh.Open(cookedPath)) { return meshData; }
+        return Parse(filename);
+    }
+
+    const uint64_t sourceHash = cooked_mesh::HashSource(sourceFile.GetData(), sourceFile.GetSize());
+    const uint64_t sourceSize = sourceFile.GetSize();
+    sourceFile.Close();
+
+    if (meshData.cookedMesh.Open(cookedPath) &&
+        meshData.cookedMesh.GetView().IsUpToDate(sourceHash, sourceSize)) {
+        return meshData;
+    }
+    meshData.cookedMesh.Close();
+
+    meshData = Parse(filename);
+    if (meshData.IsEmpty()) { return meshData; }
+
+    mesh_optimizer::OptimizeMesh(meshData.vertices, meshData.indices);
+    meshData.lods = mesh_optimizer::GenerateLods(meshData.vertices, meshData.indices);
+    //Not being able to write the cache only costs a parsing at the next launch
+    WriteCookedMesh(
+        CookMesh(meshData.vertices, meshData.indices, sourceHash, sourceSize, meshData.lods),
+        cookedPath);
+    return meshData;
+}
+
+MeshObjData MeshObj::Parse(const std::string& filename)
+{
     auto filePath = PokFileSystem::GetFullPath(
 		filename,
         FileType::MESH);
@@ -37,18 +136,34 @@ void MeshObj::Load(const std::string& filename)
         &materials,
         &warn,
         &err,
-        filePath.c_str())) { cassert(false, warn + err); }
+        filePath.c_str())) {
+        LogWarning("Impossible to parse the mesh " + filename + ": " + warn + err);
+        return MeshObjData();
+    }
 
-    std::vector<graphics::VertexMesh> vertices;
-    std::vector<uint32_t> indices;
+    MeshObjData meshData;
+    std::vector<graphics::VertexMesh>& vertices = meshData.vertices;
+    std::vector<uint32_t>& indices = meshData.indices;
     std::unordered_map<graphics::VertexMesh, size_t> uniqueVertices;
 
     size_t count = 0;
     for (const auto& shape : shapes) { count += shape.mesh.indices.size(); }
     indices.reserve(count);
 
+    //A file being written can reference the attributes written after it was read
+    const auto isIndexValid = [](const int index, const std::vector<tinyobj::real_t>& values, const size_t size) {
+        return index < 0 || static_cast<size_t>(index) * size + size <= values.size();
+    };
     for (const auto& shape : shapes) {
         for (const auto& index : shape.mesh.indices) {
+            if (index.vertex_index < 0 ||
+                !isIndexValid(index.vertex_index, attrib.vertices, 3) ||
+                !isIndexValid(index.texcoord_index, attrib.texcoords, 2) ||
+                !isIndexValid(index.normal_index, attrib.normals, 3)) {
+                LogWarning("Impossible to parse the mesh " + filename + ": index out of range");
+                return MeshObjData();
+            }
+
             const int vectorSize = 3;
             //Position
             auto position = math::Vec3(
@@ -80,6 +195,6 @@ void MeshObj::Load(const std::string& filename)
             indices.emplace_back(static_cast<uint32_t>(uniqueVertices[vertex]));
         }
     }
-    Initialize(vertices, indices);
+    return meshData;
 }
 } //namespace poke
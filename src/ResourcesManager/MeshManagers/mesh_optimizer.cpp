@@ -0,0 +1,435 @@
+#include <ResourcesManager/MeshManagers/mesh_optimizer.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace poke {
+namespace mesh_optimizer {
+namespace {
+const uint32_t kNoVertex = std::numeric_limits<uint32_t>::max();
+
+/**
+ * \brief Triangles using each vertex, stored contiguously.
+ */
+struct VertexTriangles {
+	std::vector<uint32_t> offsets; // vertexCount + 1
+	std::vector<uint32_t> triangles;
+
+	VertexTriangles(const std::vector<uint32_t>& indices, const size_t vertexCount)
+		: offsets(vertexCount + 1, 0),
+		  triangles(indices.size())
+	{
+		for (const uint32_t index : indices) { offsets[index + 1]++; }
+		for (size_t i = 0; i < vertexCount; i++) { offsets[i + 1] += offsets[i]; }
+
+		std::vector<uint32_t> writeOffsets(offsets.begin(), offsets.end() - 1);
+		for (size_t i = 0; i < indices.size(); i++) {
+			triangles[writeOffsets[indices[i]]++] = static_cast<uint32_t>(i / 3);
+		}
+	}
+};
+
+uint32_t SkipDeadEnd(
+	const std::vector<uint32_t>& liveTriangles,
+	std::vector<uint32_t>& deadEnds,
+	uint32_t& cursor)
+{
+	//Recently used vertices first, they are likely still in the cache
+	while (!deadEnds.empty()) {
+		const uint32_t vertex = deadEnds.back();
+		deadEnds.pop_back();
+		if (liveTriangles[vertex] > 0) { return vertex; }
+	}
+
+	while (cursor < liveTriangles.size()) {
+		if (liveTriangles[cursor] > 0) { return cursor; }
+		cursor++;
+	}
+	return kNoVertex;
+}
+
+/**
+ * \brief Sum of squared distances to planes, weighted by the area of their triangles.
+ */
+struct Quadric {
+	double a00 = 0, a01 = 0, a02 = 0, a03 = 0;
+	double a11 = 0, a12 = 0, a13 = 0;
+	double a22 = 0, a23 = 0;
+	double a33 = 0;
+	double weight = 0;
+
+	static Quadric FromPlane(const double a, const double b, const double c, const double d, const double weight)
+	{
+		Quadric quadric;
+		quadric.a00 = a * a * weight;
+		quadric.a01 = a * b * weight;
+		quadric.a02 = a * c * weight;
+		quadric.a03 = a * d * weight;
+		quadric.a11 = b * b * weight;
+		quadric.a12 = b * c * weight;
+		quadric.a13 = b * d * weight;
+		quadric.a22 = c * c * weight;
+		quadric.a23 = c * d * weight;
+		quadric.a33 = d * d * weight;
+		quadric.weight = weight;
+		return quadric;
+	}
+
+	void operator+=(const Quadric& other)
+	{
+		a00 += other.a00; a01 += other.a01; a02 += other.a02; a03 += other.a03;
+		a11 += other.a11; a12 += other.a12; a13 += other.a13;
+		a22 += other.a22; a23 += other.a23;
+		a33 += other.a33;
+		weight += other.weight;
+	}
+
+	/**
+	 * \brief Average squared distance of the position to the planes.
+	 */
+	double GetError(const math::Vec3& position) const
+	{
+		if (weight <= 0) { return 0; }
+
+		const double x = position.x, y = position.y, z = position.z;
+		const double error =
+			a00 * x * x + 2 * a01 * x * y + 2 * a02 * x * z + 2 * a03 * x +
+			a11 * y * y + 2 * a12 * y * z + 2 * a13 * y +
+			a22 * z * z + 2 * a23 * z +
+			a33;
+		return std::abs(error) / weight;
+	}
+};
+
+struct Collapse {
+	uint32_t from;
+	uint32_t to;
+	double error;
+};
+
+/**
+ * \brief Returns true if moving a vertex flips or degenerates one of its triangles that is not removed.
+ */
+bool IsCollapseFlipping(
+	const std::vector<graphics::VertexMesh>& vertices,
+	const std::vector<uint32_t>& indices,
+	const VertexTriangles& vertexTriangles,
+	const uint32_t from,
+	const uint32_t to)
+{
+	for (uint32_t i = vertexTriangles.offsets[from]; i < vertexTriangles.offsets[from + 1]; i++) {
+		const size_t triangle = vertexTriangles.triangles[i];
+		const uint32_t corners[3] = { indices[triangle * 3], indices[triangle * 3 + 1], indices[triangle * 3 + 2] };
+		if (corners[0] == to || corners[1] == to || corners[2] == to) { continue; }
+
+		math::Vec3 positions[3];
+		math::Vec3 collapsedPositions[3];
+		for (size_t corner = 0; corner < 3; corner++) {
+			positions[corner] = vertices[corners[corner]].position;
+			collapsedPositions[corner] = corners[corner] == from ? vertices[to].position : positions[corner];
+		}
+
+		const math::Vec3 normal = math::Vec3::Cross(positions[1] - positions[0], positions[2] - positions[0]);
+		const math::Vec3 collapsedNormal = math::Vec3::Cross(
+			collapsedPositions[1] - collapsedPositions[0],
+			collapsedPositions[2] - collapsedPositions[0]);
+		if (normal * collapsedNormal <= 0.0f) { return true; }
+	}
+	return false;
+}
+
+/**
+ * \brief Vertices on an edge used by a single triangle.
+ */
+std::vector<bool> FindBorderVertices(const std::vector<uint32_t>& indices, const size_t vertexCount)
+{
+	std::vector<std::pair<uint32_t, uint32_t>> edges;
+	edges.reserve(indices.size());
+	for (size_t i = 0; i < indices.size(); i += 3) {
+		for (size_t corner = 0; corner < 3; corner++) {
+			const uint32_t a = indices[i + corner];
+			const uint32_t b = indices[i + (corner + 1) % 3];
+			edges.emplace_back(std::min(a, b), std::max(a, b));
+		}
+	}
+	std::sort(edges.begin(), edges.end());
+
+	std::vector<bool> isBorder(vertexCount, false);
+	for (size_t i = 0; i < edges.size();) {
+		size_t next = i + 1;
+		while (next < edges.size() && edges[next] == edges[i]) { next++; }
+		if (next - i == 1) {
+			isBorder[edges[i].first] = true;
+			isBorder[edges[i].second] = true;
+		}
+		i = next;
+	}
+	return isBorder;
+}
+} //namespace
+
+VertexCacheStats AnalyzeVertexCache(
+	const std::vector<uint32_t>& indices,
+	const size_t vertexCount,
+	const size_t cacheSize)
+{
+	VertexCacheStats stats;
+	if (indices.empty() || vertexCount == 0) { return stats; }
+
+	//A vertex is in the cache if it has been transformed less than cacheSize misses ago
+	std::vector<size_t> cacheTimestamps(vertexCount, 0);
+	size_t timestamp = cacheSize + 1;
+	size_t misses = 0;
+
+	for (const uint32_t index : indices) {
+		if (timestamp - cacheTimestamps[index] > cacheSize) {
+			cacheTimestamps[index] = timestamp++;
+			misses++;
+		}
+	}
+
+	stats.acmr = static_cast<float>(misses) / static_cast<float>(indices.size() / 3);
+	stats.atvr = static_cast<float>(misses) / static_cast<float>(vertexCount);
+	return stats;
+}
+
+void OptimizeVertexCache(
+	std::vector<uint32_t>& indices,
+	const size_t vertexCount,
+	const size_t cacheSize)
+{
+	const size_t triangleCount = indices.size() / 3;
+	if (triangleCount == 0 || vertexCount == 0) { return; }
+
+	const VertexTriangles vertexTriangles(indices, vertexCount);
+
+	std::vector<uint32_t> liveTriangles(vertexCount);
+	for (size_t i = 0; i < vertexCount; i++) {
+		liveTriangles[i] = vertexTriangles.offsets[i + 1] - vertexTriangles.offsets[i];
+	}
+
+	std::vector<size_t> cacheTimestamps(vertexCount, 0);
+	std::vector<bool> isEmitted(triangleCount, false);
+	std::vector<uint32_t> deadEnds;
+	std::vector<uint32_t> candidates;
+
+	std::vector<uint32_t> optimizedIndices;
+	optimizedIndices.reserve(indices.size());
+
+	size_t timestamp = cacheSize + 1;
+	uint32_t cursor = 0;
+	uint32_t fanningVertex = 0;
+
+	while (fanningVertex != kNoVertex) {
+		candidates.clear();
+
+		//Emit every triangle around the fanning vertex
+		for (uint32_t i = vertexTriangles.offsets[fanningVertex]; i < vertexTriangles.offsets[fanningVertex + 1]; i++) {
+			const uint32_t triangle = vertexTriangles.triangles[i];
+			if (isEmitted[triangle]) { continue; }
+
+			for (size_t corner = 0; corner < 3; corner++) {
+				const uint32_t vertex = indices[triangle * 3 + corner];
+				optimizedIndices.push_back(vertex);
+				deadEnds.push_back(vertex);
+				candidates.push_back(vertex);
+				liveTriangles[vertex]--;
+
+				if (timestamp - cacheTimestamps[vertex] > cacheSize) {
+					cacheTimestamps[vertex] = timestamp++;
+				}
+			}
+			isEmitted[triangle] = true;
+		}
+
+		//Next fanning vertex is the oldest candidate that will still be in the cache after its triangles,
+		//the dead ends are used if none of them will
+		uint32_t nextVertex = kNoVertex;
+		size_t bestPriority = 0;
+		for (const uint32_t vertex : candidates) {
+			if (liveTriangles[vertex] == 0) { continue; }
+
+			size_t priority = 0;
+			if (timestamp - cacheTimestamps[vertex] + 2 * liveTriangles[vertex] <= cacheSize) {
+				priority = timestamp - cacheTimestamps[vertex];
+			}
+			if (priority > bestPriority) {
+				bestPriority = priority;
+				nextVertex = vertex;
+			}
+		}
+
+		fanningVertex = nextVertex != kNoVertex ? nextVertex : SkipDeadEnd(liveTriangles, deadEnds, cursor);
+	}
+
+	indices = std::move(optimizedIndices);
+}
+
+void OptimizeVertexFetch(
+	std::vector<graphics::VertexMesh>& vertices,
+	std::vector<uint32_t>& indices)
+{
+	std::vector<uint32_t> remap(vertices.size(), kNoVertex);
+	std::vector<graphics::VertexMesh> optimizedVertices;
+	optimizedVertices.reserve(vertices.size());
+
+	for (uint32_t& index : indices) {
+		if (remap[index] == kNoVertex) {
+			remap[index] = static_cast<uint32_t>(optimizedVertices.size());
+			optimizedVertices.push_back(vertices[index]);
+		}
+		index = remap[index];
+	}
+
+	vertices = std::move(optimizedVertices);
+}
+
+std::vector<uint32_t> SimplifyMesh(
+	const std::vector<graphics::VertexMesh>& vertices,
+	const std::vector<uint32_t>& indices,
+	const size_t targetIndexCount,
+	const float maxError,
+	float* resultError)
+{
+	std::vector<uint32_t> simplifiedIndices = indices;
+	if (resultError) { *resultError = 0.0f; }
+	if (vertices.empty() || indices.size() <= targetIndexCount) { return simplifiedIndices; }
+
+	//Errors are relative to the radius of the mesh
+	math::Vec3 minExtents = vertices[0].position;
+	math::Vec3 maxExtents = vertices[0].position;
+	for (const auto& vertex : vertices) {
+		minExtents = math::Vec3(
+			std::min(minExtents.x, vertex.position.x),
+			std::min(minExtents.y, vertex.position.y),
+			std::min(minExtents.z, vertex.position.z));
+		maxExtents = math::Vec3(
+			std::max(maxExtents.x, vertex.position.x),
+			std::max(maxExtents.y, vertex.position.y),
+			std::max(maxExtents.z, vertex.position.z));
+	}
+	const double radius = std::max((maxExtents - minExtents).GetMagnitude() * 0.5, 1e-6);
+	const double maxErrorSquared = maxError * radius * maxError * radius;
+
+	std::vector<Quadric> quadrics(vertices.size());
+	for (size_t i = 0; i < indices.size(); i += 3) {
+		const math::Vec3& p0 = vertices[indices[i]].position;
+		const math::Vec3 normal = math::Vec3::Cross(
+			vertices[indices[i + 1]].position - p0,
+			vertices[indices[i + 2]].position - p0);
+		const double area = normal.GetMagnitude();
+		if (area <= 0.0) { continue; }
+
+		const double a = normal.x / area, b = normal.y / area, c = normal.z / area;
+		const double d = -(a * p0.x + b * p0.y + c * p0.z);
+		const Quadric quadric = Quadric::FromPlane(a, b, c, d, area * 0.5);
+		for (size_t corner = 0; corner < 3; corner++) { quadrics[indices[i + corner]] += quadric; }
+	}
+
+	const std::vector<bool> isLocked = FindBorderVertices(indices, vertices.size());
+
+	std::vector<Collapse> collapses;
+	std::vector<uint32_t> collapseTargets(vertices.size());
+	std::vector<bool> isTouched(vertices.size());
+	double reachedError = 0.0;
+
+	//Every pass collapses independent edges, then the triangles are rebuilt
+	while (simplifiedIndices.size() > targetIndexCount) {
+		const VertexTriangles vertexTriangles(simplifiedIndices, vertices.size());
+
+		collapses.clear();
+		for (size_t i = 0; i < simplifiedIndices.size(); i += 3) {
+			for (size_t corner = 0; corner < 3; corner++) {
+				const uint32_t a = simplifiedIndices[i + corner];
+				const uint32_t b = simplifiedIndices[i + (corner + 1) % 3];
+
+				Quadric quadric = quadrics[a];
+				quadric += quadrics[b];
+				if (!isLocked[a]) { collapses.push_back(Collapse{ a, b, quadric.GetError(vertices[b].position) }); }
+				if (!isLocked[b]) { collapses.push_back(Collapse{ b, a, quadric.GetError(vertices[a].position) }); }
+			}
+		}
+		std::sort(collapses.begin(), collapses.end(), [](const Collapse& a, const Collapse& b) {
+			return a.error < b.error;
+		});
+
+		//Each collapse removes two triangles on a closed surface
+		const size_t maxCollapseCount = (simplifiedIndices.size() - targetIndexCount) / 6 + 1;
+		size_t collapseCount = 0;
+		for (size_t i = 0; i < vertices.size(); i++) { collapseTargets[i] = static_cast<uint32_t>(i); }
+		std::fill(isTouched.begin(), isTouched.end(), false);
+
+		for (const Collapse& collapse : collapses) {
+			if (collapse.error > maxErrorSquared || collapseCount >= maxCollapseCount) { break; }
+			if (isTouched[collapse.from] || isTouched[collapse.to]) { continue; }
+			if (IsCollapseFlipping(vertices, simplifiedIndices, vertexTriangles, collapse.from, collapse.to)) { continue; }
+
+			collapseTargets[collapse.from] = collapse.to;
+			quadrics[collapse.to] += quadrics[collapse.from];
+			reachedError = std::max(reachedError, collapse.error);
+			collapseCount++;
+
+			//Triangles around the collapsed vertex changed, their vertices wait for the next pass
+			for (uint32_t j = vertexTriangles.offsets[collapse.from]; j < vertexTriangles.offsets[collapse.from + 1]; j++) {
+				const size_t triangle = vertexTriangles.triangles[j];
+				for (size_t corner = 0; corner < 3; corner++) { isTouched[simplifiedIndices[triangle * 3 + corner]] = true; }
+			}
+		}
+		if (collapseCount == 0) { break; }
+
+		size_t writeIndex = 0;
+		for (size_t i = 0; i < simplifiedIndices.size(); i += 3) {
+			const uint32_t a = collapseTargets[simplifiedIndices[i]];
+			const uint32_t b = collapseTargets[simplifiedIndices[i + 1]];
+			const uint32_t c = collapseTargets[simplifiedIndices[i + 2]];
+			if (a == b || b == c || a == c) { continue; }
+
+			simplifiedIndices[writeIndex++] = a;
+			simplifiedIndices[writeIndex++] = b;
+			simplifiedIndices[writeIndex++] = c;
+		}
+		simplifiedIndices.resize(writeIndex);
+	}
+
+	if (resultError) { *resultError = static_cast<float>(std::sqrt(reachedError) / radius); }
+	return simplifiedIndices;
+}
+
+std::vector<MeshLodData> GenerateLods(
+	const std::vector<graphics::VertexMesh>& vertices,
+	const std::vector<uint32_t>& indices)
+{
+	std::vector<MeshLodData> lods;
+	if (indices.size() / 3 < kLodMinTriangleCount) { return lods; }
+
+	std::vector<uint32_t> previousIndices = indices;
+	for (size_t level = 0; level < kMaxGeneratedLodCount; level++) {
+		std::vector<uint32_t> lodIndices = SimplifyMesh(
+			vertices,
+			previousIndices,
+			previousIndices.size() / 6 * 3,
+			kLodMaxErrors[level]);
+
+		//A level that keeps most of the triangles costs memory without reducing the rendering
+		if (lodIndices.empty() || lodIndices.size() > previousIndices.size() * 3 / 4) { break; }
+		previousIndices = lodIndices;
+
+		MeshLodData lod;
+		lod.vertices = vertices;
+		lod.indices = std::move(lodIndices);
+		OptimizeMesh(lod.vertices, lod.indices);
+		lods.push_back(std::move(lod));
+	}
+	return lods;
+}
+
+void OptimizeMesh(
+	std::vector<graphics::VertexMesh>& vertices,
+	std::vector<uint32_t>& indices)
+{
+	OptimizeVertexCache(indices, vertices.size());
+	OptimizeVertexFetch(vertices, indices);
+}
+} //namespace mesh_optimizer
+} //namespace poke
@@ -10,11 +10,10 @@ CorePrefabsManager::CorePrefabsManager() {}
 std::vector<ecs::EntityIndex> CorePrefabsManager::Instantiate(
     const nonstd::string_view& prefabName) const
 {
-	const auto hash = math::HashString(prefabName);
-    for (size_t i = 0; i < prefabsID_.size(); i++) {
-        if (hash == prefabsID_[i]) {
-            return EcsManagerLocator::Get().InstantiatePrefab(prefabs_[i]);
-        }
+	const ResourceID prefabID = math::HashString(prefabName);
+	const ResourceHandle handle = prefabIndex_.Find(prefabID);
+    if (handle != kInvalidResourceHandle) {
+        return EcsManagerLocator::Get().InstantiatePooledPrefab(prefabID, prefabs_[handle]);
     }
 
 	LogWarning("You're trying to instantiate a prefab with the name " + static_cast<std::string>(prefabName) + " but this prefab has not been loaded by the manager", LogType::ECS_LOG);
@@ -25,9 +24,9 @@ void CorePrefabsManager::AddPrefab(const std::string& prefabName)
 {
 	const auto hash = math::HashString(prefabName);
 
-	const auto it = std::find(prefabsID_.begin(), prefabsID_.end(), hash);
-	if (it != prefabsID_.end()) return;
+	if (prefabIndex_.Find(hash) != kInvalidResourceHandle) return;
 
+	prefabIndex_.Insert(hash, static_cast<ResourceHandle>(prefabsID_.size()));
     prefabsID_.push_back(hash);
 
 	auto prefabJson = LoadJson(
@@ -41,17 +40,20 @@ void CorePrefabsManager::AddPrefab(const std::string& prefabName)
     prefabs_.back().SetFromJson(prefabJson);
 }
 
-const ecs::Prefab& CorePrefabsManager::GetPrefab(const nonstd::string_view& prefabName) const
+void CorePrefabsManager::AddPrefabPool(const std::string& prefabName, const size_t instancesCount)
 {
-	const auto hash = math::HashString(prefabName);
-    const auto it = std::find(
-		prefabsID_.begin(),
-		prefabsID_.end(),
-		hash);
+	AddPrefab(prefabName);
+
+	const ResourceID prefabID = math::HashString(prefabName);
+	EcsManagerLocator::Get().AddPrefabPool(prefabID, prefabs_[prefabIndex_.Find(prefabID)], instancesCount);
+}
 
-    const auto index = std::distance(prefabsID_.begin(), it);
+const ecs::Prefab& CorePrefabsManager::GetPrefab(const nonstd::string_view& prefabName) const
+{
+	const ResourceHandle handle = prefabIndex_.Find(math::HashString(prefabName));
+	cassert(handle != kInvalidResourceHandle, "The prefab " << prefabName << " doesn't exist");
 
-    return prefabs_[index];
+    return prefabs_[handle];
 }
 
 const std::vector<ResourceID>& CorePrefabsManager::GetPrefabsIDs() const
@@ -63,12 +65,14 @@ void CorePrefabsManager::Clear()
 {
     prefabsID_.clear();
     prefabs_.clear();
+    prefabIndex_.Clear();
 }
 
 void CorePrefabsManager::Resize(const size_t newSize)
 {
     prefabs_.resize(0);
     prefabsID_.resize(0);
+    prefabIndex_.Clear();
 }
 
 json CorePrefabsManager::ToJson()
@@ -79,12 +83,16 @@ json CorePrefabsManager::ToJson()
 
 void CorePrefabsManager::SetFromJson(const json& prefabsJson)
 {
-	prefabsID_.reserve(prefabsJson.size());
-	prefabs_.resize(prefabsJson.size());
+	prefabsID_.reserve(prefabsID_.size() + prefabsJson.size());
+	prefabs_.reserve(prefabs_.size() + prefabsJson.size());
 
     for(size_t i = 0; i < prefabsJson.size(); i++) {
-		prefabsID_.emplace_back(math::HashString(prefabsJson[i]["name"].get<std::string>()));
-		prefabs_[i].SetFromJson(prefabsJson[i]["objects"]);
+		const ResourceID prefabID = math::HashString(prefabsJson[i]["name"].get<std::string>());
+		prefabIndex_.Insert(prefabID, static_cast<ResourceHandle>(prefabsID_.size()));
+		prefabsID_.emplace_back(prefabID);
+
+		prefabs_.emplace_back();
+		prefabs_.back().SetFromJson(prefabsJson[i]["objects"]);
     }
 }
 } //namespace poke
\ No newline at end of file
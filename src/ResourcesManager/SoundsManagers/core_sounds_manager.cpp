@@ -1,5 +1,7 @@
 #include <ResourcesManager/SoundsManagers/core_sounds_manager.h>
 
+#include <algorithm>
+
 #include <Math/math.h>
 #include <Utility/log.h>
 #include <json.hpp>
@@ -17,7 +19,20 @@ void CoreSoundsManager::AddSound(const std::string& soundName)
 		soundName.c_str(),
 		FileType::SOUNDS,
 		FolderType::ROM)));
-    sounds_.back().Load();
+
+    const auto pendingIt = std::find_if(
+        pendingSounds_.begin(),
+        pendingSounds_.end(),
+        [hash](const std::pair<ResourceID, Future<std::string>>& pendingSound) {
+            return pendingSound.first == hash;
+        });
+
+    if (pendingIt != pendingSounds_.end() && !pendingIt->second.Get().empty()) {
+        sounds_.back().Load(pendingIt->second.Get());
+    } else {
+        sounds_.back().Load();
+    }
+    if (pendingIt != pendingSounds_.end()) { pendingSounds_.erase(pendingIt); }
 }
 
 void CoreSoundsManager::AddMusic(const std::string& musicName)
@@ -61,6 +76,8 @@ void CoreSoundsManager::Clear()
 
     musicIDs_.clear();
     musics_.clear();
+
+    pendingSounds_.clear();
 }
 
 void CoreSoundsManager::Resize(const size_t newSize)
@@ -82,6 +99,8 @@ void CoreSoundsManager::Resize(const size_t newSize)
 
 void CoreSoundsManager::SetFromJson(const json& soundsJson)
 {
+    PreloadSounds(soundsJson);
+
     if (CheckJsonExists(soundsJson, "clips")) {
 	    for (const auto& clipJson : soundsJson["clips"]) {
 			AddSound(clipJson.get<std::string>());
@@ -95,6 +114,26 @@ void CoreSoundsManager::SetFromJson(const json& soundsJson)
     }
 }
 
+void CoreSoundsManager::SetResourceLoader(ResourceLoader& resourceLoader)
+{
+    resourceLoader_ = &resourceLoader;
+}
+
+void CoreSoundsManager::PreloadSounds(const json& soundsJson)
+{
+    if (!resourceLoader_ || !CheckJsonExists(soundsJson, "clips")) { return; }
+
+    for (const auto& clipJson : soundsJson["clips"]) {
+        const std::string soundName = clipJson.get<std::string>();
+
+        pendingSounds_.emplace_back(
+            math::HashString(soundName),
+            resourceLoader_->LoadAsync<std::string>([soundName]() {
+                return PokFileSystem::ReadFile(soundName, FileType::SOUNDS, FolderType::ROM);
+            }));
+    }
+}
+
 json CoreSoundsManager::ToJson()
 {
     LogWarning("You're trying to save using the CoreSoundsManager, nothing will be saved.");
@@ -14,6 +14,11 @@ void Sound::Load()
     InternLoad(static_cast<audio::AudioEngine&>(AudioEngineLocator::Get()));
 }
 
+void Sound::Load(const std::string& fileData)
+{
+    InternLoad(static_cast<audio::AudioEngine&>(AudioEngineLocator::Get()), fileData);
+}
+
 void Sound::Unload() const
 {
     InternUnload();
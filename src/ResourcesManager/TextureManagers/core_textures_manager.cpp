@@ -1,5 +1,7 @@
 #include <ResourcesManager/TextureManagers/core_textures_manager.h>
 
+#include <algorithm>
+
 #include <Utility/log.h>
 #include <Math/hash.h>
 
@@ -11,34 +13,79 @@ CoreTexturesManager::CoreTexturesManager()
 
 	imagesCubes_.reserve(kImageCubeDefaultSize);
 	imageCubeIDs_.reserve(kImageCubeDefaultSize);
+
+	image2dIndex_.Reserve(kImageDefaultSize);
 }
 
 void CoreTexturesManager::AddTexture2D(const std::string& texturePath)
 {
 	const auto resourceID = math::HashString(texturePath);
 
+	//Materials can share the same texture
+	if (image2dIndex_.Find(resourceID) != kInvalidResourceHandle) { return; }
+
+	image2dIndex_.Insert(resourceID, static_cast<ResourceHandle>(image2dIDs_.size()));
 	image2dIDs_.emplace_back(resourceID);
 
-    image2ds_.emplace_back(
-        std::make_unique<graphics::Image2d>(
-            texturePath,
-            VK_FILTER_LINEAR,
-            VK_SAMPLER_ADDRESS_MODE_REPEAT,
-            true,
-            true,
-            false));
-	image2ds_.back()->Load();
+    image2ds_.emplace_back(CreateImage2d(texturePath));
+
+	const auto pendingIt = std::find_if(
+		pendingImage2ds_.begin(),
+		pendingImage2ds_.end(),
+		[resourceID](const std::pair<ResourceID, Future<graphics::LoadedImageInfos>>& pendingImage) {
+		    return pendingImage.first == resourceID;
+		});
+
+	if (pendingIt != pendingImage2ds_.end()) {
+		image2ds_.back()->Load(std::move(pendingIt->second.Get()));
+		pendingImage2ds_.erase(pendingIt);
+	} else {
+		image2ds_.back()->Load();
+	}
+}
+
+void CoreTexturesManager::PreloadTextures2D(const std::vector<std::string>& texturePaths)
+{
+	if (!resourceLoader_) { return; }
+
+	for (const std::string& texturePath : texturePaths) {
+		const auto resourceID = math::HashString(texturePath);
+
+		const bool isLoaded = image2dIndex_.Find(resourceID) != kInvalidResourceHandle;
+		const bool isPending = std::find_if(
+			pendingImage2ds_.begin(),
+			pendingImage2ds_.end(),
+			[resourceID](const std::pair<ResourceID, Future<graphics::LoadedImageInfos>>& pendingImage) {
+			    return pendingImage.first == resourceID;
+			}) != pendingImage2ds_.end();
+		if (isLoaded || isPending) { continue; }
+
+		pendingImage2ds_.emplace_back(
+			resourceID,
+			resourceLoader_->LoadAsync<graphics::LoadedImageInfos>([texturePath]() {
+			    return graphics::Image2d::LoadData(texturePath);
+			}));
+	}
 }
 
 const graphics::Image2d& CoreTexturesManager::GetTexture2DByID(
     const ResourceID resourceID) const
 {
-    for(size_t i = 0; i < image2ds_.size(); i++) {
-        if(image2dIDs_[i] == resourceID) {
-			return *image2ds_[i];
-        }
-    }
-	cassert(false, "The image doesn't exist");
+	const ResourceHandle handle = image2dIndex_.Find(resourceID);
+	cassert(handle != kInvalidResourceHandle, "The image doesn't exist");
+
+	return *image2ds_[handle];
+}
+
+ResourceHandle CoreTexturesManager::GetTexture2DHandle(const ResourceID resourceID) const
+{
+	return image2dIndex_.Find(resourceID);
+}
+
+const graphics::Image2d& CoreTexturesManager::GetTexture2DByHandle(
+    const ResourceHandle handle) const
+{
+	return *image2ds_[handle];
 }
 
 const graphics::Image2d& CoreTexturesManager::GetTexture2DByName(
@@ -52,6 +99,9 @@ void CoreTexturesManager::AddTextureCube(const std::string& texturePath)
 {
 	const auto resourceID = math::HashString(texturePath);
 
+	if (imageCubeIndex_.Find(resourceID) != kInvalidResourceHandle) { return; }
+
+	imageCubeIndex_.Insert(resourceID, static_cast<ResourceHandle>(imageCubeIDs_.size()));
 	imageCubeIDs_.emplace_back(resourceID);
 
 	imagesCubes_.emplace_back(
@@ -70,13 +120,10 @@ const graphics::ImageCube& CoreTexturesManager::GetTextureCubeByID(
     const ResourceID resourceID
 ) const
 {
-    for(size_t i = 0; i < imagesCubes_.size(); i++) {
-        if(imageCubeIDs_[i] == resourceID) {
-			return imagesCubes_[i];
-        }
-    }
+	const ResourceHandle handle = imageCubeIndex_.Find(resourceID);
+	cassert(handle != kInvalidResourceHandle, "The image cube doesn't exist");
 
-	cassert(false, "The image cube doesn't exist");
+	return imagesCubes_[handle];
 }
 
 const graphics::ImageCube& CoreTexturesManager::GetTextureCubeByName(
@@ -91,9 +138,13 @@ void CoreTexturesManager::Clear()
 {
     image2ds_.clear();
 	image2dIDs_.clear();
+	pendingImage2ds_.clear();
 
     imagesCubes_.clear();
 	imageCubeIDs_.clear();
+
+	image2dIndex_.Clear();
+	imageCubeIndex_.Clear();
 }
 
 void CoreTexturesManager::Resize(const size_t newSize)
@@ -101,12 +152,26 @@ void CoreTexturesManager::Resize(const size_t newSize)
     if (image2dIDs_.size() > newSize) {
 		image2dIDs_.resize(newSize);
 		image2ds_.resize(newSize);
+		RebuildIndex();
     } else {
 		imageCubeIDs_.reserve(newSize);
         image2ds_.reserve(newSize);
     }
 }
 
+void CoreTexturesManager::RebuildIndex()
+{
+	image2dIndex_.Clear();
+	for (size_t i = 0; i < image2dIDs_.size(); i++) {
+		image2dIndex_.Insert(image2dIDs_[i], static_cast<ResourceHandle>(i));
+	}
+
+	imageCubeIndex_.Clear();
+	for (size_t i = 0; i < imageCubeIDs_.size(); i++) {
+		imageCubeIndex_.Insert(imageCubeIDs_[i], static_cast<ResourceHandle>(i));
+	}
+}
+
 void CoreTexturesManager::SetFromJson(const json& texturesJson)
 {
 	for (const auto& textureJson : texturesJson) {
@@ -122,6 +187,37 @@ void CoreTexturesManager::SetFromJson(const json& texturesJson)
 	}
 }
 
+void CoreTexturesManager::SetResourceLoader(ResourceLoader& resourceLoader)
+{
+	resourceLoader_ = &resourceLoader;
+}
+
+std::unique_ptr<graphics::Image2d> CoreTexturesManager::ReloadTexture2D(
+    const std::string& texturePath,
+    graphics::LoadedImageInfos&& loadedImage)
+{
+	const ResourceHandle handle = image2dIndex_.Find(math::HashString(texturePath));
+	if (handle == kInvalidResourceHandle) { return nullptr; }
+
+	//The descriptors are only written again when the texture changes address
+	std::unique_ptr<graphics::Image2d> image2d = CreateImage2d(texturePath);
+	image2d->Load(std::move(loadedImage));
+	image2ds_[handle].swap(image2d);
+
+	return image2d;
+}
+
+std::unique_ptr<graphics::Image2d> CoreTexturesManager::CreateImage2d(const std::string& texturePath)
+{
+	return std::make_unique<graphics::Image2d>(
+		texturePath,
+		VK_FILTER_LINEAR,
+		VK_SAMPLER_ADDRESS_MODE_REPEAT,
+		true,
+		true,
+		false);
+}
+
 json CoreTexturesManager::ToJson()
 {
 	LogWarning("You're trying to save using the CoreTexturesManager, nothing will be saved");
@@ -0,0 +1,234 @@
+#include <ResourcesManager/resource_hot_reloader.h>
+
+#include <algorithm>
+#include <iterator>
+
+#include <CoreEngine/ServiceLocator/service_locator_definition.h>
+#include <GraphicsEngine/Devices/logical_device.h>
+#include <GraphicsEngine/vulkan_error_handler.h>
+#include <Math/hash.h>
+#include <Utility/json_utility.h>
+#include <Utility/log.h>
+
+namespace poke {
+namespace {
+//The cooked files written by the reloads are in the same folders, they are ignored
+const std::vector<FileType> kReloadedFileTypes{ FileType::MESH, FileType::TEXTURE, FileType::MATERIAL };
+
+template<typename T>
+bool HasPendingReload(
+    const std::vector<std::pair<std::string, Future<T>>>& pendingReloads,
+    const std::string& name)
+{
+    return std::any_of(
+        pendingReloads.begin(),
+        pendingReloads.end(),
+        [&name](const std::pair<std::string, Future<T>>& pendingReload) {
+            return pendingReload.first == name;
+        });
+}
+
+template<typename T>
+void WaitPendingReloads(const std::vector<std::pair<std::string, Future<T>>>& pendingReloads)
+{
+    for (const auto& pendingReload : pendingReloads) { pendingReload.second.Wait(); }
+}
+
+template<typename T>
+std::vector<std::pair<std::string, Future<T>>> TakeReadyReloads(
+    std::vector<std::pair<std::string, Future<T>>>& pendingReloads)
+{
+    const auto readyIt = std::stable_partition(
+        pendingReloads.begin(),
+        pendingReloads.end(),
+        [](const std::pair<std::string, Future<T>>& pendingReload) {
+            return !pendingReload.second.IsReady();
+        });
+
+    std::vector<std::pair<std::string, Future<T>>> readyReloads(
+        std::make_move_iterator(readyIt),
+        std::make_move_iterator(pendingReloads.end()));
+    pendingReloads.erase(readyIt, pendingReloads.end());
+    return readyReloads;
+}
+} //namespace
+
+ResourceHotReloader::ResourceHotReloader(
+    CoreMeshManager& meshManager,
+    CoreTexturesManager& texturesManager,
+    CoreMaterialsManager& materialsManager,
+    ResourceLoader& resourceLoader)
+    : meshManager_(meshManager),
+      texturesManager_(texturesManager),
+      materialsManager_(materialsManager),
+      resourceLoader_(resourceLoader) {}
+
+bool ResourceHotReloader::Start()
+{
+    std::vector<std::string> folderPaths;
+    for (const FileType fileType : kReloadedFileTypes) {
+        folderPaths.push_back(PokFileSystem::GetPath(fileType, FolderType::ROM));
+    }
+
+    if (!fileWatcher_.Start(folderPaths)) {
+        LogWarning("No resource folder can be watched, the resources won't be reloaded");
+        return false;
+    }
+    return true;
+}
+
+void ResourceHotReloader::Stop()
+{
+    fileWatcher_.Stop();
+
+    //Only the reloads are waited, the loader is shared
+    WaitPendingReloads(reloadingMeshes_);
+    WaitPendingReloads(reloadingTextures2D_);
+    WaitPendingReloads(reloadingMaterials_);
+    reloadingMeshes_.clear();
+    reloadingTextures2D_.clear();
+    reloadingMaterials_.clear();
+    delayedFilePaths_.clear();
+}
+
+void ResourceHotReloader::Update()
+{
+    if (!fileWatcher_.IsRunning()) { return; }
+
+    for (std::string& filePath : fileWatcher_.PollChanges()) {
+        LoadChangedFile(std::move(filePath));
+    }
+
+    SwapReloadedResources();
+
+    //Files changed again while they were loading, their previous load has been swapped
+    std::vector<std::string> delayedFilePaths;
+    delayedFilePaths.swap(delayedFilePaths_);
+    for (std::string& filePath : delayedFilePaths) {
+        LoadChangedFile(std::move(filePath));
+    }
+}
+
+void ResourceHotReloader::LoadChangedFile(std::string filePath)
+{
+    if (filePath.find_last_of('.') == std::string::npos) { return; }
+
+    const FileType fileType = PokFileSystem::GetFileType(filePath);
+    if (std::find(kReloadedFileTypes.begin(), kReloadedFileTypes.end(), fileType) == kReloadedFileTypes.end()) { return; }
+
+    const std::string folderPath = PokFileSystem::GetPath(fileType, FolderType::ROM);
+    if (filePath.compare(0, folderPath.size(), folderPath) != 0) { return; }
+
+    const std::string name = PokFileSystem::GetSubPathFromFullPath(filePath, fileType, FolderType::ROM, false);
+    const ResourceID resourceID = math::HashString(name);
+
+    //Two loads of the same file would write the same cooked file, the change is loaded once the first one is done
+    const auto delayChangedFile = [this, &filePath]() {
+        if (std::find(delayedFilePaths_.begin(), delayedFilePaths_.end(), filePath) == delayedFilePaths_.end()) {
+            delayedFilePaths_.push_back(std::move(filePath));
+        }
+    };
+
+    //Resources not used by the scene are loaded with it
+    switch (fileType) {
+    case FileType::MESH: {
+        if (meshManager_.GetMeshHandle(resourceID) == kInvalidResourceHandle) { return; }
+        if (HasPendingReload(reloadingMeshes_, name)) {
+            delayChangedFile();
+            return;
+        }
+
+        reloadingMeshes_.emplace_back(
+            name,
+            resourceLoader_.LoadAsync<MeshObjData>([name]() {
+                return MeshObj::LoadData(name);
+            }));
+    }
+    break;
+    case FileType::TEXTURE: {
+        if (texturesManager_.GetTexture2DHandle(resourceID) == kInvalidResourceHandle) { return; }
+        if (HasPendingReload(reloadingTextures2D_, name)) {
+            delayChangedFile();
+            return;
+        }
+
+        reloadingTextures2D_.emplace_back(
+            name,
+            resourceLoader_.LoadAsync<graphics::LoadedImageInfos>([name]() {
+                return graphics::Image2d::LoadData(name);
+            }));
+    }
+    break;
+    case FileType::MATERIAL: {
+        if (materialsManager_.GetMaterialHandle(resourceID) == kInvalidResourceHandle) { return; }
+        if (HasPendingReload(reloadingMaterials_, name)) {
+            delayChangedFile();
+            return;
+        }
+
+        //A file saved while being edited can be invalid, it is discarded instead of throwing
+        reloadingMaterials_.emplace_back(
+            name,
+            resourceLoader_.LoadAsync<json>([name]() {
+                return json::parse(
+                    PokFileSystem::ReadFile(name, FileType::MATERIAL, FolderType::ROM),
+                    nullptr,
+                    false);
+            }));
+    }
+    break;
+    default: ;
+    }
+}
+
+void ResourceHotReloader::SwapReloadedResources()
+{
+    auto meshes = TakeReadyReloads(reloadingMeshes_);
+    auto textures2D = TakeReadyReloads(reloadingTextures2D_);
+    auto materials = TakeReadyReloads(reloadingMaterials_);
+    if (meshes.empty() && textures2D.empty() && materials.empty()) { return; }
+
+    //The previous frames can still use the buffers and images replaced
+    graphics::CheckVk(vkDeviceWaitIdle(GraphicsEngineLocator::Get().GetLogicalDevice()));
+
+    for (auto& mesh : meshes) {
+        const MeshObjData& meshData = mesh.second.Get();
+        if (meshData.IsEmpty()) {
+            LogWarning("Impossible to reload the mesh " + mesh.first);
+            continue;
+        }
+        meshManager_.ReloadMesh(mesh.first, meshData);
+    }
+
+    //Textures first, the materials reloaded can use them
+    for (auto& texture2D : textures2D) {
+        graphics::LoadedImageInfos& loadedImage = texture2D.second.Get();
+        if (loadedImage.pixels.empty() && !loadedImage.cookedTexture.IsOpen()) {
+            LogWarning("Impossible to reload the texture " + texture2D.first);
+            continue;
+        }
+
+        const std::unique_ptr<graphics::Image2d> replacedTexture =
+            texturesManager_.ReloadTexture2D(texture2D.first, std::move(loadedImage));
+        if (replacedTexture) {
+            materialsManager_.ReplaceTexture2D(
+                *replacedTexture,
+                texturesManager_.GetTexture2DByName(texture2D.first));
+        }
+    }
+
+    for (auto& material : materials) {
+        const json& materialJson = material.second.Get();
+        if (materialJson.is_discarded() || !CheckJsonExists(materialJson, "materialType")) {
+            LogWarning("Impossible to reload the material " + material.first);
+            continue;
+        }
+        materialsManager_.ReloadMaterial(material.first, materialJson);
+    }
+
+    LogDebug(
+        "Reloaded " + std::to_string(meshes.size()) + " meshes, " +
+        std::to_string(textures2D.size()) + " textures and " +
+        std::to_string(materials.size()) + " materials");
+}
+} //namespace poke
@@ -0,0 +1,86 @@
+#include <ResourcesManager/resource_index.h>
+
+#include <algorithm>
+
+#include <CoreEngine/cassert.h>
+
+namespace poke {
+ResourceIndex::ResourceIndex(const size_t capacity)
+{
+    size_t powerOfTwo = 1;
+    while (powerOfTwo < capacity) { powerOfTwo <<= 1; }
+
+    keys_.resize(powerOfTwo, kEmptyKey);
+    handles_.resize(powerOfTwo, kInvalidResourceHandle);
+}
+
+void ResourceIndex::Insert(const ResourceID resourceID, const ResourceHandle handle)
+{
+    cassert(resourceID != kEmptyKey, "The resource ID 0 can't be indexed");
+
+    if ((size_ + 1) * kMaxLoadFactorInverse > keys_.size()) { Rehash(keys_.size() * 2); }
+
+    const size_t mask = keys_.size() - 1;
+    size_t slot = GetSlot(resourceID);
+    while (keys_[slot] != kEmptyKey && keys_[slot] != resourceID) { slot = (slot + 1) & mask; }
+
+    if (keys_[slot] == kEmptyKey) { size_++; }
+    keys_[slot] = resourceID;
+    handles_[slot] = handle;
+}
+
+bool ResourceIndex::Erase(const ResourceID resourceID)
+{
+    const size_t mask = keys_.size() - 1;
+    size_t slot = GetSlot(resourceID);
+    while (keys_[slot] != resourceID) {
+        if (keys_[slot] == kEmptyKey) { return false; }
+        slot = (slot + 1) & mask;
+    }
+
+    keys_[slot] = kEmptyKey;
+    handles_[slot] = kInvalidResourceHandle;
+    size_--;
+
+    //Move back the following keys that can't be reached anymore through the freed slot
+    for (size_t next = (slot + 1) & mask; keys_[next] != kEmptyKey; next = (next + 1) & mask) {
+        const size_t idealSlot = GetSlot(keys_[next]);
+        if (((next - idealSlot) & mask) >= ((next - slot) & mask)) {
+            keys_[slot] = keys_[next];
+            handles_[slot] = handles_[next];
+            keys_[next] = kEmptyKey;
+            handles_[next] = kInvalidResourceHandle;
+            slot = next;
+        }
+    }
+    return true;
+}
+
+void ResourceIndex::Clear()
+{
+    std::fill(keys_.begin(), keys_.end(), kEmptyKey);
+    std::fill(handles_.begin(), handles_.end(), kInvalidResourceHandle);
+    size_ = 0;
+}
+
+void ResourceIndex::Reserve(const size_t count)
+{
+    size_t capacity = keys_.size();
+    while (count * kMaxLoadFactorInverse > capacity) { capacity <<= 1; }
+
+    if (capacity != keys_.size()) { Rehash(capacity); }
+}
+
+void ResourceIndex::Rehash(const size_t capacity)
+{
+    std::vector<ResourceID> oldKeys(capacity, kEmptyKey);
+    std::vector<ResourceHandle> oldHandles(capacity, kInvalidResourceHandle);
+    keys_.swap(oldKeys);
+    handles_.swap(oldHandles);
+    size_ = 0;
+
+    for (size_t i = 0; i < oldKeys.size(); i++) {
+        if (oldKeys[i] != kEmptyKey) { Insert(oldKeys[i], oldHandles[i]); }
+    }
+}
+} //namespace poke
@@ -0,0 +1,25 @@
+#include <ResourcesManager/resource_loader.h>
+
+#include <algorithm>
+
+namespace poke {
+ResourceLoader::ResourceLoader(const size_t workerCount)
+{
+    workers_.reserve(workerCount);
+    for (size_t i = 0; i < workerCount; i++) {
+        workers_.emplace_back(std::make_unique<WorkerThread>());
+    }
+}
+
+void ResourceLoader::Wait()
+{
+    for (auto& worker : workers_) { worker->Wait(); }
+}
+
+size_t ResourceLoader::ComputeWorkerCount(const unsigned hardwareConcurrency)
+{
+    if (hardwareConcurrency <= 1) { return 1; }
+
+    return std::min(static_cast<size_t>(hardwareConcurrency - 1), kMaxWorkers);
+}
+} //namespace poke
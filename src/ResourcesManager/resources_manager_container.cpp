@@ -7,7 +7,10 @@ namespace poke {
 
 ResourcesManagerContainer::ResourcesManagerContainer(Engine& engine)
 {
-    
+    textureManager.SetResourceLoader(resourceLoader);
+    meshManager.SetResourceLoader(resourceLoader);
+    materialsManager.SetResourceLoader(resourceLoader);
+    soundsManager.SetResourceLoader(resourceLoader);
 }
 
 void ResourcesManagerContainer::Init()
@@ -0,0 +1,710 @@
+#include <Scenes/binary_scene.h>
+
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <unordered_map>
+#include <utility>
+
+#include <Utility/json_utility.h>
+
+namespace poke {
+namespace scene {
+namespace binary_scene {
+uint64_t HashSource(const uint8_t* data, const size_t size)
+{
+	return XXH64(data, size, math::kHashSeed);
+}
+
+ecs::ComponentType::ComponentType GetComponentType(const nonstd::string_view componentKey)
+{
+	using ecs::ComponentType::ComponentType;
+
+	static const std::array<std::pair<const char*, ComponentType>, 19> kComponentKeys{{
+		{"collider", ComponentType::COLLIDER},
+		{"model", ComponentType::MODEL},
+		{"rigidbody", ComponentType::RIGIDBODY},
+		{"light", ComponentType::LIGHT},
+		{"particleSystem", ComponentType::PARTICLE_SYSTEM},
+		{"audioSource", ComponentType::AUDIO_SOURCE},
+		{"trailRenderer", ComponentType::TRAIL_RENDERER},
+		{"segmentRenderer", ComponentType::SEGMENT_RENDERER},
+		{"spline", ComponentType::SPLINE_FOLLOWER},
+		{"enemy", ComponentType::ENEMY},
+		{"player", ComponentType::PLAYER},
+		{"destructibleElement", ComponentType::DESTRUCTIBLE_ELEMENT},
+		{"weapon", ComponentType::WEAPON},
+		{"projectile", ComponentType::PROJECTILE},
+		{"missile", ComponentType::MISSILE},
+		{"splineStates", ComponentType::SPLINE_STATES},
+		{"specialAttack", ComponentType::SPECIAL_ATTACK},
+		{"jiggle", ComponentType::JIGGLE},
+		{"gameCamera", ComponentType::GAME_CAMERA}
+	}};
+
+	for (const auto& componentKeyType : kComponentKeys) {
+		if (componentKey == componentKeyType.first) { return componentKeyType.second; }
+	}
+	return ComponentType::EMPTY;
+}
+
+uint32_t GetRecordSize(const ecs::ComponentType::ComponentType componentType)
+{
+	switch (componentType) {
+	case ecs::ComponentType::MODEL:
+		return sizeof(ModelRecord);
+	case ecs::ComponentType::RIGIDBODY:
+		return sizeof(RigidbodyRecord);
+	case ecs::ComponentType::COLLIDER:
+		return sizeof(ColliderRecord);
+	default:
+		return 0;
+	}
+}
+} //namespace binary_scene
+
+namespace {
+using namespace binary_scene;
+
+size_t AlignSectionSize(const size_t size)
+{
+	return (size + kSectionAlignment - 1) & ~(kSectionAlignment - 1);
+}
+
+class StringTable {
+public:
+	uint32_t Add(const std::string& string)
+	{
+		const auto it = indexes_.find(string);
+		if (it != indexes_.end()) { return it->second; }
+
+		const auto stringIndex = static_cast<uint32_t>(entries_.size());
+		entries_.push_back(StringEntry{
+			math::HashString(string),
+			static_cast<uint32_t>(data_.size()),
+			static_cast<uint32_t>(string.size())});
+		data_ += string;
+		indexes_.emplace(string, stringIndex);
+
+		return stringIndex;
+	}
+
+	const std::vector<StringEntry>& GetEntries() const { return entries_; }
+	const std::string& GetData() const { return data_; }
+
+private:
+	std::vector<StringEntry> entries_;
+	std::string data_;
+	std::unordered_map<std::string, uint32_t> indexes_;
+};
+
+struct SectionData {
+	SectionType type;
+	uint32_t count;
+	std::vector<uint8_t> bytes;
+};
+
+void AppendBytes(std::vector<uint8_t>& bytes, const void* data, const size_t size)
+{
+	const auto* begin = static_cast<const uint8_t*>(data);
+	bytes.insert(bytes.end(), begin, begin + size);
+}
+
+template<typename T>
+SectionData MakeArraySection(const SectionType type, const std::vector<T>& values)
+{
+	SectionData section{type, static_cast<uint32_t>(values.size()), {}};
+	AppendBytes(section.bytes, values.data(), values.size() * sizeof(T));
+	return section;
+}
+
+struct ComponentBlockData {
+	std::vector<uint32_t> entities;
+	std::vector<uint32_t> dataOffsets{0};
+	std::vector<uint8_t> data;
+};
+
+struct TypedComponentBlockData {
+	std::vector<uint32_t> entities;
+	std::vector<uint8_t> records;
+};
+
+//Same values as physics::ShapeType, the scenes don't depend on the physics
+enum ShapeRecordType : uint32_t {
+	BOX_SHAPE = 0,
+	SPHERE_SHAPE,
+	ELLIPSOID_SHAPE,
+	MESH_SHAPE
+};
+
+float ReadFloat(const json& objectJson, const char* key)
+{
+	return CheckJsonNumber(objectJson, key) ? objectJson[key].get<float>() : 0.0f;
+}
+
+math::Vec3 ReadVec3(const json& objectJson, const char* key)
+{
+	if (!CheckJsonExists(objectJson, key)) { return math::Vec3(0.0f); }
+
+	const json& vectorJson = objectJson[key];
+	if (!CheckJsonNumber(vectorJson, "x") || !CheckJsonNumber(vectorJson, "y") || !CheckJsonNumber(vectorJson, "z")) {
+		return math::Vec3(0.0f);
+	}
+	return math::Vec3(vectorJson["x"].get<float>(), vectorJson["y"].get<float>(), vectorJson["z"].get<float>());
+}
+
+template<typename T>
+T ReadRecord(const json& componentJson);
+
+template<>
+ModelRecord ReadRecord<ModelRecord>(const json& componentJson)
+{
+	ModelRecord record{0, 0};
+	if (CheckJsonNumber(componentJson, "materialHash")) { record.materialID = componentJson["materialHash"].get<uint64_t>(); }
+	if (CheckJsonNumber(componentJson, "meshHash")) { record.meshID = componentJson["meshHash"].get<uint64_t>(); }
+	return record;
+}
+
+template<>
+RigidbodyRecord ReadRecord<RigidbodyRecord>(const json& componentJson)
+{
+	RigidbodyRecord record{};
+	record.linearVelocity = ReadVec3(componentJson, "linearVelocity");
+	record.angularVelocity = ReadVec3(componentJson, "angularVelocity");
+	record.linearDrag = ReadFloat(componentJson, "linearDrag");
+	record.angularDrag = ReadFloat(componentJson, "angularDrag");
+	if (CheckJsonNumber(componentJson, "type")) { record.type = componentJson["type"].get<uint32_t>(); }
+	return record;
+}
+
+template<>
+ColliderRecord ReadRecord<ColliderRecord>(const json& componentJson)
+{
+	ColliderRecord record{};
+	if (CheckJsonParameter(componentJson, "isTrigger", json::value_t::boolean)) {
+		record.isTrigger = componentJson["isTrigger"].get<bool>() ? 1 : 0;
+	}
+	if (CheckJsonNumber(componentJson, "shapeType")) { record.shapeType = componentJson["shapeType"].get<uint32_t>(); }
+
+	if (CheckJsonExists(componentJson, "shape")) {
+		const json& shapeJson = componentJson["shape"];
+		record.positionOffset = ReadVec3(shapeJson, "positionOffset");
+		record.extent = ReadVec3(shapeJson, record.shapeType == MESH_SHAPE ? "meshExtent" : "extent");
+		record.radius = ReadFloat(shapeJson, "radius");
+	}
+	return record;
+}
+
+json RecordToJson(const ModelRecord& record)
+{
+	json componentJson;
+	componentJson["materialHash"] = record.materialID;
+	componentJson["meshHash"] = record.meshID;
+	return componentJson;
+}
+
+json RecordToJson(const RigidbodyRecord& record)
+{
+	json componentJson;
+	componentJson["linearVelocity"] = record.linearVelocity.ToJson();
+	componentJson["angularVelocity"] = record.angularVelocity.ToJson();
+	componentJson["linearDrag"] = record.linearDrag;
+	componentJson["angularDrag"] = record.angularDrag;
+	componentJson["type"] = static_cast<int>(record.type);
+	return componentJson;
+}
+
+json RecordToJson(const ColliderRecord& record)
+{
+	json componentJson;
+	componentJson["isTrigger"] = record.isTrigger != 0;
+	componentJson["shapeType"] = static_cast<int>(record.shapeType);
+	switch (record.shapeType) {
+	case BOX_SHAPE:
+		componentJson["shape"]["positionOffset"] = record.positionOffset.ToJson();
+		componentJson["shape"]["extent"] = record.extent.ToJson();
+		break;
+	case SPHERE_SHAPE:
+	case ELLIPSOID_SHAPE:
+		componentJson["shape"]["positionOffset"] = record.positionOffset.ToJson();
+		componentJson["shape"]["radius"] = record.radius;
+		break;
+	case MESH_SHAPE:
+		componentJson["shape"]["meshExtent"] = record.extent.ToJson();
+		componentJson["shape"]["positionOffset"] = record.positionOffset.ToJson();
+		break;
+	default: ;
+	}
+	return componentJson;
+}
+
+/**
+ * \brief Append the record of the component if it gives back the exact same json, otherwise it's stored as CBOR.
+ */
+template<typename T>
+bool AppendRecord(const json& componentJson, std::vector<uint8_t>& records)
+{
+	if (!componentJson.is_object()) { return false; }
+
+	const T record = ReadRecord<T>(componentJson);
+	if (RecordToJson(record) != componentJson) { return false; }
+
+	AppendBytes(records, &record, sizeof(T));
+	return true;
+}
+
+bool AppendRecord(
+	const ecs::ComponentType::ComponentType componentType,
+	const json& componentJson,
+	std::vector<uint8_t>& records)
+{
+	switch (componentType) {
+	case ecs::ComponentType::MODEL:
+		return AppendRecord<ModelRecord>(componentJson, records);
+	case ecs::ComponentType::RIGIDBODY:
+		return AppendRecord<RigidbodyRecord>(componentJson, records);
+	case ecs::ComponentType::COLLIDER:
+		return AppendRecord<ColliderRecord>(componentJson, records);
+	default:
+		return false;
+	}
+}
+
+bool IsInBounds(const uint64_t offset, const uint64_t size, const size_t bufferSize)
+{
+	return offset <= bufferSize && size <= bufferSize - offset;
+}
+} //namespace
+
+static_assert(sizeof(math::Vec3) == 3 * sizeof(float), "Transforms are stored as packed Vec3");
+
+json BinaryComponentBlock::GetComponentJson(const size_t index) const
+{
+	if (IsTyped()) {
+		switch (componentType) {
+		case ecs::ComponentType::MODEL:
+			return RecordToJson(GetRecord<ModelRecord>(index));
+		case ecs::ComponentType::RIGIDBODY:
+			return RecordToJson(GetRecord<RigidbodyRecord>(index));
+		case ecs::ComponentType::COLLIDER:
+			return RecordToJson(GetRecord<ColliderRecord>(index));
+		default:
+			return json();
+		}
+	}
+
+	return json::from_cbor(
+		data + dataOffsets[index],
+		static_cast<size_t>(dataOffsets[index + 1] - dataOffsets[index]));
+}
+
+bool BinarySceneView::SetData(const uint8_t* data, const size_t size)
+{
+	*this = BinarySceneView();
+
+	//Sections are read in place, the buffer must keep their alignment
+	if (data == nullptr ||
+		size < sizeof(Header) ||
+		reinterpret_cast<uintptr_t>(data) % kSectionAlignment != 0) {
+		return false;
+	}
+
+	const auto* header = reinterpret_cast<const Header*>(data);
+	if (header->magic != kMagic || header->version != kVersion) { return false; }
+	if (!IsInBounds(sizeof(Header), uint64_t(header->sectionCount) * sizeof(Section), size)) { return false; }
+
+	data_ = data;
+	size_ = size;
+	header_ = header;
+	sections_ = reinterpret_cast<const Section*>(data + sizeof(Header));
+
+	for (uint32_t i = 0; i < header->sectionCount; i++) {
+		if (!IsInBounds(sections_[i].offset, sections_[i].size, size) ||
+			sections_[i].offset % kSectionAlignment != 0) {
+			*this = BinarySceneView();
+			return false;
+		}
+	}
+
+	//Strings
+	const Section* stringEntries = FindSection(SectionType::STRING_ENTRIES);
+	const Section* stringData = FindSection(SectionType::STRING_DATA);
+	if (stringEntries != nullptr && stringData != nullptr &&
+		stringEntries->size >= uint64_t(stringEntries->count) * sizeof(StringEntry)) {
+		strings_ = reinterpret_cast<const StringEntry*>(data + stringEntries->offset);
+		stringCount_ = stringEntries->count;
+		stringData_ = reinterpret_cast<const char*>(data + stringData->offset);
+
+		for (uint32_t i = 0; i < stringCount_; i++) {
+			if (!IsInBounds(strings_[i].offset, strings_[i].length, stringData->size)) {
+				*this = BinarySceneView();
+				return false;
+			}
+		}
+	}
+
+	//Entities
+	if (FindSection(SectionType::ENTITY_FLAGS) != nullptr) {
+		flags_ = GetEntityArray<uint8_t>(SectionType::ENTITY_FLAGS);
+		tags_ = GetEntityArray<ecs::EntityTag>(SectionType::ENTITY_TAGS);
+		prefabs_ = GetEntityArray<uint32_t>(SectionType::ENTITY_PREFABS);
+		parents_ = GetEntityArray<ecs::EntityIndex>(SectionType::ENTITY_PARENTS);
+		positions_ = GetEntityArray<math::Vec3>(SectionType::TRANSFORM_POSITIONS);
+		rotations_ = GetEntityArray<math::Vec3>(SectionType::TRANSFORM_ROTATIONS);
+		scales_ = GetEntityArray<math::Vec3>(SectionType::TRANSFORM_SCALES);
+
+		if (!flags_ || !tags_ || !prefabs_ || !parents_ || !positions_ || !rotations_ || !scales_) {
+			*this = BinarySceneView();
+			return false;
+		}
+
+		for (uint32_t i = 0; i < header->entityCount; i++) {
+			if (prefabs_[i] != kNoString && prefabs_[i] >= stringCount_) {
+				*this = BinarySceneView();
+				return false;
+			}
+		}
+	} else if (header->entityCount != 0) {
+		*this = BinarySceneView();
+		return false;
+	}
+
+	//Components
+	for (uint32_t i = 0; i < header->sectionCount; i++) {
+		const Section& section = sections_[i];
+		if (section.type != SectionType::COMPONENT_BLOCK) { continue; }
+
+		bool isValid = section.size >= sizeof(ComponentBlockHeader);
+		const auto* blockHeader = reinterpret_cast<const ComponentBlockHeader*>(data + section.offset);
+		const uint64_t tablesSize = isValid
+			? sizeof(ComponentBlockHeader) + (uint64_t(blockHeader->entityCount) * 2 + 1) * sizeof(uint32_t)
+			: 0;
+		isValid = isValid &&
+			blockHeader->nameIndex < stringCount_ &&
+			blockHeader->entityCount <= header->entityCount &&
+			tablesSize <= section.size;
+
+		BinaryComponentBlock block;
+		if (isValid) {
+			block.name = GetString(blockHeader->nameIndex);
+			block.componentType = GetComponentType(block.name);
+			block.entityCount = blockHeader->entityCount;
+			block.entities = reinterpret_cast<const uint32_t*>(blockHeader + 1);
+			block.dataOffsets = block.entities + block.entityCount;
+			block.data = data + section.offset + tablesSize;
+
+			const uint64_t dataSize = section.size - tablesSize;
+			for (uint32_t j = 0; j < block.entityCount && isValid; j++) {
+				isValid = block.entities[j] < header->entityCount &&
+					(j == 0 || block.entities[j - 1] < block.entities[j]) &&
+					block.dataOffsets[j] <= block.dataOffsets[j + 1];
+			}
+			isValid = isValid && block.dataOffsets[block.entityCount] <= dataSize;
+		}
+
+		if (!isValid) {
+			*this = BinarySceneView();
+			return false;
+		}
+		componentBlocks_.push_back(block);
+	}
+
+	for (uint32_t i = 0; i < header->sectionCount; i++) {
+		const Section& section = sections_[i];
+		if (section.type != SectionType::TYPED_COMPONENT_BLOCK) { continue; }
+
+		bool isValid = section.size >= sizeof(TypedComponentBlockHeader);
+		const auto* blockHeader = reinterpret_cast<const TypedComponentBlockHeader*>(data + section.offset);
+		const uint64_t entitiesSize = isValid
+			? AlignSectionSize(uint64_t(blockHeader->entityCount) * sizeof(uint32_t))
+			: 0;
+		isValid = isValid &&
+			blockHeader->nameIndex < stringCount_ &&
+			blockHeader->entityCount <= header->entityCount &&
+			sizeof(TypedComponentBlockHeader) + entitiesSize + uint64_t(blockHeader->entityCount) * blockHeader->recordSize <= section.size;
+
+		BinaryComponentBlock block;
+		if (isValid) {
+			block.name = GetString(blockHeader->nameIndex);
+			block.componentType = GetComponentType(block.name);
+			block.entityCount = blockHeader->entityCount;
+			block.entities = reinterpret_cast<const uint32_t*>(blockHeader + 1);
+			block.records = data + section.offset + sizeof(TypedComponentBlockHeader) + entitiesSize;
+
+			//The record layout must be the one of this version
+			isValid = blockHeader->recordSize != 0 && blockHeader->recordSize == GetRecordSize(block.componentType);
+			for (uint32_t j = 0; j < block.entityCount && isValid; j++) {
+				isValid = block.entities[j] < header->entityCount &&
+					(j == 0 || block.entities[j - 1] < block.entities[j]);
+			}
+		}
+
+		if (!isValid) {
+			*this = BinarySceneView();
+			return false;
+		}
+		componentBlocks_.push_back(block);
+	}
+
+	return true;
+}
+
+nonstd::string_view BinarySceneView::GetString(const uint32_t stringIndex) const
+{
+	const StringEntry& entry = strings_[stringIndex];
+	return nonstd::string_view(stringData_ + entry.offset, entry.length);
+}
+
+uint32_t BinarySceneView::FindString(const math::StringHash hash) const
+{
+	for (uint32_t i = 0; i < stringCount_; i++) {
+		if (strings_[i].hash == hash) { return i; }
+	}
+	return kNoString;
+}
+
+json BinarySceneView::GetSceneDataJson() const
+{
+	const Section* section = FindSection(SectionType::SCENE_DATA);
+	if (section == nullptr) { return json(); }
+
+	return json::from_cbor(data_ + section->offset, static_cast<size_t>(section->size));
+}
+
+json BinarySceneView::ToJson() const
+{
+	json sceneJson = GetSceneDataJson();
+	if (flags_ == nullptr) { return sceneJson; }
+
+	json gameObjectsJson = json::array();
+	for (uint32_t i = 0; i < header_->entityCount; i++) {
+		json entityJson = json::object();
+
+		if (prefabs_[i] != kNoString) {
+			entityJson["prefabName"] = std::string(GetString(prefabs_[i]).data(), GetString(prefabs_[i]).size());
+		}
+		if (flags_[i] & EntityFlag::HAS_TRANSFORM) {
+			json& transformJson = entityJson["transform"];
+			transformJson["position"] = positions_[i].ToJson();
+			transformJson["rotation"] = rotations_[i].ToJson();
+			transformJson["scale"] = scales_[i].ToJson();
+			transformJson["parent"] = parents_[i];
+		}
+		if (flags_[i] & EntityFlag::HAS_TAG) {
+			entityJson["tag"] = tags_[i];
+		}
+		if (flags_[i] & EntityFlag::HAS_ACTIVE) {
+			entityJson["isActive"] = (flags_[i] & EntityFlag::IS_ACTIVE) != 0;
+		}
+
+		gameObjectsJson.push_back(std::move(entityJson));
+	}
+
+	for (const BinaryComponentBlock& block : componentBlocks_) {
+		const std::string name(block.name.data(), block.name.size());
+		for (uint32_t i = 0; i < block.entityCount; i++) {
+			gameObjectsJson[block.entities[i]][name] = block.GetComponentJson(i);
+		}
+	}
+
+	sceneJson["gameObjects"] = std::move(gameObjectsJson);
+	return sceneJson;
+}
+
+const Section* BinarySceneView::FindSection(const SectionType type) const
+{
+	for (uint32_t i = 0; i < header_->sectionCount; i++) {
+		if (sections_[i].type == type) { return &sections_[i]; }
+	}
+	return nullptr;
+}
+
+template<typename T>
+const T* BinarySceneView::GetEntityArray(const SectionType type) const
+{
+	const Section* section = FindSection(type);
+	if (section == nullptr || section->size < uint64_t(header_->entityCount) * sizeof(T)) {
+		return nullptr;
+	}
+	return reinterpret_cast<const T*>(data_ + section->offset);
+}
+
+bool BinarySceneView::IsUpToDate(const uint64_t sourceHash, const uint64_t sourceSize) const
+{
+	return IsValid() && header_->sourceHash == sourceHash && header_->sourceSize == sourceSize;
+}
+
+bool BinarySceneFile::Open(const std::string& fileName, const FolderType folderType)
+{
+	const std::string path = PokFileSystem::GetFullPath(fileName, FileType::BINARY_SCENE, folderType);
+	if (!PokFileSystem::CheckFileExists(path) || !file_.Open(path)) { return false; }
+
+	if (!view_.SetData(file_.GetData(), file_.GetSize())) {
+		file_.Close();
+		return false;
+	}
+	return true;
+}
+
+std::vector<uint8_t> CompileBinaryScene(const json& sceneJson, const uint64_t sourceHash, const uint64_t sourceSize)
+{
+	StringTable strings;
+	std::vector<SectionData> sections;
+	uint32_t entityCount = 0;
+
+	//Everything except the gameObjects is small and loaded by the managers from json
+	json sceneDataJson = sceneJson;
+	if (sceneDataJson.is_object()) { sceneDataJson.erase("gameObjects"); }
+	if (!sceneDataJson.is_null() && !sceneDataJson.empty()) {
+		sections.push_back(SectionData{SectionType::SCENE_DATA, 1, json::to_cbor(sceneDataJson)});
+	}
+
+	if (CheckJsonExists(sceneJson, "gameObjects") &&
+		CheckJsonParameter(sceneJson, "gameObjects", json::value_t::array)) {
+		const json& gameObjectsJson = sceneJson["gameObjects"];
+		entityCount = static_cast<uint32_t>(gameObjectsJson.size());
+
+		std::vector<uint8_t> flags(entityCount, 0);
+		std::vector<ecs::EntityTag> tags(entityCount, 0);
+		std::vector<uint32_t> prefabs(entityCount, kNoString);
+		std::vector<ecs::EntityIndex> parents(entityCount, ecs::kNoParent);
+		std::vector<math::Vec3> positions(entityCount, math::Vec3(0.0f));
+		std::vector<math::Vec3> rotations(entityCount, math::Vec3(0.0f));
+		std::vector<math::Vec3> scales(entityCount, math::Vec3(1.0f));
+		std::map<std::string, ComponentBlockData> componentBlocks;
+		std::map<std::string, TypedComponentBlockData> typedComponentBlocks;
+
+		for (uint32_t i = 0; i < entityCount; i++) {
+			const json& entityJson = gameObjectsJson[i];
+			if (!entityJson.is_object()) { continue; }
+
+			for (auto it = entityJson.begin(); it != entityJson.end(); ++it) {
+				const json& value = it.value();
+
+				if (it.key() == "prefabName" && value.is_string()) {
+					prefabs[i] = strings.Add(value.get<std::string>());
+				} else if (it.key() == "transform" && value.is_object()) {
+					flags[i] |= EntityFlag::HAS_TRANSFORM;
+					positions[i].SetFromJson(value.value("position", json()));
+					rotations[i].SetFromJson(value.value("rotation", json()));
+					scales[i].SetFromJson(value.value("scale", json()));
+					if (CheckJsonNumber(value, "parent")) { parents[i] = value["parent"]; }
+				} else if (it.key() == "tag" && IsJsonValueNumeric(value)) {
+					flags[i] |= EntityFlag::HAS_TAG;
+					tags[i] = value;
+				} else if (it.key() == "isActive" && value.is_boolean()) {
+					flags[i] |= EntityFlag::HAS_ACTIVE;
+					if (value.get<bool>()) { flags[i] |= EntityFlag::IS_ACTIVE; }
+				} else if (GetRecordSize(GetComponentType(it.key())) != 0 &&
+					AppendRecord(GetComponentType(it.key()), value, typedComponentBlocks[it.key()].records)) {
+					typedComponentBlocks[it.key()].entities.push_back(i);
+				} else {
+					ComponentBlockData& block = componentBlocks[it.key()];
+					block.entities.push_back(i);
+					json::to_cbor(value, block.data);
+					block.dataOffsets.push_back(static_cast<uint32_t>(block.data.size()));
+				}
+			}
+		}
+
+		sections.push_back(MakeArraySection(SectionType::ENTITY_FLAGS, flags));
+		sections.push_back(MakeArraySection(SectionType::ENTITY_TAGS, tags));
+		sections.push_back(MakeArraySection(SectionType::ENTITY_PREFABS, prefabs));
+		sections.push_back(MakeArraySection(SectionType::ENTITY_PARENTS, parents));
+		sections.push_back(MakeArraySection(SectionType::TRANSFORM_POSITIONS, positions));
+		sections.push_back(MakeArraySection(SectionType::TRANSFORM_ROTATIONS, rotations));
+		sections.push_back(MakeArraySection(SectionType::TRANSFORM_SCALES, scales));
+
+		for (const auto& componentBlock : componentBlocks) {
+			const ComponentBlockData& block = componentBlock.second;
+			const ComponentBlockHeader blockHeader{
+				strings.Add(componentBlock.first),
+				static_cast<uint32_t>(block.entities.size())};
+
+			SectionData section{SectionType::COMPONENT_BLOCK, 1, {}};
+			AppendBytes(section.bytes, &blockHeader, sizeof(ComponentBlockHeader));
+			AppendBytes(section.bytes, block.entities.data(), block.entities.size() * sizeof(uint32_t));
+			AppendBytes(section.bytes, block.dataOffsets.data(), block.dataOffsets.size() * sizeof(uint32_t));
+			AppendBytes(section.bytes, block.data.data(), block.data.size());
+			sections.push_back(std::move(section));
+		}
+
+		for (const auto& componentBlock : typedComponentBlocks) {
+			const TypedComponentBlockData& block = componentBlock.second;
+			if (block.entities.empty()) { continue; }
+
+			const TypedComponentBlockHeader blockHeader{
+				strings.Add(componentBlock.first),
+				static_cast<uint32_t>(block.entities.size()),
+				GetRecordSize(GetComponentType(componentBlock.first)),
+				0};
+
+			SectionData section{SectionType::TYPED_COMPONENT_BLOCK, 1, {}};
+			AppendBytes(section.bytes, &blockHeader, sizeof(TypedComponentBlockHeader));
+			AppendBytes(section.bytes, block.entities.data(), block.entities.size() * sizeof(uint32_t));
+			section.bytes.resize(AlignSectionSize(section.bytes.size()), 0);
+			AppendBytes(section.bytes, block.records.data(), block.records.size());
+			sections.push_back(std::move(section));
+		}
+	}
+
+	sections.push_back(MakeArraySection(SectionType::STRING_ENTRIES, strings.GetEntries()));
+	sections.push_back(SectionData{
+		SectionType::STRING_DATA,
+		static_cast<uint32_t>(strings.GetData().size()),
+		std::vector<uint8_t>(strings.GetData().begin(), strings.GetData().end())});
+
+	//Header, section table then every section aligned
+	const Header header{
+		kMagic,
+		kVersion,
+		entityCount,
+		static_cast<uint32_t>(sections.size()),
+		sourceHash,
+		sourceSize};
+	std::vector<Section> sectionTable;
+	sectionTable.reserve(sections.size());
+
+	size_t offset = AlignSectionSize(sizeof(Header) + sections.size() * sizeof(Section));
+	for (const SectionData& section : sections) {
+		sectionTable.push_back(Section{section.type, section.count, offset, section.bytes.size()});
+		offset += AlignSectionSize(section.bytes.size());
+	}
+
+	std::vector<uint8_t> bytes;
+	bytes.reserve(offset);
+	AppendBytes(bytes, &header, sizeof(Header));
+	AppendBytes(bytes, sectionTable.data(), sectionTable.size() * sizeof(Section));
+	for (const SectionData& section : sections) {
+		bytes.resize(AlignSectionSize(bytes.size()), 0);
+		AppendBytes(bytes, section.bytes.data(), section.bytes.size());
+	}
+	bytes.resize(AlignSectionSize(bytes.size()), 0);
+
+	return bytes;
+}
+
+bool ExportBinaryScene(
+	const json& sceneJson,
+	const std::string& fileName,
+	const FolderType folderType)
+{
+	MappedFile sourceFile;
+	if (!sourceFile.Open(PokFileSystem::GetFullPath(fileName, FileType::SCENE, folderType))) { return false; }
+	const std::vector<uint8_t> bytes = CompileBinaryScene(
+		sceneJson,
+		HashSource(sourceFile.GetData(), sourceFile.GetSize()),
+		sourceFile.GetSize());
+	sourceFile.Close();
+
+	std::ofstream file(
+		PokFileSystem::GetFullPath(fileName, FileType::BINARY_SCENE, folderType),
+		std::ios::binary | std::ios::trunc);
+	if (!file.is_open()) { return false; }
+
+	file.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+	return file.good();
+}
+} //namespace scene
+} //namespace poke
@@ -1,11 +1,27 @@
 #include <Scenes/scene.h>
 
+#include <Scenes/binary_scene.h>
+
 #include <Utility/log.h>
+#include <Utility/mapped_file.h>
 #include <CoreEngine/engine.h>
 #include <CoreEngine/ServiceLocator/service_locator_definition.h>
 
 namespace poke {
 namespace scene {
+namespace {
+//The binary scene is stale when the .pokscene has been edited since it was exported
+bool IsBinarySceneUpToDate(const BinarySceneFile& binaryScene, const std::string& fileName)
+{
+    //Builds can ship the binary scenes without their .pokscene
+    MappedFile sourceFile;
+    if (!sourceFile.Open(PokFileSystem::GetFullPath(fileName, FileType::SCENE, FolderType::ROM))) { return true; }
+
+    return binaryScene.GetView().IsUpToDate(
+        binary_scene::HashSource(sourceFile.GetData(), sourceFile.GetSize()),
+        sourceFile.GetSize());
+}
+} //namespace
 
 Scene::Scene(
     const SceneIndex sceneIndex,
@@ -31,12 +47,38 @@ void Scene::Load()
 		fileName_ = "Default";
     }
 
-    const json sceneJson = LoadJson(fileName_, FileType::SCENE, FolderType::ROM);
+    //The binary scene is mapped and read in place, the json is only parsed as a fallback
+    BinarySceneFile binaryScene;
+    if (ecsManager.IsBinarySceneSupported() && binaryScene.Open(fileName_) && IsBinarySceneUpToDate(binaryScene, fileName_)) {
+        const BinarySceneView& sceneView = binaryScene.GetView();
+        const json sceneDataJson = sceneView.GetSceneDataJson();
+
+        LoadResources(sceneDataJson);
+        const std::map<ecs::EntityIndex, ecs::EntityIndex> baseParentToOffsetParent =
+            ecsManager.SetEntitiesFromBinary(sceneView);
+        LoadArchetypesAndChunks(sceneDataJson, baseParentToOffsetParent);
+    } else {
+        const json sceneJson = LoadJson(fileName_, FileType::SCENE, FolderType::ROM);
+
+        cassert(!sceneJson.is_null(), "Scene not found");
+        LoadResources(sceneJson);
+
+        //Load game objects.
+        std::map<ecs::EntityIndex, ecs::EntityIndex> baseParentToOffsetParent;
+        if (CheckJsonExists(sceneJson, "gameObjects")) {
+            baseParentToOffsetParent = ecsManager.SetEntitiesFromJson(sceneJson["gameObjects"]);
+        }
+        LoadArchetypesAndChunks(sceneJson, baseParentToOffsetParent);
+    }
+
+	std::cout << "Load Scene\n";
+	Time::Get().ResetFrame();
+}
 
-	cassert(!sceneJson.is_null(), "Scene not found");
-    //Loading resources
+void Scene::LoadResources(const json& sceneJson) const
+{
     if (CheckJsonExists(sceneJson, "resources")) {
-        auto resourcesJson = sceneJson["resources"];
+        const json& resourcesJson = sceneJson["resources"];
 
 		if (CheckJsonExists(resourcesJson, "prefabNames")) {
 			PrefabsManagerLocator::Get().SetFromJson(resourcesJson["prefabNames"]);
@@ -54,13 +96,12 @@ void Scene::Load()
 			SoundsManagerLocator::Get().SetFromJson(resourcesJson["soundNames"]);
 		}
     }
+}
 
-    //Load game objects.
-	std::map<ecs::EntityIndex, ecs::EntityIndex> baseParentToOffsetParent;
-    if (CheckJsonExists(sceneJson, "gameObjects")) {
-		baseParentToOffsetParent = ecsManager.SetEntitiesFromJson(sceneJson["gameObjects"]);
-    }
-
+void Scene::LoadArchetypesAndChunks(
+    const json& sceneJson,
+    const std::map<ecs::EntityIndex, ecs::EntityIndex>& baseParentToOffsetParent) const
+{
 	//Load archetypes.
 	if (CheckJsonExists(sceneJson, "archetypes")) {
 		ArchetypesManagerLocator::Get().SetFromJson(sceneJson["archetypes"]);
@@ -71,9 +112,6 @@ void Scene::Load()
 		auto& manager = ChunksManagerLocator::Get();
 		manager.SetFromJson(sceneJson["chunks"], baseParentToOffsetParent);
 	}
-
-	std::cout << "Load Scene\n";
-	Time::Get().ResetFrame();
 }
 
 json Scene::ToJson() const
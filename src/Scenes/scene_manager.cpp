@@ -1,5 +1,7 @@
 #include <Scenes/scene_manager.h>
 
+#include <Scenes/binary_scene.h>
+
 #include <CoreEngine/engine.h>
 #include <Utility/log.h>
 #include <CoreEngine/ServiceLocator/service_locator_definition.h>
@@ -152,6 +154,12 @@ void InnerSceneManager::SaveActiveScene() const
         FileType::SCENE,
 		FolderType::SAVE_IN_ROM);
 
+	//The game loads the binary version when it exists
+	ExportBinaryScene(
+		sceneSave,
+		scenes_[activeSceneIndex_].GetSceneFileName(),
+		FolderType::SAVE_IN_ROM);
+
 	LogDebug("Scene " + scenes_[activeSceneIndex_].GetSceneFileName() + " saved !", LogType::SCENE_LOG);
 }
 
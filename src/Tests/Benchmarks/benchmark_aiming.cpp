@@ -0,0 +1,100 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <vector>
+
+#include <Game/spatial_hash.h>
+#include <Math/math.h>
+
+const float kMaxTargetDistance = 200.0f;
+const float kMaxAimAngle = 4.0f;
+const int kPlayersCount = 4;
+
+//Drawn targets, in front of the players
+std::vector<poke::math::Vec3> CreateTargetPositions(const int count)
+{
+	std::vector<poke::math::Vec3> positions(count);
+	for (int i = 0; i < count; i++) {
+		positions[i] = poke::math::Vec3(
+			std::fmod(i * 37.3f, 300.0f) - 150.0f,
+			std::fmod(i * 53.1f, 150.0f) - 75.0f,
+			std::fmod(i * 71.7f, 400.0f));
+	}
+	return positions;
+}
+
+poke::math::Vec3 GetAimDirection(const int playerIndex)
+{
+	return poke::math::Vec3(0.05f * playerIndex, -0.02f * playerIndex, 1).Normalize();
+}
+
+//Previous AimingAidSystem, the targets in range were selected then the angle to each of them was computed for each player
+static void BM_AimingLinear(benchmark::State& state) {
+	const std::vector<poke::math::Vec3> positions = CreateTargetPositions(state.range(0));
+	const poke::math::Vec3 playerPosition(0, 0, 0);
+	std::vector<poke::math::Vec3> targetPositions(positions.size());
+
+	for (auto _ : state) {
+		size_t targetNb = 0;
+		for (const poke::math::Vec3& position : positions) {
+			if (poke::math::Vec3::GetDistanceManhattan(position, playerPosition) < kMaxTargetDistance) {
+				targetPositions[targetNb++] = position;
+			}
+		}
+
+		for (int playerIndex = 0; playerIndex < kPlayersCount; playerIndex++) {
+			const poke::math::Vec3 aimDirection = GetAimDirection(playerIndex);
+			int target = -1;
+			float previousDistanceToTarget = kMaxTargetDistance;
+			for (size_t i = 0; i < targetNb; i++) {
+				const poke::math::Vec3 targetDirection = (targetPositions[i] - playerPosition).Normalize();
+				const float angle = std::atan2(
+					poke::math::Vec3::Cross(aimDirection, targetDirection).GetMagnitude(),
+					aimDirection * targetDirection) * poke::math::kRad2Deg;
+				if (angle >= kMaxAimAngle) { continue; }
+
+				const float distanceToTarget = poke::math::Vec3::GetDistanceManhattan(targetPositions[i], playerPosition);
+				if (distanceToTarget < previousDistanceToTarget) {
+					target = static_cast<int>(i);
+					previousDistanceToTarget = distanceToTarget;
+				}
+			}
+			benchmark::DoNotOptimize(target);
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AimingLinear)->Arg(500)->Arg(2000)->Arg(8000)->Unit(benchmark::kMicrosecond);
+
+//The hash is rebuilt each frame by the game, then each player only tests the cells of its cone
+static void BM_AimingSpatialHash(benchmark::State& state) {
+	const std::vector<poke::math::Vec3> positions = CreateTargetPositions(state.range(0));
+	const poke::math::Vec3 playerPosition(0, 0, 0);
+	poke::game::SpatialHash spatialHash;
+	std::vector<poke::game::SpatialHash::Entry> lockableTargets;
+
+	for (auto _ : state) {
+		spatialHash.Clear();
+		for (size_t i = 0; i < positions.size(); i++) {
+			spatialHash.Insert(static_cast<poke::ecs::EntityIndex>(i), positions[i]);
+		}
+		spatialHash.Build();
+
+		for (int playerIndex = 0; playerIndex < kPlayersCount; playerIndex++) {
+			spatialHash.QueryCone(playerPosition, GetAimDirection(playerIndex), kMaxAimAngle, kMaxTargetDistance, lockableTargets);
+
+			poke::ecs::EntityIndex target = -1;
+			float previousDistanceToTarget = kMaxTargetDistance;
+			for (const auto& lockableTarget : lockableTargets) {
+				const float distanceToTarget = poke::math::Vec3::GetDistanceManhattan(lockableTarget.position, playerPosition);
+				if (distanceToTarget < previousDistanceToTarget) {
+					target = lockableTarget.entityIndex;
+					previousDistanceToTarget = distanceToTarget;
+				}
+			}
+			benchmark::DoNotOptimize(target);
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AimingSpatialHash)->Arg(500)->Arg(2000)->Arg(8000)->Unit(benchmark::kMicrosecond);
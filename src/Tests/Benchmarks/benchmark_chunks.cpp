@@ -0,0 +1,82 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include <Chunks/chunks_grid.h>
+
+const long fromRange = 1 << 6;
+const long toRange = 1 << 12;
+
+const int kQueryNb = 1024;
+
+//Chunks of a level going forward, with a few overlaps
+std::vector<poke::chunk::Chunk> CreateChunks(const long chunkNb)
+{
+	std::mt19937 generator(0);
+	std::uniform_real_distribution<float> offsetDistribution(-10.0f, 10.0f);
+
+	std::vector<poke::chunk::Chunk> chunks(chunkNb);
+	for (long i = 0; i < chunkNb; i++) {
+		chunks[i].SetPosition({ offsetDistribution(generator), 0.0f, i * 40.0f });
+		chunks[i].SetExtent({ 100.0f, 50.0f, 50.0f });
+	}
+	return chunks;
+}
+
+std::vector<poke::math::Vec3> CreatePositions(const long chunkNb)
+{
+	std::mt19937 generator(1);
+	std::uniform_real_distribution<float> zDistribution(0.0f, chunkNb * 40.0f);
+	std::uniform_real_distribution<float> xDistribution(-50.0f, 50.0f);
+
+	std::vector<poke::math::Vec3> positions(kQueryNb);
+	for (auto& position : positions) { position = { xDistribution(generator), 0.0f, zDistribution(generator) }; }
+	return positions;
+}
+
+//Same loops than the ChunksManager before the grid
+static void BM_ChunksLinearScan(benchmark::State& state) {
+	const std::vector<poke::chunk::Chunk> chunks = CreateChunks(state.range(0));
+	const std::vector<poke::math::Vec3> positions = CreatePositions(state.range(0));
+
+	for (auto _ : state) {
+		for (const poke::math::Vec3 position : positions) {
+			poke::chunk::ChunkSet chunkSet;
+			for (poke::chunk::ChunkIndex i = 0; i < chunks.size(); i++) {
+				if (chunks[i].Overlap(poke::physics::AABB{ position, poke::math::Vec3(1.0f) })) { chunkSet.Insert(i); }
+			}
+			benchmark::DoNotOptimize(chunkSet);
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * kQueryNb);
+}
+BENCHMARK(BM_ChunksLinearScan)->Range(fromRange, toRange)->Unit(benchmark::kMicrosecond);
+
+static void BM_ChunksGrid(benchmark::State& state) {
+	const std::vector<poke::chunk::Chunk> chunks = CreateChunks(state.range(0));
+	const std::vector<poke::math::Vec3> positions = CreatePositions(state.range(0));
+
+	poke::chunk::ChunksGrid grid;
+	grid.Build(chunks);
+
+	for (auto _ : state) {
+		for (const poke::math::Vec3 position : positions) {
+			benchmark::DoNotOptimize(grid.FindChunks(chunks, poke::physics::AABB{ position, poke::math::Vec3(1.0f) }));
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * kQueryNb);
+	state.counters["Cells"] = static_cast<double>(grid.GetCellNb());
+}
+BENCHMARK(BM_ChunksGrid)->Range(fromRange, toRange)->Unit(benchmark::kMicrosecond);
+
+static void BM_ChunksGridBuild(benchmark::State& state) {
+	const std::vector<poke::chunk::Chunk> chunks = CreateChunks(state.range(0));
+
+	poke::chunk::ChunksGrid grid;
+	for (auto _ : state) {
+		grid.Build(chunks);
+		benchmark::ClobberMemory();
+	}
+}
+BENCHMARK(BM_ChunksGridBuild)->Range(fromRange, toRange)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,72 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#include <Utility/frame_limiter.h>
+
+using Clock = std::chrono::steady_clock;
+using Duration = std::chrono::duration<double, std::milli>;
+
+const Duration kTargetFrameTime(8.0);
+const int kFramesCount = 250;
+
+//Work done by a frame, every 4th frame takes longer than the target
+void DoFrameWork(const int frame)
+{
+	const Duration workTime(frame % 4 == 0 ? 10.0 : 3.0);
+	const Clock::time_point start = Clock::now();
+	volatile float value = 0.0f;
+	while (Clock::now() - start < workTime) { value = value + 1.0f; }
+}
+
+//Mean and standard deviation of the frame times, in milliseconds
+void SetFrameTimeCounters(benchmark::State& state, const double sum, const double sqrSum, const int count)
+{
+	const double mean = sum / count;
+	state.counters["FrameTime_Mean_ms"] = mean;
+	state.counters["FrameTime_StdDev_ms"] = std::sqrt(std::max(sqrSum / count - mean * mean, 0.0));
+}
+
+//Previous end of frame, the CPU time is the whole frame
+static void BM_FrameBusyWait(benchmark::State& state) {
+	double sum = 0.0;
+	double sqrSum = 0.0;
+	int frame = 0;
+	for (auto _ : state) {
+		const Clock::time_point startFrame = Clock::now();
+		DoFrameWork(frame++);
+		while (Duration(Clock::now() - startFrame) < kTargetFrameTime) {}
+
+		const double frameTime = Duration(Clock::now() - startFrame).count();
+		sum += frameTime;
+		sqrSum += frameTime * frameTime;
+	}
+	SetFrameTimeCounters(state, sum, sqrSum, frame);
+}
+BENCHMARK(BM_FrameBusyWait)->Iterations(kFramesCount)->Unit(benchmark::kMillisecond);
+
+//The CPU time is the work and the spin before the end of the frame
+static void BM_FrameLimiter(benchmark::State& state) {
+	poke::FrameLimiter frameLimiter(kTargetFrameTime);
+	frameLimiter.WaitEndOfFrame();
+
+	double sum = 0.0;
+	double sqrSum = 0.0;
+	int frame = 0;
+	Clock::time_point endFrame = Clock::now();
+	for (auto _ : state) {
+		DoFrameWork(frame++);
+		frameLimiter.WaitEndOfFrame();
+
+		const Clock::time_point startFrame = endFrame;
+		endFrame = Clock::now();
+		const double frameTime = Duration(endFrame - startFrame).count();
+		sum += frameTime;
+		sqrSum += frameTime * frameTime;
+	}
+	SetFrameTimeCounters(state, sum, sqrSum, frame);
+	state.counters["SpinTime_ms"] = frameLimiter.GetSpinTime().count();
+}
+BENCHMARK(BM_FrameLimiter)->Iterations(kFramesCount)->Unit(benchmark::kMillisecond);
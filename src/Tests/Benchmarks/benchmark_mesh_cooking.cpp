@@ -0,0 +1,178 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+
+#include <ResourcesManager/MeshManagers/mesh_obj.h>
+#include <ResourcesManager/MeshManagers/mesh_optimizer.h>
+
+const long fromRange = 1 << 4;
+const long toRange = 1 << 8;
+
+const std::string kBenchmarkMeshName = "benchmark_cooking.obj";
+
+//Grid of size * size quads written as a .obj in the meshes folder
+bool WriteGridObj(const long size)
+{
+	std::ostringstream obj;
+	for (long z = 0; z <= size; z++) {
+		for (long x = 0; x <= size; x++) {
+			obj << "v " << x << " 0 " << -z << "\n";
+			obj << "vt " << static_cast<float>(x) / size << " " << static_cast<float>(z) / size << "\n";
+		}
+	}
+	obj << "vn 0 1 0\n";
+	for (long z = 0; z < size; z++) {
+		for (long x = 0; x < size; x++) {
+			const long first = z * (size + 1) + x + 1;
+			const long next = first + size + 1;
+			obj << "f " << first << "/" << first << "/1 " << next << "/" << next << "/1 " << first + 1 << "/" << first + 1 << "/1\n";
+			obj << "f " << first + 1 << "/" << first + 1 << "/1 " << next << "/" << next << "/1 " << next + 1 << "/" << next + 1 << "/1\n";
+		}
+	}
+
+	std::ofstream file(
+		poke::PokFileSystem::GetFullPath(kBenchmarkMeshName, poke::FileType::MESH, poke::FolderType::SAVE_IN_ROM),
+		std::ios::trunc);
+	if (!file.is_open()) { return false; }
+	file << obj.str();
+	return file.good();
+}
+
+void DeleteGridObj()
+{
+	poke::PokFileSystem::DeleteFile(kBenchmarkMeshName, poke::FileType::MESH, poke::FolderType::SAVE_IN_ROM);
+	poke::PokFileSystem::DeleteFile(kBenchmarkMeshName, poke::FileType::COOKED_MESH, poke::FolderType::SAVE_IN_ROM);
+}
+
+//Parsing with tinyobjloader and removing the duplicated vertices, done at every launch before the cooked meshes
+static void BM_MeshLoadObj(benchmark::State& state) {
+	if (!WriteGridObj(state.range(0))) {
+		state.SkipWithError("Can't write the mesh");
+		return;
+	}
+
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(poke::MeshObj::Parse(kBenchmarkMeshName));
+	}
+	DeleteGridObj();
+}
+BENCHMARK(BM_MeshLoadObj)->Range(fromRange, toRange)->Unit(benchmark::kMicrosecond);
+
+//Hashing the .obj and mapping the up to date cooked mesh
+static void BM_MeshLoadCooked(benchmark::State& state) {
+	if (!WriteGridObj(state.range(0))) {
+		state.SkipWithError("Can't write the mesh");
+		return;
+	}
+	//First load cooks the mesh
+	poke::MeshObj::LoadData(kBenchmarkMeshName);
+
+	for (auto _ : state) {
+		const poke::MeshObjData meshData = poke::MeshObj::LoadData(kBenchmarkMeshName);
+		benchmark::DoNotOptimize(meshData.cookedMesh.IsOpen());
+	}
+	DeleteGridObj();
+}
+BENCHMARK(BM_MeshLoadCooked)->Range(fromRange, toRange)->Unit(benchmark::kMicrosecond);
+
+//Grid with its triangles in a random order, like a mesh exported without optimization
+void CreateShuffledGridMesh(
+	const long size,
+	std::vector<poke::graphics::VertexMesh>& vertices,
+	std::vector<uint32_t>& indices)
+{
+	for (long z = 0; z <= size; z++) {
+		for (long x = 0; x <= size; x++) {
+			vertices.emplace_back(
+				poke::math::Vec3(static_cast<float>(x), 0.0f, -static_cast<float>(z)),
+				poke::math::Vec2(static_cast<float>(x) / size, static_cast<float>(z) / size),
+				poke::math::Vec3(0.0f, 1.0f, 0.0f));
+		}
+	}
+
+	std::vector<long> quads(size * size);
+	for (long i = 0; i < size * size; i++) { quads[i] = i; }
+	std::shuffle(quads.begin(), quads.end(), std::mt19937(42));
+
+	for (const long quad : quads) {
+		const uint32_t first = static_cast<uint32_t>(quad / size * (size + 1) + quad % size);
+		const uint32_t next = first + static_cast<uint32_t>(size + 1);
+		indices.insert(indices.end(), { first, next, first + 1, first + 1, next, next + 1 });
+	}
+}
+
+static void BM_MeshOptimize(benchmark::State& state) {
+	std::vector<poke::graphics::VertexMesh> sourceVertices;
+	std::vector<uint32_t> sourceIndices;
+	CreateShuffledGridMesh(state.range(0), sourceVertices, sourceIndices);
+
+	std::vector<poke::graphics::VertexMesh> vertices;
+	std::vector<uint32_t> indices;
+	for (auto _ : state) {
+		state.PauseTiming();
+		vertices = sourceVertices;
+		indices = sourceIndices;
+		state.ResumeTiming();
+
+		poke::mesh_optimizer::OptimizeMesh(vertices, indices);
+		benchmark::DoNotOptimize(indices.data());
+	}
+
+	const poke::mesh_optimizer::VertexCacheStats sourceStats =
+		poke::mesh_optimizer::AnalyzeVertexCache(sourceIndices, sourceVertices.size());
+	const poke::mesh_optimizer::VertexCacheStats stats =
+		poke::mesh_optimizer::AnalyzeVertexCache(indices, vertices.size());
+	state.counters["ACMR_Before"] = sourceStats.acmr;
+	state.counters["ACMR_After"] = stats.acmr;
+	state.counters["ATVR_Before"] = sourceStats.atvr;
+	state.counters["ATVR_After"] = stats.atvr;
+}
+BENCHMARK(BM_MeshOptimize)->Range(fromRange, toRange)->Unit(benchmark::kMicrosecond);
+
+//Rolling terrain, so every level of detail has an error to respect
+void CreateTerrainMesh(
+	const long size,
+	std::vector<poke::graphics::VertexMesh>& vertices,
+	std::vector<uint32_t>& indices)
+{
+	for (long z = 0; z <= size; z++) {
+		for (long x = 0; x <= size; x++) {
+			const float height = std::sin(x * 0.3f) * std::cos(z * 0.2f);
+			vertices.emplace_back(
+				poke::math::Vec3(static_cast<float>(x), height, -static_cast<float>(z)),
+				poke::math::Vec2(static_cast<float>(x) / size, static_cast<float>(z) / size),
+				poke::math::Vec3(0.0f, 1.0f, 0.0f));
+		}
+	}
+	for (long z = 0; z < size; z++) {
+		for (long x = 0; x < size; x++) {
+			const uint32_t first = static_cast<uint32_t>(z * (size + 1) + x);
+			const uint32_t next = first + static_cast<uint32_t>(size + 1);
+			indices.insert(indices.end(), { first, next, first + 1, first + 1, next, next + 1 });
+		}
+	}
+}
+
+static void BM_MeshGenerateLods(benchmark::State& state) {
+	std::vector<poke::graphics::VertexMesh> vertices;
+	std::vector<uint32_t> indices;
+	CreateTerrainMesh(state.range(0), vertices, indices);
+
+	std::vector<poke::MeshLodData> lods;
+	for (auto _ : state) {
+		lods = poke::mesh_optimizer::GenerateLods(vertices, indices);
+		benchmark::DoNotOptimize(lods.data());
+	}
+
+	state.counters["Triangles"] = static_cast<double>(indices.size() / 3);
+	state.counters["Lods"] = static_cast<double>(lods.size());
+	if (!lods.empty()) {
+		state.counters["Triangles_LastLod"] = static_cast<double>(lods.back().indices.size() / 3);
+	}
+}
+BENCHMARK(BM_MeshGenerateLods)->Range(fromRange, toRange)->Unit(benchmark::kMicrosecond);
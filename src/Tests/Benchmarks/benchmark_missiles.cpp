@@ -0,0 +1,159 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include <Game/Components/missile.h>
+#include <Game/missile_kernels.h>
+#include <Math/math.h>
+#include <Math/quaternion.h>
+#include <Math/tranform.h>
+#include <PhysicsEngine/rigidbody.h>
+#include <Utility/worker_thread.h>
+
+const int kMissilesCount = 5000;
+const int kTargetsCount = 16;
+const float kDeltaTime = 1.0f / 60.0f;
+const float kMaxAngle = 90.0f;
+const float kLerpValue = 0.5f;
+
+//Salvos of missiles shot around the targets, they never run out of life time
+struct MissilesScene {
+	explicit MissilesScene(const int count)
+	{
+		for (int i = 0; i < kTargetsCount; i++) {
+			targets.emplace_back(std::cos(i * 0.4f) * 300.0f, std::sin(i * 0.7f) * 100.0f, 500.0f + i * 20.0f);
+		}
+
+		missiles.resize(count);
+		rigidbodies.resize(count);
+		transforms.resize(count);
+		for (int i = 0; i < count; i++) {
+			missiles[i].direction = poke::math::Vec3(std::sin(i * 0.1f), 0.2f, std::cos(i * 0.1f)).Normalize();
+			missiles[i].target = i * kTargetsCount / count;
+			missiles[i].speed = 100.0f;
+			missiles[i].lifeTime = 1e9f;
+			missiles[i].hasBeenShot = true;
+			transforms[i].SetLocalPosition(poke::math::Vec3(std::fmod(i * 7.3f, 200.0f), 0, std::fmod(i * 3.1f, 100.0f)));
+		}
+	}
+
+	void MoveMissiles()
+	{
+		for (size_t i = 0; i < transforms.size(); i++) {
+			transforms[i].SetLocalPosition(transforms[i].GetLocalPosition() + rigidbodies[i].linearVelocity * kDeltaTime);
+		}
+	}
+
+	std::vector<poke::math::Vec3> targets;
+	std::vector<poke::game::Missile> missiles;
+	std::vector<poke::physics::Rigidbody> rigidbodies;
+	std::vector<poke::math::Transform> transforms;
+};
+
+bool IsInFieldOfAim(const poke::math::Vec3 missileDirection, const poke::math::Vec3 targetDirection)
+{
+	const poke::math::Vec3 mdNormalized = missileDirection.Normalize();
+	const poke::math::Vec3 tdNormalized = targetDirection.Normalize();
+	const float angleBetween = std::atan2(
+		poke::math::Vec3::Cross(mdNormalized, tdNormalized).GetMagnitude(),
+		mdNormalized * tdNormalized) * poke::math::kRad2Deg;
+	return angleBetween < kMaxAngle;
+}
+
+//Previous MissilesSystem, the components were copied in staging arrays then each missile was updated and copied back
+static void BM_MissilesStaging(benchmark::State& state) {
+	MissilesScene scene(state.range(0));
+	std::vector<poke::game::Missile> missiles(scene.missiles.size());
+	std::vector<poke::physics::Rigidbody> rigidbodies(scene.missiles.size());
+	std::vector<poke::math::Transform> transforms(scene.missiles.size());
+	std::vector<poke::math::Vec3> missileTargetDirections(scene.missiles.size());
+
+	for (auto _ : state) {
+		for (size_t i = 0; i < missiles.size(); i++) { missiles[i] = scene.missiles[i]; }
+		for (size_t i = 0; i < missiles.size(); i++) { rigidbodies[i] = scene.rigidbodies[i]; }
+		for (size_t i = 0; i < missiles.size(); i++) { transforms[i] = scene.transforms[i]; }
+		for (size_t i = 0; i < missiles.size(); i++) {
+			missileTargetDirections[i] = (scene.targets[missiles[i].target] - transforms[i].GetLocalPosition()).Normalize();
+		}
+
+		for (size_t i = 0; i < missiles.size(); i++) {
+			if (IsInFieldOfAim(missiles[i].direction, missileTargetDirections[i])) {
+				missiles[i].direction =
+					(missiles[i].direction + (missileTargetDirections[i] - missiles[i].direction) * kLerpValue).Normalize();
+				transforms[i].SetLocalRotation(
+					poke::math::Quaternion::FromToRotation(poke::math::Vec3(0, 0, 1), missiles[i].direction).GetEulerAngles());
+			}
+			rigidbodies[i].linearVelocity = missiles[i].direction * missiles[i].speed;
+			missiles[i].lifeTime -= kDeltaTime;
+		}
+
+		for (size_t i = 0; i < missiles.size(); i++) { scene.rigidbodies[i] = rigidbodies[i]; }
+		for (size_t i = 0; i < missiles.size(); i++) { scene.missiles[i] = missiles[i]; }
+		for (size_t i = 0; i < missiles.size(); i++) { scene.transforms[i] = transforms[i]; }
+
+		state.PauseTiming();
+		scene.MoveMissiles();
+		state.ResumeTiming();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_MissilesStaging)->Arg(kMissilesCount)->Unit(benchmark::kMicrosecond);
+
+//Same update through the batch, arg 1 is the number of worker threads used with the main thread
+static void BM_MissilesBatch(benchmark::State& state) {
+	MissilesScene scene(state.range(0));
+	const size_t workersCount = state.range(1);
+	std::vector<std::unique_ptr<poke::WorkerThread>> workers;
+	for (size_t i = 0; i < workersCount; i++) { workers.emplace_back(std::make_unique<poke::WorkerThread>()); }
+
+	poke::game::missile_kernels::MissilesBatch batch;
+	const float cosMaxAngle = std::cos(kMaxAngle * poke::math::kDeg2Rad);
+	for (auto _ : state) {
+		batch.Resize(scene.missiles.size());
+		for (size_t i = 0; i < scene.missiles.size(); i++) {
+			const poke::game::Missile& missile = scene.missiles[i];
+			const poke::math::Vec3 position = scene.transforms[i].GetLocalPosition();
+			const poke::math::Vec3 targetPosition = scene.targets[missile.target];
+			batch.positionsX[i] = position.x;
+			batch.positionsY[i] = position.y;
+			batch.positionsZ[i] = position.z;
+			batch.targetsX[i] = targetPosition.x;
+			batch.targetsY[i] = targetPosition.y;
+			batch.targetsZ[i] = targetPosition.z;
+			batch.directionsX[i] = missile.direction.x;
+			batch.directionsY[i] = missile.direction.y;
+			batch.directionsZ[i] = missile.direction.z;
+			batch.speeds[i] = missile.speed;
+			batch.lifeTimes[i] = missile.lifeTime;
+		}
+
+		const size_t missilesPerRange = (batch.GetSize() + workersCount) / (workersCount + 1);
+		for (size_t range = 1; range <= workersCount; range++) {
+			const size_t begin = range * missilesPerRange;
+			const size_t end = std::min(begin + missilesPerRange, batch.GetSize());
+			workers[range - 1]->DoAsync([&batch, begin, end, cosMaxAngle]() {
+				poke::game::missile_kernels::UpdateMissiles(batch, begin, end, kDeltaTime, cosMaxAngle, kLerpValue);
+			});
+		}
+		poke::game::missile_kernels::UpdateMissiles(
+			batch, 0, std::min(missilesPerRange, batch.GetSize()), kDeltaTime, cosMaxAngle, kLerpValue);
+		for (auto& worker : workers) { worker->Wait(); }
+
+		for (size_t i = 0; i < scene.missiles.size(); i++) {
+			poke::game::Missile& missile = scene.missiles[i];
+			missile.direction = poke::math::Vec3(batch.directionsX[i], batch.directionsY[i], batch.directionsZ[i]);
+			missile.lifeTime = batch.lifeTimes[i];
+			scene.rigidbodies[i].linearVelocity = poke::math::Vec3(batch.velocitiesX[i], batch.velocitiesY[i], batch.velocitiesZ[i]);
+			if (batch.hasTurned[i]) { scene.transforms[i].SetLocalOrientation(batch.rotations[i]); }
+		}
+
+		state.PauseTiming();
+		scene.MoveMissiles();
+		state.ResumeTiming();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_MissilesBatch)->Args({kMissilesCount, 0})->Args({kMissilesCount, 3})->Unit(benchmark::kMicrosecond);
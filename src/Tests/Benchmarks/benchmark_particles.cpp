@@ -0,0 +1,266 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <GraphicsEngine/Particles/particle_kernels.h>
+#include <Utility/worker_thread.h>
+
+const size_t emittersCount = 100;
+const size_t particlesPerEmitter = 10000;
+const float deltaTime = 1.0f / 60.0f;
+
+struct EmitterData {
+	std::vector<poke::math::Vec3> position;
+	std::vector<poke::math::Vec3> velocity;
+	std::vector<poke::Color> originalColor;
+	std::vector<poke::Color> colorOffset;
+	std::vector<float> lifetime;
+	std::vector<float> elapsedTime;
+	std::vector<float> transparency;
+};
+
+std::vector<EmitterData> GenerateEmitters()
+{
+	std::vector<EmitterData> emitters(emittersCount);
+	for (auto& emitter : emitters) {
+		emitter.position.resize(particlesPerEmitter);
+		emitter.velocity.assign(particlesPerEmitter, poke::math::Vec3(0, 1, 0));
+		emitter.originalColor.assign(particlesPerEmitter, poke::Color(1, 1, 1, 1));
+		emitter.colorOffset.resize(particlesPerEmitter);
+		//Long lifetime, the benchmark measures the simulation without deaths
+		emitter.lifetime.assign(particlesPerEmitter, 1000.0f);
+		emitter.elapsedTime.resize(particlesPerEmitter);
+		emitter.transparency.resize(particlesPerEmitter);
+		for (size_t i = 0; i < particlesPerEmitter; i++) {
+			emitter.elapsedTime[i] = static_cast<float>(i % 1000);
+		}
+	}
+	return emitters;
+}
+
+poke::ColorGradient GenerateGradient()
+{
+	poke::ColorGradient gradient;
+	gradient.AddMark(0.5f, poke::Color(1, 0, 0, 0.5f));
+	return gradient;
+}
+
+void SimulateScalar(EmitterData& emitter, const poke::ColorGradient& gradient)
+{
+	for (size_t i = 0; i < particlesPerEmitter; i++) { emitter.elapsedTime[i] += deltaTime; }
+	for (size_t i = 0; i < particlesPerEmitter; i++) { emitter.velocity[i].y += -10.0f * deltaTime; }
+	for (size_t i = 0; i < particlesPerEmitter; i++) { emitter.position[i] += emitter.velocity[i] * deltaTime; }
+	for (size_t i = 0; i < particlesPerEmitter; i++) {
+		emitter.colorOffset[i] = emitter.originalColor[i] * gradient.GetColorAt(
+			emitter.elapsedTime[i] / emitter.lifetime[i]);
+		emitter.transparency[i] = emitter.colorOffset[i].a;
+	}
+}
+
+void SimulateKernels(EmitterData& emitter, const poke::ColorGradient& gradient)
+{
+	using namespace poke::graphics::particle_kernels;
+
+	AgeParticles(emitter.elapsedTime.data(), particlesPerEmitter, deltaTime);
+	//Constant lifetime, the emitters are in ring buffer mode
+	benchmark::DoNotOptimize(CountDeadParticlesInRing(
+		emitter.elapsedTime.data(),
+		emitter.lifetime.data(),
+		0,
+		particlesPerEmitter,
+		particlesPerEmitter));
+	ApplyGravity(emitter.velocity.data(), particlesPerEmitter, -10.0f * deltaTime);
+	IntegratePositions(emitter.position.data(), emitter.velocity.data(), particlesPerEmitter, deltaTime);
+	ComputeColorsOverLifetime(
+		gradient,
+		emitter.elapsedTime.data(),
+		emitter.lifetime.data(),
+		emitter.originalColor.data(),
+		emitter.colorOffset.data(),
+		emitter.transparency.data(),
+		particlesPerEmitter);
+}
+
+static void BM_ParticlesScalar(benchmark::State& state) {
+	auto emitters = GenerateEmitters();
+	const auto gradient = GenerateGradient();
+
+	for (auto _ : state) {
+		for (auto& emitter : emitters) { SimulateScalar(emitter, gradient); }
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * emittersCount * particlesPerEmitter);
+}
+BENCHMARK(BM_ParticlesScalar)->Unit(benchmark::kMillisecond);
+
+static void BM_ParticlesKernels(benchmark::State& state) {
+	auto emitters = GenerateEmitters();
+	const auto gradient = GenerateGradient();
+
+	for (auto _ : state) {
+		for (auto& emitter : emitters) { SimulateKernels(emitter, gradient); }
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * emittersCount * particlesPerEmitter);
+}
+BENCHMARK(BM_ParticlesKernels)->Unit(benchmark::kMillisecond);
+
+//Same split as ParticlesSystem, the calling thread takes the first range
+static void BM_ParticlesKernelsWorkers(benchmark::State& state) {
+	auto emitters = GenerateEmitters();
+	const auto gradient = GenerateGradient();
+
+	const size_t rangesCount = state.range(0);
+	std::vector<std::unique_ptr<poke::WorkerThread>> workers;
+	for (size_t i = 1; i < rangesCount; i++) {
+		workers.emplace_back(std::make_unique<poke::WorkerThread>());
+	}
+	const size_t emittersPerRange = (emittersCount + rangesCount - 1) / rangesCount;
+
+	for (auto _ : state) {
+		for (size_t range = 1; range < rangesCount; range++) {
+			workers[range - 1]->DoAsync([&emitters, &gradient, range, emittersPerRange]() {
+				const size_t end = std::min(emittersCount, (range + 1) * emittersPerRange);
+				for (size_t i = range * emittersPerRange; i < end; i++) {
+					SimulateKernels(emitters[i], gradient);
+				}
+			});
+		}
+		for (size_t i = 0; i < emittersPerRange; i++) { SimulateKernels(emitters[i], gradient); }
+		for (auto& worker : workers) { worker->Wait(); }
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * emittersCount * particlesPerEmitter);
+}
+BENCHMARK(BM_ParticlesKernelsWorkers)->Arg(1)->Arg(2)->Arg(4)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+//Mass death: a burst of particles dies during the same frame
+struct BurstData {
+	std::vector<poke::math::Vec3> position;
+	std::vector<poke::math::Vec3> velocity;
+	std::vector<poke::Color> color;
+	std::vector<float> lifetime;
+	std::vector<float> elapsedTime;
+	std::vector<float> scale;
+};
+
+const size_t burstParticlesCount = 10000;
+
+//Dead particles are spread uniformly, range(0) is the percentage of dead particles.
+//When every particle dies the previous algorithm rescans the whole array for each of them.
+BurstData GenerateBurst(const long deadPercent)
+{
+	BurstData burst;
+	burst.position.resize(burstParticlesCount);
+	burst.velocity.resize(burstParticlesCount);
+	burst.color.resize(burstParticlesCount);
+	burst.scale.resize(burstParticlesCount);
+	burst.lifetime.assign(burstParticlesCount, 1.0f);
+	burst.elapsedTime.resize(burstParticlesCount);
+	for (size_t i = 0; i < burstParticlesCount; i++) {
+		burst.elapsedTime[i] = static_cast<long>(i * 100 / burstParticlesCount) < deadPercent ? 2.0f : 0.5f;
+	}
+	std::shuffle(burst.elapsedTime.begin(), burst.elapsedTime.end(), std::mt19937(42));
+	return burst;
+}
+
+//Previous ParticlesSystem algorithm, swap each dead particle with the last alive one then rescan
+size_t RemoveDeadSwapAndRescan(BurstData& burst)
+{
+	auto upperBound = static_cast<int>(burst.elapsedTime.size());
+	for (auto j = upperBound - 1; j >= 0; --j) {
+		if (burst.elapsedTime[j] < burst.lifetime[j]) {
+			upperBound = j + 1;
+			break;
+		}
+	}
+
+	for (auto i = 0; i < upperBound; i++) {
+		if (burst.elapsedTime[i] >= burst.lifetime[i]) {
+			const auto index = upperBound - 1;
+			std::swap(burst.position[i], burst.position[index]);
+			std::swap(burst.velocity[i], burst.velocity[index]);
+			std::swap(burst.color[i], burst.color[index]);
+			std::swap(burst.lifetime[i], burst.lifetime[index]);
+			std::swap(burst.elapsedTime[i], burst.elapsedTime[index]);
+			std::swap(burst.scale[i], burst.scale[index]);
+
+			for (auto j = upperBound - 1; j >= 0; --j) {
+				if (burst.elapsedTime[j] < burst.lifetime[j]) {
+					upperBound = j + 1;
+					break;
+				}
+			}
+		}
+	}
+	return upperBound;
+}
+
+size_t RemoveDeadCompaction(BurstData& burst, std::vector<poke::graphics::particle_kernels::ParticleMove>& moves)
+{
+	using namespace poke::graphics::particle_kernels;
+
+	size_t movesCount = 0;
+	const size_t aliveCount = ComputeDeadParticlesMoves(
+		burst.elapsedTime.data(),
+		burst.lifetime.data(),
+		burst.elapsedTime.size(),
+		moves.data(),
+		movesCount);
+	ApplyParticlesMoves(burst.position.data(), moves.data(), movesCount);
+	ApplyParticlesMoves(burst.velocity.data(), moves.data(), movesCount);
+	ApplyParticlesMoves(burst.color.data(), moves.data(), movesCount);
+	ApplyParticlesMoves(burst.lifetime.data(), moves.data(), movesCount);
+	ApplyParticlesMoves(burst.elapsedTime.data(), moves.data(), movesCount);
+	ApplyParticlesMoves(burst.scale.data(), moves.data(), movesCount);
+	return aliveCount;
+}
+
+static void BM_MassDeathSwapAndRescan(benchmark::State& state) {
+	const auto burst = GenerateBurst(state.range(0));
+
+	for (auto _ : state) {
+		state.PauseTiming();
+		auto data = burst;
+		state.ResumeTiming();
+		benchmark::DoNotOptimize(RemoveDeadSwapAndRescan(data));
+	}
+}
+BENCHMARK(BM_MassDeathSwapAndRescan)->Arg(1)->Arg(10)->Arg(50)->Arg(90)->Arg(100);
+
+static void BM_MassDeathCompaction(benchmark::State& state) {
+	const auto burst = GenerateBurst(state.range(0));
+	std::vector<poke::graphics::particle_kernels::ParticleMove> moves(burstParticlesCount / 2 + 1);
+
+	for (auto _ : state) {
+		state.PauseTiming();
+		auto data = burst;
+		state.ResumeTiming();
+		benchmark::DoNotOptimize(RemoveDeadCompaction(data, moves));
+	}
+}
+BENCHMARK(BM_MassDeathCompaction)->Arg(1)->Arg(10)->Arg(50)->Arg(90)->Arg(100);
+
+//Constant lifetime, particles are in emission order and the dead ones are at the head of the ring
+static void BM_MassDeathRingBuffer(benchmark::State& state) {
+	auto burst = GenerateBurst(state.range(0));
+	std::sort(burst.elapsedTime.begin(), burst.elapsedTime.end(), std::greater<float>());
+
+	//The head is in the middle of the ring, the alive particles wrap around
+	const size_t first = burstParticlesCount / 2;
+	std::rotate(burst.elapsedTime.begin(), burst.elapsedTime.begin() + first, burst.elapsedTime.end());
+
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(poke::graphics::particle_kernels::CountDeadParticlesInRing(
+			burst.elapsedTime.data(),
+			burst.lifetime.data(),
+			first,
+			burstParticlesCount,
+			burstParticlesCount));
+	}
+}
+BENCHMARK(BM_MassDeathRingBuffer)->Arg(1)->Arg(10)->Arg(50)->Arg(90)->Arg(100);
@@ -0,0 +1,81 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+#include <CoreEngine/engine.h>
+#include <CoreEngine/ServiceLocator/service_locator_definition.h>
+#include <Editor/editor.h>
+#include <GraphicsEngine/Renderers/renderer_editor.h>
+
+const int kSpawnNb = 64;
+
+//A projectile with a light child, the objects of the prefab aren't in an archetype
+json CreatePrefabsJson()
+{
+	json objectsJson;
+	objectsJson[0]["objectName"] = "Projectile";
+	objectsJson[0]["transform"] = poke::math::Transform(poke::math::Vec3(0, 0, 0)).ToJson();
+	objectsJson[0]["transform"]["parent"] = -1;
+	objectsJson[0]["rigidbody"]["angularDrag"] = 0.0f;
+	objectsJson[0]["rigidbody"]["angularVelocity"] = poke::math::Vec3(0, 0, 0).ToJson();
+	objectsJson[0]["rigidbody"]["linearDrag"] = 0.0f;
+	objectsJson[0]["rigidbody"]["linearVelocity"] = poke::math::Vec3(0, 0, 10).ToJson();
+	objectsJson[0]["rigidbody"]["type"] = poke::physics::RigidbodyType::DYNAMIC;
+	objectsJson[0]["collider"]["isTrigger"] = true;
+	objectsJson[0]["collider"]["shape"]["extent"] = poke::math::Vec3(1, 1, 1).ToJson();
+	objectsJson[0]["collider"]["shape"]["positionOffset"] = poke::math::Vec3(0, 0, 0).ToJson();
+	objectsJson[0]["collider"]["shapeType"] = poke::physics::ShapeType::BOX;
+
+	objectsJson[1]["objectName"] = "ProjectileLight";
+	objectsJson[1]["transform"] = poke::math::Transform(poke::math::Vec3(0, 0, 0)).ToJson();
+	objectsJson[1]["transform"]["parent"] = 0;
+
+	json prefabsJson;
+	prefabsJson[0]["name"] = "Projectile";
+	prefabsJson[0]["objects"] = objectsJson;
+	return prefabsJson;
+}
+
+std::unique_ptr<poke::Engine> CreateEngine()
+{
+	const poke::EngineSetting engineSettings{
+		"benchmarkPrefabs",
+		poke::AppType::EDITOR,
+		std::chrono::duration<double, std::milli>(16.66f),
+		720,
+		640,
+		"[Benchmark] Prefabs",
+		{{0, "Default", "Default"}}
+	};
+
+	auto engine = std::make_unique<poke::Engine>(engineSettings);
+	engine->SetApp(std::make_unique<poke::editor::Editor>(*engine, ""));
+	engine->GetModuleManager().graphicsEngine.SetRenderer(
+		std::make_unique<poke::graphics::RendererEditor>(*engine));
+	engine->Init();
+
+	poke::PrefabsManagerLocator::Get().SetFromJson(CreatePrefabsJson());
+	return engine;
+}
+
+//Spawn and destroy a wave of projectiles, arg 0 is the size of the pool
+static void BM_PrefabSpawn(benchmark::State& state) {
+	const auto engine = CreateEngine();
+	auto& prefabsManager = poke::PrefabsManagerLocator::Get();
+	auto& ecsManager = poke::EcsManagerLocator::Get();
+	if (state.range(0) > 0) { prefabsManager.AddPrefabPool("Projectile", state.range(0)); }
+
+	std::vector<poke::ecs::EntityIndex> roots(kSpawnNb);
+	for (auto _ : state) {
+		for (int i = 0; i < kSpawnNb; i++) {
+			roots[i] = prefabsManager.Instantiate("Projectile")[0];
+		}
+		benchmark::DoNotOptimize(roots.data());
+
+		state.PauseTiming();
+		for (const poke::ecs::EntityIndex root : roots) { ecsManager.DestroyEntity(root); }
+		state.ResumeTiming();
+	}
+	state.SetItemsProcessed(state.iterations() * kSpawnNb);
+}
+BENCHMARK(BM_PrefabSpawn)->Arg(0)->Arg(kSpawnNb)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,109 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <unordered_map>
+
+#include <ResourcesManager/resource_index.h>
+
+const long fromRange = 1 << 4;
+const long toRange = 10000;
+
+const size_t kLookupsCount = 1024;
+
+std::vector<poke::ResourceID> CreateResourceIDs(const size_t resourcesCount)
+{
+	std::vector<poke::ResourceID> resourceIDs(resourcesCount);
+	for (size_t i = 0; i < resourcesCount; i++) {
+		resourceIDs[i] = poke::math::HashString("resource_" + std::to_string(i));
+	}
+	return resourceIDs;
+}
+
+//Existing resources looked up in a random order, like the draw system does with its entities
+std::vector<poke::ResourceID> CreateLookups(const std::vector<poke::ResourceID>& resourceIDs)
+{
+	std::mt19937 generator(42);
+	std::uniform_int_distribution<size_t> distribution(0, resourceIDs.size() - 1);
+
+	std::vector<poke::ResourceID> lookups(kLookupsCount);
+	for (auto& lookup : lookups) { lookup = resourceIDs[distribution(generator)]; }
+	return lookups;
+}
+
+//Same search than the managers before the index
+static void BM_ResourceLookupLinear(benchmark::State& state) {
+	const std::vector<poke::ResourceID> resourceIDs = CreateResourceIDs(state.range(0));
+	const std::vector<poke::ResourceID> lookups = CreateLookups(resourceIDs);
+
+	for (auto _ : state) {
+		for (const poke::ResourceID lookup : lookups) {
+			size_t index = 0;
+			for (size_t i = 0; i < resourceIDs.size(); i++) {
+				if (resourceIDs[i] == lookup) {
+					index = i;
+					break;
+				}
+			}
+			benchmark::DoNotOptimize(index);
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * kLookupsCount);
+}
+BENCHMARK(BM_ResourceLookupLinear)->Range(fromRange, toRange);
+
+static void BM_ResourceLookupIndex(benchmark::State& state) {
+	const std::vector<poke::ResourceID> resourceIDs = CreateResourceIDs(state.range(0));
+	const std::vector<poke::ResourceID> lookups = CreateLookups(resourceIDs);
+
+	poke::ResourceIndex resourceIndex;
+	for (size_t i = 0; i < resourceIDs.size(); i++) {
+		resourceIndex.Insert(resourceIDs[i], static_cast<poke::ResourceHandle>(i));
+	}
+
+	for (auto _ : state) {
+		for (const poke::ResourceID lookup : lookups) {
+			benchmark::DoNotOptimize(resourceIndex.Find(lookup));
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * kLookupsCount);
+}
+BENCHMARK(BM_ResourceLookupIndex)->Range(fromRange, toRange);
+
+static void BM_ResourceLookupUnorderedMap(benchmark::State& state) {
+	const std::vector<poke::ResourceID> resourceIDs = CreateResourceIDs(state.range(0));
+	const std::vector<poke::ResourceID> lookups = CreateLookups(resourceIDs);
+
+	std::unordered_map<poke::ResourceID, poke::ResourceHandle> resourceMap;
+	for (size_t i = 0; i < resourceIDs.size(); i++) {
+		resourceMap.emplace(resourceIDs[i], static_cast<poke::ResourceHandle>(i));
+	}
+
+	for (auto _ : state) {
+		for (const poke::ResourceID lookup : lookups) {
+			benchmark::DoNotOptimize(resourceMap.find(lookup)->second);
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * kLookupsCount);
+}
+BENCHMARK(BM_ResourceLookupUnorderedMap)->Range(fromRange, toRange);
+
+//A cached handle skips the lookup, only the access to the resource remains
+static void BM_ResourceLookupCachedHandle(benchmark::State& state) {
+	const std::vector<poke::ResourceID> resourceIDs = CreateResourceIDs(state.range(0));
+	const std::vector<poke::ResourceID> lookups = CreateLookups(resourceIDs);
+
+	poke::ResourceIndex resourceIndex;
+	for (size_t i = 0; i < resourceIDs.size(); i++) {
+		resourceIndex.Insert(resourceIDs[i], static_cast<poke::ResourceHandle>(i));
+	}
+	std::vector<poke::ResourceHandle> handles;
+	for (const poke::ResourceID lookup : lookups) { handles.push_back(resourceIndex.Find(lookup)); }
+
+	for (auto _ : state) {
+		for (const poke::ResourceHandle handle : handles) {
+			benchmark::DoNotOptimize(resourceIDs[handle]);
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * kLookupsCount);
+}
+BENCHMARK(BM_ResourceLookupCachedHandle)->Range(fromRange, toRange);
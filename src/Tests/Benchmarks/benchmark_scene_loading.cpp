@@ -0,0 +1,302 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include <Math/tranform.h>
+#include <GraphicsEngine/Images/image_2d.h>
+#include <GraphicsEngine/Models/model.h>
+#include <PhysicsEngine/collider.h>
+#include <PhysicsEngine/rigidbody.h>
+#include <ResourcesManager/resource_loader.h>
+#include <ResourcesManager/MeshManagers/mesh_obj.h>
+#include <Scenes/binary_scene.h>
+#include <Utility/json_utility.h>
+
+const long fromRange = 1 << 8;
+const long toRange = 1 << 14;
+
+const std::vector<std::string> kGameScenes{ "MainMenuParsed", "TestAllElementScene", "Default" };
+
+const std::vector<std::string> kComponentKeys{
+	"collider", "model", "rigidbody", "light", "particleSystem", "audioSource",
+	"trailRenderer", "segmentRenderer", "spline", "enemy", "destructibleElement", "jiggle"
+};
+
+json CreateScene(const long entitiesCount)
+{
+	json sceneJson;
+	sceneJson["resources"]["meshNames"] = { "Cube", "Sphere", "Ship" };
+
+	for (long i = 0; i < entitiesCount; i++) {
+		json entityJson;
+		const poke::math::Transform transform(
+			poke::math::Vec3(static_cast<float>(i), 0.5f, -static_cast<float>(i)),
+			poke::math::Vec3(0.0f, static_cast<float>(i % 360), 0.0f),
+			poke::math::Vec3(1.0f));
+		entityJson["transform"] = transform.ToJson();
+		entityJson["transform"]["parent"] = i % 4 == 0 ? poke::ecs::kNoParent : static_cast<int>(i - i % 4);
+		entityJson["tag"] = i % 3;
+
+		entityJson["model"] = poke::graphics::Model(1238971298371ull, 9817234987123ull + i % 3).ToJson();
+		if (i % 2 == 0) {
+			poke::physics::Collider collider;
+			collider.isTrigger = false;
+			collider.SetShape(poke::physics::BoxShape(poke::math::Vec3(0.0f), poke::math::Vec3(1.0f)));
+			entityJson["collider"] = collider.ToJson();
+		}
+		if (i % 8 == 0) {
+			poke::physics::Rigidbody rigidbody;
+			rigidbody.type = poke::physics::RigidbodyType::KINEMATIC;
+			entityJson["rigidbody"] = rigidbody.ToJson();
+		}
+		sceneJson["gameObjects"].push_back(entityJson);
+	}
+	return sceneJson;
+}
+
+//Same accesses than CoreEcsManager::SetEntitiesFromJson without the managers
+size_t ReadJsonScene(const json& sceneJson)
+{
+	size_t componentsCount = 0;
+	for (json entityJson : sceneJson["gameObjects"]) {
+		for (const std::string& componentKey : kComponentKeys) {
+			if (poke::CheckJsonExists(entityJson, componentKey) &&
+				poke::CheckJsonParameter(entityJson, componentKey, nlohmann::detail::value_t::object)) {
+				json componentJson = entityJson[componentKey];
+				if (componentKey == "model") {
+					poke::graphics::Model model;
+					model.SetFromJson(componentJson);
+					benchmark::DoNotOptimize(model);
+				} else if (componentKey == "rigidbody") {
+					poke::physics::Rigidbody rigidbody;
+					rigidbody.SetFromJson(componentJson);
+					benchmark::DoNotOptimize(rigidbody);
+				} else if (componentKey == "collider") {
+					poke::physics::Collider collider;
+					collider.SetFromJson(componentJson);
+					benchmark::DoNotOptimize(collider);
+				}
+				benchmark::DoNotOptimize(componentJson);
+				componentsCount++;
+			}
+		}
+		if (poke::CheckJsonExists(entityJson, "transform")) {
+			poke::math::Transform transform;
+			transform.SetFromJson(entityJson["transform"]);
+			const int parent = entityJson["transform"]["parent"];
+			benchmark::DoNotOptimize(transform);
+			benchmark::DoNotOptimize(parent);
+			componentsCount++;
+		}
+	}
+	return componentsCount;
+}
+
+//Same accesses than CoreEcsManager::SetEntitiesFromBinary without the managers
+size_t ReadBinaryScene(const poke::scene::BinarySceneView& sceneView)
+{
+	size_t componentsCount = 0;
+	for (size_t i = 0; i < sceneView.GetComponentBlockCount(); i++) {
+		const poke::scene::BinaryComponentBlock& block = sceneView.GetComponentBlock(i);
+		if (block.componentType == poke::ecs::ComponentType::EMPTY) { continue; }
+
+		for (uint32_t j = 0; j < block.entityCount; j++) {
+			if (!block.IsTyped()) {
+				json componentJson = block.GetComponentJson(j);
+				benchmark::DoNotOptimize(componentJson);
+			} else if (block.componentType == poke::ecs::ComponentType::MODEL) {
+				const auto& record = block.GetRecord<poke::scene::binary_scene::ModelRecord>(j);
+				poke::graphics::Model model(record.materialID, record.meshID);
+				benchmark::DoNotOptimize(model);
+			} else if (block.componentType == poke::ecs::ComponentType::RIGIDBODY) {
+				const auto& record = block.GetRecord<poke::scene::binary_scene::RigidbodyRecord>(j);
+				poke::physics::Rigidbody rigidbody;
+				rigidbody.linearVelocity = record.linearVelocity;
+				rigidbody.angularVelocity = record.angularVelocity;
+				rigidbody.linearDrag = record.linearDrag;
+				rigidbody.angularDrag = record.angularDrag;
+				rigidbody.type = static_cast<poke::physics::RigidbodyType>(record.type);
+				benchmark::DoNotOptimize(rigidbody);
+			} else if (block.componentType == poke::ecs::ComponentType::COLLIDER) {
+				const auto& record = block.GetRecord<poke::scene::binary_scene::ColliderRecord>(j);
+				poke::physics::Collider collider;
+				collider.isTrigger = record.isTrigger != 0;
+				//The generated scenes only have box colliders
+				collider.SetShape(poke::physics::BoxShape(record.positionOffset, record.extent));
+				benchmark::DoNotOptimize(collider);
+			}
+			componentsCount++;
+		}
+	}
+
+	for (uint32_t i = 0; i < sceneView.GetEntityCount(); i++) {
+		if (sceneView.GetFlags()[i] & poke::scene::binary_scene::EntityFlag::HAS_TRANSFORM) {
+			poke::math::Transform transform(
+				sceneView.GetPositions()[i],
+				sceneView.GetRotations()[i],
+				sceneView.GetScales()[i]);
+			const int parent = sceneView.GetParents()[i];
+			benchmark::DoNotOptimize(transform);
+			benchmark::DoNotOptimize(parent);
+			componentsCount++;
+		}
+	}
+	return componentsCount;
+}
+
+static void BM_SceneLoadJson(benchmark::State& state) {
+	const std::string sceneText = CreateScene(state.range(0)).dump();
+
+	for (auto _ : state) {
+		const json sceneJson = json::parse(sceneText);
+		benchmark::DoNotOptimize(ReadJsonScene(sceneJson));
+	}
+	state.counters["Bytes"] = static_cast<double>(sceneText.size());
+}
+BENCHMARK(BM_SceneLoadJson)->Range(fromRange, toRange)->Unit(benchmark::kMicrosecond);
+
+static void BM_SceneLoadBinary(benchmark::State& state) {
+	const std::vector<uint8_t> bytes = poke::scene::CompileBinaryScene(CreateScene(state.range(0)));
+
+	for (auto _ : state) {
+		poke::scene::BinarySceneView sceneView;
+		sceneView.SetData(bytes.data(), bytes.size());
+		benchmark::DoNotOptimize(ReadBinaryScene(sceneView));
+	}
+	state.counters["Bytes"] = static_cast<double>(bytes.size());
+}
+BENCHMARK(BM_SceneLoadBinary)->Range(fromRange, toRange)->Unit(benchmark::kMicrosecond);
+
+//Game scenes, from the disk
+static void BM_GameSceneLoadJson(benchmark::State& state) {
+	const std::string& sceneName = kGameScenes[state.range(0)];
+	if (!poke::PokFileSystem::CheckFileExists(
+		poke::PokFileSystem::GetFullPath(sceneName, poke::FileType::SCENE, poke::FolderType::ROM))) {
+		state.SkipWithError(("Missing scene " + sceneName).c_str());
+		return;
+	}
+
+	for (auto _ : state) {
+		const json sceneJson = poke::PokFileSystem::ReadJsonFile(sceneName, poke::FileType::SCENE, poke::FolderType::ROM);
+		benchmark::DoNotOptimize(ReadJsonScene(sceneJson));
+	}
+	state.SetLabel(sceneName);
+}
+BENCHMARK(BM_GameSceneLoadJson)->DenseRange(0, static_cast<int>(kGameScenes.size()) - 1)->Unit(benchmark::kMicrosecond);
+
+static void BM_GameSceneLoadBinary(benchmark::State& state) {
+	const std::string& sceneName = kGameScenes[state.range(0)];
+	const json sceneJson = poke::PokFileSystem::ReadJsonFile(sceneName, poke::FileType::SCENE, poke::FolderType::ROM);
+	if (sceneJson.is_null() ||
+		!poke::PokFileSystem::WriteFile(sceneName, sceneJson, poke::FileType::SCENE, poke::FolderType::SAVE) ||
+		!poke::scene::ExportBinaryScene(sceneJson, sceneName, poke::FolderType::SAVE)) {
+		state.SkipWithError(("Missing scene " + sceneName).c_str());
+		return;
+	}
+
+	for (auto _ : state) {
+		poke::scene::BinarySceneFile binaryScene;
+		binaryScene.Open(sceneName, poke::FolderType::SAVE);
+		benchmark::DoNotOptimize(ReadBinaryScene(binaryScene.GetView()));
+	}
+	state.SetLabel(sceneName);
+
+	poke::PokFileSystem::DeleteFile(sceneName, poke::FileType::BINARY_SCENE, poke::FolderType::SAVE);
+	poke::PokFileSystem::DeleteFile(sceneName, poke::FileType::SCENE, poke::FolderType::SAVE);
+}
+BENCHMARK(BM_GameSceneLoadBinary)->DenseRange(0, static_cast<int>(kGameScenes.size()) - 1)->Unit(benchmark::kMicrosecond);
+
+//Resources of the game scenes, only the work done outside of the graphics device
+struct SceneResources {
+	std::vector<std::string> meshNames;
+	std::vector<std::string> texturePaths;
+};
+
+bool GetSceneResources(const std::string& sceneName, SceneResources& sceneResources)
+{
+	const json sceneJson = poke::PokFileSystem::ReadJsonFile(sceneName, poke::FileType::SCENE, poke::FolderType::ROM);
+	if (sceneJson.is_null() || !poke::CheckJsonExists(sceneJson, "resources")) { return false; }
+
+	const json& resourcesJson = sceneJson["resources"];
+	if (poke::CheckJsonExists(resourcesJson, "meshNames")) {
+		for (const auto& meshJson : resourcesJson["meshNames"]) {
+			sceneResources.meshNames.push_back(meshJson.get<std::string>());
+		}
+	}
+	if (poke::CheckJsonExists(resourcesJson, "materialNames")) {
+		for (const auto& materialNameJson : resourcesJson["materialNames"]) {
+			const json materialJson = poke::LoadJson(materialNameJson.get<std::string>(), poke::FileType::MATERIAL);
+
+			for (const char* textureKey : { "textureBaseColor", "textureNormal", "textureRMA" }) {
+				if (poke::CheckJsonExists(materialJson, textureKey)) {
+					sceneResources.texturePaths.push_back(materialJson[textureKey].get<std::string>());
+				}
+			}
+		}
+	}
+	return true;
+}
+
+//Same work than the managers without a ResourceLoader
+static void BM_GameSceneResourcesSequential(benchmark::State& state) {
+	const std::string& sceneName = kGameScenes[state.range(0)];
+	SceneResources sceneResources;
+	if (!GetSceneResources(sceneName, sceneResources)) {
+		state.SkipWithError(("Missing scene " + sceneName).c_str());
+		return;
+	}
+
+	for (auto _ : state) {
+		for (const std::string& meshName : sceneResources.meshNames) {
+			benchmark::DoNotOptimize(poke::MeshObj::LoadData(meshName));
+		}
+		for (const std::string& texturePath : sceneResources.texturePaths) {
+			benchmark::DoNotOptimize(poke::graphics::Image2d::LoadData(texturePath));
+		}
+	}
+	state.SetLabel(sceneName);
+}
+BENCHMARK(BM_GameSceneResourcesSequential)->DenseRange(0, static_cast<int>(kGameScenes.size()) - 1)->Unit(benchmark::kMillisecond);
+
+//Same work than the managers with a ResourceLoader, the main thread only waits for the data
+static void BM_GameSceneResourcesAsync(benchmark::State& state) {
+	const std::string& sceneName = kGameScenes[state.range(0)];
+	SceneResources sceneResources;
+	if (!GetSceneResources(sceneName, sceneResources)) {
+		state.SkipWithError(("Missing scene " + sceneName).c_str());
+		return;
+	}
+
+	poke::ResourceLoader resourceLoader(static_cast<size_t>(state.range(1)));
+
+	for (auto _ : state) {
+		std::vector<poke::Future<poke::MeshObjData>> meshes;
+		std::vector<poke::Future<poke::graphics::LoadedImageInfos>> textures;
+
+		for (const std::string& meshName : sceneResources.meshNames) {
+			meshes.push_back(resourceLoader.LoadAsync<poke::MeshObjData>([&meshName]() {
+				return poke::MeshObj::LoadData(meshName);
+			}));
+		}
+		for (const std::string& texturePath : sceneResources.texturePaths) {
+			textures.push_back(resourceLoader.LoadAsync<poke::graphics::LoadedImageInfos>([&texturePath]() {
+				return poke::graphics::Image2d::LoadData(texturePath);
+			}));
+		}
+
+		for (auto& mesh : meshes) { benchmark::DoNotOptimize(mesh.Get()); }
+		for (auto& texture : textures) { benchmark::DoNotOptimize(texture.Get()); }
+	}
+	state.SetLabel(sceneName);
+}
+
+//Every game scene with 1, 2, 4 and 8 workers
+static void GameSceneWorkerArguments(benchmark::internal::Benchmark* benchmark) {
+	for (int sceneIndex = 0; sceneIndex < static_cast<int>(kGameScenes.size()); sceneIndex++) {
+		for (int workerCount = 1; workerCount <= 8; workerCount *= 2) {
+			benchmark->Args({ sceneIndex, workerCount });
+		}
+	}
+}
+BENCHMARK(BM_GameSceneResourcesAsync)->Apply(GameSceneWorkerArguments)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,106 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <vector>
+
+#include <Math/spline_path.h>
+
+const long fromRange = 1 << 6;
+const long toRange = 1 << 14;
+
+const int kSplinePointsCount = 32;
+
+std::vector<poke::math::Vec3> CreateSplinePoints()
+{
+	std::vector<poke::math::Vec3> points;
+	for (int i = 0; i < kSplinePointsCount; i++) {
+		points.emplace_back(std::cos(i * 0.7f) * 20.0f, std::sin(i * 0.3f) * 5.0f, i * 10.0f);
+	}
+	return points;
+}
+
+//Previous CubicHermiteSpline::Lerp, the knots were computed with pow at each evaluation
+double GetPortionOfDistance(const double t, const poke::math::Vec3 p0, const poke::math::Vec3 p1)
+{
+	const auto a = pow(p1.x - p0.x, 2.0f) + pow(p1.y - p0.y, 2.0f) + pow(p1.z - p0.z, 2.0f);
+	const auto b = pow(a, 0.5f);
+	const auto c = pow(b, 1);
+	return c + t;
+}
+
+poke::math::Vec3 LerpKnots(const std::vector<poke::math::Vec3>& points, const int pointIndex, const double percent)
+{
+	const auto p0 = points[pointIndex - 1];
+	const auto p1 = points[pointIndex];
+	const auto p2 = points[pointIndex + 1];
+	const auto p3 = points[pointIndex + 2];
+
+	const auto t0 = 0.0;
+	const auto t1 = GetPortionOfDistance(t0, p0, p1);
+	const auto t2 = GetPortionOfDistance(t1, p1, p2);
+	const auto t3 = GetPortionOfDistance(t2, p0, p3);
+
+	const auto t = ((t2 - t1) * percent) + t1;
+	const auto a1 = p0 * (t1 - t) / (t1 - t0) + p1 * (t - t0) / (t1 - t0);
+	const auto a2 = p1 * (t2 - t) / (t2 - t1) + p2 * (t - t1) / (t2 - t1);
+	const auto a3 = p2 * (t3 - t) / (t3 - t2) + p3 * (t - t2) / (t3 - t2);
+
+	const auto b1 = a1 * (t2 - t) / (t2 - t0) + a2 * (t - t0) / (t2 - t0);
+	const auto b2 = a2 * (t3 - t) / (t3 - t1) + a3 * (t - t1) / (t3 - t1);
+
+	return b1 * (t2 - t) / (t2 - t1) + b2 * (t - t1) / (t2 - t1);
+}
+
+//One evaluation per follower, spread on the whole spline
+static void BM_SplineLerpKnots(benchmark::State& state) {
+	const std::vector<poke::math::Vec3> points = CreateSplinePoints();
+	std::vector<poke::math::Vec3> positions(state.range(0));
+	for (auto _ : state) {
+		for (auto i = 0; i < state.range(0); i++) {
+			const float percent = static_cast<float>(i) / state.range(0) * (kSplinePointsCount - 3);
+			positions[i] = LerpKnots(points, 1 + static_cast<int>(percent), percent - std::floor(percent));
+		}
+		benchmark::DoNotOptimize(positions.data());
+	}
+}
+BENCHMARK(BM_SplineLerpKnots)->Range(fromRange, toRange);
+
+static void BM_SplineEvaluate(benchmark::State& state) {
+	const auto splinePath = poke::math::SplineRegistry::Get().Register(CreateSplinePoints());
+	const poke::math::SplinePath& path = *splinePath;
+	std::vector<poke::math::Vec3> positions(state.range(0));
+	for (auto _ : state) {
+		for (auto i = 0; i < state.range(0); i++) {
+			const float percent = static_cast<float>(i) / state.range(0) * path.GetSegmentCount();
+			positions[i] = path.Evaluate(static_cast<int>(percent), percent - std::floor(percent));
+		}
+		benchmark::DoNotOptimize(positions.data());
+	}
+}
+BENCHMARK(BM_SplineEvaluate)->Range(fromRange, toRange);
+
+//Constant speed, the distances are converted with the arc length table
+static void BM_SplineEvaluateDistances(benchmark::State& state) {
+	const auto splinePath = poke::math::SplineRegistry::Get().Register(CreateSplinePoints());
+	const poke::math::SplinePath& path = *splinePath;
+	std::vector<float> distances(state.range(0));
+	for (auto i = 0; i < state.range(0); i++) {
+		distances[i] = static_cast<float>(i) / state.range(0) * path.GetLength();
+	}
+
+	std::vector<poke::math::Vec3> positions(state.range(0));
+	for (auto _ : state) {
+		path.Evaluate(distances.data(), positions.data(), distances.size());
+		benchmark::DoNotOptimize(positions.data());
+	}
+}
+BENCHMARK(BM_SplineEvaluateDistances)->Range(fromRange, toRange);
+
+static void BM_SplineBake(benchmark::State& state) {
+	const std::vector<poke::math::Vec3> points = CreateSplinePoints();
+	for (auto _ : state) {
+		const poke::math::SplinePath path(0, points);
+		benchmark::DoNotOptimize(path.GetLength());
+	}
+}
+BENCHMARK(BM_SplineBake);
@@ -0,0 +1,112 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include <GraphicsEngine/Images/image.h>
+#include <GraphicsEngine/Images/cooked_texture.h>
+#include <GraphicsEngine/Images/texture_compressor.h>
+
+const long fromRange = 1 << 6;
+const long toRange = 1 << 11;
+
+//Smooth colors with some details, opaque
+std::vector<uint8_t> CreateTexturePixels(const long size)
+{
+	std::vector<uint8_t> pixels(size * size * 4);
+	for (long y = 0; y < size; y++) {
+		for (long x = 0; x < size; x++) {
+			uint8_t* pixel = pixels.data() + (y * size + x) * 4;
+			pixel[0] = static_cast<uint8_t>(x * 255 / (size - 1));
+			pixel[1] = static_cast<uint8_t>(y * 255 / (size - 1));
+			pixel[2] = static_cast<uint8_t>(128 + 96 * std::sin(x * 0.05f) * std::cos(y * 0.07f));
+			pixel[3] = 255;
+		}
+	}
+	return pixels;
+}
+
+//Uncompressed .tga, the cheapest source format stb_image can decode
+std::vector<uint8_t> CreateTgaFile(const std::vector<uint8_t>& pixels, const long size)
+{
+	std::vector<uint8_t> file(18 + pixels.size(), 0);
+	file[2] = 2; // True color
+	file[12] = static_cast<uint8_t>(size & 0xFF);
+	file[13] = static_cast<uint8_t>(size >> 8);
+	file[14] = static_cast<uint8_t>(size & 0xFF);
+	file[15] = static_cast<uint8_t>(size >> 8);
+	file[16] = 32;
+	file[17] = 0x28; // Top left origin, 8 bits of alpha
+
+	for (size_t i = 0; i < pixels.size(); i += 4) {
+		file[18 + i] = pixels[i + 2];
+		file[18 + i + 1] = pixels[i + 1];
+		file[18 + i + 2] = pixels[i];
+		file[18 + i + 3] = pixels[i + 3];
+	}
+	return file;
+}
+
+static void BM_TextureCook(benchmark::State& state) {
+	const long size = state.range(0);
+	const std::vector<uint8_t> pixels = CreateTexturePixels(size);
+
+	std::vector<uint8_t> bytes;
+	for (auto _ : state) {
+		bytes = poke::CookTexture(pixels.data(), size, size, 0, 0);
+		benchmark::DoNotOptimize(bytes.data());
+	}
+
+	poke::CookedTextureView cookedTexture;
+	cookedTexture.SetData(bytes.data(), bytes.size());
+	const std::vector<uint8_t> decompressedPixels = poke::texture_compressor::DecompressLevel(
+		cookedTexture.GetMipData(0),
+		size,
+		size,
+		cookedTexture.GetFormat());
+	state.counters["PSNR"] = poke::texture_compressor::ComputePsnr(pixels.data(), decompressedPixels.data(), pixels.size());
+	state.counters["Bytes_Cooked"] = static_cast<double>(bytes.size());
+}
+BENCHMARK(BM_TextureCook)->Range(fromRange, toRange)->Unit(benchmark::kMillisecond);
+
+//Work done before the upload without cooking, the mipmaps are then blitted by the device
+static void BM_TextureLoadSource(benchmark::State& state) {
+	const long size = state.range(0);
+	const std::vector<uint8_t> file = CreateTgaFile(CreateTexturePixels(size), size);
+
+	size_t uploadSize = 0;
+	for (auto _ : state) {
+		const poke::graphics::LoadedImageInfos loadedImage =
+			poke::graphics::Image::LoadPixelsFromMemory(file.data(), file.size());
+
+		std::vector<char> stagingBuffer(loadedImage.pixels.size());
+		std::memcpy(stagingBuffer.data(), loadedImage.pixels.data(), stagingBuffer.size());
+		benchmark::DoNotOptimize(stagingBuffer.data());
+		uploadSize = stagingBuffer.size();
+	}
+	//Every level of a RGBA8 chain stays in the device memory
+	state.counters["Bytes_Upload"] = static_cast<double>(uploadSize);
+	state.counters["Bytes_Device"] = static_cast<double>(uploadSize * 4 / 3);
+}
+BENCHMARK(BM_TextureLoadSource)->Range(fromRange, toRange)->Unit(benchmark::kMicrosecond);
+
+static void BM_TextureLoadCooked(benchmark::State& state) {
+	const long size = state.range(0);
+	const std::vector<uint8_t> pixels = CreateTexturePixels(size);
+	const std::vector<uint8_t> bytes = poke::CookTexture(pixels.data(), size, size, 0, 0);
+
+	size_t uploadSize = 0;
+	for (auto _ : state) {
+		poke::CookedTextureView cookedTexture;
+		cookedTexture.SetData(bytes.data(), bytes.size());
+
+		uploadSize = cookedTexture.GetMipsSize(cookedTexture.GetMipCount());
+		std::vector<char> stagingBuffer(uploadSize);
+		std::memcpy(stagingBuffer.data(), cookedTexture.GetMipData(0), uploadSize);
+		benchmark::DoNotOptimize(stagingBuffer.data());
+	}
+	state.counters["Bytes_Upload"] = static_cast<double>(uploadSize);
+	state.counters["Bytes_Device"] = static_cast<double>(uploadSize);
+}
+BENCHMARK(BM_TextureLoadCooked)->Range(fromRange, toRange)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,176 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include <Ecs/Components/trail_renderer.h>
+
+const int kTrailsCount = 500;
+const float kDeltaTime = 1.0f / 60.0f;
+const int kWarmUpFrames = 120;
+
+const poke::math::Vec3 kCameraFront(0, 0, 1);
+
+//Each trail turns on its own circle, fast enough to add vertices every frame
+poke::math::Vec3 GetTrailPosition(const int trailIndex, const int frame)
+{
+	const float angle = frame * kDeltaTime * 3.0f + trailIndex;
+	return poke::math::Vec3(std::cos(angle) * 5.0f + trailIndex, std::sin(angle) * 5.0f, 0);
+}
+
+//Previous TrailRenderer, the oldest vertices were erased from the front and the whole mesh was rebuilt
+struct VectorTrail {
+	bool Update(const poke::math::Vec3 worldPos)
+	{
+		if (centerPositions.empty()) {
+			centerPositions.push_back(worldPos);
+			return false;
+		}
+
+		for (auto& leftVertex : leftVertices) { leftVertex.timeAlive += kDeltaTime; }
+		for (auto& rightVertex : rightVertices) { rightVertex.timeAlive += kDeltaTime; }
+
+		bool hasChanged = false;
+		if (poke::math::Vec3::GetDistanceManhattan(centerPositions.back(), worldPos) > vertexDistanceMin * vertexDistanceMin) {
+			const poke::math::Vec3 dirToCurrentPos = (worldPos - centerPositions.back()).Normalize();
+			const poke::math::Vec3 cross = poke::math::Vec3::Cross(kCameraFront, dirToCurrentPos);
+			const poke::math::Vec3 leftPos = worldPos + cross * -widthStart * 0.5f;
+			const poke::math::Vec3 rightPos = worldPos + cross * widthStart * 0.5f;
+
+			leftVertices.emplace_back(leftPos, worldPos, (leftPos - worldPos).Normalize());
+			rightVertices.emplace_back(rightPos, worldPos, (rightPos - worldPos).Normalize());
+			centerPositions.push_back(worldPos);
+			hasChanged = true;
+		}
+
+		while (!leftVertices.empty() && leftVertices.front().timeAlive > lifetime) {
+			leftVertices.erase(leftVertices.begin());
+			rightVertices.erase(rightVertices.begin());
+			centerPositions.erase(centerPositions.begin());
+			hasChanged = true;
+		}
+
+		const float widthDelta = widthStart - widthEnd;
+		const float timeDelta = lifetime - changeTime;
+		for (size_t i = 0; i < leftVertices.size(); i++) {
+			if (leftVertices[i].timeAlive > changeTime) {
+				const float width = widthStart - (widthDelta * ((leftVertices[i].timeAlive - changeTime) / (timeDelta + 0.00001f)));
+				leftVertices[i].AdjustWidth(width * 0.5f);
+				rightVertices[i].AdjustWidth(width * 0.5f);
+			}
+		}
+		return true;
+	}
+
+	void GenerateMesh(std::vector<poke::graphics::VertexMesh>& vertices, std::vector<uint32_t>& indexes) const
+	{
+		vertices.clear();
+		indexes.clear();
+		if (leftVertices.size() < 2) { return; }
+
+		vertices.resize(leftVertices.size() * 2);
+		indexes.resize((leftVertices.size() - 1) * 6);
+
+		const float timeDelta = leftVertices.back().timeAlive - leftVertices.front().timeAlive + 0.0001f;
+		for (size_t i = 0, j = 0; i < leftVertices.size(); i++, j += 2) {
+			const float uvValue = leftVertices[i].timeAlive / timeDelta;
+			vertices[j] = poke::graphics::VertexMesh(leftVertices[i].position, poke::math::Vec2(uvValue, 0), { 0, 0, 0 });
+			vertices[j + 1] = poke::graphics::VertexMesh(rightVertices[i].position, poke::math::Vec2(uvValue, 1), { 0, 0, 0 });
+
+			const int vertexIndex = static_cast<int>(i * 2);
+			if (i > 0) {
+				const size_t triIndex = (i - 1) * 6;
+				indexes[triIndex] = vertexIndex - 2;
+				indexes[triIndex + 1] = vertexIndex - 1;
+				indexes[triIndex + 2] = vertexIndex + 1;
+				indexes[triIndex + 3] = vertexIndex - 2;
+				indexes[triIndex + 4] = vertexIndex + 1;
+				indexes[triIndex + 5] = vertexIndex;
+			}
+		}
+	}
+
+	float lifetime = 1.0f;
+	float changeTime = 0.5f;
+	float widthStart = 1.0f;
+	float widthEnd = 0.2f;
+	float vertexDistanceMin = 0.1f;
+
+	std::vector<poke::math::Vec3> centerPositions;
+	std::vector<poke::ecs::TrailRendererVertex> leftVertices;
+	std::vector<poke::ecs::TrailRendererVertex> rightVertices;
+};
+
+//One frame of every trail, the mesh was then uploaded through new buffers and a staging buffer
+static void BM_TrailsRebuild(benchmark::State& state) {
+	std::vector<VectorTrail> trails(state.range(0));
+	std::vector<poke::graphics::VertexMesh> vertices;
+	std::vector<uint32_t> indexes;
+	std::vector<char> stagingBuffer;
+
+	int frame = 0;
+	for (; frame < kWarmUpFrames; frame++) {
+		for (int i = 0; i < state.range(0); i++) { trails[i].Update(GetTrailPosition(i, frame)); }
+	}
+
+	size_t uploadSize = 0;
+	for (auto _ : state) {
+		uploadSize = 0;
+		for (int i = 0; i < state.range(0); i++) {
+			if (!trails[i].Update(GetTrailPosition(i, frame))) { continue; }
+			trails[i].GenerateMesh(vertices, indexes);
+
+			stagingBuffer.resize(vertices.size() * sizeof(poke::graphics::VertexMesh) + indexes.size() * sizeof(uint32_t));
+			std::memcpy(stagingBuffer.data(), vertices.data(), vertices.size() * sizeof(poke::graphics::VertexMesh));
+			std::memcpy(
+				stagingBuffer.data() + vertices.size() * sizeof(poke::graphics::VertexMesh),
+				indexes.data(),
+				indexes.size() * sizeof(uint32_t));
+			benchmark::DoNotOptimize(stagingBuffer.data());
+			uploadSize += stagingBuffer.size();
+		}
+		frame++;
+	}
+	state.counters["Bytes_Upload"] = static_cast<double>(uploadSize);
+}
+BENCHMARK(BM_TrailsRebuild)->Arg(kTrailsCount)->Unit(benchmark::kMicrosecond);
+
+//Same frame with the rings, only the range alive is written in the mapped vertex buffer
+static void BM_TrailsRing(benchmark::State& state) {
+	std::vector<poke::ecs::TrailRenderer> trails(state.range(0));
+	for (auto& trail : trails) { trail.widthEnd = 0.2f; }
+	std::vector<poke::graphics::VertexMesh> vertices(poke::ecs::TrailRenderer::kMaxVertexPairs * 2);
+	std::vector<poke::graphics::VertexMesh> vertexBuffer(vertices.size());
+
+	int frame = 0;
+	for (; frame < kWarmUpFrames; frame++) {
+		for (int i = 0; i < state.range(0); i++) { trails[i].Update(GetTrailPosition(i, frame), kDeltaTime, kCameraFront); }
+	}
+
+	size_t uploadSize = 0;
+	for (auto _ : state) {
+		uploadSize = 0;
+		for (int i = 0; i < state.range(0); i++) {
+			if (!trails[i].Update(GetTrailPosition(i, frame), kDeltaTime, kCameraFront)) { continue; }
+			const poke::ecs::TrailMeshRange meshRange = trails[i].WriteMesh(vertices.data());
+
+			//Same split than CoreMeshManager::UpdateDynamicMesh when the range wraps
+			const uint32_t endCount = std::min(meshRange.vertexCount, static_cast<uint32_t>(vertices.size()) - meshRange.firstVertex);
+			std::memcpy(
+				vertexBuffer.data() + meshRange.firstVertex,
+				vertices.data() + meshRange.firstVertex,
+				endCount * sizeof(poke::graphics::VertexMesh));
+			std::memcpy(
+				vertexBuffer.data(),
+				vertices.data(),
+				(meshRange.vertexCount - endCount) * sizeof(poke::graphics::VertexMesh));
+			benchmark::DoNotOptimize(vertexBuffer.data());
+			uploadSize += meshRange.vertexCount * sizeof(poke::graphics::VertexMesh);
+		}
+		frame++;
+	}
+	state.counters["Bytes_Upload"] = static_cast<double>(uploadSize);
+}
+BENCHMARK(BM_TrailsRing)->Arg(kTrailsCount)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,80 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include <Math/tranform.h>
+
+const int kTransformsCount = 4096;
+const int kHierarchyDepth = 4;
+
+//Chains of kHierarchyDepth transforms, the first of each chain has no parent
+struct Hierarchy {
+	explicit Hierarchy(const int count)
+	{
+		for (int i = 0; i < count; i++) {
+			parents.push_back(i % kHierarchyDepth == 0 ? -1 : i - 1);
+			eulerAngles.emplace_back(i * 0.01f, i * 0.02f - 1.0f, 0.5f - i * 0.015f);
+			transforms.emplace_back(poke::math::Vec3(i * 0.1f, 1, -2), eulerAngles.back(), poke::math::Vec3(1.5f));
+		}
+	}
+
+	std::vector<int> parents;
+	std::vector<poke::math::Vec3> eulerAngles;
+	std::vector<poke::math::Transform> transforms;
+};
+
+//Previous composition, the rotations were stored as euler angles and summed down the hierarchy
+static void BM_TransformsEulerComposition(benchmark::State& state) {
+	const Hierarchy hierarchy(state.range(0));
+	std::vector<poke::math::Matrix4> worldMatrices(hierarchy.transforms.size());
+	std::vector<poke::math::Vec3> worldRotations(hierarchy.transforms.size());
+
+	for (auto _ : state) {
+		for (size_t i = 0; i < hierarchy.transforms.size(); i++) {
+			const poke::math::Transform& transform = hierarchy.transforms[i];
+			const poke::math::Matrix4 localMatrix = poke::math::Matrix4::GetWorldMatrix(
+				transform.GetLocalPosition(),
+				hierarchy.eulerAngles[i],
+				transform.GetLocalScale());
+
+			const int parent = hierarchy.parents[i];
+			if (parent == -1) {
+				worldMatrices[i] = localMatrix;
+				worldRotations[i] = hierarchy.eulerAngles[i];
+			} else {
+				worldMatrices[i] = worldMatrices[parent] * localMatrix;
+				worldRotations[i] = hierarchy.eulerAngles[i] + worldRotations[parent];
+			}
+		}
+		benchmark::DoNotOptimize(worldMatrices.data());
+		benchmark::DoNotOptimize(worldRotations.data());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TransformsEulerComposition)->Arg(kTransformsCount)->Unit(benchmark::kMicrosecond);
+
+static void BM_TransformsQuaternionComposition(benchmark::State& state) {
+	const Hierarchy hierarchy(state.range(0));
+	std::vector<poke::math::Matrix4> worldMatrices(hierarchy.transforms.size());
+	std::vector<poke::math::Quaternion> worldOrientations(hierarchy.transforms.size());
+
+	for (auto _ : state) {
+		for (size_t i = 0; i < hierarchy.transforms.size(); i++) {
+			const poke::math::Transform& transform = hierarchy.transforms[i];
+			const poke::math::Matrix4 localMatrix = transform.GetLocalMatrix();
+
+			const int parent = hierarchy.parents[i];
+			if (parent == -1) {
+				worldMatrices[i] = localMatrix;
+				worldOrientations[i] = transform.GetLocalOrientation();
+			} else {
+				worldMatrices[i] = worldMatrices[parent] * localMatrix;
+				worldOrientations[i] = worldOrientations[parent] * transform.GetLocalOrientation();
+			}
+		}
+		benchmark::DoNotOptimize(worldMatrices.data());
+		benchmark::DoNotOptimize(worldOrientations.data());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TransformsQuaternionComposition)->Arg(kTransformsCount)->Unit(benchmark::kMicrosecond);
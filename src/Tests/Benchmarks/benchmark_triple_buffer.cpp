@@ -0,0 +1,54 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include <Memory/triple_buffer.h>
+#include <Math/matrix.h>
+
+const long fromRange = 1 << 6;
+const long toRange = 1 << 14;
+
+struct FrameData {
+	poke::math::Matrix4 transform;
+	int materialID;
+	int meshID;
+};
+
+//Previous hand-off: the drawing vector is copied into the rendering one at the end of each frame
+static void BM_FrameDataCopy(benchmark::State& state) {
+	std::vector<FrameData> drawing;
+	std::vector<FrameData> rendering;
+
+	for (auto _ : state) {
+		drawing.clear();
+		for (long i = 0; i < state.range(0); i++) {
+			drawing.push_back(FrameData{ poke::math::Matrix4::Identity(), static_cast<int>(i), static_cast<int>(i) });
+		}
+
+		rendering.clear();
+		rendering = drawing;
+		benchmark::DoNotOptimize(rendering.data());
+	}
+	state.counters["BytesCopied"] = benchmark::Counter(
+		static_cast<double>(state.range(0) * sizeof(FrameData)),
+		benchmark::Counter::kDefaults);
+}
+BENCHMARK(BM_FrameDataCopy)->Range(fromRange, toRange);
+
+static void BM_FrameDataTripleBuffer(benchmark::State& state) {
+	poke::memory::TripleBuffer<std::vector<FrameData>> frameData;
+
+	for (auto _ : state) {
+		auto& drawing = frameData.GetWriteBuffer();
+		drawing.clear();
+		for (long i = 0; i < state.range(0); i++) {
+			drawing.push_back(FrameData{ poke::math::Matrix4::Identity(), static_cast<int>(i), static_cast<int>(i) });
+		}
+
+		frameData.Publish();
+		frameData.Fetch();
+		benchmark::DoNotOptimize(frameData.GetReadBuffer().data());
+	}
+	state.counters["BytesCopied"] = 0;
+}
+BENCHMARK(BM_FrameDataTripleBuffer)->Range(fromRange, toRange);
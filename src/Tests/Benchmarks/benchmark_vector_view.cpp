@@ -2,6 +2,8 @@
 
 #include <random>
 
+#include <Ecs/ComponentManagers/components_view.h>
+#include <Ecs/Components/spline_follower.h>
 #include <Math/tranform.h>
 #include <Memory/vector_view.h>
 
@@ -92,4 +94,58 @@ static void BM_VV_GetSetComponent(benchmark::State& state) {
 			vectorView[i].SetLocalPosition({ 10, 10, 10 });
 	}
 }
-BENCHMARK(BM_VV_GetSetComponent)->Range(fromRange, toRange);
\ No newline at end of file
+BENCHMARK(BM_VV_GetSetComponent)->Range(fromRange, toRange);
+
+//Same update than the SplineFollowerSystem, the spline points are copied twice by GetComponent and SetComponent
+const long kSplinePointsCount = 16;
+
+std::vector<poke::ecs::SplineFollower> CreateSplineFollowers(const size_t size)
+{
+	std::vector<poke::math::Vec3> points;
+	for (long i = 0; i < kSplinePointsCount; i++) {
+		points.emplace_back(static_cast<float>(i), 0.0f, static_cast<float>(i % 2));
+	}
+	return std::vector<poke::ecs::SplineFollower>(size, poke::ecs::SplineFollower(points));
+}
+
+static void BM_CopySplineFollower(benchmark::State& state) {
+	std::vector<poke::ecs::SplineFollower> splineFollowers = CreateSplineFollowers(state.range(0));
+	for (auto _ : state) {
+		for (auto i = 0; i < state.range(0); i++) {
+			poke::ecs::SplineFollower splineFollower = splineFollowers[i];
+			splineFollower.segmentPercentage += splineFollower.speed;
+			splineFollowers[i] = splineFollower;
+		}
+		benchmark::ClobberMemory();
+	}
+}
+BENCHMARK(BM_CopySplineFollower)->Range(fromRange, toRange);
+
+static void BM_CV_SplineFollower(benchmark::State& state) {
+	std::vector<poke::ecs::SplineFollower> splineFollowers = CreateSplineFollowers(state.range(0));
+	poke::ecs::ComponentsView<poke::ecs::SplineFollower> componentsView(splineFollowers);
+	for (auto _ : state) {
+		for (auto i = 0; i < state.range(0); i++) {
+			poke::ecs::SplineFollower& splineFollower = componentsView[i];
+			splineFollower.segmentPercentage += splineFollower.speed;
+		}
+		benchmark::ClobberMemory();
+	}
+}
+BENCHMARK(BM_CV_SplineFollower)->Range(fromRange, toRange);
+
+//Writes flagged for the observers, each entity is flagged once per frame
+static void BM_CV_UpdateSplineFollower(benchmark::State& state) {
+	std::vector<poke::ecs::SplineFollower> splineFollowers = CreateSplineFollowers(state.range(0));
+	poke::ecs::DirtyEntities dirtyEntities;
+	poke::ecs::ComponentsView<poke::ecs::SplineFollower> componentsView(splineFollowers, &dirtyEntities);
+	for (auto _ : state) {
+		for (auto i = 0; i < state.range(0); i++) {
+			poke::ecs::SplineFollower& splineFollower = componentsView.Update(i);
+			splineFollower.segmentPercentage += splineFollower.speed;
+		}
+		dirtyEntities.Clear();
+		benchmark::ClobberMemory();
+	}
+}
+BENCHMARK(BM_CV_UpdateSplineFollower)->Range(fromRange, toRange);
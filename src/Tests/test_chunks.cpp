@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 
+#include <random>
+
+#include <Chunks/chunks_grid.h>
 #include <CoreEngine/engine.h>
 #include <Editor/editor.h>
 #include <GraphicsEngine/Renderers/renderer_editor.h>
@@ -229,4 +232,214 @@ TEST(Chunks, AABB)
 	engine.Init();
 
 	engine.Run();
-}
\ No newline at end of file
+}
+
+class ChunkStreamingFlyThrough {
+public:
+	inline static const int kChunkNb = 8;
+	inline static const int kEntityNbPerChunk = 16;
+	inline static const float kChunkLength = 20.0f;
+
+	ChunkStreamingFlyThrough(poke::Engine& engine) :
+		engine_(engine)
+	{
+
+	}
+
+	//Chunks in a row, each one shows the next one and destroys the one two steps behind
+	void OnInit()
+	{
+		using namespace poke;
+
+		auto& ecsManager = EcsManagerLocator::Get();
+		auto& transformsManager = ecsManager.GetComponentsManager<ecs::TransformsManager>();
+		auto& modelsManager = ecsManager.GetComponentsManager<ecs::ModelsManager>();
+
+		json chunksJson;
+		std::map<ecs::EntityIndex, ecs::EntityIndex> entityIds;
+		for (int i = 0; i < kChunkNb; i++) {
+			chunk::Chunk chunk;
+			chunk.SetPosition(math::Vec3(0.0f, 0.0f, i * kChunkLength));
+			chunk.SetExtent(math::Vec3(kChunkLength));
+			if (i + 1 < kChunkNb) { chunk.AddChunkToShow(i + 1); }
+			if (i >= 2) { chunk.AddChunkToDestroy(i - 2); }
+
+			ecs::EntityIndex root = ecs::kNoParent;
+			for (int j = 0; j < kEntityNbPerChunk; j++) {
+				const ecs::EntityIndex entity = ecsManager.AddEntity();
+
+				ecsManager.AddComponent(entity, ecs::ComponentType::TRANSFORM);
+				math::Transform transform = transformsManager.GetComponent(entity);
+				transform.SetLocalPosition(math::Vec3(
+					static_cast<float>(j % 4),
+					0.0f,
+					i * kChunkLength + static_cast<float>(j / 4)));
+				transformsManager.SetComponent(entity, transform);
+
+				ecsManager.AddComponent(entity, ecs::ComponentType::MODEL);
+				modelsManager.SetComponent(entity, graphics::Model(0, MeshManagerLocator::Get().GetSphereID()));
+
+				//A hierarchy per chunk
+				if (j == 0) { root = entity; } else if (j == 1) { transformsManager.SetParent(entity, root); }
+
+				chunk.AddLinkEntity(entity);
+				entityIds[entity] = entity;
+			}
+			chunksJson[i] = chunk.ToJson(entityIds);
+		}
+
+		auto& chunksManager = ChunksManagerLocator::Get();
+		chunksManager.SetStreaming(true);
+		chunksManager.SetFromJson(chunksJson, entityIds);
+	}
+
+	//The camera moves one unit per frame along the chunks
+	void OnUpdate()
+	{
+		auto& chunksManager = poke::ChunksManagerLocator::Get();
+		chunksManager.UpdateActiveChunkWithPosition(poke::math::Vec3(0.0f, 0.0f, cameraZ_));
+		cameraZ_ += 1.0f;
+
+		lastActiveChunk_ = std::max(lastActiveChunk_, static_cast<int>(chunksManager.GetActiveChunkIndex()));
+		if (cameraZ_ > kChunkNb * kChunkLength) {
+			stats_ = chunksManager.GetStreamingStats();
+
+			//The first chunk has been destroyed behind the camera, its entities are only on disk
+			isFirstChunkOnDisk_ = poke::PokFileSystem::CheckFileExists(poke::PokFileSystem::GetFullPath(
+				"evictedChunk0",
+				poke::FileType::EVICTED_CHUNK,
+				poke::FolderType::SAVE));
+			engine_.Stop();
+		}
+	}
+
+	int GetLastActiveChunk() const { return lastActiveChunk_; }
+
+	const poke::chunk::ChunkStreamingStats& GetStats() const { return stats_; }
+
+	bool IsFirstChunkOnDisk() const { return isFirstChunkOnDisk_; }
+private:
+	poke::Engine& engine_;
+
+	float cameraZ_ = 0.0f;
+	int lastActiveChunk_ = 0;
+	poke::chunk::ChunkStreamingStats stats_;
+	bool isFirstChunkOnDisk_ = false;
+};
+
+TEST(Chunks, StreamingFlyThrough)
+{
+	poke::EngineSetting engineSettings{
+		"testChunksStreaming",
+		poke::AppType::EDITOR,
+		std::chrono::duration<double, std::milli>(16.66f),
+		720,
+		640,
+		"POK engine",
+		{{0, "Default", "Default"}}
+	};
+
+	poke::Engine engine(engineSettings);
+
+	//Load editor application
+	engine.SetApp(std::make_unique<poke::editor::Editor>(engine, ""));
+
+	//Load editor graphics renderer
+	engine.GetModuleManager().graphicsEngine.SetRenderer(
+		std::make_unique<poke::graphics::RendererEditor>(engine));
+
+	// TEST
+
+	ChunkStreamingFlyThrough flyThrough(engine);
+	engine.AddObserver(
+		poke::observer::MainLoopSubject::APP_INIT,
+		[&]() { flyThrough.OnInit(); });
+	engine.AddObserver(poke::observer::MainLoopSubject::UPDATE, [&]() {flyThrough.OnUpdate(); });
+	//
+
+	engine.Init();
+
+	engine.Run();
+
+	const int chunkNb = ChunkStreamingFlyThrough::kChunkNb;
+	const int entityNbPerChunk = ChunkStreamingFlyThrough::kEntityNbPerChunk;
+	const auto& stats = flyThrough.GetStats();
+	EXPECT_EQ(flyThrough.GetLastActiveChunk(), chunkNb - 1);
+
+	//The chunks not shown at the start are evicted, then loaded one by one and destroyed behind the camera
+	EXPECT_EQ(stats.loadedChunkNb, static_cast<size_t>(chunkNb - 2));
+	EXPECT_EQ(stats.evictedChunkNb, static_cast<size_t>(2 * (chunkNb - 2)));
+	EXPECT_EQ(stats.residentEntityNb, static_cast<size_t>(2 * entityNbPerChunk));
+
+	//At most the previous, the active and the next chunk are in the ecs
+	EXPECT_LE(stats.peakResidentEntityNb, static_cast<size_t>(3 * entityNbPerChunk));
+	EXPECT_GT(stats.evictedBytes, 0u);
+	EXPECT_TRUE(flyThrough.IsFirstChunkOnDisk());
+}
+
+TEST(Chunks, ChunkSet)
+{
+	poke::chunk::ChunkSet chunkSet{ 300, 2, 70 };
+	EXPECT_EQ(chunkSet.Size(), 3u);
+	EXPECT_TRUE(chunkSet.Contains(300));
+	EXPECT_FALSE(chunkSet.Contains(3));
+
+	//More chunks than the inline capacity, the indexes stay sorted
+	for (poke::chunk::ChunkIndex i = 0; i < 10; i++) { chunkSet.Insert(i * 100); }
+	chunkSet.Insert(2);
+	EXPECT_EQ(chunkSet.Size(), 12u);
+	EXPECT_TRUE(std::is_sorted(chunkSet.begin(), chunkSet.end()));
+	EXPECT_TRUE(chunkSet.Contains(900));
+
+	for (poke::chunk::ChunkIndex i = 0; i < 10; i++) { chunkSet.Erase(i * 100); }
+	EXPECT_EQ(chunkSet, poke::chunk::ChunkSet({ 70, 2 }));
+
+	chunkSet.Clear();
+	EXPECT_TRUE(chunkSet.IsEmpty());
+	EXPECT_EQ(chunkSet.begin(), chunkSet.end());
+}
+
+TEST(Chunks, Grid)
+{
+	using namespace poke;
+
+	//Overlapping chunks of different sizes, more than the former limit of 64
+	std::mt19937 generator(42);
+	std::uniform_real_distribution<float> positionDistribution(-500.0f, 500.0f);
+	std::uniform_real_distribution<float> extentDistribution(5.0f, 80.0f);
+	std::vector<chunk::Chunk> chunks(500);
+	for (auto& chunk : chunks) {
+		chunk.SetPosition({ positionDistribution(generator), positionDistribution(generator) * 0.1f, positionDistribution(generator) });
+		chunk.SetExtent({ extentDistribution(generator), extentDistribution(generator), extentDistribution(generator) });
+	}
+
+	chunk::ChunksGrid grid;
+	grid.Build(chunks);
+	EXPECT_GT(grid.GetCellNb(), 1u);
+
+	std::uniform_real_distribution<float> queryDistribution(-600.0f, 600.0f);
+	for (int i = 0; i < 2000; i++) {
+		const math::Vec3 position(queryDistribution(generator), queryDistribution(generator) * 0.1f, queryDistribution(generator));
+
+		//Same chunk than a linear scan
+		chunk::ChunkIndex expectedChunk = chunk::ChunksGrid::kNoChunk;
+		for (chunk::ChunkIndex j = 0; j < chunks.size(); j++) {
+			if (chunks[j].IsPositionInside(position)) {
+				expectedChunk = j;
+				break;
+			}
+		}
+		EXPECT_EQ(grid.FindChunk(chunks, position), expectedChunk);
+
+		const physics::AABB aabb{ position, math::Vec3(extentDistribution(generator)) };
+		chunk::ChunkSet expectedChunks;
+		for (chunk::ChunkIndex j = 0; j < chunks.size(); j++) {
+			if (chunks[j].Overlap(aabb)) { expectedChunks.Insert(j); }
+		}
+		EXPECT_EQ(grid.FindChunks(chunks, aabb), expectedChunks);
+	}
+
+	grid.Build({});
+	EXPECT_EQ(grid.FindChunk(chunks, math::Vec3(0.0f)), chunk::ChunksGrid::kNoChunk);
+	EXPECT_TRUE(grid.FindChunks(chunks, physics::AABB{ math::Vec3(0.0f), math::Vec3(1.0f) }).IsEmpty());
+}
@@ -5,6 +5,7 @@
 #include <GraphicsEngine/Renderers/renderer_editor.h>
 #include <CoreEngine/ServiceLocator/service_locator_definition.h>
 #include "Ecs/Utility/entity_vector.h"
+#include <Ecs/ComponentManagers/components_view.h>
 #include <algorithm>
 
 //---------------------------------Add/Remove Entity --------------------------
@@ -247,13 +248,12 @@ TEST(ECS, Add1Archetype)
 	engine.Init();
 
 	poke::ecs::Archetype tmpArchetype;
-	tmpArchetype.AddComponent(poke::ecs::ComponentType::TRANSFORM);
-	tmpArchetype.transform.SetLocalPosition({ 0, 0, 0 });
+	tmpArchetype.EmplaceComponent<poke::math::Transform>(poke::ecs::ComponentType::TRANSFORM).SetLocalPosition({ 0, 0, 0 });
 
-	tmpArchetype.AddComponent(poke::ecs::ComponentType::COLLIDER);
-	tmpArchetype.collider.shapeType = poke::physics::ShapeType::BOX;
-	tmpArchetype.collider.boxShape.SetCenter({ 0,0,0 });
-	tmpArchetype.collider.boxShape.SetExtent({ 1,1,1 });
+	auto& archetypeCollider = tmpArchetype.EmplaceComponent<poke::physics::Collider>(poke::ecs::ComponentType::COLLIDER);
+	archetypeCollider.shapeType = poke::physics::ShapeType::BOX;
+	archetypeCollider.boxShape.SetCenter({ 0,0,0 });
+	archetypeCollider.boxShape.SetExtent({ 1,1,1 });
 
 	poke::ArchetypesManagerLocator::Get().AddArchetype(tmpArchetype, "test", 100);
 
@@ -302,13 +302,12 @@ TEST(ECS, Add2Archetypes)
 	engine.Init();
 
 	poke::ecs::Archetype tmpArchetype;
-	tmpArchetype.AddComponent(poke::ecs::ComponentType::TRANSFORM);
-	tmpArchetype.transform.SetLocalPosition({ 0, 0, 0 });
+	tmpArchetype.EmplaceComponent<poke::math::Transform>(poke::ecs::ComponentType::TRANSFORM).SetLocalPosition({ 0, 0, 0 });
 
-	tmpArchetype.AddComponent(poke::ecs::ComponentType::COLLIDER);
-	tmpArchetype.collider.shapeType = poke::physics::ShapeType::BOX;
-	tmpArchetype.collider.boxShape.SetCenter({ 0,0,0 });
-	tmpArchetype.collider.boxShape.SetExtent({ 1,1,1 });
+	auto& archetypeCollider = tmpArchetype.EmplaceComponent<poke::physics::Collider>(poke::ecs::ComponentType::COLLIDER);
+	archetypeCollider.shapeType = poke::physics::ShapeType::BOX;
+	archetypeCollider.boxShape.SetCenter({ 0,0,0 });
+	archetypeCollider.boxShape.SetExtent({ 1,1,1 });
 	const int sizeArchetype = 100;
 	poke::ArchetypesManagerLocator::Get().AddArchetype(tmpArchetype, "test", sizeArchetype);
 
@@ -379,13 +378,12 @@ TEST(ECS, Add1ArchetypeHalfFiled)
 	engine.Init();
 
 	poke::ecs::Archetype tmpArchetype;
-	tmpArchetype.AddComponent(poke::ecs::ComponentType::TRANSFORM);
-	tmpArchetype.transform.SetLocalPosition({ 0, 0, 0 });
+	tmpArchetype.EmplaceComponent<poke::math::Transform>(poke::ecs::ComponentType::TRANSFORM).SetLocalPosition({ 0, 0, 0 });
 
-	tmpArchetype.AddComponent(poke::ecs::ComponentType::COLLIDER);
-	tmpArchetype.collider.shapeType = poke::physics::ShapeType::BOX;
-	tmpArchetype.collider.boxShape.SetCenter({ 0,0,0 });
-	tmpArchetype.collider.boxShape.SetExtent({ 1,1,1 });
+	auto& archetypeCollider = tmpArchetype.EmplaceComponent<poke::physics::Collider>(poke::ecs::ComponentType::COLLIDER);
+	archetypeCollider.shapeType = poke::physics::ShapeType::BOX;
+	archetypeCollider.boxShape.SetCenter({ 0,0,0 });
+	archetypeCollider.boxShape.SetExtent({ 1,1,1 });
 
 	const int size = 100;
 	poke::ArchetypesManagerLocator::Get().AddArchetype(tmpArchetype, "test", size);
@@ -443,13 +441,12 @@ TEST(ECS, UpdateArchetypesAddComponent)
 	const auto size = 100;
 	poke::ecs::Archetype tmpArchetype;
 	tmpArchetype.size = size;
-	tmpArchetype.AddComponent(poke::ecs::ComponentType::TRANSFORM);
-	tmpArchetype.transform.SetLocalPosition({ 0, 0, 0 });
+	tmpArchetype.EmplaceComponent<poke::math::Transform>(poke::ecs::ComponentType::TRANSFORM).SetLocalPosition({ 0, 0, 0 });
 
-	tmpArchetype.AddComponent(poke::ecs::ComponentType::COLLIDER);
-	tmpArchetype.collider.shapeType = poke::physics::ShapeType::BOX;
-	tmpArchetype.collider.boxShape.SetCenter({ 0,0,0 });
-	tmpArchetype.collider.boxShape.SetExtent({ 1,1,1 });
+	auto& archetypeCollider = tmpArchetype.EmplaceComponent<poke::physics::Collider>(poke::ecs::ComponentType::COLLIDER);
+	archetypeCollider.shapeType = poke::physics::ShapeType::BOX;
+	archetypeCollider.boxShape.SetCenter({ 0,0,0 });
+	archetypeCollider.boxShape.SetExtent({ 1,1,1 });
 
 	poke::ArchetypesManagerLocator::Get().AddArchetype(tmpArchetype, "test", size);
 
@@ -524,13 +521,12 @@ TEST(ECS, UpdateArchetypesAddAndRemoveComponent)
 	const int size = 100;
 	poke::ecs::Archetype tmpArchetype;
 	tmpArchetype.size = size;
-	tmpArchetype.AddComponent(poke::ecs::ComponentType::TRANSFORM);
-	tmpArchetype.transform.SetLocalPosition({ 0, 0, 0 });
+	tmpArchetype.EmplaceComponent<poke::math::Transform>(poke::ecs::ComponentType::TRANSFORM).SetLocalPosition({ 0, 0, 0 });
 
-	tmpArchetype.AddComponent(poke::ecs::ComponentType::COLLIDER);
-	tmpArchetype.collider.shapeType = poke::physics::ShapeType::BOX;
-	tmpArchetype.collider.boxShape.SetCenter({ 0,0,0 });
-	tmpArchetype.collider.boxShape.SetExtent({ 1,1,1 });
+	auto& archetypeCollider = tmpArchetype.EmplaceComponent<poke::physics::Collider>(poke::ecs::ComponentType::COLLIDER);
+	archetypeCollider.shapeType = poke::physics::ShapeType::BOX;
+	archetypeCollider.boxShape.SetCenter({ 0,0,0 });
+	archetypeCollider.boxShape.SetExtent({ 1,1,1 });
 
 	poke::ArchetypesManagerLocator::Get().AddArchetype(tmpArchetype, "test", size);
 
@@ -616,13 +612,12 @@ TEST(ECS, OneArchetypesResizeBigger)
 	const auto size = 100;
 	poke::ecs::Archetype tmpArchetype;
 	tmpArchetype.size = size;
-	tmpArchetype.AddComponent(poke::ecs::ComponentType::TRANSFORM);
-	tmpArchetype.transform.SetLocalPosition({ 0, 0, 0 });
+	tmpArchetype.EmplaceComponent<poke::math::Transform>(poke::ecs::ComponentType::TRANSFORM).SetLocalPosition({ 0, 0, 0 });
 
-	tmpArchetype.AddComponent(poke::ecs::ComponentType::COLLIDER);
-	tmpArchetype.collider.shapeType = poke::physics::ShapeType::BOX;
-	tmpArchetype.collider.boxShape.SetCenter({ 0,0,0 });
-	tmpArchetype.collider.boxShape.SetExtent({ 1,1,1 });
+	auto& archetypeCollider = tmpArchetype.EmplaceComponent<poke::physics::Collider>(poke::ecs::ComponentType::COLLIDER);
+	archetypeCollider.shapeType = poke::physics::ShapeType::BOX;
+	archetypeCollider.boxShape.SetCenter({ 0,0,0 });
+	archetypeCollider.boxShape.SetExtent({ 1,1,1 });
 
 	poke::ArchetypesManagerLocator::Get().AddArchetype(tmpArchetype, "test", size);
 
@@ -691,13 +686,12 @@ TEST(ECS, OneArchetypesResizeSmaller)
 	const auto size = 100;
 	poke::ecs::Archetype tmpArchetype;
 	tmpArchetype.size = size;
-	tmpArchetype.AddComponent(poke::ecs::ComponentType::TRANSFORM);
-	tmpArchetype.transform.SetLocalPosition({ 0, 0, 0 });
+	tmpArchetype.EmplaceComponent<poke::math::Transform>(poke::ecs::ComponentType::TRANSFORM).SetLocalPosition({ 0, 0, 0 });
 
-	tmpArchetype.AddComponent(poke::ecs::ComponentType::COLLIDER);
-	tmpArchetype.collider.shapeType = poke::physics::ShapeType::BOX;
-	tmpArchetype.collider.boxShape.SetCenter({ 0,0,0 });
-	tmpArchetype.collider.boxShape.SetExtent({ 1,1,1 });
+	auto& archetypeCollider = tmpArchetype.EmplaceComponent<poke::physics::Collider>(poke::ecs::ComponentType::COLLIDER);
+	archetypeCollider.shapeType = poke::physics::ShapeType::BOX;
+	archetypeCollider.boxShape.SetCenter({ 0,0,0 });
+	archetypeCollider.boxShape.SetExtent({ 1,1,1 });
 
 	poke::ArchetypesManagerLocator::Get().AddArchetype(tmpArchetype, "test", size);
 
@@ -763,13 +757,12 @@ TEST(ECS, ArchetypemanagerGetPool)
 	engine.Init();
 
 	poke::ecs::Archetype tmpArchetype;
-	tmpArchetype.AddComponent(poke::ecs::ComponentType::TRANSFORM);
-	tmpArchetype.transform.SetLocalPosition({ 0, 0, 0 });
+	tmpArchetype.EmplaceComponent<poke::math::Transform>(poke::ecs::ComponentType::TRANSFORM).SetLocalPosition({ 0, 0, 0 });
 
-	tmpArchetype.AddComponent(poke::ecs::ComponentType::COLLIDER);
-	tmpArchetype.collider.shapeType = poke::physics::ShapeType::BOX;
-	tmpArchetype.collider.boxShape.SetCenter({ 0,0,0 });
-	tmpArchetype.collider.boxShape.SetExtent({ 1,1,1 });
+	auto& archetypeCollider = tmpArchetype.EmplaceComponent<poke::physics::Collider>(poke::ecs::ComponentType::COLLIDER);
+	archetypeCollider.shapeType = poke::physics::ShapeType::BOX;
+	archetypeCollider.boxShape.SetCenter({ 0,0,0 });
+	archetypeCollider.boxShape.SetExtent({ 1,1,1 });
 
 	poke::ArchetypesManagerLocator::Get().AddArchetype(tmpArchetype, "test", 100);
 
@@ -828,13 +821,12 @@ TEST(ECS, ArchetypeManagerDefaultValueAfterDestroy)
 	engine.Init();
 
 	poke::ecs::Archetype tmpArchetype;
-	tmpArchetype.AddComponent(poke::ecs::ComponentType::TRANSFORM);
-	tmpArchetype.transform.SetLocalPosition({ 0, 0, 0 });
+	tmpArchetype.EmplaceComponent<poke::math::Transform>(poke::ecs::ComponentType::TRANSFORM).SetLocalPosition({ 0, 0, 0 });
 
-	tmpArchetype.AddComponent(poke::ecs::ComponentType::COLLIDER);
-	tmpArchetype.collider.shapeType = poke::physics::ShapeType::BOX;
-	tmpArchetype.collider.boxShape.SetCenter({ 0,0,0 });
-	tmpArchetype.collider.boxShape.SetExtent({ 1,1,1 });
+	auto& archetypeCollider = tmpArchetype.EmplaceComponent<poke::physics::Collider>(poke::ecs::ComponentType::COLLIDER);
+	archetypeCollider.shapeType = poke::physics::ShapeType::BOX;
+	archetypeCollider.boxShape.SetCenter({ 0,0,0 });
+	archetypeCollider.boxShape.SetExtent({ 1,1,1 });
 
 	const size_t archetypeSize = 100;
 	poke::ArchetypesManagerLocator::Get().AddArchetype(tmpArchetype, "test", archetypeSize);
@@ -1010,6 +1002,210 @@ TEST(ECS, EntityVectorResize)
 }
 //-----------------------------------------------------------------------------
 
+//---------------------------------Archetype components -----------------------
+TEST(ECS, ArchetypeStoresOnlyItsComponents)
+{
+	poke::ecs::Archetype archetype;
+	archetype.EmplaceComponent<poke::math::Transform>(poke::ecs::ComponentType::TRANSFORM).SetLocalPosition({ 1, 2, 3 });
+
+	poke::physics::Collider collider;
+	collider.isTrigger = true;
+	archetype.SetComponent(poke::ecs::ComponentType::COLLIDER, collider);
+
+	ASSERT_TRUE(archetype.HasComponent(poke::ecs::ComponentType::TRANSFORM));
+	ASSERT_TRUE(archetype.HasComponent(poke::ecs::ComponentType::COLLIDER));
+	ASSERT_FALSE(archetype.HasComponent(poke::ecs::ComponentType::RIGIDBODY));
+
+	//The copy only holds the two components added
+	const poke::ecs::Archetype copy = archetype;
+	ASSERT_TRUE(copy.GetComponent<poke::math::Transform>(poke::ecs::ComponentType::TRANSFORM).GetLocalPosition() == poke::math::Vec3(1, 2, 3));
+	ASSERT_TRUE(copy.GetComponent<poke::physics::Collider>(poke::ecs::ComponentType::COLLIDER).isTrigger);
+	ASSERT_TRUE(copy.GetComponent<poke::physics::Rigidbody>(poke::ecs::ComponentType::RIGIDBODY) == poke::physics::Rigidbody());
+
+	//A component removed from the mask is read as a default one
+	archetype.RemoveComponent(poke::ecs::ComponentType::TRANSFORM);
+	ASSERT_TRUE(archetype.GetComponent<poke::math::Transform>(poke::ecs::ComponentType::TRANSFORM).GetLocalPosition() == poke::math::Transform().GetLocalPosition());
+}
+
+TEST(ECS, ArchetypeJsonOnlyHoldsItsComponents)
+{
+	poke::ecs::Archetype archetype;
+	archetype.EmplaceComponent<poke::math::Transform>(poke::ecs::ComponentType::TRANSFORM).SetLocalPosition({ 4, 5, 6 });
+	archetype.EmplaceComponent<poke::physics::Rigidbody>(poke::ecs::ComponentType::RIGIDBODY).linearDrag = 0.5f;
+
+	const json archetypeJson = archetype.ToJson();
+	ASSERT_TRUE(poke::CheckJsonExists(archetypeJson, "transform"));
+	ASSERT_TRUE(poke::CheckJsonExists(archetypeJson, "rigidbody"));
+	ASSERT_FALSE(poke::CheckJsonExists(archetypeJson, "collider"));
+
+	poke::ecs::Archetype loadedArchetype;
+	loadedArchetype.SetFromJson(archetypeJson);
+	ASSERT_TRUE(loadedArchetype.GetComponentMask() == archetype.GetComponentMask());
+	ASSERT_TRUE(loadedArchetype.GetComponent<poke::math::Transform>(poke::ecs::ComponentType::TRANSFORM).GetLocalPosition() == poke::math::Vec3(4, 5, 6));
+	ASSERT_FLOAT_EQ(loadedArchetype.GetComponent<poke::physics::Rigidbody>(poke::ecs::ComponentType::RIGIDBODY).linearDrag, 0.5f);
+}
+
+namespace {
+//Non trivial component, the use count of the shared value tells how many copies are alive
+struct SharedSplineFollower {
+	poke::ecs::SplineFollower splineFollower;
+	std::shared_ptr<int> value;
+};
+
+void EmplaceSharedSplineFollower(
+	poke::ecs::ComponentsBlob& blob,
+	const poke::ecs::ComponentType::ComponentType type,
+	const std::shared_ptr<int>& value)
+{
+	auto& component = blob.Emplace<SharedSplineFollower>(type);
+	component.splineFollower.spline.SetPoints({ { 0, 0, 0 }, { 1, 0, 0 }, { 2, 0, 0 } });
+	component.value = value;
+}
+} //namespace
+
+TEST(ECS, ComponentsBlobGrowthKeepsComponents)
+{
+	const auto value = std::make_shared<int>(7);
+	{
+		poke::ecs::ComponentsBlob blob;
+		EmplaceSharedSplineFollower(blob, poke::ecs::ComponentType::SPLINE_FOLLOWER, value);
+		ASSERT_EQ(value.use_count(), 2);
+
+		//Each component added reallocates the blob, the ones already stored are moved and their old copy destroyed
+		blob.Emplace<poke::physics::Rigidbody>(poke::ecs::ComponentType::RIGIDBODY).linearDrag = 0.5f;
+		EmplaceSharedSplineFollower(blob, poke::ecs::ComponentType::TRAIL_RENDERER, value);
+		ASSERT_EQ(value.use_count(), 3);
+
+		const auto& splineFollower = blob.Get<SharedSplineFollower>(poke::ecs::ComponentType::SPLINE_FOLLOWER);
+		ASSERT_EQ(splineFollower.value, value);
+		ASSERT_EQ(splineFollower.splineFollower.spline.GetPoints().size(), 3);
+		ASSERT_FLOAT_EQ(blob.Get<poke::physics::Rigidbody>(poke::ecs::ComponentType::RIGIDBODY).linearDrag, 0.5f);
+
+		//Emplacing a stored component neither grows the blob nor creates a new component
+		const size_t size = blob.GetSize();
+		ASSERT_EQ(&blob.Emplace<SharedSplineFollower>(poke::ecs::ComponentType::SPLINE_FOLLOWER), &splineFollower);
+		ASSERT_EQ(blob.GetSize(), size);
+		ASSERT_EQ(value.use_count(), 3);
+	}
+	ASSERT_EQ(value.use_count(), 1);
+}
+
+TEST(ECS, ComponentsBlobCopyAndMove)
+{
+	const auto value = std::make_shared<int>(7);
+	{
+		poke::ecs::ComponentsBlob blob;
+		EmplaceSharedSplineFollower(blob, poke::ecs::ComponentType::SPLINE_FOLLOWER, value);
+		EmplaceSharedSplineFollower(blob, poke::ecs::ComponentType::TRAIL_RENDERER, value);
+		ASSERT_EQ(value.use_count(), 3);
+
+		//The copy owns its own components
+		poke::ecs::ComponentsBlob copy(blob);
+		ASSERT_EQ(value.use_count(), 5);
+		copy.Emplace<SharedSplineFollower>(poke::ecs::ComponentType::SPLINE_FOLLOWER).splineFollower.speed = 2.0f;
+		ASSERT_FLOAT_EQ(blob.Get<SharedSplineFollower>(poke::ecs::ComponentType::SPLINE_FOLLOWER).splineFollower.speed, poke::ecs::SplineFollower().speed);
+
+		//Moving only transfers the ownership, the moved from blob is empty
+		poke::ecs::ComponentsBlob moved(std::move(copy));
+		ASSERT_EQ(value.use_count(), 5);
+		ASSERT_EQ(copy.GetSize(), 0);
+		ASSERT_FALSE(copy.Has(poke::ecs::ComponentType::SPLINE_FOLLOWER));
+		ASSERT_FLOAT_EQ(moved.Get<SharedSplineFollower>(poke::ecs::ComponentType::SPLINE_FOLLOWER).splineFollower.speed, 2.0f);
+
+		//Assigning destroys the components replaced
+		poke::ecs::ComponentsBlob assigned;
+		EmplaceSharedSplineFollower(assigned, poke::ecs::ComponentType::LIGHT, value);
+		ASSERT_EQ(value.use_count(), 6);
+		assigned = blob;
+		ASSERT_EQ(value.use_count(), 7);
+		ASSERT_FALSE(assigned.Has(poke::ecs::ComponentType::LIGHT));
+
+		assigned = std::move(moved);
+		ASSERT_EQ(value.use_count(), 5);
+		ASSERT_EQ(moved.GetSize(), 0);
+
+		const auto& self = assigned;
+		assigned = self;
+		ASSERT_EQ(value.use_count(), 5);
+		ASSERT_FLOAT_EQ(assigned.Get<SharedSplineFollower>(poke::ecs::ComponentType::SPLINE_FOLLOWER).splineFollower.speed, 2.0f);
+	}
+	ASSERT_EQ(value.use_count(), 1);
+}
+
+TEST(ECS, ComponentsBlobMissingAndRemovedComponents)
+{
+	const auto value = std::make_shared<int>(7);
+	{
+		//A missing component is read as a default one
+		const poke::ecs::ComponentsBlob blob;
+		ASSERT_FALSE(blob.Has(poke::ecs::ComponentType::SPLINE_FOLLOWER));
+		const auto& missing = blob.Get<SharedSplineFollower>(poke::ecs::ComponentType::SPLINE_FOLLOWER);
+		ASSERT_EQ(missing.value, nullptr);
+		ASSERT_TRUE(missing.splineFollower == poke::ecs::SplineFollower());
+
+		poke::ecs::Archetype archetype;
+		ASSERT_EQ(archetype.GetComponent<SharedSplineFollower>(poke::ecs::ComponentType::SPLINE_FOLLOWER).value, nullptr);
+
+		auto& component = archetype.EmplaceComponent<SharedSplineFollower>(poke::ecs::ComponentType::SPLINE_FOLLOWER);
+		component.value = value;
+		ASSERT_EQ(archetype.GetComponent<SharedSplineFollower>(poke::ecs::ComponentType::SPLINE_FOLLOWER).value, value);
+
+		//A removed component is read as a default one, it is still destroyed with the archetype
+		archetype.RemoveComponent(poke::ecs::ComponentType::SPLINE_FOLLOWER);
+		ASSERT_EQ(archetype.GetComponent<SharedSplineFollower>(poke::ecs::ComponentType::SPLINE_FOLLOWER).value, nullptr);
+		ASSERT_EQ(value.use_count(), 2);
+	}
+	ASSERT_EQ(value.use_count(), 1);
+}
+
+#ifndef NDEBUG
+TEST(ECS, ComponentsBlobGetWithAnotherTypeAsserts)
+{
+	poke::ecs::ComponentsBlob blob;
+	blob.Emplace<SharedSplineFollower>(poke::ecs::ComponentType::SPLINE_FOLLOWER);
+
+	ASSERT_DEATH(blob.Get<poke::physics::Rigidbody>(poke::ecs::ComponentType::SPLINE_FOLLOWER), "another type");
+	ASSERT_DEATH(blob.Emplace<poke::physics::Rigidbody>(poke::ecs::ComponentType::SPLINE_FOLLOWER), "another type");
+}
+#endif
+//-----------------------------------------------------------------------------
+
+//---------------------------------Components view ----------------------------
+TEST(ECS, ComponentsViewUpdateMarksOnlyTouchedEntities)
+{
+	std::vector<poke::ecs::SplineFollower> splineFollowers(10);
+	poke::ecs::DirtyEntities dirtyEntities;
+	poke::ecs::ComponentsView<poke::ecs::SplineFollower> componentsView(splineFollowers, &dirtyEntities);
+
+	//Reads and simulation writes don't mark the entities
+	componentsView[1].speed = 2.0f;
+	const auto& constView = componentsView;
+	ASSERT_FLOAT_EQ(constView[1].speed, 2.0f);
+	ASSERT_TRUE(dirtyEntities.GetEntities().empty());
+
+	componentsView.Update(3).speed = 3.0f;
+	componentsView.Update(7).speed = 7.0f;
+	componentsView.Update(3).segmentPercentage = 0.5f;
+
+	ASSERT_FLOAT_EQ(splineFollowers[3].speed, 3.0f);
+	ASSERT_FLOAT_EQ(splineFollowers[3].segmentPercentage, 0.5f);
+	ASSERT_EQ(dirtyEntities.GetEntities(), std::vector<poke::ecs::EntityIndex>({ 3, 7 }));
+	for (poke::ecs::EntityIndex entity = 0; entity < 10; entity++) {
+		ASSERT_EQ(dirtyEntities.IsDirty(entity), entity == 3 || entity == 7);
+	}
+
+	//Cleared once the observers are notified
+	dirtyEntities.Clear();
+	ASSERT_TRUE(dirtyEntities.GetEntities().empty());
+	ASSERT_FALSE(dirtyEntities.IsDirty(3));
+
+	//Without dirty entities, the view doesn't track the writes
+	poke::ecs::ComponentsView<poke::ecs::SplineFollower> untrackedView(splineFollowers);
+	untrackedView.Update(2).speed = 1.0f;
+	ASSERT_FLOAT_EQ(splineFollowers[2].speed, 1.0f);
+}
+//-----------------------------------------------------------------------------
+
 template <typename T>
 class HasGetComponentIndex
 {
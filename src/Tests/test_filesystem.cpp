@@ -1,11 +1,109 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <thread>
+
 #include <CoreEngine/engine.h>
 #include <Editor/editor.h>
 #include <Utility/file_system.h>
+#include <Utility/file_watcher.h>
+#include <Utility/mapped_file.h>
 
 TEST(Filesystem, AbsolutePath)
 {
 	std::cout << poke::PokFileSystem::GetAbsoluteFullPath("pokEngine", poke::FileType::ENGINE_SETTING, poke::FolderType::SAVE_IN_ROM) << "\n";
 	std::cout << poke::PokFileSystem::GetFullPath("pokEngine", poke::FileType::ENGINE_SETTING, poke::FolderType::SAVE_IN_ROM);
-}
\ No newline at end of file
+}
+
+namespace {
+//The watcher thread reports the writes asynchronously
+std::vector<std::string> WaitForChanges(poke::FileWatcher& fileWatcher, const size_t changesCount)
+{
+	std::vector<std::string> changes;
+	for (int i = 0; i < 50 && changes.size() < changesCount; i++) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(2 * poke::FileWatcher::kPollIntervalMs));
+
+		for (const std::string& change : fileWatcher.PollChanges()) { changes.push_back(change); }
+	}
+	std::sort(changes.begin(), changes.end());
+	return changes;
+}
+
+void WriteTextFile(const std::string& filePath, const std::string& content)
+{
+	std::ofstream file(filePath, std::ios::trunc);
+	file << content;
+}
+} //namespace
+
+TEST(Filesystem, FileWatcherWrites)
+{
+	const std::string folderPath = poke::PokFileSystem::GetPath(poke::FileType::DATA, poke::FolderType::SAVE) + "fileWatcher/";
+	poke::PokFileSystem::RemoveDirectory(folderPath);
+	poke::PokFileSystem::CreateDirectory(folderPath + "textures/");
+
+	poke::FileWatcher fileWatcher;
+	ASSERT_TRUE(fileWatcher.Start({ folderPath }));
+	EXPECT_TRUE(fileWatcher.IsRunning());
+
+	//Each file is reported once even when written several times
+	for (int i = 0; i < 3; i++) {
+		WriteTextFile(folderPath + "mesh.obj", "v 0 0 " + std::to_string(i));
+	}
+	WriteTextFile(folderPath + "textures/texture.png", "png");
+
+	const std::vector<std::string> expectedChanges{ folderPath + "mesh.obj", folderPath + "textures/texture.png" };
+	EXPECT_EQ(WaitForChanges(fileWatcher, expectedChanges.size()), expectedChanges);
+
+	//Folders created after Start are watched too
+	poke::PokFileSystem::CreateDirectory(folderPath + "materials/");
+	WriteTextFile(folderPath + "materials/material.pokmaterial", "{}");
+
+	const std::vector<std::string> changes = WaitForChanges(fileWatcher, 1);
+	EXPECT_NE(std::find(changes.begin(), changes.end(), folderPath + "materials/material.pokmaterial"), changes.end());
+
+	fileWatcher.Stop();
+	EXPECT_FALSE(fileWatcher.IsRunning());
+	EXPECT_TRUE(fileWatcher.PollChanges().empty());
+
+	poke::PokFileSystem::RemoveDirectory(folderPath);
+}
+
+TEST(Filesystem, FileWatcherMissingFolder)
+{
+	poke::FileWatcher fileWatcher;
+	EXPECT_FALSE(fileWatcher.Start({ "missingFolder/" }));
+	EXPECT_FALSE(fileWatcher.IsRunning());
+}
+
+TEST(Filesystem, WriteFileAtomicallyKeepsMappedContent)
+{
+	const std::string folderPath = poke::PokFileSystem::GetPath(poke::FileType::DATA, poke::FolderType::SAVE) + "atomicWrite/";
+	poke::PokFileSystem::RemoveDirectory(folderPath);
+	poke::PokFileSystem::CreateDirectory(folderPath);
+	const std::string filePath = folderPath + "cooked.pokmesh";
+
+	const std::string oldContent(4096, 'a');
+	ASSERT_TRUE(poke::PokFileSystem::WriteFileAtomically(filePath, oldContent.data(), oldContent.size()));
+
+	poke::MappedFile mappedFile;
+	ASSERT_TRUE(mappedFile.Open(filePath));
+
+	//A shorter file written while the old one is mapped, the mapping must not see it
+	const std::string newContent(16, 'b');
+	ASSERT_TRUE(poke::PokFileSystem::WriteFileAtomically(filePath, newContent.data(), newContent.size()));
+	ASSERT_EQ(mappedFile.GetSize(), oldContent.size());
+	EXPECT_EQ(std::string(reinterpret_cast<const char*>(mappedFile.GetData()), mappedFile.GetSize()), oldContent);
+	mappedFile.Close();
+
+	ASSERT_TRUE(mappedFile.Open(filePath));
+	EXPECT_EQ(std::string(reinterpret_cast<const char*>(mappedFile.GetData()), mappedFile.GetSize()), newContent);
+	mappedFile.Close();
+
+	//Only the written file is left in the folder
+	EXPECT_EQ(poke::PokFileSystem::GetAllFilesInDirectories(folderPath).size(), 1);
+
+	poke::PokFileSystem::RemoveDirectory(folderPath);
+}
@@ -3,6 +3,7 @@
 #include <CoreEngine/engine.h>
 #include <Editor/editor.h>
 #include <GraphicsEngine/Renderers/renderer_editor.h>
+#include <GraphicsEngine/Renderers/renderer_game.h>
 #include <Utility/file_system.h>
 #include <CoreEngine/ServiceLocator/service_locator_definition.h>
 #include <Tests/TestGame/test_game_system.h>
@@ -13,6 +14,10 @@
 #include <Game/Ecs/game_archetype.h>
 #include <Math/hash.h>
 #include "Game/ComponentManagers/spline_state_manager.h"
+#include <Game/missile_kernels.h>
+#include <Game/spatial_hash.h>
+#include <Game/game.h>
+#include <atomic>
 
 class MovingGameCameraSystem final : public poke::game::GameSystem {
 public:
@@ -1695,6 +1700,62 @@ TEST(Game, TestProjectile)
 	engine.Run();
 }
 
+TEST(Game, RunFrameTasksUntilStop)
+{
+	poke::EngineSetting engineSettings{
+		"testGameRun",
+		poke::AppType::GAME,
+		std::chrono::duration<double, std::milli>(16.66f),
+		720,
+		640,
+		"POK game",
+		{{0, "Default", "Default"}}
+	};
+
+	poke::Engine engine(engineSettings);
+
+	engine.SetApp(std::make_unique<poke::game::Game>(engine, ""));
+	engine.GetModuleManager().graphicsEngine.SetRenderer(std::make_unique<poke::graphics::RendererGame>(engine));
+
+	// TEST
+
+	const int frameCount = 10;
+	std::atomic<int> updateCount{ 0 };
+	std::atomic<int> drawCount{ 0 };
+	std::atomic<int> cullingCount{ 0 };
+	std::atomic<int> renderCount{ 0 };
+	int endFrameCount = 0;
+	bool isDrawAfterUpdate = true;
+	bool isFrameComplete = true;
+
+	engine.AddObserver(poke::observer::MainLoopSubject::UPDATE, [&]() { updateCount++; });
+	engine.AddObserver(poke::observer::MainLoopSubject::DRAW, [&]() {
+		drawCount++;
+		isDrawAfterUpdate &= drawCount == updateCount;
+	});
+	engine.AddObserver(poke::observer::MainLoopSubject::CULLING, [&]() { cullingCount++; });
+	engine.AddObserver(poke::observer::MainLoopSubject::RENDER, [&]() { renderCount++; });
+
+	//Both threads are waited before the end of the frame, the game stops itself once enough frames ran
+	engine.AddObserver(poke::observer::MainLoopSubject::END_FRAME, [&]() {
+		endFrameCount++;
+		isFrameComplete &= updateCount == endFrameCount && drawCount == endFrameCount &&
+			cullingCount == endFrameCount && renderCount == endFrameCount;
+		if (endFrameCount == frameCount) { engine.Stop(); }
+	});
+	//
+
+	engine.Init();
+
+	engine.Run();
+
+	EXPECT_EQ(endFrameCount, frameCount);
+	EXPECT_EQ(updateCount, frameCount);
+	EXPECT_EQ(renderCount, frameCount);
+	EXPECT_TRUE(isDrawAfterUpdate);
+	EXPECT_TRUE(isFrameComplete);
+}
+
 TEST(Game, TestMissile)
 {
 	const char* projectName = "pokEngine";
@@ -2525,4 +2586,145 @@ TEST(Game, TestAiming)
 	// TEST	
 
 	engine.Run();
-}
\ No newline at end of file
+}
+//The targets are found by the spatial hash as they were by testing all of them
+TEST(Game, SpatialHashQueries)
+{
+	poke::game::SpatialHash spatialHash(10.0f);
+	std::vector<poke::math::Vec3> positions;
+	for (int i = 0; i < 500; i++) {
+		positions.emplace_back(
+			static_cast<float>((i * 37) % 200) - 100.0f,
+			static_cast<float>((i * 53) % 120) - 60.0f,
+			static_cast<float>((i * 71) % 300));
+		spatialHash.Insert(i, positions.back());
+	}
+	spatialHash.Build();
+	ASSERT_EQ(spatialHash.GetSize(), positions.size());
+
+	const poke::math::Vec3 origin(0, 0, -10);
+	const poke::math::Vec3 direction = poke::math::Vec3(0.1f, -0.05f, 1).Normalize();
+	const float maxAngle = 10.0f;
+	const float maxDistance = 200.0f;
+
+	std::vector<poke::game::SpatialHash::Entry> results;
+	spatialHash.QueryRadius(origin, 40.0f, results);
+	size_t expectedNb = 0;
+	for (const poke::math::Vec3& position : positions) {
+		if ((position - origin).GetMagnitude() <= 40.0f) { expectedNb++; }
+	}
+	EXPECT_EQ(results.size(), expectedNb);
+
+	spatialHash.QueryCone(origin, direction, maxAngle, maxDistance, results);
+	std::vector<poke::ecs::EntityIndex> expectedTargets;
+	for (size_t i = 0; i < positions.size(); i++) {
+		const poke::math::Vec3 toTarget = positions[i] - origin;
+		const float angle = std::acos(direction * toTarget.Normalize()) * poke::math::kRad2Deg;
+		if (toTarget.GetMagnitude() <= maxDistance && angle < maxAngle) {
+			expectedTargets.push_back(static_cast<poke::ecs::EntityIndex>(i));
+		}
+	}
+	std::vector<poke::ecs::EntityIndex> foundTargets;
+	for (const auto& result : results) { foundTargets.push_back(result.entityIndex); }
+	std::sort(foundTargets.begin(), foundTargets.end());
+	ASSERT_FALSE(expectedTargets.empty());
+	EXPECT_EQ(foundTargets, expectedTargets);
+
+	spatialHash.QueryNearest(origin, 5, maxDistance, results);
+	ASSERT_EQ(results.size(), 5);
+	for (size_t i = 1; i < results.size(); i++) {
+		EXPECT_LE((results[i - 1].position - origin).GetMagnitude(), (results[i].position - origin).GetMagnitude());
+	}
+	for (const poke::math::Vec3& position : positions) {
+		EXPECT_GE((position - origin).GetMagnitude() + 0.001f, (results[0].position - origin).GetMagnitude());
+	}
+
+	spatialHash.Clear();
+	spatialHash.Build();
+	spatialHash.QueryRadius(origin, maxDistance, results);
+	EXPECT_TRUE(results.empty());
+}
+
+//Far cells can share a bucket, each entity must be found once and only in its cell
+TEST(Game, SpatialHashSharedBuckets)
+{
+	poke::game::SpatialHash spatialHash(1.0f);
+	for (int i = 0; i < 200; i++) {
+		spatialHash.Insert(i, poke::math::Vec3(static_cast<float>(i * 1000), 0, 0));
+	}
+	spatialHash.Insert(200, poke::math::Vec3(0.5f, 0.5f, 0.5f));
+	spatialHash.Build();
+
+	std::vector<poke::game::SpatialHash::Entry> results;
+	spatialHash.QueryRadius(poke::math::Vec3(0, 0, 0), 1.0f, results);
+	ASSERT_EQ(results.size(), 2);
+	EXPECT_NE(results[0].entityIndex, results[1].entityIndex);
+
+	for (int i = 1; i < 200; i++) {
+		spatialHash.QueryRadius(poke::math::Vec3(static_cast<float>(i * 1000), 0, 0), 0.5f, results);
+		ASSERT_EQ(results.size(), 1);
+		EXPECT_EQ(results[0].entityIndex, i);
+	}
+}
+
+//The batch of missiles turns, moves and ages them like the previous update of each missile
+TEST(Game, MissileKernelsMatchMissileUpdate)
+{
+	const float maxAngle = 90.0f;
+	const float lerpValue = 0.5f;
+	const float deltaTime = 0.1f;
+
+	//Not a multiple of 4, a part of the missiles goes through the scalar loop
+	const size_t count = 23;
+	poke::game::missile_kernels::MissilesBatch batch;
+	batch.Resize(count);
+	for (size_t i = 0; i < count; i++) {
+		const poke::math::Vec3 direction = poke::math::Vec3(std::sin(i * 0.7f), std::cos(i * 1.3f), std::cos(i * 0.7f)).Normalize();
+		batch.positionsX[i] = i * 2.0f;
+		batch.positionsY[i] = 0.0f;
+		batch.positionsZ[i] = -static_cast<float>(i);
+		batch.targetsX[i] = 10.0f;
+		batch.targetsY[i] = 5.0f;
+		batch.targetsZ[i] = i % 5 == 0 ? -static_cast<float>(i) : 20.0f;
+		batch.directionsX[i] = direction.x;
+		batch.directionsY[i] = direction.y;
+		batch.directionsZ[i] = direction.z;
+		batch.speeds[i] = 10.0f + i;
+		batch.lifeTimes[i] = i * 0.01f;
+	}
+	batch.targetsX[0] = batch.positionsX[0];
+	batch.targetsY[0] = batch.positionsY[0];
+	batch.targetsZ[0] = batch.positionsZ[0];
+	const poke::game::missile_kernels::MissilesBatch initialBatch = batch;
+
+	poke::game::missile_kernels::UpdateMissiles(batch, 0, 9, deltaTime, std::cos(maxAngle * poke::math::kDeg2Rad), lerpValue);
+	poke::game::missile_kernels::UpdateMissiles(batch, 9, count, deltaTime, std::cos(maxAngle * poke::math::kDeg2Rad), lerpValue);
+
+	for (size_t i = 0; i < count; i++) {
+		poke::math::Vec3 direction(initialBatch.directionsX[i], initialBatch.directionsY[i], initialBatch.directionsZ[i]);
+		const poke::math::Vec3 targetDirection = (
+			poke::math::Vec3(initialBatch.targetsX[i], initialBatch.targetsY[i], initialBatch.targetsZ[i]) -
+			poke::math::Vec3(initialBatch.positionsX[i], initialBatch.positionsY[i], initialBatch.positionsZ[i])).Normalize();
+		const float angle = std::atan2(
+			poke::math::Vec3::Cross(direction, targetDirection).GetMagnitude(),
+			direction * targetDirection) * poke::math::kRad2Deg;
+
+		const bool hasTurned = angle < maxAngle;
+		EXPECT_EQ(batch.hasTurned[i] != 0, hasTurned);
+		if (hasTurned) {
+			direction = (direction + (targetDirection - direction) * lerpValue).Normalize();
+			const poke::math::Vec3 rotation = poke::math::Quaternion::FromToRotation(poke::math::Vec3(0, 0, 1), direction).GetEulerAngles();
+			const poke::math::Vec3 batchRotation = batch.rotations[i].GetEulerAngles();
+			EXPECT_NEAR(batchRotation.x, rotation.x, 1e-3f);
+			EXPECT_NEAR(batchRotation.y, rotation.y, 1e-3f);
+			EXPECT_NEAR(batchRotation.z, rotation.z, 1e-3f);
+		}
+		EXPECT_NEAR(batch.directionsX[i], direction.x, 1e-5f);
+		EXPECT_NEAR(batch.directionsY[i], direction.y, 1e-5f);
+		EXPECT_NEAR(batch.directionsZ[i], direction.z, 1e-5f);
+		EXPECT_NEAR(batch.velocitiesX[i], direction.x * initialBatch.speeds[i], 1e-4f);
+		EXPECT_NEAR(batch.velocitiesY[i], direction.y * initialBatch.speeds[i], 1e-4f);
+		EXPECT_NEAR(batch.velocitiesZ[i], direction.z * initialBatch.speeds[i], 1e-4f);
+		EXPECT_FLOAT_EQ(batch.lifeTimes[i], std::max(initialBatch.lifeTimes[i] - deltaTime, 0.0f));
+	}
+}
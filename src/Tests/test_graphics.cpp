@@ -0,0 +1,341 @@
+#include <gtest/gtest.h>
+
+#include <GraphicsEngine/null_graphic_engine.h>
+#include <GraphicsEngine/Particles/particles_storage.h>
+#include <GraphicsEngine/Particles/particle_kernels.h>
+
+namespace {
+template<int Index>
+class TestSubrenderer : public poke::graphics::RenderPipeline {
+public:
+    explicit TestSubrenderer(const poke::graphics::Pipeline::Stage stage)
+        : RenderPipeline(stage) {}
+
+    void OnRender(const poke::graphics::CommandBuffer& commandBuffer) override { }
+
+    constexpr static int GetSubrendererIndex() { return Index; }
+};
+
+class TestRenderer : public poke::graphics::Renderer {
+public:
+    TestRenderer()
+    {
+        using namespace poke::graphics;
+        AddSubrenderer<TestSubrenderer<0>>(Pipeline::Stage(0, 0));
+        AddSubrenderer<TestSubrenderer<1>>(Pipeline::Stage(0, 1));
+        AddSubrenderer<TestSubrenderer<2>>(Pipeline::Stage(0, 1));
+        AddSubrenderer<TestSubrenderer<3>>(Pipeline::Stage(0, 1));
+        AddSubrenderer<TestSubrenderer<4>>(Pipeline::Stage(0, 2));
+        AddSubrenderer<TestSubrenderer<5>>(Pipeline::Stage(1, 0));
+    }
+
+    void OnEngineInit() override { }
+
+    void Start() override { started_ = true; }
+};
+
+//The emission order is kept in position.x to follow the particles when they are moved
+poke::graphics::Particle CreateTestParticle(const float order, const float lifetime = 1.0f)
+{
+    return poke::graphics::Particle(
+        poke::math::Vec3(order, 0, 0),
+        poke::math::Vec3(),
+        lifetime,
+        1.0f,
+        0.0f,
+        poke::Color(),
+        poke::ColorGradient());
+}
+
+//Ring buffer of capacity 4 where the particles 2, 3, 4, 5 are stored at the indexes 2, 3, 0, 1
+poke::graphics::ParticlesStorage CreateWrappedRing()
+{
+    poke::graphics::ParticlesStorage storage;
+    storage.SetRingBuffer(true);
+    for (int i = 0; i < 4; i++) { storage.Emit(CreateTestParticle(i), 4); }
+
+    storage.elapsedTime[0] = 1.0f;
+    storage.elapsedTime[1] = 1.0f;
+    storage.RemoveDeadParticles();
+
+    storage.Emit(CreateTestParticle(4), 4);
+    storage.Emit(CreateTestParticle(5), 4);
+    return storage;
+}
+
+//Walks the ring from the head until the first alive particle
+size_t CountDeadParticlesInRingScalar(
+    const std::vector<float>& elapsedTime,
+    const std::vector<float>& lifetime,
+    const size_t first,
+    const size_t count)
+{
+    size_t deadCount = 0;
+    while (deadCount < count) {
+        const size_t index = (first + deadCount) % elapsedTime.size();
+        if (elapsedTime[index] < lifetime[index]) { break; }
+        deadCount++;
+    }
+    return deadCount;
+}
+} //namespace
+
+TEST(Graphics, RecordJobsOrder)
+{
+    using namespace poke::graphics;
+
+    NullGraphicEngine graphicEngine;
+    graphicEngine.SetRenderer(std::make_unique<TestRenderer>());
+
+    std::vector<RecordJob> jobs;
+    graphicEngine.BuildRecordJobs(Pipeline::Stage(0, 0), jobs);
+    graphicEngine.BuildRecordJobs(Pipeline::Stage(0, 1), jobs);
+    graphicEngine.BuildRecordJobs(Pipeline::Stage(0, 2), jobs);
+
+    ASSERT_EQ(jobs.size(), 5);
+
+    const auto workerCount = ComputeRecordWorkerCount(std::thread::hardware_concurrency());
+    for (uint32_t i = 0; i < jobs.size(); i++) {
+        EXPECT_EQ(jobs[i].subrendererIndex, static_cast<int>(i));
+        EXPECT_EQ(jobs[i].slot, i);
+        EXPECT_EQ(jobs[i].workerIndex, i % workerCount);
+        EXPECT_EQ(jobs[i].inheritanceInfo.subpass, jobs[i].stage.second);
+        EXPECT_EQ(jobs[i].inheritanceInfo.sType, VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO);
+    }
+
+    EXPECT_EQ(jobs[0].stage.second, 0);
+    EXPECT_EQ(jobs[1].stage.second, 1);
+    EXPECT_EQ(jobs[3].stage.second, 1);
+    EXPECT_EQ(jobs[4].stage.second, 2);
+}
+
+TEST(Graphics, RecordJobsSlotsAcrossStages)
+{
+    using namespace poke::graphics;
+
+    NullGraphicEngine graphicEngine;
+    graphicEngine.SetRenderer(std::make_unique<TestRenderer>());
+
+    //The jobs of the whole frame are kept, a later stage doesn't reuse the slots of the previous ones
+    std::vector<RecordJob> jobs;
+    graphicEngine.BuildRecordJobs(Pipeline::Stage(0, 1), jobs);
+    graphicEngine.BuildRecordJobs(Pipeline::Stage(1, 0), jobs);
+
+    ASSERT_EQ(jobs.size(), 4);
+    EXPECT_EQ(jobs[3].subrendererIndex, 5);
+    EXPECT_EQ(jobs[3].slot, 3);
+
+    //Same slot, same worker, every frame
+    std::vector<RecordJob> nextFrameJobs;
+    graphicEngine.BuildRecordJobs(Pipeline::Stage(0, 1), nextFrameJobs);
+    graphicEngine.BuildRecordJobs(Pipeline::Stage(1, 0), nextFrameJobs);
+    ASSERT_EQ(nextFrameJobs.size(), jobs.size());
+    for (size_t i = 0; i < jobs.size(); i++) {
+        EXPECT_EQ(nextFrameJobs[i].slot, jobs[i].slot);
+        EXPECT_EQ(nextFrameJobs[i].workerIndex, jobs[i].workerIndex);
+    }
+}
+
+TEST(Graphics, RecordJobsSkipDisabled)
+{
+    using namespace poke::graphics;
+
+    NullGraphicEngine graphicEngine;
+    graphicEngine.SetRenderer(std::make_unique<TestRenderer>());
+    graphicEngine.GetRenderer().GetRendererContainer().Get<TestSubrenderer<2>>().SetEnabled(false);
+
+    std::vector<RecordJob> jobs;
+    graphicEngine.BuildRecordJobs(Pipeline::Stage(0, 1), jobs);
+
+    ASSERT_EQ(jobs.size(), 2);
+    EXPECT_EQ(jobs[0].subrendererIndex, 1);
+    EXPECT_EQ(jobs[1].subrendererIndex, 3);
+    EXPECT_EQ(jobs[1].slot, 1);
+}
+
+TEST(Graphics, RecordJobParameters)
+{
+    using namespace poke::graphics;
+
+    const RecordJobTarget target{VK_NULL_HANDLE, VK_NULL_HANDLE, {1280, 720}};
+    const auto job = CreateRecordJob(Pipeline::Stage(0, 2), 4, 5, 2, target);
+
+    EXPECT_EQ(job.workerIndex, 1);
+    EXPECT_EQ(job.inheritanceInfo.subpass, 2);
+
+    //Viewport is flipped on the y axis
+    EXPECT_FLOAT_EQ(job.viewport.y, 720.0f);
+    EXPECT_FLOAT_EQ(job.viewport.height, -720.0f);
+    EXPECT_FLOAT_EQ(job.viewport.width, 1280.0f);
+    EXPECT_EQ(job.scissor.extent.width, 1280);
+    EXPECT_EQ(job.scissor.extent.height, 720);
+
+    EXPECT_EQ(ComputeRecordWorkerCount(0), 1);
+    EXPECT_EQ(ComputeRecordWorkerCount(64), kMaxRecordWorkers);
+}
+
+TEST(Graphics, ParticlesRingEmitAcrossWrap)
+{
+    auto storage = CreateWrappedRing();
+
+    EXPECT_EQ(storage.GetCapacity(), 4);
+    EXPECT_EQ(storage.nbParticles, 4);
+    EXPECT_EQ(storage.firstParticle, 2);
+    EXPECT_FLOAT_EQ(storage.position[0].x, 4.0f);
+    EXPECT_FLOAT_EQ(storage.position[1].x, 5.0f);
+    EXPECT_FLOAT_EQ(storage.position[2].x, 2.0f);
+    EXPECT_FLOAT_EQ(storage.position[3].x, 3.0f);
+    EXPECT_FLOAT_EQ(storage.elapsedTime[0], 0.0f);
+
+    //The ring is full
+    EXPECT_FALSE(storage.Emit(CreateTestParticle(6), 4));
+}
+
+TEST(Graphics, ParticlesRingRemoveDeadAtHead)
+{
+    auto storage = CreateWrappedRing();
+
+    //The head wraps around the end of the arrays
+    storage.elapsedTime[2] = 1.0f;
+    storage.elapsedTime[3] = 1.5f;
+    storage.elapsedTime[0] = 1.0f;
+    storage.RemoveDeadParticles();
+    EXPECT_EQ(storage.nbParticles, 1);
+    EXPECT_EQ(storage.firstParticle, 1);
+    EXPECT_FLOAT_EQ(storage.position[storage.firstParticle].x, 5.0f);
+
+    //No particle is removed while the head is alive
+    storage.RemoveDeadParticles();
+    EXPECT_EQ(storage.nbParticles, 1);
+
+    //The head goes back to the start once the ring is empty
+    storage.elapsedTime[1] = 1.0f;
+    storage.RemoveDeadParticles();
+    EXPECT_EQ(storage.nbParticles, 0);
+    EXPECT_EQ(storage.firstParticle, 0);
+}
+
+TEST(Graphics, ParticlesRingLinearizeAfterWrap)
+{
+    auto storage = CreateWrappedRing();
+    storage.elapsedTime[3] = 0.5f;
+
+    storage.Linearize();
+
+    EXPECT_EQ(storage.firstParticle, 0);
+    EXPECT_EQ(storage.nbParticles, 4);
+    for (int i = 0; i < 4; i++) { EXPECT_FLOAT_EQ(storage.position[i].x, i + 2.0f); }
+    //Every array is rotated, not only the positions
+    EXPECT_FLOAT_EQ(storage.elapsedTime[1], 0.5f);
+}
+
+TEST(Graphics, ParticlesRingSetLinearWithLiveParticles)
+{
+    auto storage = CreateWrappedRing();
+
+    storage.SetRingBuffer(false);
+
+    EXPECT_FALSE(storage.isRingBuffer);
+    EXPECT_EQ(storage.firstParticle, 0);
+    EXPECT_EQ(storage.nbParticles, 4);
+    for (int i = 0; i < 4; i++) { EXPECT_FLOAT_EQ(storage.position[i].x, i + 2.0f); }
+
+    //Linear storage grows on emission
+    EXPECT_TRUE(storage.Emit(CreateTestParticle(6), 8));
+    EXPECT_FLOAT_EQ(storage.position[4].x, 6.0f);
+
+    //The ring buffer is only entered once every particle is dead
+    storage.SetRingBuffer(true);
+    EXPECT_FALSE(storage.isRingBuffer);
+}
+
+TEST(Graphics, ParticlesCompactionMoves)
+{
+    using namespace poke::graphics::particle_kernels;
+
+    //Dead particles are 0, 2, 5 and 8, more than 4 particles to go through the vectorized count
+    const std::vector<float> lifetime(10, 1.0f);
+    const std::vector<float> elapsedTime{1.0f, 0.0f, 2.0f, 0.5f, 0.9f, 1.0f, 0.1f, 0.2f, 1.5f, 0.3f};
+
+    std::vector<ParticleMove> moves(elapsedTime.size() / 2 + 1);
+    size_t movesCount = 0;
+    const size_t aliveCount = ComputeDeadParticlesMoves(
+        elapsedTime.data(),
+        lifetime.data(),
+        elapsedTime.size(),
+        moves.data(),
+        movesCount);
+
+    EXPECT_EQ(aliveCount, 6);
+    ASSERT_EQ(movesCount, 3);
+    EXPECT_EQ(moves[0].destination, 0);
+    EXPECT_EQ(moves[0].source, 6);
+    EXPECT_EQ(moves[1].destination, 2);
+    EXPECT_EQ(moves[1].source, 7);
+    EXPECT_EQ(moves[2].destination, 5);
+    EXPECT_EQ(moves[2].source, 9);
+
+    //The same input through the storage leaves only the alive particles at the front
+    poke::graphics::ParticlesStorage storage;
+    for (size_t i = 0; i < elapsedTime.size(); i++) {
+        storage.Emit(CreateTestParticle(static_cast<float>(i)), elapsedTime.size());
+    }
+    storage.elapsedTime = elapsedTime;
+    storage.RemoveDeadParticles();
+
+    ASSERT_EQ(storage.nbParticles, 6);
+    const float expectedOrder[] = {6.0f, 1.0f, 7.0f, 3.0f, 4.0f, 9.0f};
+    for (int i = 0; i < 6; i++) {
+        EXPECT_FLOAT_EQ(storage.position[i].x, expectedOrder[i]);
+        EXPECT_LT(storage.elapsedTime[i], storage.lifetime[i]);
+    }
+}
+
+TEST(Graphics, ParticlesCountDeadInRing)
+{
+    using namespace poke::graphics::particle_kernels;
+
+    const size_t capacity = 16;
+    const std::vector<float> lifetime(capacity, 1.0f);
+
+    //Particles are emitted one after the other so the elapsed times decrease from the head
+    const auto createRing = [&](const size_t first, const size_t count, const float headElapsedTime) {
+        std::vector<float> elapsedTime(capacity, 0.0f);
+        for (size_t i = 0; i < count; i++) {
+            elapsedTime[(first + i) % capacity] = headElapsedTime - i * 0.1f;
+        }
+        return elapsedTime;
+    };
+
+    const auto check = [&](const size_t first, const size_t count, const float headElapsedTime) {
+        const auto elapsedTime = createRing(first, count, headElapsedTime);
+        const size_t expected = CountDeadParticlesInRingScalar(elapsedTime, lifetime, first, count);
+        EXPECT_EQ(
+            CountDeadParticlesInRing(elapsedTime.data(), lifetime.data(), first, count, capacity),
+            expected) << "first " << first << " count " << count << " head " << headElapsedTime;
+        return expected;
+    };
+
+    //Wrapped ranges, the dead particles cross the end of the arrays or not
+    EXPECT_EQ(check(12, 10, 1.55f), 6);
+    EXPECT_EQ(check(12, 10, 1.25f), 3);
+    EXPECT_EQ(check(15, 16, 1.05f), 1);
+
+    //All alive
+    EXPECT_EQ(check(12, 10, 0.95f), 0);
+    EXPECT_EQ(check(0, 16, 0.5f), 0);
+
+    //All dead
+    EXPECT_EQ(check(12, 10, 2.5f), 10);
+    EXPECT_EQ(check(3, 16, 3.0f), 16);
+
+    //Empty ring
+    EXPECT_EQ(check(5, 0, 1.0f), 0);
+
+    //Every head, length and age against the reference
+    for (size_t first = 0; first < capacity; first++) {
+        for (size_t count = 0; count <= capacity; count++) {
+            for (int age = 0; age <= 20; age++) { check(first, count, 0.95f + age * 0.1f); }
+        }
+    }
+}
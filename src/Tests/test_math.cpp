@@ -0,0 +1,213 @@
+#include <gtest/gtest.h>
+
+#include <Math/cubic_hermite_spline.h>
+#include <Math/math.h>
+#include <Math/spline_path.h>
+#include <Math/tranform.h>
+#include <Utility/json_utility.h>
+
+namespace {
+const std::vector<poke::math::Vec3> kCurvePoints{
+	poke::math::Vec3(0, 0, 0),
+	poke::math::Vec3(0, 0, 10),
+	poke::math::Vec3(10, 0, 20),
+	poke::math::Vec3(30, 5, 20),
+	poke::math::Vec3(30, 0, 0),
+	poke::math::Vec3(50, 0, -10),
+	poke::math::Vec3(60, 0, -10),
+};
+
+//Euler angles inside the range given back by the transforms
+const std::vector<poke::math::Vec3> kEulerAngles{
+	poke::math::Vec3(0, 0, 0),
+	poke::math::Vec3(0.5f, 0, 0),
+	poke::math::Vec3(0, -1.2f, 0),
+	poke::math::Vec3(0, 0, 2.5f),
+	poke::math::Vec3(0.3f, 0.7f, -1.1f),
+	poke::math::Vec3(-2.8f, 1.4f, 3.0f),
+};
+
+void ExpectMatrixNear(const poke::math::Matrix4& matrix, const poke::math::Matrix4& expected)
+{
+	for (int column = 0; column < 4; column++) {
+		for (int row = 0; row < 4; row++) {
+			EXPECT_NEAR(matrix[column][row], expected[column][row], 1e-4f);
+		}
+	}
+}
+} //namespace
+
+TEST(Math, SplineLine)
+{
+	std::vector<poke::math::Vec3> points;
+	for (int i = 0; i < 6; i++) { points.emplace_back(static_cast<float>(i), 0.0f, 0.0f); }
+	const auto splinePath = poke::math::SplineRegistry::Get().Register(points);
+	const poke::math::SplinePath& path = *splinePath;
+
+	//The first and last points are only tangents
+	ASSERT_EQ(path.GetSegmentCount(), 3);
+	EXPECT_NEAR(path.GetLength(), 3.0f, 1e-4f);
+	EXPECT_NEAR(path.GetSegmentLength(1), 1.0f, 1e-4f);
+
+	//The percentage isn't the distance, the knots aren't uniform
+	const poke::math::SplineLocation location = path.Locate(1.5f);
+	EXPECT_EQ(location.segment, 1);
+	EXPECT_NEAR(path.Evaluate(location).x, 2.5f, 1e-3f);
+
+	//Out of the spline, the locations are clamped
+	EXPECT_NEAR(path.Evaluate(path.Locate(-1.0f)).x, 1.0f, 1e-4f);
+	EXPECT_NEAR(path.Evaluate(path.Locate(10.0f)).x, 4.0f, 1e-4f);
+}
+
+TEST(Math, SplineSegmentsEnds)
+{
+	const auto splinePath = poke::math::SplineRegistry::Get().Register(kCurvePoints);
+	const poke::math::SplinePath& path = *splinePath;
+
+	for (int i = 0; i < path.GetSegmentCount(); i++) {
+		const poke::math::Vec3 start = path.Evaluate(i, 0.0f);
+		const poke::math::Vec3 end = path.Evaluate(i, 1.0f);
+		EXPECT_NEAR(poke::math::Vec3::GetDistance(start, kCurvePoints[i + 1]), 0.0f, 1e-3f);
+		EXPECT_NEAR(poke::math::Vec3::GetDistance(end, kCurvePoints[i + 2]), 0.0f, 1e-3f);
+	}
+}
+
+TEST(Math, SplineConstantSpeed)
+{
+	const auto splinePath = poke::math::SplineRegistry::Get().Register(kCurvePoints);
+	const poke::math::SplinePath& path = *splinePath;
+
+	const int stepCount = 500;
+	const float step = path.GetLength() / stepCount;
+	std::vector<float> distances(stepCount + 1);
+	for (int i = 0; i <= stepCount; i++) { distances[i] = step * i; }
+
+	std::vector<poke::math::Vec3> positions(distances.size());
+	path.Evaluate(distances.data(), positions.data(), distances.size());
+
+	//Same distance between every position, even where the segments are curved
+	for (int i = 1; i <= stepCount; i++) {
+		EXPECT_NEAR(poke::math::Vec3::GetDistance(positions[i - 1], positions[i]), step, step * 0.05f);
+	}
+
+	for (const float distance : distances) {
+		EXPECT_NEAR(path.GetDistance(path.Locate(distance)), distance, 1e-2f);
+	}
+}
+
+TEST(Math, SplineRegistry)
+{
+	poke::math::SplineRegistry& splineRegistry = poke::math::SplineRegistry::Get();
+
+	const poke::math::CubicHermiteSpline spline(kCurvePoints);
+	const size_t splineCount = splineRegistry.GetSplineCount();
+
+	//Same points, same spline
+	poke::math::CubicHermiteSpline otherSpline;
+	otherSpline.SetPoints(kCurvePoints);
+	EXPECT_EQ(spline.GetID(), otherSpline.GetID());
+	EXPECT_EQ(spline, otherSpline);
+	EXPECT_EQ(splineRegistry.GetSpline(spline.GetID()).get(), &spline.GetPath());
+	EXPECT_EQ(splineRegistry.GetSplineCount(), splineCount);
+
+	otherSpline.AddPoint(poke::math::Vec3(70, 0, -10));
+	EXPECT_NE(spline, otherSpline);
+	EXPECT_EQ(otherSpline.GetSize(), static_cast<int>(kCurvePoints.size()) + 1);
+	EXPECT_EQ(splineRegistry.GetSplineCount(), splineCount + 1);
+
+	//The empty spline is shared without being registered
+	EXPECT_EQ(poke::math::CubicHermiteSpline().GetID(), splineRegistry.GetEmptySpline()->GetID());
+	EXPECT_EQ(poke::math::CubicHermiteSpline().GetSize(), 0);
+}
+
+TEST(Math, SplineRegistryRelease)
+{
+	poke::math::SplineRegistry& splineRegistry = poke::math::SplineRegistry::Get();
+	const size_t splineCount = splineRegistry.GetSplineCount();
+
+	poke::math::CubicHermiteSpline spline(kCurvePoints);
+	const poke::math::SplineID id = spline.GetID();
+
+	//Every edit registers a new spline, the previous one isn't used anymore
+	for (int i = 0; i < 100; i++) {
+		spline.SetPoint(poke::math::Vec3(static_cast<float>(i), 0, 0), 0);
+	}
+	EXPECT_EQ(splineRegistry.GetSplineCount(), splineCount + 1);
+	EXPECT_EQ(splineRegistry.GetSpline(id), nullptr);
+
+	{
+		const poke::math::CubicHermiteSpline copiedSpline = spline;
+		spline.SetPoints({});
+		EXPECT_EQ(splineRegistry.GetSplineCount(), splineCount + 1);
+		EXPECT_EQ(copiedSpline.GetPoints()[0].x, 99.0f);
+	}
+	EXPECT_EQ(splineRegistry.GetSplineCount(), splineCount);
+}
+
+TEST(Math, TransformEulerView)
+{
+	const poke::math::Vec3 position(1, -2, 3);
+	const poke::math::Vec3 scale(2, 1, 0.5f);
+	for (const poke::math::Vec3 eulerAngles : kEulerAngles) {
+		const poke::math::Transform transform(position, eulerAngles, scale);
+
+		const poke::math::Vec3 rotation = transform.GetLocalRotation();
+		EXPECT_NEAR(rotation.x, eulerAngles.x, 1e-4f);
+		EXPECT_NEAR(rotation.y, eulerAngles.y, 1e-4f);
+		EXPECT_NEAR(rotation.z, eulerAngles.z, 1e-4f);
+
+		//Same matrix than the rotations around x, y and z
+		ExpectMatrixNear(transform.GetLocalMatrix(), poke::math::Matrix4::GetWorldMatrix(position, eulerAngles, scale));
+	}
+}
+
+TEST(Math, TransformJsonBackwardCompatibility)
+{
+	//Scenes saved with the euler angles, some of them out of the range given back
+	std::vector<poke::math::Vec3> savedRotations = kEulerAngles;
+	savedRotations.emplace_back(0, 3.0f, 0);
+	savedRotations.emplace_back(7.0f, -4.0f, 2.0f);
+	savedRotations.emplace_back(0.4f, poke::math::kPi * 0.5f, 0.2f);
+
+	for (const poke::math::Vec3 savedRotation : savedRotations) {
+		json transformJson;
+		transformJson["position"] = poke::math::Vec3(4, 5, 6).ToJson();
+		transformJson["rotation"] = savedRotation.ToJson();
+		transformJson["scale"] = poke::math::Vec3(1, 2, 3).ToJson();
+
+		poke::math::Transform transform;
+		transform.SetFromJson(transformJson);
+		const poke::math::Matrix4 savedMatrix = poke::math::Matrix4::GetWorldMatrix(
+			poke::math::Vec3(4, 5, 6),
+			savedRotation,
+			poke::math::Vec3(1, 2, 3));
+		ExpectMatrixNear(transform.GetLocalMatrix(), savedMatrix);
+
+		//Saved again with the same keys, the rotation is unchanged
+		const json savedJson = transform.ToJson();
+		EXPECT_TRUE(poke::CheckJsonExists(savedJson, "position"));
+		EXPECT_TRUE(poke::CheckJsonExists(savedJson, "rotation"));
+		EXPECT_TRUE(poke::CheckJsonExists(savedJson, "scale"));
+
+		poke::math::Transform loadedTransform;
+		loadedTransform.SetFromJson(savedJson);
+		ExpectMatrixNear(loadedTransform.GetLocalMatrix(), savedMatrix);
+	}
+}
+
+TEST(Math, TransformOrientationComposition)
+{
+	const poke::math::Transform parent(poke::math::Vec3(1, 2, 3), kEulerAngles[4], poke::math::Vec3(2));
+	for (const poke::math::Vec3 eulerAngles : kEulerAngles) {
+		const poke::math::Transform child(poke::math::Vec3(-1, 0, 2), eulerAngles, poke::math::Vec3(0.5f));
+
+		//With uniform scales, the world transform is the product of the local ones
+		const poke::math::Matrix4 worldMatrix = parent.GetLocalMatrix() * child.GetLocalMatrix();
+		poke::math::Transform worldTransform(
+			(worldMatrix * poke::math::Vec4(0, 0, 0, 1)).To3(),
+			poke::math::Vec3(0, 0, 0),
+			poke::math::Vec3(1));
+		worldTransform.SetLocalOrientation(parent.GetLocalOrientation() * child.GetLocalOrientation());
+		ExpectMatrixNear(worldTransform.GetLocalMatrix(), worldMatrix);
+	}
+}
@@ -0,0 +1,282 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <thread>
+#include <vector>
+
+#include <Ecs/Components/trail_renderer.h>
+#include <Memory/frame_arena.h>
+#include <Memory/triple_buffer.h>
+#include <PhysicsEngine/physics_engine.h>
+#include <Utility/worker_thread.h>
+
+namespace {
+//Only allocations made by the thread while counting are recorded
+thread_local bool isCountingAllocations = false;
+thread_local size_t allocationsCount = 0;
+
+void* CountedAllocation(const size_t size)
+{
+    if (isCountingAllocations) { allocationsCount++; }
+
+    void* ptr = std::malloc(size == 0 ? 1 : size);
+    if (!ptr) { throw std::bad_alloc(); }
+    return ptr;
+}
+
+void StartCountingAllocations()
+{
+    allocationsCount = 0;
+    isCountingAllocations = true;
+}
+
+size_t StopCountingAllocations()
+{
+    isCountingAllocations = false;
+    return allocationsCount;
+}
+} //namespace
+
+void* operator new(const size_t size) { return CountedAllocation(size); }
+void* operator new[](const size_t size) { return CountedAllocation(size); }
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { std::free(ptr); }
+
+TEST(Memory, FrameArenaAlignment)
+{
+    poke::memory::FrameArena arena(256);
+
+    arena.Allocate(1, 1);
+    void* ptr = arena.Allocate(16, 16);
+
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % 16, 0);
+    EXPECT_EQ(arena.GetStats().overflowCount, 0);
+
+    arena.Reset();
+    EXPECT_EQ(arena.GetStats().usedSize, 0);
+    EXPECT_EQ(arena.GetStats().peakSize, 0);
+}
+
+TEST(Memory, FrameArenaGrowAfterOverflow)
+{
+    poke::memory::FrameArena arena(64);
+
+    arena.Allocate(32, 4);
+    arena.Allocate(128, 4);
+    EXPECT_EQ(arena.GetStats().overflowCount, 1);
+    EXPECT_GE(arena.GetStats().peakSize, 160);
+
+    arena.Reset();
+    EXPECT_GE(arena.GetStats().capacity, 160);
+
+    //The same frame now fits in the buffer
+    arena.Allocate(32, 4);
+    arena.Allocate(128, 4);
+    EXPECT_EQ(arena.GetStats().overflowCount, 1);
+    EXPECT_GE(arena.GetStats().highWaterMark, 160);
+}
+
+TEST(Memory, FrameVectorReleaseLastAllocation)
+{
+    poke::memory::FrameArena arena(1024);
+    poke::memory::FrameAllocator<int> allocator(arena);
+
+    {
+        poke::memory::FrameVector<int> values(allocator);
+        values.reserve(64);
+        EXPECT_GE(arena.GetStats().usedSize, 64 * sizeof(int));
+    }
+    EXPECT_EQ(arena.GetStats().usedSize, 0);
+}
+
+TEST(Memory, TripleBufferPublishFetchOrder)
+{
+    poke::memory::TripleBuffer<int> frames(0);
+
+    //Nothing published yet
+    EXPECT_FALSE(frames.Fetch());
+    EXPECT_EQ(frames.GetReadBuffer(), 0);
+
+    frames.GetWriteBuffer() = 1;
+    frames.Publish();
+    EXPECT_NE(&frames.GetWriteBuffer(), &frames.GetReadBuffer());
+
+    //The consumer only sees the frame once it fetched it
+    EXPECT_EQ(frames.GetReadBuffer(), 0);
+    EXPECT_TRUE(frames.Fetch());
+    EXPECT_EQ(frames.GetReadBuffer(), 1);
+
+    //The read buffer stays the same until something new is published
+    EXPECT_FALSE(frames.Fetch());
+    EXPECT_EQ(frames.GetReadBuffer(), 1);
+
+    frames.GetWriteBuffer() = 2;
+    frames.Publish();
+    EXPECT_TRUE(frames.Fetch());
+    EXPECT_EQ(frames.GetReadBuffer(), 2);
+}
+
+TEST(Memory, TripleBufferLatestValueWins)
+{
+    poke::memory::TripleBuffer<int> frames(0);
+
+    for (int frame = 1; frame <= 3; frame++) {
+        frames.GetWriteBuffer() = frame;
+        frames.Publish();
+    }
+
+    //Frames published between two fetches are skipped
+    EXPECT_TRUE(frames.Fetch());
+    EXPECT_EQ(frames.GetReadBuffer(), 3);
+    EXPECT_FALSE(frames.Fetch());
+
+    //The producer never gets the buffer being read
+    frames.GetWriteBuffer() = 4;
+    EXPECT_EQ(frames.GetReadBuffer(), 3);
+}
+
+TEST(Memory, TripleBufferNoTornReads)
+{
+    const int framesCount = 20000;
+    const size_t frameSize = 256;
+    poke::memory::TripleBuffer<std::vector<int>> frames(std::vector<int>(frameSize, 0));
+
+    //Every value of a frame is its number, a torn read mixes two frames
+    std::thread producer([&frames, framesCount] {
+        for (int frame = 1; frame <= framesCount; frame++) {
+            auto& values = frames.GetWriteBuffer();
+            std::fill(values.begin(), values.end(), frame);
+            frames.Publish();
+        }
+    });
+
+    int lastFrame = 0;
+    size_t tornReadsCount = 0;
+    size_t outOfOrderCount = 0;
+    while (lastFrame < framesCount) {
+        if (!frames.Fetch()) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        const auto& values = frames.GetReadBuffer();
+        const int frame = values.front();
+        if (std::any_of(values.begin(), values.end(), [frame](const int value) { return value != frame; })) {
+            tornReadsCount++;
+        }
+        if (frame <= lastFrame) { outOfOrderCount++; }
+        lastFrame = frame;
+    }
+    producer.join();
+
+    EXPECT_EQ(tornReadsCount, 0);
+    EXPECT_EQ(outOfOrderCount, 0);
+    EXPECT_EQ(lastFrame, framesCount);
+}
+
+TEST(Memory, ZeroHeapAllocationSteadyPhysicsAndTrailFrames)
+{
+    using namespace poke;
+
+    const size_t entitiesCount = 512;
+    physics::PhysicsData physicsData;
+    for (size_t i = 0; i < entitiesCount; i++) {
+        math::Transform transform;
+        transform.SetLocalPosition(math::Vec3(static_cast<float>(i) * 10.0f, 0, 0));
+
+        physics::Rigidbody rigidbody;
+        rigidbody.linearVelocity = math::Vec3(0, 1, 0);
+
+        physicsData.worldTransforms.push_back(transform);
+        physicsData.colliders.emplace_back();
+        physicsData.rigidbodies.push_back(rigidbody);
+        physicsData.entities.push_back(static_cast<ecs::EntityIndex>(i));
+    }
+
+    physics::PhysicsEngine physicsEngine;
+    physicsEngine.SetPhysicsEngineData(physicsData);
+
+    //The trail gets a new pair of vertices every frame and retires the oldest once the ring is full
+    ecs::TrailRenderer trailRenderer;
+    trailRenderer.lifetime = 10.0f;
+    trailRenderer.widthEnd = 0.5f;
+    std::vector<graphics::VertexMesh> ringVertices(ecs::TrailRenderer::kMaxVertexPairs * 2);
+
+    size_t frame = 0;
+    const auto simulateFrame = [&]() {
+        physicsEngine.OnPhysicUpdate();
+
+        const math::Vec3 trailPosition(static_cast<float>(frame++), 0, 0);
+        trailRenderer.Update(trailPosition, 1.0f / 60.0f, math::Vec3(0, 0, 1));
+        trailRenderer.WriteMesh(ringVertices.data());
+
+        FrameArena::ResetAll();
+    };
+
+    //First frames create the arena buffer and the ring of the trail
+    simulateFrame();
+    simulateFrame();
+
+    StartCountingAllocations();
+    for (size_t i = 0; i < ecs::TrailRenderer::kMaxVertexPairs * 2; i++) { simulateFrame(); }
+    EXPECT_EQ(StopCountingAllocations(), 0);
+
+    EXPECT_EQ(trailRenderer.GetVertexPairsCount(), ecs::TrailRenderer::kMaxVertexPairs);
+    EXPECT_GT(FrameArena::GetLastFramePeakSize(), 0);
+}
+
+TEST(Memory, ZeroHeapAllocationFrameTasks)
+{
+    using namespace poke;
+
+    WorkerThread mainThread;
+    WorkerThread renderThread;
+    std::atomic<int> mainTasksCount{0};
+    std::atomic<int> renderTasksCount{0};
+    std::vector<int> updateOrder;
+    updateOrder.reserve(64);
+
+    //Same graph as the game loop, registered once
+    mainThread.SetFrameTasks({
+        [&mainTasksCount] { mainTasksCount++; },
+        [&updateOrder] { updateOrder.push_back(0); },
+        [&updateOrder] { updateOrder.push_back(1); },
+        [&mainTasksCount] { mainTasksCount++; }
+    });
+    renderThread.SetFrameTasks({
+        [&renderTasksCount] { renderTasksCount++; },
+        [&renderTasksCount] { renderTasksCount++; }
+    });
+
+    const auto simulateFrame = [&mainThread, &renderThread]() {
+        mainThread.RunFrameTasks();
+        renderThread.RunFrameTasks();
+        mainThread.Wait();
+        renderThread.Wait();
+    };
+
+    simulateFrame();
+
+    StartCountingAllocations();
+    for (int i = 0; i < 10; i++) { simulateFrame(); }
+    EXPECT_EQ(StopCountingAllocations(), 0);
+
+    //Every task ran once a frame, in order
+    EXPECT_EQ(mainTasksCount, 22);
+    EXPECT_EQ(renderTasksCount, 22);
+    ASSERT_EQ(updateOrder.size(), 22);
+    for (size_t i = 0; i < updateOrder.size(); i++) { EXPECT_EQ(updateOrder[i], static_cast<int>(i % 2)); }
+
+    //The tasks added during a frame still run before the end of the frame
+    bool hasRunAsyncTask = false;
+    mainThread.RunFrameTasks();
+    mainThread.DoAsync([&hasRunAsyncTask] { hasRunAsyncTask = true; });
+    mainThread.Wait();
+    EXPECT_TRUE(hasRunAsyncTask);
+    EXPECT_EQ(mainTasksCount, 24);
+}
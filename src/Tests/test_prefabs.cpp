@@ -7,6 +7,7 @@
 #include <Utility/log.h>
 #include <fstream>
 #include <Ecs/Prefabs/engine_prefab.h>
+#include <Ecs/ComponentManagers/transforms_manager.h>
 
 json GetTestEnginePrefabJson()
 {
@@ -299,3 +300,59 @@ TEST(Prefab, PrefabManager_EditorDisplayName)
 	ASSERT_TRUE(editor.GetEditorEcsManager().GetEntityName(entities[0]) == "Player");
 	ASSERT_TRUE(editor.GetEditorEcsManager().GetEntityName(entities[1]) == "weapon_projectile");
 }
+
+TEST(Prefab, PrefabManager_InstantiatePooled)
+{
+	poke::EngineSetting engineSettings{
+		"testPrefabPrefabManager_InstantiatePooled",
+		poke::AppType::EDITOR,
+		std::chrono::duration<double, std::milli>(16.66f),
+		720,
+		640,
+		"[Test] PrefabsManager: Intantiate pooled",
+		{{0, "Default", "Default"}}
+	};
+
+	poke::Engine engine(engineSettings);
+
+	//Load editor application
+	engine.SetApp(std::make_unique<poke::editor::Editor>(engine, ""));
+
+	//Load editor graphics renderer
+	engine.GetModuleManager().graphicsEngine.SetRenderer(
+		std::make_unique<poke::graphics::RendererEditor>(engine));
+
+	engine.Init();
+
+	// TEST
+	json jsonContent = GetTestPrefabsFile();
+	poke::PrefabsManagerLocator::Get().SetFromJson(jsonContent["prefabs"]);
+	poke::PrefabsManagerLocator::Get().AddPrefabPool("test", 1);
+
+	auto& ecsManager = poke::EcsManagerLocator::Get();
+	auto& transformsManager = ecsManager.GetComponentsManager<poke::ecs::TransformsManager>();
+
+	const auto entities = poke::PrefabsManagerLocator::Get().Instantiate("test");
+	ASSERT_EQ(entities.size(), 2u);
+	ASSERT_TRUE(ecsManager.IsEntityActive(entities[0]));
+	ASSERT_TRUE(ecsManager.IsEntityActive(entities[1]));
+	ASSERT_EQ(transformsManager.GetParent(entities[1]), entities[0]);
+
+	//The pool is empty, a new instance is created
+	const auto otherEntities = poke::PrefabsManagerLocator::Get().Instantiate("test");
+	ASSERT_NE(otherEntities[0], entities[0]);
+
+	//The destroyed instance is reused with the components of the prefab
+	transformsManager.SetComponent(entities[0], poke::math::Transform(poke::math::Vec3(0, 0, 0)));
+	ecsManager.RemoveComponent(entities[0], poke::ecs::ComponentType::MODEL);
+	ecsManager.DestroyEntity(entities[0]);
+	ASSERT_FALSE(ecsManager.IsEntityActive(entities[0]));
+	ASSERT_FALSE(ecsManager.IsEntityActive(entities[1]));
+
+	const auto reusedEntities = poke::PrefabsManagerLocator::Get().Instantiate("test");
+	ASSERT_EQ(reusedEntities, entities);
+	ASSERT_TRUE(ecsManager.IsEntityActive(reusedEntities[1]));
+	ASSERT_TRUE(ecsManager.HasComponent(reusedEntities[0], poke::ecs::ComponentType::MODEL));
+	ASSERT_EQ(transformsManager.GetComponent(reusedEntities[0]).GetLocalPosition(), poke::math::Vec3(10, 10, 10));
+	ASSERT_EQ(transformsManager.GetParent(reusedEntities[1]), reusedEntities[0]);
+}
@@ -0,0 +1,536 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <random>
+
+#include <GraphicsEngine/Images/cooked_texture.h>
+#include <GraphicsEngine/Images/texture_compressor.h>
+#include <ResourcesManager/resource_index.h>
+#include <ResourcesManager/MeshManagers/cooked_mesh.h>
+#include <ResourcesManager/MeshManagers/mesh_optimizer.h>
+
+TEST(Resources, ResourceIndexInsertFind)
+{
+	poke::ResourceIndex resourceIndex;
+
+	resourceIndex.Insert(poke::math::HashString("Cube"), 0);
+	resourceIndex.Insert(poke::math::HashString("Ship"), 1);
+	EXPECT_EQ(resourceIndex.Find(poke::math::HashString("Cube")), 0);
+	EXPECT_EQ(resourceIndex.Find(poke::math::HashString("Ship")), 1);
+	EXPECT_EQ(resourceIndex.Find(poke::math::HashString("Missing")), poke::kInvalidResourceHandle);
+
+	//Inserting again replaces the handle
+	resourceIndex.Insert(poke::math::HashString("Cube"), 2);
+	EXPECT_EQ(resourceIndex.Find(poke::math::HashString("Cube")), 2);
+	EXPECT_EQ(resourceIndex.GetSize(), 2);
+}
+
+TEST(Resources, ResourceIndexCollisions)
+{
+	poke::ResourceIndex resourceIndex(16);
+
+	//Same low bits, they all probe the same first slot
+	const poke::ResourceID baseID = 5;
+	for (poke::ResourceHandle i = 0; i < 6; i++) {
+		resourceIndex.Insert(baseID + (static_cast<poke::ResourceID>(i) << 32), i);
+	}
+
+	EXPECT_TRUE(resourceIndex.Erase(baseID + (2ull << 32)));
+	EXPECT_FALSE(resourceIndex.Erase(baseID + (2ull << 32)));
+	for (poke::ResourceHandle i = 0; i < 6; i++) {
+		const poke::ResourceHandle expected = i == 2 ? poke::kInvalidResourceHandle : i;
+		EXPECT_EQ(resourceIndex.Find(baseID + (static_cast<poke::ResourceID>(i) << 32)), expected);
+	}
+}
+
+TEST(Resources, ResourceIndexGrowAndErase)
+{
+	const size_t resourcesCount = 10000;
+
+	std::mt19937_64 generator(42);
+	std::vector<poke::ResourceID> resourceIDs(resourcesCount);
+	poke::ResourceIndex resourceIndex;
+	for (size_t i = 0; i < resourcesCount; i++) {
+		resourceIDs[i] = generator() | 1;
+		resourceIndex.Insert(resourceIDs[i], static_cast<poke::ResourceHandle>(i));
+	}
+	EXPECT_EQ(resourceIndex.GetSize(), resourcesCount);
+	EXPECT_GE(resourceIndex.GetCapacity(), resourcesCount * 2);
+
+	for (size_t i = 0; i < resourcesCount; i += 2) {
+		EXPECT_TRUE(resourceIndex.Erase(resourceIDs[i]));
+	}
+	for (size_t i = 0; i < resourcesCount; i++) {
+		const poke::ResourceHandle expected = i % 2 == 0 ?
+			poke::kInvalidResourceHandle : static_cast<poke::ResourceHandle>(i);
+		ASSERT_EQ(resourceIndex.Find(resourceIDs[i]), expected);
+	}
+}
+
+TEST(Resources, ResourceIndexHandles)
+{
+	const poke::ResourceHandle handle = poke::ResourceIndex::MakeHandle(3, 123456);
+
+	EXPECT_EQ(poke::ResourceIndex::GetHandleStorage(handle), 3);
+	EXPECT_EQ(poke::ResourceIndex::GetHandleIndex(handle), 123456);
+}
+
+namespace {
+//Grid of size * size quads in the XZ plane
+void CreateGridMesh(
+	const size_t size,
+	std::vector<poke::graphics::VertexMesh>& vertices,
+	std::vector<uint32_t>& indices)
+{
+	for (size_t z = 0; z <= size; z++) {
+		for (size_t x = 0; x <= size; x++) {
+			vertices.emplace_back(
+				poke::math::Vec3(static_cast<float>(x), 0.0f, -static_cast<float>(z)),
+				poke::math::Vec2(static_cast<float>(x) / size, static_cast<float>(z) / size),
+				poke::math::Vec3(0.0f, 1.0f, 0.0f));
+		}
+	}
+	for (size_t z = 0; z < size; z++) {
+		for (size_t x = 0; x < size; x++) {
+			const uint32_t first = static_cast<uint32_t>(z * (size + 1) + x);
+			const uint32_t next = first + static_cast<uint32_t>(size + 1);
+			indices.insert(indices.end(), { first, next, first + 1, first + 1, next, next + 1 });
+		}
+	}
+}
+
+//Sphere with shared vertices, except on the UV seam
+void CreateSphereMesh(
+	const size_t segments,
+	std::vector<poke::graphics::VertexMesh>& vertices,
+	std::vector<uint32_t>& indices)
+{
+	const float pi = 3.14159265f;
+	for (size_t ring = 0; ring <= segments; ring++) {
+		const float theta = pi * ring / segments;
+		for (size_t segment = 0; segment <= segments; segment++) {
+			const float phi = 2.0f * pi * segment / segments;
+			const poke::math::Vec3 normal(std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi));
+			vertices.emplace_back(
+				normal,
+				poke::math::Vec2(static_cast<float>(segment) / segments, static_cast<float>(ring) / segments),
+				normal);
+		}
+	}
+	for (size_t ring = 0; ring < segments; ring++) {
+		for (size_t segment = 0; segment < segments; segment++) {
+			const uint32_t first = static_cast<uint32_t>(ring * (segments + 1) + segment);
+			const uint32_t next = first + static_cast<uint32_t>(segments + 1);
+			if (ring != 0) { indices.insert(indices.end(), { first, first + 1, next }); }
+			if (ring != segments - 1) { indices.insert(indices.end(), { first + 1, next + 1, next }); }
+		}
+	}
+}
+
+//Triangles as vertices, rotated to start with their smallest position so the winding is compared too
+std::vector<std::array<poke::math::Vec3, 3>> GetSortedTriangles(
+	const std::vector<poke::graphics::VertexMesh>& vertices,
+	const std::vector<uint32_t>& indices)
+{
+	std::vector<std::array<poke::math::Vec3, 3>> triangles;
+	const auto isLess = [](const poke::math::Vec3& a, const poke::math::Vec3& b) {
+		return std::tie(a.x, a.y, a.z) < std::tie(b.x, b.y, b.z);
+	};
+
+	for (size_t i = 0; i < indices.size(); i += 3) {
+		std::array<poke::math::Vec3, 3> triangle{
+			vertices[indices[i]].position,
+			vertices[indices[i + 1]].position,
+			vertices[indices[i + 2]].position };
+		while (isLess(triangle[1], triangle[0]) || isLess(triangle[2], triangle[0])) {
+			std::rotate(triangle.begin(), triangle.begin() + 1, triangle.end());
+		}
+		triangles.push_back(triangle);
+	}
+	std::sort(triangles.begin(), triangles.end(), [&isLess](const auto& a, const auto& b) {
+		return std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end(), isLess);
+	});
+	return triangles;
+}
+} //namespace
+
+TEST(Resources, CookedMeshRoundTrip)
+{
+	std::vector<poke::graphics::VertexMesh> vertices;
+	std::vector<uint32_t> indices;
+	CreateGridMesh(8, vertices, indices);
+
+	const std::vector<uint8_t> bytes = poke::CookMesh(vertices, indices, 1234, 56);
+
+	poke::CookedMeshView cookedMesh;
+	ASSERT_TRUE(cookedMesh.SetData(bytes.data(), bytes.size()));
+	EXPECT_TRUE(cookedMesh.IsUpToDate(1234, 56));
+	EXPECT_FALSE(cookedMesh.IsUpToDate(1235, 56));
+	EXPECT_FALSE(cookedMesh.IsUpToDate(1234, 57));
+
+	ASSERT_EQ(cookedMesh.GetVertexCount(), vertices.size());
+	for (size_t i = 0; i < vertices.size(); i++) {
+		EXPECT_EQ(cookedMesh.GetVertices()[i], vertices[i]);
+	}
+	EXPECT_EQ(cookedMesh.GetIndexSize(), sizeof(uint16_t));
+	EXPECT_EQ(cookedMesh.GetIndicesUint32(), indices);
+
+	EXPECT_EQ(cookedMesh.GetMinExtents(), poke::math::Vec3(0.0f, 0.0f, -8.0f));
+	EXPECT_FLOAT_EQ(cookedMesh.GetMaxExtents().x, 8.0f);
+}
+
+TEST(Resources, CookedMeshNegativeExtents)
+{
+	std::vector<poke::graphics::VertexMesh> vertices;
+	std::vector<uint32_t> indices;
+	CreateGridMesh(8, vertices, indices);
+	for (auto& vertex : vertices) { vertex.position = vertex.position - poke::math::Vec3(20.0f, 20.0f, 20.0f); }
+
+	const std::vector<uint8_t> bytes = poke::CookMesh(vertices, indices, 0, 0);
+
+	//Every position is below 0
+	poke::CookedMeshView cookedMesh;
+	ASSERT_TRUE(cookedMesh.SetData(bytes.data(), bytes.size()));
+	EXPECT_EQ(cookedMesh.GetMinExtents(), poke::math::Vec3(-20.0f, -20.0f, -28.0f));
+	EXPECT_EQ(cookedMesh.GetMaxExtents(), poke::math::Vec3(-12.0f, -20.0f, -20.0f));
+}
+
+TEST(Resources, CookedMeshIndices32)
+{
+	std::vector<poke::graphics::VertexMesh> vertices;
+	std::vector<uint32_t> indices;
+	CreateGridMesh(256, vertices, indices);
+	ASSERT_GT(vertices.size(), std::numeric_limits<uint16_t>::max());
+
+	const std::vector<uint8_t> bytes = poke::CookMesh(vertices, indices, 0, 0);
+
+	poke::CookedMeshView cookedMesh;
+	ASSERT_TRUE(cookedMesh.SetData(bytes.data(), bytes.size()));
+	EXPECT_EQ(cookedMesh.GetIndexSize(), sizeof(uint32_t));
+	EXPECT_EQ(cookedMesh.GetIndicesUint32(), indices);
+}
+
+TEST(Resources, CookedMeshInvalidData)
+{
+	std::vector<poke::graphics::VertexMesh> vertices;
+	std::vector<uint32_t> indices;
+	CreateGridMesh(4, vertices, indices);
+	std::vector<uint8_t> bytes = poke::CookMesh(vertices, indices, 0, 0);
+
+	poke::CookedMeshView cookedMesh;
+	EXPECT_FALSE(cookedMesh.SetData(bytes.data(), sizeof(poke::cooked_mesh::Header) - 1));
+	//Truncated while written
+	EXPECT_FALSE(cookedMesh.SetData(bytes.data(), bytes.size() / 2));
+
+	bytes[0] = 0;
+	EXPECT_FALSE(cookedMesh.SetData(bytes.data(), bytes.size()));
+	EXPECT_FALSE(cookedMesh.IsValid());
+}
+
+TEST(Resources, MeshOptimizerVertexCache)
+{
+	std::vector<poke::graphics::VertexMesh> vertices;
+	std::vector<uint32_t> indices;
+	CreateGridMesh(32, vertices, indices);
+
+	//Random triangle order, like a mesh exported without optimization
+	std::vector<size_t> triangleOrder(indices.size() / 3);
+	for (size_t i = 0; i < triangleOrder.size(); i++) { triangleOrder[i] = i; }
+	std::shuffle(triangleOrder.begin(), triangleOrder.end(), std::mt19937(42));
+
+	std::vector<uint32_t> shuffledIndices;
+	for (const size_t triangle : triangleOrder) {
+		shuffledIndices.insert(shuffledIndices.end(), indices.begin() + triangle * 3, indices.begin() + triangle * 3 + 3);
+	}
+
+	const poke::mesh_optimizer::VertexCacheStats shuffledStats =
+		poke::mesh_optimizer::AnalyzeVertexCache(shuffledIndices, vertices.size());
+
+	std::vector<uint32_t> optimizedIndices = shuffledIndices;
+	poke::mesh_optimizer::OptimizeVertexCache(optimizedIndices, vertices.size());
+	const poke::mesh_optimizer::VertexCacheStats optimizedStats =
+		poke::mesh_optimizer::AnalyzeVertexCache(optimizedIndices, vertices.size());
+
+	EXPECT_GT(shuffledStats.acmr, 2.0f);
+	EXPECT_LT(optimizedStats.acmr, 1.0f);
+	EXPECT_LT(optimizedStats.atvr, shuffledStats.atvr);
+	EXPECT_EQ(GetSortedTriangles(vertices, optimizedIndices), GetSortedTriangles(vertices, shuffledIndices));
+}
+
+TEST(Resources, MeshOptimizerVertexFetch)
+{
+	std::vector<poke::graphics::VertexMesh> vertices;
+	std::vector<uint32_t> indices;
+	CreateGridMesh(8, vertices, indices);
+	const auto triangles = GetSortedTriangles(vertices, indices);
+
+	//Unused vertex, removed by the optimization
+	vertices.emplace_back(poke::math::Vec3(100.0f), poke::math::Vec2(0.0f), poke::math::Vec3(0.0f));
+	std::reverse(indices.begin(), indices.end());
+
+	poke::mesh_optimizer::OptimizeMesh(vertices, indices);
+
+	EXPECT_EQ(vertices.size(), 81);
+	uint32_t nextNewVertex = 0;
+	for (const uint32_t index : indices) {
+		ASSERT_LE(index, nextNewVertex);
+		if (index == nextNewVertex) { nextNewVertex++; }
+	}
+	EXPECT_EQ(GetSortedTriangles(vertices, indices).size(), triangles.size());
+}
+
+TEST(Resources, MeshSimplifyFlatGrid)
+{
+	std::vector<poke::graphics::VertexMesh> vertices;
+	std::vector<uint32_t> indices;
+	CreateGridMesh(32, vertices, indices);
+
+	float error = 1.0f;
+	const std::vector<uint32_t> simplifiedIndices =
+		poke::mesh_optimizer::SimplifyMesh(vertices, indices, indices.size() / 4, 0.01f, &error);
+
+	//A plane is simplified without error, only its border is kept
+	EXPECT_LE(simplifiedIndices.size(), indices.size() / 4);
+	EXPECT_FLOAT_EQ(error, 0.0f);
+
+	std::vector<bool> isUsed(vertices.size(), false);
+	for (const uint32_t index : simplifiedIndices) { isUsed[index] = true; }
+	for (size_t x = 0; x <= 32; x++) {
+		EXPECT_TRUE(isUsed[x]);
+		EXPECT_TRUE(isUsed[32 * 33 + x]);
+	}
+
+	//Every triangle keeps the winding of the grid
+	for (size_t i = 0; i < simplifiedIndices.size(); i += 3) {
+		const poke::math::Vec3 normal = poke::math::Vec3::Cross(
+			vertices[simplifiedIndices[i + 1]].position - vertices[simplifiedIndices[i]].position,
+			vertices[simplifiedIndices[i + 2]].position - vertices[simplifiedIndices[i]].position);
+		EXPECT_LT(normal.y, 0.0f);
+	}
+}
+
+TEST(Resources, MeshSimplifyMaxError)
+{
+	std::vector<poke::graphics::VertexMesh> vertices;
+	std::vector<uint32_t> indices;
+	CreateSphereMesh(32, vertices, indices);
+
+	float error = 0.0f;
+	const std::vector<uint32_t> simplifiedIndices =
+		poke::mesh_optimizer::SimplifyMesh(vertices, indices, 0, 0.05f, &error);
+
+	//A sphere can't be simplified to nothing within the error
+	EXPECT_GT(simplifiedIndices.size(), 0);
+	EXPECT_LT(simplifiedIndices.size(), indices.size());
+	EXPECT_LE(error, 0.05f);
+}
+
+TEST(Resources, MeshGenerateLods)
+{
+	std::vector<poke::graphics::VertexMesh> vertices;
+	std::vector<uint32_t> indices;
+	CreateSphereMesh(48, vertices, indices);
+	poke::mesh_optimizer::OptimizeMesh(vertices, indices);
+
+	const std::vector<poke::MeshLodData> lods = poke::mesh_optimizer::GenerateLods(vertices, indices);
+	ASSERT_GE(lods.size(), 2);
+	ASSERT_LE(lods.size(), poke::mesh_optimizer::kMaxGeneratedLodCount);
+
+	size_t previousIndexCount = indices.size();
+	for (const poke::MeshLodData& lod : lods) {
+		EXPECT_LE(lod.indices.size(), previousIndexCount * 3 / 4);
+		EXPECT_LE(lod.vertices.size(), vertices.size());
+		for (const uint32_t index : lod.indices) { ASSERT_LT(index, lod.vertices.size()); }
+		previousIndexCount = lod.indices.size();
+	}
+
+	//Levels are stored in the cooked mesh
+	const std::vector<uint8_t> bytes = poke::CookMesh(vertices, indices, 0, 0, lods);
+	poke::CookedMeshView cookedMesh;
+	ASSERT_TRUE(cookedMesh.SetData(bytes.data(), bytes.size()));
+	ASSERT_EQ(cookedMesh.GetLodCount(), lods.size() + 1);
+	EXPECT_EQ(cookedMesh.GetIndicesUint32(0), indices);
+	for (size_t i = 0; i < lods.size(); i++) {
+		EXPECT_EQ(cookedMesh.GetVertexCount(i + 1), lods[i].vertices.size());
+		EXPECT_EQ(cookedMesh.GetIndicesUint32(i + 1), lods[i].indices);
+	}
+}
+
+TEST(Resources, MeshLodSelection)
+{
+	const float projectionScale = 1.0f / std::tan(0.5f * 1.0472f);
+
+	EXPECT_EQ(poke::graphics::SelectLod(1.0f, 2.0f, projectionScale, 4), 0);
+	EXPECT_EQ(poke::graphics::SelectLod(1.0f, 10.0f, projectionScale, 4), 1);
+	EXPECT_EQ(poke::graphics::SelectLod(1.0f, 1000.0f, projectionScale, 4), 3);
+	//Never more than the levels of the mesh
+	EXPECT_EQ(poke::graphics::SelectLod(1.0f, 1000.0f, projectionScale, 2), 1);
+	EXPECT_EQ(poke::graphics::SelectLod(1.0f, 1000.0f, projectionScale, 1), 0);
+	//Inside the bounding sphere
+	EXPECT_EQ(poke::graphics::SelectLod(1.0f, 0.5f, projectionScale, 4), 0);
+}
+
+TEST(Resources, MeshLodSwitchDistance)
+{
+	const float projectionScale = 1.0f / std::tan(0.5f * 1.0472f);
+
+	//A box of size 2 is bounded by a sphere of radius sqrt(3)
+	const float radius = poke::graphics::GetLodRadius(poke::math::Vec3(2, 2, 2));
+	EXPECT_NEAR(radius, std::sqrt(3.0f), 1e-5f);
+
+	//The first level switches when the projected radius is a quarter of half the screen, at 12 units
+	const float switchDistance = radius * projectionScale / poke::graphics::kLodScreenSizes[0];
+	EXPECT_NEAR(switchDistance, 12.0f, 1e-2f);
+	EXPECT_EQ(poke::graphics::SelectLod(radius, 11.9f, projectionScale, 4), 0);
+	EXPECT_EQ(poke::graphics::SelectLod(radius, 12.1f, projectionScale, 4), 1);
+}
+
+//Smooth colors, like most of the textures of the game
+std::vector<uint8_t> CreateGradientImage(const uint32_t width, const uint32_t height, const bool hasAlpha)
+{
+	std::vector<uint8_t> pixels(size_t(width) * height * 4);
+	for (uint32_t y = 0; y < height; y++) {
+		for (uint32_t x = 0; x < width; x++) {
+			uint8_t* pixel = pixels.data() + (size_t(y) * width + x) * 4;
+			pixel[0] = static_cast<uint8_t>(x * 255 / std::max(width - 1, 1u));
+			pixel[1] = static_cast<uint8_t>(y * 255 / std::max(height - 1, 1u));
+			pixel[2] = static_cast<uint8_t>(128 + 64 * std::sin(x * 0.1f));
+			pixel[3] = hasAlpha ? static_cast<uint8_t>((x + y) * 255 / (width + height)) : 255;
+		}
+	}
+	return pixels;
+}
+
+TEST(Resources, TextureMipChain)
+{
+	//Checkerboard of black and white pixels
+	std::vector<uint8_t> pixels(8 * 4 * 4);
+	for (size_t i = 0; i < 8 * 4; i++) {
+		const uint8_t value = (i % 8 + i / 8) % 2 == 0 ? 0 : 255;
+		std::fill(pixels.begin() + i * 4, pixels.begin() + i * 4 + 4, value);
+	}
+
+	const std::vector<poke::texture_compressor::MipLevel> levels =
+		poke::texture_compressor::GenerateMipChain(pixels.data(), 8, 4);
+	ASSERT_EQ(levels.size(), 4);
+	EXPECT_EQ(levels[0].pixels, pixels);
+
+	const std::array<std::pair<uint32_t, uint32_t>, 4> extents{ {{8, 4}, {4, 2}, {2, 1}, {1, 1}} };
+	for (size_t i = 0; i < levels.size(); i++) {
+		EXPECT_EQ(levels[i].width, extents[i].first);
+		EXPECT_EQ(levels[i].height, extents[i].second);
+		ASSERT_EQ(levels[i].pixels.size(), levels[i].width * levels[i].height * 4);
+	}
+	for (const uint8_t value : levels[1].pixels) { EXPECT_EQ(value, 128); }
+}
+
+TEST(Resources, TextureCompressBc1)
+{
+	using namespace poke::texture_compressor;
+
+	const std::vector<uint8_t> pixels = CreateGradientImage(64, 64, false);
+	EXPECT_FALSE(HasAlpha(pixels.data(), 64 * 64));
+
+	const std::vector<uint8_t> data = CompressLevel(pixels.data(), 64, 64, TextureFormat::BC1);
+	EXPECT_EQ(data.size(), pixels.size() / 8);
+
+	const std::vector<uint8_t> decompressedPixels = DecompressLevel(data.data(), 64, 64, TextureFormat::BC1);
+	ASSERT_EQ(decompressedPixels.size(), pixels.size());
+	EXPECT_GT(ComputePsnr(pixels.data(), decompressedPixels.data(), pixels.size()), 38.0f);
+
+	//Colors exactly representable in 5:6:5 are kept
+	std::vector<uint8_t> solidPixels(6 * 3 * 4);
+	for (size_t i = 0; i < solidPixels.size(); i += 4) {
+		solidPixels[i] = 255;
+		solidPixels[i + 1] = 0;
+		solidPixels[i + 2] = 255;
+		solidPixels[i + 3] = 255;
+	}
+	const std::vector<uint8_t> solidData = CompressLevel(solidPixels.data(), 6, 3, TextureFormat::BC1);
+	EXPECT_EQ(solidData.size(), 2 * 8);
+	EXPECT_EQ(DecompressLevel(solidData.data(), 6, 3, TextureFormat::BC1), solidPixels);
+}
+
+TEST(Resources, TextureCompressBc3)
+{
+	using namespace poke::texture_compressor;
+
+	const std::vector<uint8_t> pixels = CreateGradientImage(64, 64, true);
+	EXPECT_TRUE(HasAlpha(pixels.data(), 64 * 64));
+
+	const std::vector<uint8_t> data = CompressLevel(pixels.data(), 64, 64, TextureFormat::BC3);
+	EXPECT_EQ(data.size(), pixels.size() / 4);
+
+	const std::vector<uint8_t> decompressedPixels = DecompressLevel(data.data(), 64, 64, TextureFormat::BC3);
+	EXPECT_GT(ComputePsnr(pixels.data(), decompressedPixels.data(), pixels.size()), 38.0f);
+	for (size_t i = 3; i < pixels.size(); i += 4) {
+		EXPECT_NEAR(pixels[i], decompressedPixels[i], 4);
+	}
+}
+
+TEST(Resources, CookedTextureRoundTrip)
+{
+	using namespace poke::texture_compressor;
+
+	const std::vector<uint8_t> pixels = CreateGradientImage(30, 20, false);
+	const std::vector<uint8_t> bytes = poke::CookTexture(pixels.data(), 30, 20, 1234, 56);
+
+	poke::CookedTextureView cookedTexture;
+	ASSERT_TRUE(cookedTexture.SetData(bytes.data(), bytes.size()));
+	EXPECT_TRUE(cookedTexture.IsUpToDate(1234, 56));
+	EXPECT_FALSE(cookedTexture.IsUpToDate(1234, 57));
+	EXPECT_EQ(cookedTexture.GetWidth(), 30);
+	EXPECT_EQ(cookedTexture.GetHeight(), 20);
+	EXPECT_EQ(cookedTexture.GetFormat(), TextureFormat::BC1);
+
+	//Same level count than the mipmaps generated at load time
+	ASSERT_EQ(cookedTexture.GetMipCount(), 5);
+	EXPECT_EQ(cookedTexture.GetMip(4).width, 1);
+	EXPECT_EQ(cookedTexture.GetMip(4).height, 1);
+
+	const std::vector<MipLevel> levels = GenerateMipChain(pixels.data(), 30, 20);
+	for (uint32_t i = 0; i < cookedTexture.GetMipCount(); i++) {
+		const poke::cooked_texture::Mip& mip = cookedTexture.GetMip(i);
+		EXPECT_EQ(mip.offset % poke::cooked_texture::kDataAlignment, 0);
+		EXPECT_EQ(
+			std::vector<uint8_t>(cookedTexture.GetMipData(i), cookedTexture.GetMipData(i) + mip.size),
+			CompressLevel(levels[i].pixels.data(), levels[i].width, levels[i].height, TextureFormat::BC1));
+	}
+	EXPECT_EQ(
+		cookedTexture.GetMipsSize(cookedTexture.GetMipCount()),
+		cookedTexture.GetMip(4).offset + cookedTexture.GetMip(4).size - cookedTexture.GetMip(0).offset);
+}
+
+TEST(Resources, CookedTextureKeepsNoise)
+{
+	//Noise can't be compressed without a visible loss
+	std::vector<uint8_t> pixels(16 * 16 * 4);
+	std::mt19937 generator(42);
+	std::uniform_int_distribution<int> distribution(0, 255);
+	for (size_t i = 0; i < pixels.size(); i++) { pixels[i] = i % 4 == 3 ? 255 : static_cast<uint8_t>(distribution(generator)); }
+
+	const std::vector<uint8_t> bytes = poke::CookTexture(pixels.data(), 16, 16, 0, 0);
+
+	poke::CookedTextureView cookedTexture;
+	ASSERT_TRUE(cookedTexture.SetData(bytes.data(), bytes.size()));
+	EXPECT_EQ(cookedTexture.GetFormat(), poke::texture_compressor::TextureFormat::RGBA8);
+	EXPECT_EQ(std::vector<uint8_t>(cookedTexture.GetMipData(0), cookedTexture.GetMipData(0) + pixels.size()), pixels);
+}
+
+TEST(Resources, CookedTextureInvalidData)
+{
+	const std::vector<uint8_t> pixels = CreateGradientImage(8, 8, true);
+	std::vector<uint8_t> bytes = poke::CookTexture(pixels.data(), 8, 8, 0, 0);
+
+	poke::CookedTextureView cookedTexture;
+	EXPECT_FALSE(cookedTexture.SetData(bytes.data(), sizeof(poke::cooked_texture::Header) - 1));
+	//Truncated while written
+	EXPECT_FALSE(cookedTexture.SetData(bytes.data(), bytes.size() / 2));
+
+	bytes[0] = 0;
+	EXPECT_FALSE(cookedTexture.SetData(bytes.data(), bytes.size()));
+	EXPECT_FALSE(cookedTexture.IsValid());
+}
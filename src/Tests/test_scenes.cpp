@@ -9,6 +9,8 @@
 #include <CoreEngine/ServiceLocator/service_locator_definition.h>
 
 #include <Utility/json_utility.h>
+#include <Scenes/binary_scene.h>
+#include <ResourcesManager/resource_loader.h>
 
 TEST(Scenes, Default)
 {
@@ -69,4 +71,238 @@ TEST(Scenes, CheckSceneSaveLoadSame)
 
     //Since we changed nothing in the scene, we except it to be the exact same !
 	EXPECT_EQ(baseSceneJson, endSceneJson);
-}
\ No newline at end of file
+}
+
+namespace {
+json CreateBinarySceneTestJson()
+{
+	json sceneJson;
+	sceneJson["resources"]["meshNames"] = { "Cube", "Sphere" };
+	sceneJson["chunks"] = json::array();
+
+	for (int i = 0; i < 8; i++) {
+		json entityJson;
+		poke::math::Transform transform(
+			poke::math::Vec3(1.5f * i, 0.25f, -2.0f),
+			poke::math::Vec3(0.0f, 90.0f, 0.0f),
+			poke::math::Vec3(1.0f, 2.0f, 1.0f));
+		entityJson["transform"] = transform.ToJson();
+		entityJson["transform"]["parent"] = i == 0 ? poke::ecs::kNoParent : 0;
+
+		if (i % 2 == 1) {
+			entityJson["model"]["meshID"] = 123456789012u;
+			entityJson["model"]["materialID"] = 42;
+		}
+		if (i == 3) {
+			entityJson["prefabName"] = "LightFighter";
+			entityJson["tag"] = 2;
+			entityJson["isActive"] = false;
+		}
+		if (i == 5) {
+			entityJson["name"] = "NotAComponent";
+		}
+		//Stored as typed records
+		if (i % 2 == 0) {
+			entityJson["model"]["meshHash"] = 123456789012u + i;
+			entityJson["model"]["materialHash"] = 42;
+			entityJson["collider"]["isTrigger"] = i == 2;
+			entityJson["collider"]["shapeType"] = i == 4 ? 1 : 0;
+			entityJson["collider"]["shape"]["positionOffset"] = poke::math::Vec3(0.0f, 0.5f, 0.0f).ToJson();
+			if (i == 4) {
+				entityJson["collider"]["shape"]["radius"] = 2.5f;
+			} else {
+				entityJson["collider"]["shape"]["extent"] = poke::math::Vec3(1.0f, 2.0f, 3.0f).ToJson();
+			}
+		}
+		if (i == 6) {
+			entityJson["rigidbody"]["linearVelocity"] = poke::math::Vec3(0.0f, 0.0f, 10.0f).ToJson();
+			entityJson["rigidbody"]["angularVelocity"] = poke::math::Vec3(0.0f).ToJson();
+			entityJson["rigidbody"]["linearDrag"] = 0.5f;
+			entityJson["rigidbody"]["angularDrag"] = 1.0f;
+			entityJson["rigidbody"]["type"] = 1;
+		}
+		sceneJson["gameObjects"].push_back(entityJson);
+	}
+	return sceneJson;
+}
+} //namespace
+
+TEST(Scenes, BinarySceneRoundTrip)
+{
+	const json sceneJson = CreateBinarySceneTestJson();
+	const std::vector<uint8_t> bytes = poke::scene::CompileBinaryScene(sceneJson);
+
+	poke::scene::BinarySceneView sceneView;
+	ASSERT_TRUE(sceneView.SetData(bytes.data(), bytes.size()));
+	EXPECT_EQ(sceneView.GetEntityCount(), 8);
+	EXPECT_EQ(sceneView.GetPositions()[2].x, 3.0f);
+	EXPECT_EQ(sceneView.GetParents()[0], poke::ecs::kNoParent);
+
+	//Prefab names and component keys are shared in the string table
+	const uint32_t prefabIndex = sceneView.FindString(poke::math::HashString(std::string("LightFighter")));
+	ASSERT_NE(prefabIndex, poke::scene::binary_scene::kNoString);
+	EXPECT_EQ(sceneView.GetPrefabs()[3], prefabIndex);
+
+	EXPECT_EQ(sceneView.ToJson(), sceneJson);
+}
+
+TEST(Scenes, BinarySceneTypedComponents)
+{
+	namespace binary_scene = poke::scene::binary_scene;
+
+	const std::vector<uint8_t> bytes = poke::scene::CompileBinaryScene(CreateBinarySceneTestJson());
+	poke::scene::BinarySceneView sceneView;
+	ASSERT_TRUE(sceneView.SetData(bytes.data(), bytes.size()));
+
+	const poke::scene::BinaryComponentBlock* typedModels = nullptr;
+	const poke::scene::BinaryComponentBlock* jsonModels = nullptr;
+	const poke::scene::BinaryComponentBlock* colliders = nullptr;
+	const poke::scene::BinaryComponentBlock* rigidbodies = nullptr;
+	for (size_t i = 0; i < sceneView.GetComponentBlockCount(); i++) {
+		const poke::scene::BinaryComponentBlock& block = sceneView.GetComponentBlock(i);
+		switch (block.componentType) {
+		case poke::ecs::ComponentType::MODEL:
+			(block.IsTyped() ? typedModels : jsonModels) = &block;
+			break;
+		case poke::ecs::ComponentType::COLLIDER:
+			colliders = &block;
+			break;
+		case poke::ecs::ComponentType::RIGIDBODY:
+			rigidbodies = &block;
+			break;
+		default: ;
+		}
+	}
+
+	//Models with unknown keys can't be read by the models manager as records
+	ASSERT_NE(jsonModels, nullptr);
+	EXPECT_FALSE(jsonModels->IsTyped());
+	EXPECT_EQ(jsonModels->entityCount, 4);
+
+	ASSERT_NE(typedModels, nullptr);
+	ASSERT_EQ(typedModels->entityCount, 4);
+	EXPECT_EQ(typedModels->entities[1], 2);
+	EXPECT_EQ(typedModels->GetRecord<binary_scene::ModelRecord>(1).meshID, 123456789014u);
+	EXPECT_EQ(typedModels->GetRecord<binary_scene::ModelRecord>(1).materialID, 42);
+
+	ASSERT_NE(colliders, nullptr);
+	ASSERT_TRUE(colliders->IsTyped());
+	ASSERT_EQ(colliders->entityCount, 4);
+	EXPECT_EQ(colliders->GetRecord<binary_scene::ColliderRecord>(1).isTrigger, 1);
+	EXPECT_EQ(colliders->GetRecord<binary_scene::ColliderRecord>(1).extent.z, 3.0f);
+	EXPECT_EQ(colliders->GetRecord<binary_scene::ColliderRecord>(2).shapeType, 1);
+	EXPECT_EQ(colliders->GetRecord<binary_scene::ColliderRecord>(2).radius, 2.5f);
+
+	ASSERT_NE(rigidbodies, nullptr);
+	ASSERT_TRUE(rigidbodies->IsTyped());
+	ASSERT_EQ(rigidbodies->entityCount, 1);
+	EXPECT_EQ(rigidbodies->entities[0], 6);
+	EXPECT_EQ(rigidbodies->GetRecord<binary_scene::RigidbodyRecord>(0).linearVelocity.z, 10.0f);
+	EXPECT_EQ(rigidbodies->GetRecord<binary_scene::RigidbodyRecord>(0).type, 1);
+
+	//A record that doesn't match its layout is rejected
+	std::vector<uint8_t> wrongRecordSize = bytes;
+	const auto* header = reinterpret_cast<const binary_scene::Header*>(wrongRecordSize.data());
+	const auto* sections = reinterpret_cast<const binary_scene::Section*>(wrongRecordSize.data() + sizeof(binary_scene::Header));
+	for (uint32_t i = 0; i < header->sectionCount; i++) {
+		if (sections[i].type == binary_scene::SectionType::TYPED_COMPONENT_BLOCK) {
+			reinterpret_cast<binary_scene::TypedComponentBlockHeader*>(wrongRecordSize.data() + sections[i].offset)->recordSize++;
+		}
+	}
+	EXPECT_FALSE(sceneView.SetData(wrongRecordSize.data(), wrongRecordSize.size()));
+}
+
+TEST(Scenes, BinarySceneRejectCorruptedData)
+{
+	const std::vector<uint8_t> bytes = poke::scene::CompileBinaryScene(CreateBinarySceneTestJson());
+
+	poke::scene::BinarySceneView sceneView;
+	for (size_t size = 0; size < bytes.size(); size += 8) {
+		EXPECT_FALSE(sceneView.SetData(bytes.data(), size));
+	}
+
+	std::vector<uint8_t> wrongVersion = bytes;
+	reinterpret_cast<poke::scene::binary_scene::Header*>(wrongVersion.data())->version++;
+	EXPECT_FALSE(sceneView.SetData(wrongVersion.data(), wrongVersion.size()));
+}
+
+TEST(Scenes, BinarySceneSavedSceneRoundTrip)
+{
+	const std::string sceneName = "TestAllElementScene";
+	const json sceneJson = poke::LoadJson(sceneName, poke::FileType::SCENE, poke::FolderType::ROM);
+	ASSERT_FALSE(sceneJson.is_null());
+
+	ASSERT_TRUE(poke::PokFileSystem::WriteFile(sceneName, sceneJson, poke::FileType::SCENE, poke::FolderType::SAVE));
+	ASSERT_TRUE(poke::scene::ExportBinaryScene(sceneJson, sceneName, poke::FolderType::SAVE));
+
+	poke::scene::BinarySceneFile binaryScene;
+	ASSERT_TRUE(binaryScene.Open(sceneName, poke::FolderType::SAVE));
+	EXPECT_EQ(binaryScene.GetView().ToJson(), sceneJson);
+
+	poke::PokFileSystem::DeleteFile(sceneName, poke::FileType::BINARY_SCENE, poke::FolderType::SAVE);
+	poke::PokFileSystem::DeleteFile(sceneName, poke::FileType::SCENE, poke::FolderType::SAVE);
+}
+
+TEST(Scenes, BinarySceneStaleSource)
+{
+	const std::string sceneName = "TestBinarySceneStaleSource";
+	json sceneJson = CreateBinarySceneTestJson();
+
+	//Without its .pokscene the binary scene can't be checked
+	EXPECT_FALSE(poke::scene::ExportBinaryScene(sceneJson, sceneName, poke::FolderType::SAVE));
+
+	ASSERT_TRUE(poke::PokFileSystem::WriteFile(sceneName, sceneJson, poke::FileType::SCENE, poke::FolderType::SAVE));
+	ASSERT_TRUE(poke::scene::ExportBinaryScene(sceneJson, sceneName, poke::FolderType::SAVE));
+
+	const std::string sourceContent = poke::PokFileSystem::ReadFile(sceneName, poke::FileType::SCENE, poke::FolderType::SAVE);
+	const auto* sourceData = reinterpret_cast<const uint8_t*>(sourceContent.data());
+	const uint64_t sourceHash = poke::scene::binary_scene::HashSource(sourceData, sourceContent.size());
+
+	poke::scene::BinarySceneFile binaryScene;
+	ASSERT_TRUE(binaryScene.Open(sceneName, poke::FolderType::SAVE));
+	EXPECT_TRUE(binaryScene.GetView().IsUpToDate(sourceHash, sourceContent.size()));
+
+	//The .pokscene edited after the export
+	sceneJson["gameObjects"][0]["transform"]["position"]["x"] = 42.0f;
+	ASSERT_TRUE(poke::PokFileSystem::WriteFile(sceneName, sceneJson, poke::FileType::SCENE, poke::FolderType::SAVE));
+
+	const std::string editedContent = poke::PokFileSystem::ReadFile(sceneName, poke::FileType::SCENE, poke::FolderType::SAVE);
+	const auto* editedData = reinterpret_cast<const uint8_t*>(editedContent.data());
+	EXPECT_FALSE(binaryScene.GetView().IsUpToDate(
+		poke::scene::binary_scene::HashSource(editedData, editedContent.size()),
+		editedContent.size()));
+
+	poke::PokFileSystem::DeleteFile(sceneName, poke::FileType::BINARY_SCENE, poke::FolderType::SAVE);
+	poke::PokFileSystem::DeleteFile(sceneName, poke::FileType::SCENE, poke::FolderType::SAVE);
+}
+
+TEST(Scenes, ResourceLoaderWorkerCount)
+{
+	EXPECT_EQ(poke::ResourceLoader::ComputeWorkerCount(0), 1);
+	EXPECT_EQ(poke::ResourceLoader::ComputeWorkerCount(1), 1);
+	EXPECT_EQ(poke::ResourceLoader::ComputeWorkerCount(4), 3);
+	EXPECT_EQ(poke::ResourceLoader::ComputeWorkerCount(64), 8);
+}
+
+TEST(Scenes, ResourceLoaderLoadAsync)
+{
+	const int loadsCount = 64;
+
+	for (const size_t workerCount : { 0, 1, 4 }) {
+		poke::ResourceLoader resourceLoader(workerCount);
+
+		std::vector<poke::Future<std::vector<int>>> loads;
+		for (int i = 0; i < loadsCount; i++) {
+			loads.push_back(resourceLoader.LoadAsync<std::vector<int>>([i]() {
+				return std::vector<int>(static_cast<size_t>(i), i);
+			}));
+		}
+
+		//Registration order doesn't depend on which worker finished first
+		for (int i = 0; i < loadsCount; i++) {
+			ASSERT_TRUE(loads[i].HasValue());
+			EXPECT_EQ(loads[i].Get().size(), static_cast<size_t>(i));
+		}
+		resourceLoader.Wait();
+	}
+}
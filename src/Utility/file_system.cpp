@@ -1,6 +1,9 @@
 #include <Utility/file_system.h>
 
+#include <atomic>
+#include <cstdio>
 #include <fstream>
+#include <system_error>
 #include <vector>
 
 #include <experimental/filesystem>
@@ -154,6 +157,31 @@ bool PokFileSystem::WriteFile(
 	return true;
 }
 
+bool PokFileSystem::WriteFileAtomically(const std::string& filePath, const void* data, const size_t size)
+{
+	//Two threads writing the same file never share their temporary file
+	static std::atomic<uint32_t> temporaryFilesCount{ 0 };
+	const std::string temporaryPath = filePath + ".tmp" + std::to_string(temporaryFilesCount.fetch_add(1));
+
+	std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+	if (!file.is_open()) { return false; }
+
+	file.write(static_cast<const char*>(data), size);
+	file.close();
+	if (!file.good()) {
+		std::remove(temporaryPath.c_str());
+		return false;
+	}
+
+	std::error_code error;
+	fs::rename(temporaryPath, filePath, error);
+	if (error) {
+		std::remove(temporaryPath.c_str());
+		return false;
+	}
+	return true;
+}
+
 std::string PokFileSystem::ReadFile(
 	const std::string& fileName, 
 	const FileType fileType, 
@@ -244,7 +272,8 @@ std::string PokFileSystem::GetPath(
 	    case FileType::DATA: return path;
 	    case FileType::LOGS: return path + "logs/";
 	    case FileType::JSON: return path;
-	    case FileType::SCENE: return path + "resources/scenes/";
+	    case FileType::SCENE:
+	    case FileType::BINARY_SCENE: return path + "resources/scenes/";
 	    case FileType::PREFAB: return path + "resources/prefabs/";
 	    case FileType::LANG: return path + "translation/";
 		case FileType::LANG_CSV: return path + "translation/";
@@ -253,11 +282,13 @@ std::string PokFileSystem::GetPath(
 	    case FileType::VERT:
 	    case FileType::FRAG:		
 	    case FileType::COMP: return path + "shaders/";
-	    case FileType::TEXTURE: return path + "resources/textures/";
+	    case FileType::TEXTURE:
+	    case FileType::COOKED_TEXTURE: return path + "resources/textures/";
 	    case FileType::IMAGE_CUBE: 
 	    case FileType::SKYBOX: return path + "resources/skybox/";
 		case FileType::COMPILED_SHADER: return path + "shaders/compiled/";
-		case FileType::MESH: return path + "resources/meshes/";
+		case FileType::MESH:
+		case FileType::COOKED_MESH: return path + "resources/meshes/";
 		case FileType::USER_PREFS: return path + "userPrefs/";
 		case FileType::ENGINE_SETTING:
 		case FileType::APP_SETTING: return path + "setting/";
@@ -267,6 +298,7 @@ std::string PokFileSystem::GetPath(
 		case FileType::PARTICLE: return path + "resources/particles/";
 		case FileType::SOUNDS: return path + "resources/sounds/";
 		case FileType::FMOD_BANK: return path + "resources/fmodBanks/";
+		case FileType::EVICTED_CHUNK: return path + "chunks/";
 	    default: return path;
 
 	}
@@ -308,6 +340,7 @@ std::string PokFileSystem::GetExtension(const FileType fileType)
 	    case FileType::LOGS: return std::string(".poklog");
 	    case FileType::JSON: return std::string(".json");
 	    case FileType::SCENE: return std::string(".pokscene");
+	    case FileType::BINARY_SCENE: return std::string(".pokscenebin");
 	    case FileType::LANG: return std::string(".poklang");
 		case FileType::LANG_CSV: return std::string(".csv");
 	    case FileType::FONTS: return std::string(".ttf");
@@ -317,6 +350,8 @@ std::string PokFileSystem::GetExtension(const FileType fileType)
 	    case FileType::FRAG:
 	    case FileType::COMP: return std::string(".spv");
 		case FileType::COMPILED_SHADER: return std::string(".pokpreshader");
+		case FileType::COOKED_MESH: return std::string(".pokmesh");
+		case FileType::COOKED_TEXTURE: return std::string(".poktex");
 		case FileType::USER_PREFS: return std::string(".userprefs");
 		case FileType::ENGINE_SETTING: return std::string(".pokenginesetting");
 		case FileType::APP_SETTING: return std::string(".pokappsetting");
@@ -326,6 +361,7 @@ std::string PokFileSystem::GetExtension(const FileType fileType)
 		case FileType::PARTICLE: return std::string(".pokparticle");
 		case FileType::TAGS: return std::string(".poktag");
 		case FileType::FMOD_BANK: return std::string(".bank");
+		case FileType::EVICTED_CHUNK: return std::string(".pokchunk");
 	    default: return std::string();
 	}
 }
@@ -356,14 +392,17 @@ std::string PokFileSystem::ResourceTypeToString(FileType resourceType) {
 	case FileType::COMP: return "COMP";
 	case FileType::LOGS: return "LOGS";
 	case FileType::MESH: return "MESH";
+	case FileType::COOKED_MESH: return "COOKED_MESH";
 	case FileType::MATERIAL: return "MATERIAL";
 	case FileType::TEXTURE: return "TEXTURE";
+	case FileType::COOKED_TEXTURE: return "COOKED_TEXTURE";
 	case FileType::SKYBOX: return "SKYBOX";
 	case FileType::IMAGE_CUBE: return "IMAGE_CUBE";
 	case FileType::CUSTOM: return "CUSTOM";
 	case FileType::DATA: return "DATA";
 	case FileType::JSON: return "JSON";
 	case FileType::SCENE: return "SCENE";
+	case FileType::BINARY_SCENE: return "BINARY_SCENE";
 	case FileType::PREFAB: return "PREFAB";
 	case FileType::LANG: return "LANG";
 	case FileType::SHADER: return "SHADER";
@@ -376,6 +415,7 @@ std::string PokFileSystem::ResourceTypeToString(FileType resourceType) {
 	case FileType::VERT: return "VERT";
 	case FileType::TAGS: return "TAGS";
 	case FileType::FMOD_BANK: return "FMOD_BANK";
+	case FileType::EVICTED_CHUNK: return "EVICTED_CHUNK";
 	default: return "UNKNOWN";
 	}
 }
@@ -390,6 +430,7 @@ FileType PokFileSystem::GetFileType(std::string& filePath) {
 	if (fileExtention == ".poklog") { return FileType::LOGS; }
 	if (fileExtention == ".json") { return FileType::JSON; }
 	if (fileExtention == ".pokscene") { return FileType::SCENE; }
+	if (fileExtention == ".pokscenebin") { return FileType::BINARY_SCENE; }
 	if (fileExtention == ".poklang") { return FileType::LANG; }
 	if (fileExtention == ".csv") { return FileType::LANG_CSV; }
 	if (fileExtention == ".ttf") { return FileType::FONTS; }
@@ -406,6 +447,8 @@ FileType PokFileSystem::GetFileType(std::string& filePath) {
 	if (fileExtention == ".pokmaterial") { return FileType::MATERIAL; }
 	if (fileExtention == ".pokparticle") { return FileType::PARTICLE; }
 	if (fileExtention == ".obj") { return FileType::MESH; }
+	if (fileExtention == ".pokmesh") { return FileType::COOKED_MESH; }
+	if (fileExtention == ".poktex") { return FileType::COOKED_TEXTURE; }
 	if (fileExtention == ".png" ||
 		fileExtention == ".tga" ||
 		fileExtention == ".jpg") {
@@ -413,6 +456,7 @@ FileType PokFileSystem::GetFileType(std::string& filePath) {
 	}
 	if (fileExtention == ".poktag") { return FileType::TAGS;  }
 	if (fileExtention == ".bank") { return FileType::FMOD_BANK;  }
+	if (fileExtention == ".pokchunk") { return FileType::EVICTED_CHUNK; }
 
 	return FileType::CUSTOM;
 }
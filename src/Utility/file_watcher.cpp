@@ -0,0 +1,297 @@
+#include <Utility/file_watcher.h>
+
+#include <algorithm>
+#include <cstdint>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#elif defined(__linux__)
+#include <dirent.h>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <unordered_map>
+#define POK_INOTIFY_FILE_WATCHER
+#else
+#include <chrono>
+#include <experimental/filesystem>
+#include <unordered_map>
+namespace fs = std::experimental::filesystem;
+#endif
+
+namespace poke {
+
+FileWatcher::~FileWatcher()
+{
+	Stop();
+}
+
+bool FileWatcher::Start(const std::vector<std::string>& folderPaths)
+{
+	Stop();
+
+	folderPaths_ = folderPaths;
+	isRunning_ = true;
+
+	//The folders are watched before returning, no write done after Start can be missed
+	std::promise<bool> isWatching;
+	std::future<bool> isWatchingFuture = isWatching.get_future();
+	thread_ = std::thread([this, &isWatching]() {
+		Run(isWatching);
+	});
+
+	if (!isWatchingFuture.get()) {
+		Stop();
+		return false;
+	}
+	return true;
+}
+
+void FileWatcher::Stop()
+{
+	isRunning_ = false;
+	if (thread_.joinable()) { thread_.join(); }
+
+	std::lock_guard<std::mutex> lock(mutex_);
+	changes_.clear();
+}
+
+std::vector<std::string> FileWatcher::PollChanges()
+{
+	std::vector<std::string> changes;
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		changes.swap(changes_);
+	}
+	return changes;
+}
+
+void FileWatcher::PushChange(const std::string& filePath)
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+
+	//A file is often written several times in a row
+	if (std::find(changes_.begin(), changes_.end(), filePath) == changes_.end()) {
+		changes_.push_back(filePath);
+	}
+}
+
+#if defined(_WIN32)
+namespace {
+struct WatchedFolder {
+	std::string path;
+	HANDLE handle = INVALID_HANDLE_VALUE;
+	OVERLAPPED overlapped{};
+	//FILE_NOTIFY_INFORMATION entries are aligned on 4 bytes
+	std::vector<DWORD> buffer = std::vector<DWORD>(16 * 1024);
+};
+
+bool ReadChanges(WatchedFolder& folder)
+{
+	return ReadDirectoryChangesW(
+		folder.handle,
+		folder.buffer.data(),
+		static_cast<DWORD>(folder.buffer.size() * sizeof(DWORD)),
+		TRUE,
+		FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_FILE_NAME,
+		nullptr,
+		&folder.overlapped,
+		nullptr) != 0;
+}
+
+std::string ToUtf8(const WCHAR* name, const DWORD nameSize)
+{
+	const int length = static_cast<int>(nameSize / sizeof(WCHAR));
+	const int size = WideCharToMultiByte(CP_UTF8, 0, name, length, nullptr, 0, nullptr, nullptr);
+
+	std::string utf8Name(size, '\0');
+	WideCharToMultiByte(CP_UTF8, 0, name, length, &utf8Name[0], size, nullptr, nullptr);
+	std::replace(utf8Name.begin(), utf8Name.end(), '\\', '/');
+	return utf8Name;
+}
+} //namespace
+
+void FileWatcher::Run(std::promise<bool>& isWatching)
+{
+	std::vector<WatchedFolder> folders(folderPaths_.size());
+	std::vector<HANDLE> events;
+	for (size_t i = 0; i < folderPaths_.size(); i++) {
+		WatchedFolder& folder = folders[events.size()];
+		folder.path = folderPaths_[i];
+		folder.handle = CreateFileA(
+			folder.path.c_str(),
+			FILE_LIST_DIRECTORY,
+			FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+			nullptr,
+			OPEN_EXISTING,
+			FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED,
+			nullptr);
+		if (folder.handle == INVALID_HANDLE_VALUE) { continue; }
+
+		folder.overlapped.hEvent = CreateEventA(nullptr, TRUE, FALSE, nullptr);
+		if (!ReadChanges(folder)) {
+			CloseHandle(folder.overlapped.hEvent);
+			CloseHandle(folder.handle);
+			folder = WatchedFolder();
+			continue;
+		}
+		events.push_back(folder.overlapped.hEvent);
+	}
+	folders.resize(events.size());
+	isWatching.set_value(!folders.empty());
+
+	while (isRunning_ && !folders.empty()) {
+		const DWORD result = WaitForMultipleObjects(
+			static_cast<DWORD>(events.size()),
+			events.data(),
+			FALSE,
+			kPollIntervalMs);
+		if (result == WAIT_TIMEOUT || result == WAIT_FAILED) { continue; }
+
+		for (WatchedFolder& folder : folders) {
+			DWORD size = 0;
+			if (!GetOverlappedResult(folder.handle, &folder.overlapped, &size, FALSE)) { continue; }
+
+			const uint8_t* entry = reinterpret_cast<const uint8_t*>(folder.buffer.data());
+			while (size > 0) {
+				const FILE_NOTIFY_INFORMATION* info = reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(entry);
+				if (info->Action == FILE_ACTION_ADDED ||
+					info->Action == FILE_ACTION_MODIFIED ||
+					info->Action == FILE_ACTION_RENAMED_NEW_NAME) {
+					PushChange(folder.path + ToUtf8(info->FileName, info->FileNameLength));
+				}
+				if (info->NextEntryOffset == 0) { break; }
+				entry += info->NextEntryOffset;
+			}
+
+			ResetEvent(folder.overlapped.hEvent);
+			ReadChanges(folder);
+		}
+	}
+
+	for (WatchedFolder& folder : folders) {
+		CancelIo(folder.handle);
+		CloseHandle(folder.overlapped.hEvent);
+		CloseHandle(folder.handle);
+	}
+}
+#elif defined(POK_INOTIFY_FILE_WATCHER)
+namespace {
+const uint32_t kFolderEvents = IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE;
+
+//inotify doesn't watch the subfolders, each of them gets its own watch
+void AddWatches(
+	const int notifyFd,
+	const std::string& folderPath,
+	std::unordered_map<int, std::string>& folders,
+	std::vector<std::string>* existingFiles)
+{
+	const int watch = inotify_add_watch(notifyFd, folderPath.c_str(), kFolderEvents);
+	if (watch < 0) { return; }
+	folders[watch] = folderPath;
+
+	DIR* dir = opendir(folderPath.c_str());
+	if (!dir) { return; }
+
+	while (const dirent* entry = readdir(dir)) {
+		const std::string name = entry->d_name;
+		if (name == "." || name == "..") { continue; }
+
+		if (entry->d_type == DT_DIR) {
+			AddWatches(notifyFd, folderPath + name + "/", folders, existingFiles);
+		} else if (existingFiles) {
+			existingFiles->push_back(folderPath + name);
+		}
+	}
+	closedir(dir);
+}
+} //namespace
+
+void FileWatcher::Run(std::promise<bool>& isWatching)
+{
+	const int notifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	if (notifyFd < 0) {
+		isWatching.set_value(false);
+		return;
+	}
+
+	std::unordered_map<int, std::string> folders;
+	for (const std::string& folderPath : folderPaths_) {
+		AddWatches(notifyFd, folderPath, folders, nullptr);
+	}
+	isWatching.set_value(!folders.empty());
+
+	alignas(inotify_event) char buffer[16 * 1024];
+	while (isRunning_ && !folders.empty()) {
+		pollfd pollFd{ notifyFd, POLLIN, 0 };
+		if (poll(&pollFd, 1, kPollIntervalMs) <= 0) { continue; }
+
+		ssize_t size;
+		while ((size = read(notifyFd, buffer, sizeof(buffer))) > 0) {
+			for (const char* entry = buffer; entry < buffer + size;) {
+				const inotify_event* event = reinterpret_cast<const inotify_event*>(entry);
+				entry += sizeof(inotify_event) + event->len;
+
+				const auto folderIt = folders.find(event->wd);
+				if (event->len == 0 || folderIt == folders.end()) { continue; }
+
+				const std::string path = folderIt->second + event->name;
+				if (event->mask & IN_ISDIR) {
+					//The files written before the new folder is watched are reported now
+					std::vector<std::string> existingFiles;
+					AddWatches(notifyFd, path + "/", folders, &existingFiles);
+					for (const std::string& existingFile : existingFiles) { PushChange(existingFile); }
+				} else if (event->mask & (IN_CLOSE_WRITE | IN_MOVED_TO)) {
+					PushChange(path);
+				}
+			}
+		}
+	}
+	close(notifyFd);
+}
+#else
+namespace {
+using WriteTimes = std::unordered_map<std::string, fs::file_time_type>;
+
+void ListWriteTimes(const std::string& folderPath, WriteTimes& writeTimes)
+{
+	std::error_code error;
+	for (fs::recursive_directory_iterator it(folderPath, error), end; !error && it != end; it.increment(error)) {
+		if (!fs::is_regular_file(it->status())) { continue; }
+
+		std::string path = it->path().generic_string();
+		writeTimes[path] = fs::last_write_time(it->path(), error);
+	}
+}
+} //namespace
+
+void FileWatcher::Run(std::promise<bool>& isWatching)
+{
+	WriteTimes writeTimes;
+	bool hasFolder = false;
+	for (const std::string& folderPath : folderPaths_) {
+		hasFolder |= fs::is_directory(folderPath);
+		ListWriteTimes(folderPath, writeTimes);
+	}
+	isWatching.set_value(hasFolder);
+
+	while (isRunning_ && hasFolder) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(kPollIntervalMs));
+
+		WriteTimes newWriteTimes;
+		for (const std::string& folderPath : folderPaths_) {
+			ListWriteTimes(folderPath, newWriteTimes);
+		}
+		for (const auto& writeTime : newWriteTimes) {
+			const auto it = writeTimes.find(writeTime.first);
+			if (it == writeTimes.end() || it->second != writeTime.second) {
+				PushChange(writeTime.first);
+			}
+		}
+		writeTimes.swap(newWriteTimes);
+	}
+}
+#endif
+} //namespace poke
@@ -0,0 +1,80 @@
+#include <Utility/frame_limiter.h>
+
+#include <algorithm>
+#include <thread>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include <timeapi.h>
+#pragma comment(lib, "winmm.lib")
+#endif
+
+namespace poke {
+namespace {
+const FrameLimiter::Duration kMinSpinTime(0.2);
+const FrameLimiter::Duration kMaxSpinTime(4.0);
+//The spin time goes back slowly toward the min after the sleeps woke up in time
+const double kSpinTimeDecay = 0.95;
+
+//Time slept by a paused application when the frames aren't limited
+const FrameLimiter::Duration kIdleTime(16.0);
+} //namespace
+
+FrameLimiter::FrameLimiter(const Duration targetFrameTime)
+    : targetFrameTime_(targetFrameTime),
+      spinTime_(kMaxSpinTime * 0.5)
+{
+#if defined(_WIN32)
+    //With the default timer resolution, a sleep can last 15.6ms
+    timeBeginPeriod(1);
+#endif
+}
+
+FrameLimiter::~FrameLimiter()
+{
+#if defined(_WIN32)
+    timeEndPeriod(1);
+#endif
+}
+
+void FrameLimiter::SetTargetFrameTime(const Duration targetFrameTime)
+{
+    targetFrameTime_ = targetFrameTime;
+    isStarted_ = false;
+}
+
+void FrameLimiter::WaitEndOfFrame()
+{
+    if (targetFrameTime_.count() <= 0.0) { return; }
+
+    const Clock::duration frameTime = std::chrono::duration_cast<Clock::duration>(targetFrameTime_);
+    const Clock::time_point now = Clock::now();
+    if (!isStarted_ || now >= endOfFrame_) {
+        //The end of the first frame isn't known, a late frame isn't caught up
+        endOfFrame_ = now + frameTime;
+        isStarted_ = true;
+        return;
+    }
+
+    const Duration remainingTime = endOfFrame_ - now;
+    if (remainingTime > spinTime_) {
+        const Duration sleepTime = remainingTime - spinTime_;
+        std::this_thread::sleep_for(sleepTime);
+
+        //The spin has to cover the latest wake up seen
+        const Duration lateness = Duration(Clock::now() - now) - sleepTime;
+        spinTime_ = std::clamp(std::max(lateness * 2.0, spinTime_ * kSpinTimeDecay), kMinSpinTime, kMaxSpinTime);
+    }
+
+    while (Clock::now() < endOfFrame_) { std::this_thread::yield(); }
+    endOfFrame_ += frameTime;
+}
+
+void FrameLimiter::Idle()
+{
+    std::this_thread::sleep_for(targetFrameTime_.count() > 0.0 ? targetFrameTime_ : kIdleTime);
+    isStarted_ = false;
+}
+} //namespace poke
@@ -0,0 +1,18 @@
+#include <Utility/job_pool.h>
+
+#include <algorithm>
+
+namespace poke {
+JobPool::JobPool(const size_t workerCount)
+{
+    workers_.reserve(workerCount);
+    for (size_t i = 0; i < workerCount; i++) {
+        workers_.emplace_back(std::make_unique<WorkerThread>());
+    }
+}
+
+size_t JobPool::ComputeWorkerCount(const unsigned hardwareConcurrency)
+{
+    return std::min(kMaxWorkers, static_cast<size_t>(hardwareConcurrency / 2));
+}
+} //namespace poke
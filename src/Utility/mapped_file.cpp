@@ -0,0 +1,148 @@
+#include <Utility/mapped_file.h>
+
+#include <fstream>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#elif !defined(NN_NINTENDO_SDK)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define POK_POSIX_MAPPED_FILE
+#endif
+
+namespace poke {
+
+MappedFile::~MappedFile()
+{
+	Close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+{
+	MoveFrom(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+	if (this != &other) {
+		Close();
+		MoveFrom(other);
+	}
+	return *this;
+}
+
+void MappedFile::MoveFrom(MappedFile& other)
+{
+	//The heap buffer keeps its address when moved, the data pointer stays valid
+	data_ = other.data_;
+	size_ = other.size_;
+	fileHandle_ = other.fileHandle_;
+	mappingHandle_ = other.mappingHandle_;
+	buffer_ = std::move(other.buffer_);
+
+	other.data_ = nullptr;
+	other.size_ = 0;
+	other.fileHandle_ = nullptr;
+	other.mappingHandle_ = nullptr;
+}
+
+bool MappedFile::Open(const std::string& filePath)
+{
+	Close();
+
+#if defined(_WIN32)
+	HANDLE file = CreateFileA(
+		filePath.c_str(),
+		GENERIC_READ,
+		FILE_SHARE_READ,
+		nullptr,
+		OPEN_EXISTING,
+		FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+		nullptr);
+	if (file == INVALID_HANDLE_VALUE) { return false; }
+
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+		CloseHandle(file);
+		return false;
+	}
+
+	HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (mapping == nullptr) {
+		CloseHandle(file);
+		return false;
+	}
+
+	void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (view == nullptr) {
+		CloseHandle(mapping);
+		CloseHandle(file);
+		return false;
+	}
+
+	fileHandle_ = file;
+	mappingHandle_ = mapping;
+	data_ = static_cast<const uint8_t*>(view);
+	size_ = static_cast<size_t>(fileSize.QuadPart);
+	return true;
+#elif defined(POK_POSIX_MAPPED_FILE)
+	const int file = open(filePath.c_str(), O_RDONLY);
+	if (file < 0) { return false; }
+
+	struct stat fileStat;
+	if (fstat(file, &fileStat) != 0 || fileStat.st_size == 0) {
+		close(file);
+		return false;
+	}
+
+	void* view = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+	//The mapping stays valid once the descriptor is closed
+	close(file);
+	if (view == MAP_FAILED) { return false; }
+
+	mappingHandle_ = view;
+	data_ = static_cast<const uint8_t*>(view);
+	size_ = static_cast<size_t>(fileStat.st_size);
+	return true;
+#else
+	std::ifstream file(filePath, std::ios::ate | std::ios::binary);
+	if (!file.is_open()) { return false; }
+
+	const auto fileSize = static_cast<size_t>(file.tellg());
+	if (fileSize == 0) { return false; }
+
+	buffer_.resize(fileSize);
+	file.seekg(0);
+	file.read(reinterpret_cast<char*>(buffer_.data()), fileSize);
+
+	data_ = buffer_.data();
+	size_ = fileSize;
+	return true;
+#endif
+}
+
+void MappedFile::Close()
+{
+	if (data_ == nullptr) { return; }
+
+#if defined(_WIN32)
+	UnmapViewOfFile(data_);
+	CloseHandle(static_cast<HANDLE>(mappingHandle_));
+	CloseHandle(static_cast<HANDLE>(fileHandle_));
+#elif defined(POK_POSIX_MAPPED_FILE)
+	munmap(mappingHandle_, size_);
+#else
+	buffer_.clear();
+	buffer_.shrink_to_fit();
+#endif
+
+	data_ = nullptr;
+	size_ = 0;
+	fileHandle_ = nullptr;
+	mappingHandle_ = nullptr;
+}
+} //namespace poke
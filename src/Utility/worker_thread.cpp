@@ -7,14 +7,26 @@ namespace poke {
 void WorkerThread::StartWorker() {
     std::unique_lock<std::mutex> lock(mutex_);
     do {
-        while (isRunning_ && tasks_.empty()) { itemInQueue_.wait(lock); }
+        while (isRunning_ && tasks_.empty() && !areFrameTasksPending_) { itemInQueue_.wait(lock); }
 
         while (!tasks_.empty()) {
             const auto task = tasks_.front();
             tasks_.pop();
+            isWorking_ = true;
             lock.unlock();
             task();
             lock.lock();
+            isWorking_ = false;
+        }
+
+        //The tasks added while the frame tasks are executed run after them
+        if (areFrameTasksPending_) {
+            areFrameTasksPending_ = false;
+            isWorking_ = true;
+            lock.unlock();
+            for (const auto& frameTask : frameTasks_) { frameTask(); }
+            lock.lock();
+            isWorking_ = false;
         }
         itemInQueue_.notify_all();
     } while (isRunning_);
@@ -22,9 +34,9 @@ void WorkerThread::StartWorker() {
 }
 
 WorkerThread::WorkerThread()
-    : isRunning_(false) {
+    : isRunning_(true) {
+    //Running before the thread starts, a Stop() called right after the construction must not be missed
     thread_.reset(new std::thread([this] {
-        isRunning_ = true;
         this->StartWorker();
     }));
 }
@@ -57,9 +69,21 @@ void WorkerThread::DoSync(const std::function<void()>& task) {
         event.wait(l);
 }
 
+void WorkerThread::SetFrameTasks(std::vector<std::function<void()>> frameTasks) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    frameTasks_ = std::move(frameTasks);
+}
+
+void WorkerThread::RunFrameTasks() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    areFrameTasksPending_ = true;
+    //The worker and a waiting thread share the condition
+    itemInQueue_.notify_all();
+}
+
 void WorkerThread::Wait() {
     std::unique_lock<std::mutex> l(mutex_);
-    while (!tasks_.empty())
+    while (!tasks_.empty() || isWorking_ || areFrameTasksPending_)
         itemInQueue_.wait(l);
 }
 